@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <chrono>
 #include <limits>
 
@@ -110,27 +111,15 @@ void TrackHolder::SelectGroup (const RecordedAllocationGroup *_group) noexcept
 
 void TrackHolder::MoveBy (int _offset) noexcept
 {
+    const std::size_t applied = track.GetAppliedEventCount ();
     if (_offset < 0)
     {
-        while (_offset)
-        {
-            ++_offset;
-            if (!track.MoveToPreviousEvent ())
-            {
-                return;
-            }
-        }
+        const auto undoCount = static_cast<std::size_t> (-static_cast<std::int64_t> (_offset));
+        track.MoveToAppliedEventCount (applied - std::min (applied, undoCount));
     }
     else
     {
-        while (_offset)
-        {
-            --_offset;
-            if (!track.MoveToNextEvent ())
-            {
-                return;
-            }
-        }
+        track.MoveToAppliedEventCount (std::min (applied + static_cast<std::size_t> (_offset), track.GetEventCount ()));
     }
 }
 
@@ -184,45 +173,12 @@ void TrackHolder::UpdateLoading () noexcept
 
 void TrackHolder::UpdateTimeSelection () noexcept
 {
-    using namespace std::chrono_literals;
-    using Clock = std::chrono::high_resolution_clock;
-    static const Clock ::duration timeout = 10ms;
-
     if (timeSelectionRequestS)
     {
-        const Clock::time_point updateStart = Clock::now ();
-        Track::EventIterator currentEvent = track.EventCurrent ();
-        const float currentTimeS = GetEventTime (currentEvent);
-        const bool goingForward = timeSelectionRequestS.value () > currentTimeS;
-
-        while (true)
-        {
-            if (goingForward)
-            {
-                ++currentEvent;
-                if (GetEventTime (currentEvent) > timeSelectionRequestS.value () || !track.MoveToNextEvent ())
-                {
-                    timeSelectionRequestS.reset ();
-                    break;
-                }
-            }
-            else
-            {
-                --currentEvent;
-                const bool lastUndo = GetEventTime (currentEvent) < timeSelectionRequestS.value ();
-
-                if (!track.MoveToPreviousEvent () || lastUndo)
-                {
-                    timeSelectionRequestS.reset ();
-                    break;
-                }
-            }
-
-            if (Clock::now () - updateStart > timeout)
-            {
-                break;
-            }
-        }
+        // Track seeks through keyframes, therefore even huge jumps are fast enough to be done in one update.
+        const double requestS = std::max (0.0, static_cast<double> (timeSelectionRequestS.value ()));
+        track.MoveToTime (static_cast<std::uint64_t> (requestS * 1e9));
+        timeSelectionRequestS.reset ();
     }
 }
 
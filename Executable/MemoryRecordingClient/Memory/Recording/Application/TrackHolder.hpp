@@ -42,7 +42,7 @@ public:
 
     void SelectGroup (const RecordedAllocationGroup *_group) noexcept;
 
-    /// \brief Immediately move by **small** offset.
+    /// \brief Immediately move by given offset in events.
     void MoveBy (int _offset) noexcept;
 
 private:
@@ -21,6 +21,7 @@
 #include <Celerity/Resource/Object/Loading.hpp>
 #include <Celerity/Transform/TransformHierarchyCleanup.hpp>
 #include <Celerity/Transform/TransformVisualSync.hpp>
+#include <Celerity/Transform/TransformWorldPropagation.hpp>
 #include <Celerity/UI/UI.hpp>
 
 #include <Configuration/AssemblyConfiguration.hpp>
@@ -125,12 +126,15 @@ extern "C" Platformer2dDemoLogicApi void __cdecl BuildPipelineMainMenuLoadingNor
     Emergence::Celerity::Rendering2d::AddToNormalUpdate (_builder, WORLD_BOX);
     Emergence::Celerity::TransformHierarchyCleanup::Add2dToNormalUpdate (_builder);
     Emergence::Celerity::TransformVisualSync::Add2dToNormalUpdate (_builder);
+    Emergence::Celerity::TransformWorldPropagation::Add2dToNormalUpdate (_builder);
     LevelLoading::AddToNormalUpdate (_builder);
     LoadingAnimation::AddToNormalUpdate (_builder);
     MainMenuLoadingOrchestration::AddToNormalUpdate (_builder);
 
     _builder.AddCheckpointDependency (Emergence::Celerity::Assembly::Checkpoint::FINISHED,
                                       Emergence::Celerity::RenderPipelineFoundation::Checkpoint::RENDER_STARTED);
+    _builder.AddCheckpointDependency (Emergence::Celerity::TransformWorldPropagation::Checkpoint::FINISHED,
+                                      Emergence::Celerity::RenderPipelineFoundation::Checkpoint::RENDER_STARTED);
 }
 
 extern "C" Platformer2dDemoLogicApi void __cdecl BuildPipelineMainMenuReadyFixed (
@@ -152,11 +156,14 @@ extern "C" Platformer2dDemoLogicApi void __cdecl BuildPipelineMainMenuReadyNorma
     Emergence::Celerity::Rendering2d::AddToNormalUpdate (_builder, WORLD_BOX);
     Emergence::Celerity::TransformHierarchyCleanup::Add2dToNormalUpdate (_builder);
     Emergence::Celerity::TransformVisualSync::Add2dToNormalUpdate (_builder);
+    Emergence::Celerity::TransformWorldPropagation::Add2dToNormalUpdate (_builder);
     Emergence::Celerity::UI::AddToNormalUpdate (_builder, &context->inputAccumulator, GetKeyCodeMapping ());
     MainMenuManagement::AddToNormalUpdate (_builder);
 
     _builder.AddCheckpointDependency (Emergence::Celerity::Assembly::Checkpoint::FINISHED,
                                       Emergence::Celerity::UI::Checkpoint::HIERARCHY_CLEANUP_STARTED);
+    _builder.AddCheckpointDependency (Emergence::Celerity::TransformWorldPropagation::Checkpoint::FINISHED,
+                                      Emergence::Celerity::RenderPipelineFoundation::Checkpoint::RENDER_STARTED);
 }
 
 extern "C" Platformer2dDemoLogicApi void __cdecl BuildPipelinePlatformerLoadingFixed (
@@ -191,10 +198,14 @@ extern "C" Platformer2dDemoLogicApi void __cdecl BuildPipelinePlatformerLoadingN
     Emergence::Celerity::Rendering2d::AddToNormalUpdate (_builder, WORLD_BOX);
     Emergence::Celerity::TransformHierarchyCleanup::Add2dToNormalUpdate (_builder);
     Emergence::Celerity::TransformVisualSync::Add2dToNormalUpdate (_builder);
+    Emergence::Celerity::TransformWorldPropagation::Add2dToNormalUpdate (_builder);
     LayerSetup::AddToNormalUpdate (_builder);
     LevelLoading::AddToNormalUpdate (_builder);
     LoadingAnimation::AddToNormalUpdate (_builder);
     PlatformerLoadingOrchestration::AddToNormalUpdate (_builder);
+
+    _builder.AddCheckpointDependency (Emergence::Celerity::TransformWorldPropagation::Checkpoint::FINISHED,
+                                      Emergence::Celerity::RenderPipelineFoundation::Checkpoint::RENDER_STARTED);
 }
 
 extern "C" Platformer2dDemoLogicApi void __cdecl BuildPipelinePlatformerGameFixed (
@@ -230,6 +241,7 @@ extern "C" Platformer2dDemoLogicApi void __cdecl BuildPipelinePlatformerGameNorm
     Emergence::Celerity::Rendering2d::AddToNormalUpdate (_builder, WORLD_BOX);
     Emergence::Celerity::TransformHierarchyCleanup::Add2dToNormalUpdate (_builder);
     Emergence::Celerity::TransformVisualSync::Add2dToNormalUpdate (_builder);
+    Emergence::Celerity::TransformWorldPropagation::Add2dToNormalUpdate (_builder);
     Emergence::Celerity::UI::AddToNormalUpdate (_builder, &context->inputAccumulator, GetKeyCodeMapping ());
     Camera::AddToNormalUpdate (_builder);
     LayerSetup::AddToNormalUpdate (_builder);
@@ -237,4 +249,10 @@ extern "C" Platformer2dDemoLogicApi void __cdecl BuildPipelinePlatformerGameNorm
 
     _builder.AddCheckpointDependency (Emergence::Celerity::Assembly::Checkpoint::FINISHED,
                                       Emergence::Celerity::UI::Checkpoint::HIERARCHY_CLEANUP_STARTED);
+
+    // Camera follows player by changing visual transform, therefore it must be done before propagation.
+    _builder.AddCheckpointDependency (Camera::Checkpoint::FINISHED,
+                                      Emergence::Celerity::TransformWorldPropagation::Checkpoint::STARTED);
+    _builder.AddCheckpointDependency (Emergence::Celerity::TransformWorldPropagation::Checkpoint::FINISHED,
+                                      Emergence::Celerity::RenderPipelineFoundation::Checkpoint::RENDER_STARTED);
 }
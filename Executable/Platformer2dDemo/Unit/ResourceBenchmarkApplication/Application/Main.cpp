@@ -0,0 +1,240 @@
+#include <istream>
+#include <streambuf>
+
+#include <Configuration/ResourceProviderTypes.hpp>
+
+#include <Container/Vector.hpp>
+
+#include <Log/Log.hpp>
+
+#include <Memory/Heap.hpp>
+
+#include <Resource/Provider/Helpers.hpp>
+
+#include <Serialization/Binary.hpp>
+#include <Serialization/Yaml.hpp>
+
+#include <Testing/BenchmarkMain.hpp>
+
+#include <VirtualFileSystem/Context.hpp>
+#include <VirtualFileSystem/Helpers.hpp>
+#include <VirtualFileSystem/Reader.hpp>
+
+using namespace Emergence::Memory::Literals;
+
+/// \brief Resource object from game resources, which content is loaded into memory before measurements.
+struct ResourceObjectSample final
+{
+    Emergence::StandardLayout::Mapping type;
+    Emergence::Container::Vector<std::uint8_t> yaml {Emergence::Memory::Profiler::AllocationGroup {"Samples"_us}};
+    Emergence::Container::Vector<std::uint8_t> binary {Emergence::Memory::Profiler::AllocationGroup {"Samples"_us}};
+};
+
+struct ResourceObjectSampleSet final
+{
+    Emergence::Container::Vector<ResourceObjectSample> samples {
+        Emergence::Memory::Profiler::AllocationGroup {"Samples"_us}};
+
+    std::size_t maxObjectSize = 0u;
+    std::size_t maxObjectAlignment = 1u;
+};
+
+/// \brief Read-only stream buffer over sample content, so stream creation is not measured as file access.
+class SpanInputBuffer final : public std::streambuf
+{
+public:
+    explicit SpanInputBuffer (const Emergence::Container::Vector<std::uint8_t> &_data) noexcept
+    {
+        // Get area is never written through, therefore it is safe to remove constness here.
+        auto *begin = reinterpret_cast<char *> (const_cast<std::uint8_t *> (_data.data ()));
+        setg (begin, begin, begin + _data.size ());
+    }
+};
+
+static bool ReadContent (const Emergence::VirtualFileSystem::Entry &_entry,
+                         Emergence::Container::Vector<std::uint8_t> &_output) noexcept
+{
+    Emergence::VirtualFileSystem::Reader reader {_entry};
+    if (!reader)
+    {
+        return false;
+    }
+
+    std::istream &input = reader.InputStream ();
+    while (input)
+    {
+        constexpr std::size_t CHUNK_SIZE = 4096u;
+        const std::size_t oldSize = _output.size ();
+        _output.resize (oldSize + CHUNK_SIZE);
+        input.read (reinterpret_cast<char *> (_output.data () + oldSize), static_cast<std::streamsize> (CHUNK_SIZE));
+        _output.resize (oldSize + static_cast<std::size_t> (input.gcount ()));
+    }
+
+    return !input.bad ();
+}
+
+static bool AddSample (const Emergence::Resource::Provider::ResourceProvider &_provider,
+                       const Emergence::StandardLayout::Mapping &_type,
+                       Emergence::Memory::UniqueString _id,
+                       void *_objectBuffer,
+                       ResourceObjectSampleSet &_output) noexcept
+{
+    ResourceObjectSample sample {_type};
+    if (!ReadContent (_provider.GetObjectEntry (_type, _id), sample.yaml))
+    {
+        EMERGENCE_LOG (ERROR, "ResourceBenchmark: Unable to read \"", _id, "\".");
+        return false;
+    }
+
+    // Binary sample is produced from the same object, so both formats contain exactly the same data.
+    _type.Construct (_objectBuffer);
+    SpanInputBuffer buffer {sample.yaml};
+    std::istream input {&buffer};
+    const bool loaded = Emergence::Serialization::Yaml::DeserializeObject (
+        input, _objectBuffer, _type, _provider.GetPatchableTypesRegistry ());
+
+    if (loaded)
+    {
+        Emergence::Serialization::Binary::SerializeTypeName (sample.binary, _type.GetName ());
+        Emergence::Serialization::Binary::SerializeObject (sample.binary, _objectBuffer, _type);
+    }
+    else
+    {
+        EMERGENCE_LOG (ERROR, "ResourceBenchmark: Unable to deserialize \"", _id, "\".");
+    }
+
+    _type.Destruct (_objectBuffer);
+    if (loaded)
+    {
+        _output.samples.emplace_back (std::move (sample));
+    }
+
+    return loaded;
+}
+
+static ResourceObjectSampleSet LoadSamples () noexcept
+{
+    ResourceObjectSampleSet result;
+    Emergence::VirtualFileSystem::Context virtualFileSystem;
+    const Emergence::VirtualFileSystem::Entry resourcesRoot {
+        virtualFileSystem.CreateDirectory (virtualFileSystem.GetRoot (), "Resources")};
+    Emergence::VirtualFileSystem::MountConfigurationList resourcesMount;
+
+    if (!Emergence::VirtualFileSystem::FetchMountConfigurationList (".", "CoreResources", resourcesMount) ||
+        !Emergence::VirtualFileSystem::MountConfigurationListAt (virtualFileSystem, resourcesRoot, resourcesMount))
+    {
+        EMERGENCE_LOG (ERROR, "ResourceBenchmark: Unable to mount \"CoreResources\", benchmark must be executed from "
+                              "game directory.");
+        return result;
+    }
+
+    Emergence::Resource::Provider::ResourceProvider provider {&virtualFileSystem, GetResourceTypesRegistry (),
+                                                              GetPatchableTypesRegistry ()};
+
+    if (Emergence::Resource::Provider::AddMountedDirectoriesAsSources (provider, resourcesRoot, resourcesMount) !=
+        Emergence::Resource::Provider::SourceOperationResponse::SUCCESSFUL)
+    {
+        EMERGENCE_LOG (ERROR, "ResourceBenchmark: Unable to add resource sources.");
+        return result;
+    }
+
+    for (const auto &[typeName, type] : GetResourceTypesRegistry ().GetRegistry ())
+    {
+        result.maxObjectSize = std::max (result.maxObjectSize, type.GetObjectSize ());
+        result.maxObjectAlignment = std::max (result.maxObjectAlignment, type.GetObjectAlignment ());
+    }
+
+    Emergence::Memory::Heap heap {Emergence::Memory::Profiler::AllocationGroup {"Samples"_us}};
+    void *objectBuffer = heap.Acquire (result.maxObjectSize, result.maxObjectAlignment);
+
+    for (const auto &[typeName, type] : GetResourceTypesRegistry ().GetRegistry ())
+    {
+        for (auto cursor = provider.FindObjectsByType (type); **cursor; ++cursor)
+        {
+            const Emergence::Memory::UniqueString id = *cursor;
+
+            // Only uncooked objects are interesting, because they are the ones loaded from yaml during development.
+            if (provider.GetObjectFormat (type, id) == Emergence::Resource::Provider::ObjectFormat::YAML)
+            {
+                AddSample (provider, type, id, objectBuffer, result);
+            }
+        }
+    }
+
+    heap.Release (objectBuffer, result.maxObjectSize);
+    EMERGENCE_LOG (INFO, "ResourceBenchmark: Loaded ", result.samples.size (), " resource object samples.");
+    return result;
+}
+
+static const ResourceObjectSampleSet &GetSamples () noexcept
+{
+    static const ResourceObjectSampleSet samples = LoadSamples ();
+    return samples;
+}
+
+/// \brief Deserializes samples in round-robin order until run record count is reached.
+template <typename Deserializer>
+static void MeasureDeserialization (Emergence::Testing::BenchmarkRun &_run, Deserializer _deserializer) noexcept
+{
+    const ResourceObjectSampleSet &sampleSet = GetSamples ();
+    if (sampleSet.samples.empty ())
+    {
+        return;
+    }
+
+    Emergence::Memory::Heap heap {Emergence::Memory::Profiler::AllocationGroup {"Deserialization"_us}};
+    void *objectBuffer = heap.Acquire (sampleSet.maxObjectSize, sampleSet.maxObjectAlignment);
+
+    _run.Measure (
+        [&sampleSet, &_run, &_deserializer, objectBuffer] ()
+        {
+            std::size_t successful = 0u;
+            for (std::size_t index = 0u; index < _run.GetRecordCount (); ++index)
+            {
+                const ResourceObjectSample &sample = sampleSet.samples[index % sampleSet.samples.size ()];
+                sample.type.Construct (objectBuffer);
+
+                if (_deserializer (sample, objectBuffer))
+                {
+                    ++successful;
+                }
+
+                sample.type.Destruct (objectBuffer);
+            }
+
+            return successful;
+        });
+
+    heap.Release (objectBuffer, sampleSet.maxObjectSize);
+}
+
+static void DeserializeYaml (Emergence::Testing::BenchmarkRun &_run) noexcept
+{
+    MeasureDeserialization (_run,
+                            [] (const ResourceObjectSample &_sample, void *_object)
+                            {
+                                SpanInputBuffer buffer {_sample.yaml};
+                                std::istream input {&buffer};
+
+                                // Type name is just a comment in yaml, therefore we do not skip it.
+                                return Emergence::Serialization::Yaml::DeserializeObject (
+                                    input, _object, _sample.type, GetPatchableTypesRegistry ());
+                            });
+}
+
+static void DeserializeBinary (Emergence::Testing::BenchmarkRun &_run) noexcept
+{
+    MeasureDeserialization (_run,
+                            [] (const ResourceObjectSample &_sample, void *_object)
+                            {
+                                std::span<const std::uint8_t> input {_sample.binary.data (), _sample.binary.size ()};
+                                Emergence::Serialization::Binary::FormatVersion version;
+
+                                return *Emergence::Serialization::Binary::DeserializeTypeName (input, version) &&
+                                       Emergence::Serialization::Binary::DeserializeObject (
+                                           input, _object, _sample.type, GetPatchableTypesRegistry (), version);
+                            });
+}
+
+EMERGENCE_BENCHMARK ("Resource/Deserialize/Yaml", DeserializeYaml);
+EMERGENCE_BENCHMARK ("Resource/Deserialize/Binary", DeserializeBinary);
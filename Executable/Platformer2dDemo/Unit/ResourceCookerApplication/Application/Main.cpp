@@ -117,7 +117,7 @@ int main (int _argumentCount, char **_arguments)
     }
 
     Emergence::VirtualFileSystem::MountConfigurationList resultMountList;
-    resultMountList.items.emplace_back () = {Emergence::VirtualFileSystem::MountSource::PACKAGE, packageName,
+    resultMountList.items.emplace_back () = {Emergence::VirtualFileSystem::MountSource::MAPPED_PACKAGE, packageName,
                                              arguments.groupName};
 
     if (!Emergence::Resource::Cooking::ProduceMountList (context, arguments.groupName, resultMountList))
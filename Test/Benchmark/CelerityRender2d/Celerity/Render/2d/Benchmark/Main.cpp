@@ -0,0 +1 @@
+#include <Testing/BenchmarkMain.hpp>
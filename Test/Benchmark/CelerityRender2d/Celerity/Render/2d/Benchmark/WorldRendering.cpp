@@ -0,0 +1,365 @@
+#include <cmath>
+
+#include <Celerity/Asset/AssetManagement.hpp>
+#include <Celerity/Asset/Events.hpp>
+#include <Celerity/Asset/ManualAssetConstructor.hpp>
+#include <Celerity/Asset/Render/2d/Sprite2dUvAnimation.hpp>
+#include <Celerity/Asset/Render/2d/Sprite2dUvAnimationManagement.hpp>
+#include <Celerity/Asset/Render/Foundation/FrameBufferManagement.hpp>
+#include <Celerity/Asset/Render/Foundation/Material.hpp>
+#include <Celerity/Asset/Render/Foundation/MaterialInstance.hpp>
+#include <Celerity/Asset/Render/Foundation/MaterialInstanceManagement.hpp>
+#include <Celerity/Asset/Render/Foundation/MaterialManagement.hpp>
+#include <Celerity/Asset/Render/Foundation/Texture.hpp>
+#include <Celerity/Asset/Render/Foundation/TextureManagement.hpp>
+#include <Celerity/Event/EventRegistrar.hpp>
+#include <Celerity/PipelineBuilder.hpp>
+#include <Celerity/PipelineBuilderMacros.hpp>
+#include <Celerity/Render/2d/AssetUsage.hpp>
+#include <Celerity/Render/2d/Camera2dComponent.hpp>
+#include <Celerity/Render/2d/Events.hpp>
+#include <Celerity/Render/2d/Render2dSingleton.hpp>
+#include <Celerity/Render/2d/Rendering2d.hpp>
+#include <Celerity/Render/2d/Sprite2dComponent.hpp>
+#include <Celerity/Render/2d/World2dRenderPass.hpp>
+#include <Celerity/Render/Foundation/AssetUsage.hpp>
+#include <Celerity/Render/Foundation/Events.hpp>
+#include <Celerity/Render/Foundation/Material.hpp>
+#include <Celerity/Render/Foundation/MaterialInstance.hpp>
+#include <Celerity/Render/Foundation/PostProcess.hpp>
+#include <Celerity/Render/Foundation/RenderPipelineFoundation.hpp>
+#include <Celerity/Render/Foundation/Viewport.hpp>
+#include <Celerity/Transform/Events.hpp>
+#include <Celerity/Transform/TransformComponent.hpp>
+#include <Celerity/Transform/TransformHierarchyCleanup.hpp>
+#include <Celerity/Transform/TransformVisualSync.hpp>
+#include <Celerity/Transform/TransformWorldPropagation.hpp>
+#include <Celerity/World.hpp>
+
+#include <Container/StringBuilder.hpp>
+
+#include <Log/Log.hpp>
+
+#include <Render/Backend/Configuration.hpp>
+#include <Render/Backend/Null/Statistics.hpp>
+
+#include <Resource/Provider/ResourceProvider.hpp>
+
+#include <Testing/Benchmark.hpp>
+
+#include <VirtualFileSystem/Context.hpp>
+
+namespace Emergence::Celerity::Benchmark
+{
+using namespace Memory::Literals;
+
+/// \brief Sprites are distributed between material instances and layers in round-robin
+///        order, so batching has to sort them instead of just appending to one batch.
+static constexpr std::size_t MATERIAL_INSTANCE_COUNT = 4u;
+
+static constexpr std::uint16_t LAYER_COUNT = 4u;
+
+static constexpr UniqueId CAMERA_OBJECT_ID = 0u;
+
+static constexpr UniqueId FIRST_SPRITE_OBJECT_ID = 1u;
+
+static constexpr std::uint32_t VIEWPORT_WIDTH = 1920u;
+
+static constexpr std::uint32_t VIEWPORT_HEIGHT = 1080u;
+
+/// \brief Null backend never parses shaders, but still requires them to be non-empty.
+static const std::uint8_t DUMMY_SHADER[] = {0u};
+
+static const Memory::UniqueString MATERIAL_ID {"BenchmarkMaterial"};
+
+static const Memory::UniqueString VIEWPORT_NAME {"BenchmarkViewport"};
+
+static Memory::UniqueString GetMaterialInstanceId (std::size_t _index) noexcept
+{
+    return Memory::UniqueString {EMERGENCE_BUILD_STRING ("BenchmarkMaterialInstance", _index)};
+}
+
+/// \brief Creates grid of sprites, that is fully visible through the camera, and moves part of them every frame.
+class SceneExecutor final : public TaskExecutorBase<SceneExecutor>
+{
+public:
+    SceneExecutor (TaskConstructor &_constructor, std::size_t _spriteCount, std::size_t _movingStep) noexcept;
+
+    void Execute () noexcept;
+
+private:
+    void CreateScene () noexcept;
+
+    void MoveSprites () noexcept;
+
+    FetchSingletonQuery fetchRender;
+
+    InsertLongTermQuery insertMaterial;
+    InsertLongTermQuery insertMaterialInstance;
+    InsertLongTermQuery insertViewport;
+    InsertLongTermQuery insertWorldPass;
+    InsertLongTermQuery insertCamera;
+    InsertLongTermQuery insertTransform;
+    InsertLongTermQuery insertSprite;
+    ModifyValueQuery modifyTransformById;
+
+    ManualAssetConstructor manualAssetConstructor;
+
+    std::size_t spriteCount = 0u;
+    std::size_t gridSide = 0u;
+
+    /// \brief Every sprite with index divisible by this step is moved every frame. Zero means that nothing moves.
+    std::size_t movingStep = 0u;
+
+    bool sceneCreated = false;
+    float movementOffset = 0.0f;
+};
+
+SceneExecutor::SceneExecutor (TaskConstructor &_constructor, std::size_t _spriteCount, std::size_t _movingStep) noexcept
+    : TaskExecutorBase (_constructor),
+
+      fetchRender (FETCH_SINGLETON (Render2dSingleton)),
+
+      insertMaterial (INSERT_LONG_TERM (Material)),
+      insertMaterialInstance (INSERT_LONG_TERM (MaterialInstance)),
+      insertViewport (INSERT_LONG_TERM (Viewport)),
+      insertWorldPass (INSERT_LONG_TERM (World2dRenderPass)),
+      insertCamera (INSERT_LONG_TERM (Camera2dComponent)),
+      insertTransform (INSERT_LONG_TERM (Transform2dComponent)),
+      insertSprite (INSERT_LONG_TERM (Sprite2dComponent)),
+      modifyTransformById (MODIFY_VALUE_1F (Transform2dComponent, objectId)),
+
+      manualAssetConstructor (_constructor),
+
+      spriteCount (_spriteCount),
+      gridSide (static_cast<std::size_t> (std::ceil (std::sqrt (static_cast<float> (_spriteCount))))),
+      movingStep (_movingStep)
+{
+    _constructor.DependOn (AssetManagement::Checkpoint::FINISHED);
+    _constructor.DependOn (TransformHierarchyCleanup::Checkpoint::FINISHED);
+    _constructor.MakeDependencyOf (RenderPipelineFoundation::Checkpoint::RENDER_STARTED);
+    _constructor.MakeDependencyOf (TransformVisualSync::Checkpoint::STARTED);
+}
+
+void SceneExecutor::Execute () noexcept
+{
+    if (sceneCreated)
+    {
+        MoveSprites ();
+    }
+    else
+    {
+        CreateScene ();
+        sceneCreated = true;
+    }
+}
+
+void SceneExecutor::CreateScene () noexcept
+{
+    // Materials are constructed manually, so benchmark does not depend on shader compilation and resources.
+    manualAssetConstructor.ConstructManualAsset (MATERIAL_ID, Material::Reflect ().mapping);
+    auto materialCursor = insertMaterial.Execute ();
+    auto *material = static_cast<Material *> (++materialCursor);
+    material->assetId = MATERIAL_ID;
+    material->program = Render::Backend::Program {DUMMY_SHADER, sizeof (DUMMY_SHADER), DUMMY_SHADER,
+                                                  sizeof (DUMMY_SHADER)};
+
+    auto materialInstanceCursor = insertMaterialInstance.Execute ();
+    for (std::size_t index = 0u; index < MATERIAL_INSTANCE_COUNT; ++index)
+    {
+        const Memory::UniqueString materialInstanceId = GetMaterialInstanceId (index);
+        manualAssetConstructor.ConstructManualAsset (materialInstanceId, MaterialInstance::Reflect ().mapping);
+
+        auto *materialInstance = static_cast<MaterialInstance *> (++materialInstanceCursor);
+        materialInstance->assetId = materialInstanceId;
+        materialInstance->materialId = MATERIAL_ID;
+    }
+
+    auto viewportCursor = insertViewport.Execute ();
+    auto *viewport = static_cast<Viewport *> (++viewportCursor);
+    viewport->name = VIEWPORT_NAME;
+    viewport->width = VIEWPORT_WIDTH;
+    viewport->height = VIEWPORT_HEIGHT;
+
+    auto passCursor = insertWorldPass.Execute ();
+    auto *pass = static_cast<World2dRenderPass *> (++passCursor);
+    pass->name = VIEWPORT_NAME;
+    pass->cameraObjectId = CAMERA_OBJECT_ID;
+
+    const float halfGridSize = static_cast<float> (gridSide) * 0.5f;
+    auto transformCursor = insertTransform.Execute ();
+    auto *cameraTransform = static_cast<Transform2dComponent *> (++transformCursor);
+    cameraTransform->SetObjectId (CAMERA_OBJECT_ID);
+    cameraTransform->SetVisualLocalTransform ({{halfGridSize, halfGridSize}, 0.0f, {1.0f, 1.0f}});
+
+    auto cameraCursor = insertCamera.Execute ();
+    auto *camera = static_cast<Camera2dComponent *> (++cameraCursor);
+    camera->objectId = CAMERA_OBJECT_ID;
+    camera->halfOrthographicSize = halfGridSize + 1.0f;
+
+    auto renderCursor = fetchRender.Execute ();
+    const auto *render = static_cast<const Render2dSingleton *> (*renderCursor);
+    auto spriteCursor = insertSprite.Execute ();
+
+    for (std::size_t index = 0u; index < spriteCount; ++index)
+    {
+        const UniqueId objectId = FIRST_SPRITE_OBJECT_ID + index;
+        auto *transform = static_cast<Transform2dComponent *> (++transformCursor);
+        transform->SetObjectId (objectId);
+        transform->SetVisualLocalTransform (
+            {{static_cast<float> (index % gridSide) + 0.5f, static_cast<float> (index / gridSide) + 0.5f},
+             0.0f,
+             {1.0f, 1.0f}});
+
+        auto *sprite = static_cast<Sprite2dComponent *> (++spriteCursor);
+        sprite->objectId = objectId;
+        sprite->spriteId = render->GenerateSprite2dId ();
+        sprite->materialInstanceId = GetMaterialInstanceId (index % MATERIAL_INSTANCE_COUNT);
+        sprite->halfSize = {0.4f, 0.4f};
+        sprite->layer = static_cast<std::uint16_t> ((index / MATERIAL_INSTANCE_COUNT) % LAYER_COUNT);
+    }
+}
+
+void SceneExecutor::MoveSprites () noexcept
+{
+    if (movingStep == 0u)
+    {
+        return;
+    }
+
+    // Sprites oscillate inside their grid cells, therefore they never leave camera view.
+    movementOffset = movementOffset > 0.0f ? -0.05f : 0.05f;
+    for (std::size_t index = 0u; index < spriteCount; index += movingStep)
+    {
+        const UniqueId objectId = FIRST_SPRITE_OBJECT_ID + index;
+        auto cursor = modifyTransformById.Execute (&objectId);
+        auto *transform = static_cast<Transform2dComponent *> (*cursor);
+
+        Math::Transform2d localTransform = transform->GetVisualLocalTransform ();
+        localTransform.translation.x += movementOffset;
+        transform->SetVisualLocalTransform (localTransform);
+    }
+}
+
+static Container::MappingRegistry GetResourceTypes () noexcept
+{
+    Container::MappingRegistry registry;
+    registry.Register (MaterialAsset::Reflect ().mapping);
+    registry.Register (MaterialInstanceAsset::Reflect ().mapping);
+    registry.Register (Sprite2dUvAnimationAsset::Reflect ().mapping);
+    registry.Register (TextureAsset::Reflect ().mapping);
+    return registry;
+}
+
+/// \brief Initializes null render backend once per benchmark execution, because backends do not support reinit.
+static void EnsureRenderBackendInitialized () noexcept
+{
+    static const bool initialized = [] ()
+    {
+        Render::Backend::Config config;
+        config.width = VIEWPORT_WIDTH;
+        config.height = VIEWPORT_HEIGHT;
+        return Render::Backend::Init (config, nullptr, nullptr, false);
+    }();
+
+    if (!initialized)
+    {
+        EMERGENCE_LOG (ERROR, "CelerityRender2dBenchmark: Unable to initialize render backend.");
+    }
+}
+
+/// \brief World with full 2d render pipeline, that renders grid of sprites using null render backend.
+struct Scene final
+{
+    Scene (std::size_t _spriteCount, std::size_t _movingStep) noexcept;
+
+    VirtualFileSystem::Context virtualFileSystem;
+    Resource::Provider::ResourceProvider resourceProvider {&virtualFileSystem, GetResourceTypes (), {}};
+    World world {"BenchmarkWorld"_us, {{1.0f / 60.0f}}};
+};
+
+Scene::Scene (std::size_t _spriteCount, std::size_t _movingStep) noexcept
+{
+    EnsureRenderBackendInitialized ();
+    AssetReferenceBindingList binding {GetAssetBindingAllocationGroup ()};
+    GetRender2dAssetUsage (binding);
+    GetRenderFoundationAssetUsage (binding);
+    AssetReferenceBindingEventMap assetReferenceBindingEventMap;
+
+    {
+        EventRegistrar registrar {&world};
+        assetReferenceBindingEventMap = RegisterAssetEvents (registrar, binding);
+        RegisterTransform2dEvents (registrar);
+        RegisterTransformCommonEvents (registrar);
+        RegisterRender2dEvents (registrar);
+        RegisterRenderFoundationEvents (registrar);
+    }
+
+    static const Math::AxisAlignedBox2d worldBox {{-1000.0f, -1000.0f}, {1000.0f, 1000.0f}};
+    PipelineBuilder pipelineBuilder {world.GetRootView ()};
+
+    pipelineBuilder.Begin ("NormalUpdate"_us, PipelineType::NORMAL);
+    AssetManagement::AddToNormalUpdate (pipelineBuilder, binding, assetReferenceBindingEventMap);
+    FrameBufferManagement::AddToNormalUpdate (pipelineBuilder);
+    TransformHierarchyCleanup::Add2dToNormalUpdate (pipelineBuilder);
+    MaterialInstanceManagement::AddToNormalUpdate (pipelineBuilder, &resourceProvider, assetReferenceBindingEventMap);
+    MaterialManagement::AddToNormalUpdate (pipelineBuilder, &resourceProvider, assetReferenceBindingEventMap);
+    PostProcess::AddToNormalUpdate (pipelineBuilder);
+    RenderPipelineFoundation::AddToNormalUpdate (pipelineBuilder);
+    Rendering2d::AddToNormalUpdate (pipelineBuilder, worldBox);
+    Sprite2dUvAnimationManagement::AddToNormalUpdate (pipelineBuilder, &resourceProvider,
+                                                      assetReferenceBindingEventMap);
+    TextureManagement::AddToNormalUpdate (pipelineBuilder, &resourceProvider, assetReferenceBindingEventMap);
+    TransformVisualSync::Add2dToNormalUpdate (pipelineBuilder);
+    TransformWorldPropagation::Add2dToNormalUpdate (pipelineBuilder);
+    pipelineBuilder.AddCheckpointDependency (TransformWorldPropagation::Checkpoint::FINISHED,
+                                             RenderPipelineFoundation::Checkpoint::RENDER_STARTED);
+    pipelineBuilder.AddTask ("SceneExecutor"_us).SetExecutor<SceneExecutor> (_spriteCount, _movingStep);
+
+    if (!pipelineBuilder.End ())
+    {
+        EMERGENCE_LOG (ERROR, "CelerityRender2dBenchmark: Unable to build pipeline.");
+        return;
+    }
+
+    // First frame creates scene, second one registers asset usages and only third one renders everything.
+    // Then we wait until unchanged sprites are baked into static geometry, so steady state is measured.
+    constexpr std::size_t WARM_UP_FRAMES = 24u;
+    for (std::size_t frame = 0u; frame < WARM_UP_FRAMES; ++frame)
+    {
+        world.Update ();
+    }
+
+    if (Render::Backend::Null::GetLastFrameStatistics ().submittedVertices != _spriteCount * 4u)
+    {
+        EMERGENCE_LOG (ERROR, "CelerityRender2dBenchmark: Expected all ", _spriteCount,
+                       " sprites to be rendered, but only ",
+                       Render::Backend::Null::GetLastFrameStatistics ().submittedVertices / 4u, " were rendered.");
+    }
+}
+
+static void RenderFrame (Testing::BenchmarkRun &_run, std::size_t _movingStep) noexcept
+{
+    Scene scene {_run.GetRecordCount (), _movingStep};
+    _run.Measure (
+        [&scene] ()
+        {
+            scene.world.Update ();
+            return Render::Backend::Null::GetLastFrameStatistics ().submittedVertices;
+        });
+}
+
+static void RenderFrameStatic (Testing::BenchmarkRun &_run) noexcept
+{
+    RenderFrame (_run, 0u);
+}
+
+static void RenderFrameMoving (Testing::BenchmarkRun &_run) noexcept
+{
+    // Every tenth sprite moves, which is close to typical ratio of dynamic objects in our levels.
+    RenderFrame (_run, 10u);
+}
+
+EMERGENCE_BENCHMARK ("World2d/RenderFrame/Static", RenderFrameStatic);
+EMERGENCE_BENCHMARK ("World2d/RenderFrame/Moving", RenderFrameMoving);
+} // namespace Emergence::Celerity::Benchmark
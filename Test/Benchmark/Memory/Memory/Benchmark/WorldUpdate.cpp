@@ -0,0 +1,251 @@
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include <Memory/Heap.hpp>
+
+#include <Testing/Benchmark.hpp>
+#include <Testing/BenchmarkRecord.hpp>
+
+namespace Emergence::Memory::Benchmark
+{
+/// \brief Reproduction of the previous Heap backend: the same profiling, but every request goes to aligned malloc.
+class MallocHeap final
+{
+public:
+    explicit MallocHeap (Profiler::AllocationGroup _group) noexcept
+        : group (std::move (_group))
+    {
+    }
+
+    void *Acquire (std::size_t _bytes, std::size_t _alignment) noexcept
+    {
+        group.Allocate (_bytes);
+        group.Acquire (_bytes);
+        return Allocate (_bytes, _alignment);
+    }
+
+    void *Resize (void *_record, std::size_t _alignment, std::size_t _currentSize, std::size_t _newSize) noexcept
+    {
+        group.Allocate (_newSize);
+        group.Acquire (_newSize);
+        group.Release (_currentSize);
+        group.Free (_currentSize);
+
+        void *newRecord = Allocate (_newSize, _alignment);
+        memcpy (newRecord, _record, std::min (_currentSize, _newSize));
+        Free (_record);
+        return newRecord;
+    }
+
+    void Release (void *_record, std::size_t _bytes) noexcept
+    {
+        group.Release (_bytes);
+        group.Free (_bytes);
+        Free (_record);
+    }
+
+private:
+    static void *Allocate (std::size_t _bytes, std::size_t _alignment) noexcept
+    {
+        // Size is rounded up, because not every aligned malloc implementation accepts arbitrary sizes.
+        const std::size_t size = (_bytes + _alignment - 1u) / _alignment * _alignment;
+#if defined(_MSVC_STL_VERSION)
+        return _aligned_malloc (size, _alignment);
+#else
+        return std::aligned_alloc (_alignment, size);
+#endif
+    }
+
+    static void Free (void *_record) noexcept
+    {
+#if defined(_MSVC_STL_VERSION)
+        _aligned_free (_record);
+#else
+        std::free (_record);
+#endif
+    }
+
+    Profiler::AllocationGroup group;
+};
+
+/// \brief Count of frames, that are simulated during one measured pass.
+constexpr std::size_t FRAMES_PER_PASS = 4u;
+
+/// \brief Entity is replaced by new one once in this count of frames, like short living projectiles and effects.
+constexpr std::size_t ENTITY_REPLACEMENT_PERIOD = 8u;
+
+/// \brief Count of elements, that are pushed into temporary per-entity vector every frame.
+constexpr std::size_t TEMPORARY_ELEMENTS = 12u;
+
+/// \brief Heap-allocated state of one entity: component-like object and its growable child list.
+struct EntityAllocations final
+{
+    void *component = nullptr;
+    std::size_t componentSize = 0u;
+
+    void *children = nullptr;
+    std::size_t childrenCapacity = 0u;
+};
+
+/// \brief Part of the world, that is updated by one thread.
+template <typename HeapType>
+class WorldSlice final
+{
+public:
+    WorldSlice (std::size_t _entityCount, std::uint32_t _seed) noexcept
+        : heap (Profiler::AllocationGroup {}),
+          entities (_entityCount)
+    {
+        for (std::uint32_t skip = 0u; skip < _seed; ++skip)
+        {
+            random.Next ();
+        }
+
+        for (EntityAllocations &entity : entities)
+        {
+            Spawn (entity);
+        }
+    }
+
+    WorldSlice (const WorldSlice &_other) = delete;
+
+    WorldSlice (WorldSlice &&_other) = delete;
+
+    ~WorldSlice () noexcept
+    {
+        for (EntityAllocations &entity : entities)
+        {
+            Despawn (entity);
+        }
+    }
+
+    /// \brief Simulates one frame: entities collect temporary data into growable vectors, some entities are
+    ///        replaced and some entities grow their child lists.
+    /// \return Count of executed heap operations.
+    std::size_t Update () noexcept
+    {
+        std::size_t operations = 0u;
+        for (EntityAllocations &entity : entities)
+        {
+            const std::uint32_t roll = random.Next ();
+            if (roll % ENTITY_REPLACEMENT_PERIOD == 0u)
+            {
+                Despawn (entity);
+                Spawn (entity);
+                operations += 4u;
+            }
+            else if (roll % ENTITY_REPLACEMENT_PERIOD == 1u)
+            {
+                const std::size_t newCapacity = entity.childrenCapacity * 2u;
+                entity.children = heap.Resize (entity.children, alignof (std::uint64_t),
+                                               entity.childrenCapacity * sizeof (std::uint64_t),
+                                               newCapacity * sizeof (std::uint64_t));
+                entity.childrenCapacity = newCapacity;
+                ++operations;
+            }
+
+            operations += CollectTemporary ();
+        }
+
+        return operations;
+    }
+
+    WorldSlice &operator= (const WorldSlice &_other) = delete;
+
+    WorldSlice &operator= (WorldSlice &&_other) = delete;
+
+private:
+    void Spawn (EntityAllocations &_entity) noexcept
+    {
+        // Component sizes are spread across small size classes, like in typical game object model.
+        _entity.componentSize = 16u + (random.Next () % 24u) * 16u;
+        _entity.component = heap.Acquire (_entity.componentSize, alignof (std::uint64_t));
+        memset (_entity.component, 0, _entity.componentSize);
+
+        _entity.childrenCapacity = 2u;
+        _entity.children = heap.Acquire (_entity.childrenCapacity * sizeof (std::uint64_t), alignof (std::uint64_t));
+    }
+
+    void Despawn (EntityAllocations &_entity) noexcept
+    {
+        heap.Release (_entity.component, _entity.componentSize);
+        heap.Release (_entity.children, _entity.childrenCapacity * sizeof (std::uint64_t));
+        _entity = {};
+    }
+
+    /// \brief Pushes elements into temporary vector with doubling growth strategy and releases it.
+    std::size_t CollectTemporary () noexcept
+    {
+        std::size_t capacity = 1u;
+        auto *elements = static_cast<std::uint64_t *> (heap.Acquire (sizeof (std::uint64_t), alignof (std::uint64_t)));
+        std::size_t operations = 2u;
+
+        for (std::size_t index = 0u; index < TEMPORARY_ELEMENTS; ++index)
+        {
+            if (index == capacity)
+            {
+                elements = static_cast<std::uint64_t *> (heap.Resize (elements, alignof (std::uint64_t),
+                                                                      capacity * sizeof (std::uint64_t),
+                                                                      capacity * 2u * sizeof (std::uint64_t)));
+                capacity *= 2u;
+                ++operations;
+            }
+
+            elements[index] = index;
+        }
+
+        heap.Release (elements, capacity * sizeof (std::uint64_t));
+        return operations;
+    }
+
+    HeapType heap;
+    Testing::BenchmarkRandom random;
+    std::vector<EntityAllocations> entities;
+};
+
+/// \brief Splits world between hardware threads and updates all slices in parallel, like task executor does.
+template <typename HeapType>
+void MeasureWorldUpdate (Testing::BenchmarkRun &_run) noexcept
+{
+    const std::size_t threadCount = std::clamp (std::thread::hardware_concurrency (), 2u, 8u);
+    const std::size_t entitiesPerThread = std::max<std::size_t> (1u, _run.GetRecordCount () / threadCount);
+
+    _run.Measure (
+        [threadCount, entitiesPerThread] ()
+        {
+            std::vector<std::size_t> operations (threadCount, 0u);
+            std::vector<std::thread> threads;
+            threads.reserve (threadCount);
+
+            for (std::size_t threadIndex = 0u; threadIndex < threadCount; ++threadIndex)
+            {
+                threads.emplace_back (
+                    [&operations, threadIndex, entitiesPerThread] ()
+                    {
+                        // Slice is created and destroyed inside measured pass, because spawn and cleanup
+                        // of the world are the part of the typical allocation pattern too.
+                        WorldSlice<HeapType> slice {entitiesPerThread, static_cast<std::uint32_t> (threadIndex)};
+                        for (std::size_t frame = 0u; frame < FRAMES_PER_PASS; ++frame)
+                        {
+                            operations[threadIndex] += slice.Update ();
+                        }
+                    });
+            }
+
+            std::size_t total = 0u;
+            for (std::size_t threadIndex = 0u; threadIndex < threadCount; ++threadIndex)
+            {
+                threads[threadIndex].join ();
+                total += operations[threadIndex];
+            }
+
+            return total;
+        });
+}
+
+EMERGENCE_BENCHMARK ("Heap/WorldUpdate/ThreadCaching", MeasureWorldUpdate<Heap>);
+EMERGENCE_BENCHMARK ("Heap/WorldUpdate/Malloc", MeasureWorldUpdate<MallocHeap>);
+} // namespace Emergence::Memory::Benchmark
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <Container/Optional.hpp>
+
+#include <Pegasus/Storage.hpp>
+
+#include <Testing/Benchmark.hpp>
+#include <Testing/BenchmarkRecord.hpp>
+
+namespace Emergence::Pegasus::Benchmark
+{
+/// \brief Storage with one index of given type, that is recreated before every pass of mutating benchmarks.
+template <typename Record, typename Index>
+struct Environment final
+{
+    template <typename CreateIndex>
+    Environment (CreateIndex &_createIndex) noexcept
+        : storage (Record::Reflect ().mapping),
+          index (_createIndex (storage))
+    {
+    }
+
+    void Fill (std::size_t _recordCount) noexcept
+    {
+        Testing::BenchmarkRandom random;
+        Storage::Allocator allocator = storage.AllocateAndInsert ();
+
+        for (std::size_t recordIndex = 0u; recordIndex < _recordCount; ++recordIndex)
+        {
+            // Mapping has no constructor, therefore we construct records manually.
+            auto *record = new (allocator.Next ()) Record {};
+            record->Generate (recordIndex, _recordCount, random);
+        }
+    }
+
+    Storage storage;
+    Handling::Handle<Index> index;
+};
+
+/// \brief Measures insertion of all records into empty storage with index.
+template <typename Record, typename Index, typename CreateIndex>
+void MeasureInsertion (Testing::BenchmarkRun &_run, CreateIndex _createIndex) noexcept
+{
+    Container::Optional<Environment<Record, Index>> environment;
+    _run.Measure (
+        [&environment, &_createIndex] ()
+        {
+            environment.reset ();
+            environment.emplace (_createIndex);
+        },
+        [&environment, &_run] ()
+        {
+            environment->Fill (_run.GetRecordCount ());
+            return _run.GetRecordCount ();
+        });
+}
+
+/// \brief Measures `_operation` on freshly filled storage, for example edition or deletion of all records.
+template <typename Record, typename Index, typename CreateIndex, typename Operation>
+void MeasureOnFreshStorage (Testing::BenchmarkRun &_run, CreateIndex _createIndex, Operation _operation) noexcept
+{
+    Container::Optional<Environment<Record, Index>> environment;
+    _run.Measure (
+        [&environment, &_createIndex, &_run] ()
+        {
+            environment.reset ();
+            environment.emplace (_createIndex);
+            environment->Fill (_run.GetRecordCount ());
+        },
+        [&environment, &_operation] ()
+        {
+            return _operation (*environment->index.Get ());
+        });
+}
+
+/// \brief Measures read only `_operation` on storage, that is filled only once.
+template <typename Record, typename Index, typename CreateIndex, typename Operation>
+void MeasureOnFilledStorage (Testing::BenchmarkRun &_run, CreateIndex _createIndex, Operation _operation) noexcept
+{
+    Environment<Record, Index> environment {_createIndex};
+    environment.Fill (_run.GetRecordCount ());
+
+    _run.Measure (
+        [&environment, &_operation] ()
+        {
+            return _operation (*environment.index.Get ());
+        });
+}
+} // namespace Emergence::Pegasus::Benchmark
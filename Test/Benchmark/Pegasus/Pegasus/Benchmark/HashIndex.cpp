@@ -0,0 +1,95 @@
+#include <Memory/Profiler/Test/DefaultAllocationGroupStub.hpp>
+
+#include <Pegasus/Benchmark/Environment.hpp>
+
+namespace Emergence::Pegasus::Benchmark
+{
+template <typename Record>
+static Handling::Handle<HashIndex> CreateKeyIndex (Storage &_storage) noexcept
+{
+    return _storage.CreateHashIndex ({Record::Reflect ().key});
+}
+
+static std::int32_t GetKeyCount (const Testing::BenchmarkRun &_run) noexcept
+{
+    return static_cast<std::int32_t> (_run.GetRecordCount () / 8u + 1u);
+}
+
+template <typename Record>
+static void Insert (Testing::BenchmarkRun &_run) noexcept
+{
+    MeasureInsertion<Record, HashIndex> (_run, CreateKeyIndex<Record>);
+}
+
+template <typename Record>
+static void Lookup (Testing::BenchmarkRun &_run) noexcept
+{
+    auto lookup = [keyCount = GetKeyCount (_run)] (HashIndex &_index)
+    {
+        std::uint64_t checksum = 0u;
+        for (std::int32_t key = 0; key < keyCount; ++key)
+        {
+            HashIndex::ReadCursor cursor = _index.LookupToRead ({&key});
+            while (const auto *record = static_cast<const Record *> (*cursor))
+            {
+                checksum += record->id;
+                ++cursor;
+            }
+        }
+
+        return checksum;
+    };
+
+    MeasureOnFilledStorage<Record, HashIndex> (_run, CreateKeyIndex<Record>, lookup);
+}
+
+template <typename Record>
+static void Edit (Testing::BenchmarkRun &_run) noexcept
+{
+    auto edit = [keyCount = GetKeyCount (_run)] (HashIndex &_index)
+    {
+        std::size_t edited = 0u;
+        for (std::int32_t key = 0; key < keyCount; ++key)
+        {
+            HashIndex::EditCursor cursor = _index.LookupToEdit ({&key});
+            while (auto *record = static_cast<Record *> (*cursor))
+            {
+                // Moves record to the key, that is never looked up again during this pass.
+                record->key += keyCount;
+                ++cursor;
+                ++edited;
+            }
+        }
+
+        return edited;
+    };
+
+    MeasureOnFreshStorage<Record, HashIndex> (_run, CreateKeyIndex<Record>, edit);
+}
+
+template <typename Record>
+static void Delete (Testing::BenchmarkRun &_run) noexcept
+{
+    auto erase = [keyCount = GetKeyCount (_run)] (HashIndex &_index)
+    {
+        std::size_t deleted = 0u;
+        for (std::int32_t key = 0; key < keyCount; ++key)
+        {
+            deleted += Testing::DeleteAll (_index.LookupToEdit ({&key}));
+        }
+
+        return deleted;
+    };
+
+    MeasureOnFreshStorage<Record, HashIndex> (_run, CreateKeyIndex<Record>, erase);
+}
+
+EMERGENCE_BENCHMARK ("HashIndex/Insert/Compact", Insert<Testing::CompactBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("HashIndex/Insert/Wide", Insert<Testing::WideBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("HashIndex/Lookup/Compact", Lookup<Testing::CompactBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("HashIndex/Lookup/Wide", Lookup<Testing::WideBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("HashIndex/Edit/Compact", Edit<Testing::CompactBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("HashIndex/Edit/Wide", Edit<Testing::WideBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("HashIndex/Delete/Compact", Delete<Testing::CompactBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("HashIndex/Delete/Wide", Delete<Testing::WideBenchmarkRecord>);
+} // namespace Emergence::Pegasus::Benchmark
@@ -0,0 +1,78 @@
+#include <Memory/Profiler/Test/DefaultAllocationGroupStub.hpp>
+
+#include <Pegasus/Benchmark/Environment.hpp>
+
+namespace Emergence::Pegasus::Benchmark
+{
+/// \brief Each range scan covers 8 key values, that is 64 records on average.
+constexpr std::int32_t SCANNED_KEYS = 8;
+
+template <typename Record>
+static Handling::Handle<OrderedIndex> CreateKeyIndex (Storage &_storage) noexcept
+{
+    return _storage.CreateOrderedIndex (Record::Reflect ().key);
+}
+
+template <typename Record>
+static void Insert (Testing::BenchmarkRun &_run) noexcept
+{
+    MeasureInsertion<Record, OrderedIndex> (_run, CreateKeyIndex<Record>);
+}
+
+template <typename Record>
+static void RangeScan (Testing::BenchmarkRun &_run) noexcept
+{
+    const auto keyCount = static_cast<std::int32_t> (_run.GetRecordCount () / 8u + 1u);
+    auto scan = [keyCount] (OrderedIndex &_index)
+    {
+        std::uint64_t checksum = 0u;
+        for (std::int32_t min = 0; min < keyCount; min += SCANNED_KEYS)
+        {
+            const std::int32_t max = min + SCANNED_KEYS - 1;
+            OrderedIndex::AscendingReadCursor cursor = _index.LookupToReadAscending ({&min}, {&max});
+
+            while (const auto *record = static_cast<const Record *> (*cursor))
+            {
+                checksum += record->id;
+                ++cursor;
+            }
+        }
+
+        return checksum;
+    };
+
+    MeasureOnFilledStorage<Record, OrderedIndex> (_run, CreateKeyIndex<Record>, scan);
+}
+
+template <typename Record>
+static void Edit (Testing::BenchmarkRun &_run) noexcept
+{
+    auto edit = [recordCount = _run.GetRecordCount ()] (OrderedIndex &_index)
+    {
+        Testing::BenchmarkRandom random;
+        return Testing::ShiftAll<Record> (_index.LookupToEditAscending ({nullptr}, {nullptr}), recordCount, random);
+    };
+
+    MeasureOnFreshStorage<Record, OrderedIndex> (_run, CreateKeyIndex<Record>, edit);
+}
+
+template <typename Record>
+static void Delete (Testing::BenchmarkRun &_run) noexcept
+{
+    auto erase = [] (OrderedIndex &_index)
+    {
+        return Testing::DeleteAll (_index.LookupToEditAscending ({nullptr}, {nullptr}));
+    };
+
+    MeasureOnFreshStorage<Record, OrderedIndex> (_run, CreateKeyIndex<Record>, erase);
+}
+
+EMERGENCE_BENCHMARK ("OrderedIndex/Insert/Compact", Insert<Testing::CompactBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("OrderedIndex/Insert/Wide", Insert<Testing::WideBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("OrderedIndex/RangeScan/Compact", RangeScan<Testing::CompactBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("OrderedIndex/RangeScan/Wide", RangeScan<Testing::WideBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("OrderedIndex/Edit/Compact", Edit<Testing::CompactBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("OrderedIndex/Edit/Wide", Edit<Testing::WideBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("OrderedIndex/Delete/Compact", Delete<Testing::CompactBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("OrderedIndex/Delete/Wide", Delete<Testing::WideBenchmarkRecord>);
+} // namespace Emergence::Pegasus::Benchmark
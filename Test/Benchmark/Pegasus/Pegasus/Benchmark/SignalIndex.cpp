@@ -0,0 +1,80 @@
+#include <Memory/Profiler/Test/DefaultAllocationGroupStub.hpp>
+
+#include <Pegasus/Benchmark/Environment.hpp>
+
+namespace Emergence::Pegasus::Benchmark
+{
+template <typename Record>
+static Handling::Handle<SignalIndex> CreateAliveIndex (Storage &_storage) noexcept
+{
+    return _storage.CreateSignalIndex (Record::Reflect ().alive, {1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u});
+}
+
+template <typename Record>
+static void Insert (Testing::BenchmarkRun &_run) noexcept
+{
+    MeasureInsertion<Record, SignalIndex> (_run, CreateAliveIndex<Record>);
+}
+
+template <typename Record>
+static void Lookup (Testing::BenchmarkRun &_run) noexcept
+{
+    auto lookup = [] (SignalIndex &_index)
+    {
+        std::uint64_t checksum = 0u;
+        SignalIndex::ReadCursor cursor = _index.LookupSignaledToRead ();
+
+        while (const auto *record = static_cast<const Record *> (*cursor))
+        {
+            checksum += record->id;
+            ++cursor;
+        }
+
+        return checksum;
+    };
+
+    MeasureOnFilledStorage<Record, SignalIndex> (_run, CreateAliveIndex<Record>, lookup);
+}
+
+template <typename Record>
+static void Edit (Testing::BenchmarkRun &_run) noexcept
+{
+    auto edit = [] (SignalIndex &_index)
+    {
+        std::size_t edited = 0u;
+        SignalIndex::EditCursor cursor = _index.LookupSignaledToEdit ();
+
+        while (auto *record = static_cast<Record *> (*cursor))
+        {
+            // Record is no longer signaled, therefore index needs to exclude it.
+            record->alive = 0u;
+            ++cursor;
+            ++edited;
+        }
+
+        return edited;
+    };
+
+    MeasureOnFreshStorage<Record, SignalIndex> (_run, CreateAliveIndex<Record>, edit);
+}
+
+template <typename Record>
+static void Delete (Testing::BenchmarkRun &_run) noexcept
+{
+    auto erase = [] (SignalIndex &_index)
+    {
+        return Testing::DeleteAll (_index.LookupSignaledToEdit ());
+    };
+
+    MeasureOnFreshStorage<Record, SignalIndex> (_run, CreateAliveIndex<Record>, erase);
+}
+
+EMERGENCE_BENCHMARK ("SignalIndex/Insert/Compact", Insert<Testing::CompactBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("SignalIndex/Insert/Wide", Insert<Testing::WideBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("SignalIndex/Lookup/Compact", Lookup<Testing::CompactBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("SignalIndex/Lookup/Wide", Lookup<Testing::WideBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("SignalIndex/Edit/Compact", Edit<Testing::CompactBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("SignalIndex/Edit/Wide", Edit<Testing::WideBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("SignalIndex/Delete/Compact", Delete<Testing::CompactBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("SignalIndex/Delete/Wide", Delete<Testing::WideBenchmarkRecord>);
+} // namespace Emergence::Pegasus::Benchmark
@@ -0,0 +1,103 @@
+#include <array>
+#include <cstring>
+
+#include <Memory/Profiler/Test/DefaultAllocationGroupStub.hpp>
+
+#include <Pegasus/Benchmark/Environment.hpp>
+
+namespace Emergence::Pegasus::Benchmark
+{
+/// \brief Size of shape, used for lookups. Covers ~1/2500 of the world.
+constexpr float QUERY_SIZE = 20.0f;
+
+/// \brief Shape in the same layout as volumetric index expects: min and max for every dimension.
+using QueryShape = std::array<float, 4u>;
+
+template <typename Record>
+static Handling::Handle<VolumetricIndex> CreateBoundsIndex (Storage &_storage) noexcept
+{
+    auto toPlaceholder = [] (float _value)
+    {
+        VolumetricIndex::ValuePlaceholder placeholder {};
+        memcpy (placeholder.data (), &_value, sizeof (_value));
+        return placeholder;
+    };
+
+    const typename Record::Reflection &reflection = Record::Reflect ();
+    return _storage.CreateVolumetricIndex (
+        {{reflection.minX, toPlaceholder (0.0f), reflection.maxX, toPlaceholder (Testing::BENCHMARK_WORLD_SIZE)},
+         {reflection.minY, toPlaceholder (0.0f), reflection.maxY, toPlaceholder (Testing::BENCHMARK_WORLD_SIZE)}});
+}
+
+static const QueryShape WHOLE_WORLD {0.0f, Testing::BENCHMARK_WORLD_SIZE, 0.0f, Testing::BENCHMARK_WORLD_SIZE};
+
+template <typename Record>
+static void Insert (Testing::BenchmarkRun &_run) noexcept
+{
+    MeasureInsertion<Record, VolumetricIndex> (_run, CreateBoundsIndex<Record>);
+}
+
+template <typename Record>
+static void ShapeQuery (Testing::BenchmarkRun &_run) noexcept
+{
+    // Query count is proportional to record count, so ns/record stays comparable between record counts.
+    auto lookup = [queryCount = _run.GetRecordCount () / 64u + 1u] (VolumetricIndex &_index)
+    {
+        Testing::BenchmarkRandom random;
+        std::uint64_t checksum = 0u;
+        constexpr auto POSITIONS = static_cast<std::uint32_t> (Testing::BENCHMARK_WORLD_SIZE - QUERY_SIZE);
+
+        for (std::size_t query = 0u; query < queryCount; ++query)
+        {
+            const std::uint32_t position = random.Next ();
+            const auto minX = static_cast<float> (position % POSITIONS);
+            const auto minY = static_cast<float> ((position >> 12u) % POSITIONS);
+            const QueryShape shape {minX, minX + QUERY_SIZE, minY, minY + QUERY_SIZE};
+
+            VolumetricIndex::ShapeIntersectionReadCursor cursor = _index.LookupShapeIntersectionToRead (shape.data ());
+            while (const auto *record = static_cast<const Record *> (*cursor))
+            {
+                checksum += record->id;
+                ++cursor;
+            }
+        }
+
+        return checksum;
+    };
+
+    MeasureOnFilledStorage<Record, VolumetricIndex> (_run, CreateBoundsIndex<Record>, lookup);
+}
+
+template <typename Record>
+static void Edit (Testing::BenchmarkRun &_run) noexcept
+{
+    auto edit = [recordCount = _run.GetRecordCount ()] (VolumetricIndex &_index)
+    {
+        Testing::BenchmarkRandom random;
+        return Testing::ShiftAll<Record> (_index.LookupShapeIntersectionToEdit (WHOLE_WORLD.data ()), recordCount,
+                                          random);
+    };
+
+    MeasureOnFreshStorage<Record, VolumetricIndex> (_run, CreateBoundsIndex<Record>, edit);
+}
+
+template <typename Record>
+static void Delete (Testing::BenchmarkRun &_run) noexcept
+{
+    auto erase = [] (VolumetricIndex &_index)
+    {
+        return Testing::DeleteAll (_index.LookupShapeIntersectionToEdit (WHOLE_WORLD.data ()));
+    };
+
+    MeasureOnFreshStorage<Record, VolumetricIndex> (_run, CreateBoundsIndex<Record>, erase);
+}
+
+EMERGENCE_BENCHMARK ("VolumetricIndex/Insert/Compact", Insert<Testing::CompactBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("VolumetricIndex/Insert/Wide", Insert<Testing::WideBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("VolumetricIndex/ShapeQuery/Compact", ShapeQuery<Testing::CompactBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("VolumetricIndex/ShapeQuery/Wide", ShapeQuery<Testing::WideBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("VolumetricIndex/Edit/Compact", Edit<Testing::CompactBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("VolumetricIndex/Edit/Wide", Edit<Testing::WideBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("VolumetricIndex/Delete/Compact", Delete<Testing::CompactBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("VolumetricIndex/Delete/Wide", Delete<Testing::WideBenchmarkRecord>);
+} // namespace Emergence::Pegasus::Benchmark
@@ -0,0 +1,135 @@
+#include <algorithm>
+
+#include <Assert/Assert.hpp>
+
+#include <Container/Vector.hpp>
+
+#include <Memory/Profiler/Test/DefaultAllocationGroupStub.hpp>
+#include <Memory/UniqueString.hpp>
+
+#include <Task/Executor.hpp>
+
+#include <Testing/Benchmark.hpp>
+
+#include <Time/Time.hpp>
+
+namespace Emergence::Task::Benchmark
+{
+/// \brief Describes task of a synthetic pipeline.
+struct TaskSeed final
+{
+    const char *name = nullptr;
+
+    /// \brief How long task spins, in microseconds.
+    std::uint64_t durationUs = 0u;
+
+    /// \brief Name of the task that depends on this task, if any.
+    /// \details Modeled pipelines are trees that converge to frame end, therefore one dependant is enough.
+    const char *dependant = nullptr;
+};
+
+using Seed = Container::Vector<TaskSeed>;
+
+static void Spin (std::uint64_t _durationUs) noexcept
+{
+    const std::uint64_t end = Time::NanosecondsSinceStartup () + _durationUs * 1000u;
+    while (Time::NanosecondsSinceStartup () < end)
+    {
+        // Busy wait imitates CPU-bound task.
+    }
+}
+
+static Collection GrowCollection (const Seed &_seed) noexcept
+{
+    Collection collection;
+    for (const TaskSeed &taskSeed : _seed)
+    {
+        Collection::Item &item = collection.tasks.emplace_back ();
+        item.name = Memory::UniqueString {taskSeed.name};
+        item.task = [duration = taskSeed.durationUs] ()
+        {
+            Spin (duration);
+        };
+
+        if (taskSeed.dependant)
+        {
+            const Memory::UniqueString dependantName {taskSeed.dependant};
+            auto iterator = std::find_if (_seed.begin (), _seed.end (),
+                                          [dependantName] (const TaskSeed &_other)
+                                          {
+                                              return Memory::UniqueString {_other.name} == dependantName;
+                                          });
+
+            EMERGENCE_ASSERT (iterator != _seed.end ());
+            item.dependantTasksIndices.emplace_back (std::distance (_seed.begin (), iterator));
+        }
+    }
+
+    return collection;
+}
+
+/// \details Platformer2dDemo pipelines can only be built with render and physics backends, therefore we model
+///          the shape of its game pipelines: most of the frame consists of cheap independent gameplay, cleanup and
+///          UI tasks, that are registered first, while the frame time is bound by the long chain of heavy tasks:
+///          input, control, physics simulation, transform synchronization, camera, batching and render submission.
+static Seed CreatePlatformerFrameSeed () noexcept
+{
+    static const char *const CHEAP_TASK_NAMES[] = {
+        "AnimationSelection", "AnimationUpdate", "AssetReferenceCleanup", "AssetStateUpdate", "ComponentCleanup",
+        "DamageCleanup", "FollowCameraSetup", "HitBoxCleanup", "InputCleanup", "LayerCleanup", "LocaleUpdate",
+        "MovementCleanup", "PrefabCleanup", "ResourceConfigLoading", "ResourceObjectLoading", "SpawnCleanup",
+        "SpriteCleanup", "TransformCleanup", "UIControlCleanup", "UIInputCleanup", "UINodeCleanup", "UIStyleCleanup",
+        "ViewportCleanup", "WorldStateCleanup"};
+
+    Seed seed {Memory::Profiler::AllocationGroup::Top ()};
+    for (const char *name : CHEAP_TASK_NAMES)
+    {
+        seed.emplace_back (TaskSeed {name, 60u, "FrameEnd"});
+    }
+
+    seed.emplace_back (TaskSeed {"InputDispatch", 100u, "PlayerControl"});
+    seed.emplace_back (TaskSeed {"PlayerControl", 150u, "PhysicsSimulation"});
+    seed.emplace_back (TaskSeed {"PhysicsSimulation", 900u, "TransformSynchronization"});
+    seed.emplace_back (TaskSeed {"TransformSynchronization", 300u, "CameraUpdate"});
+    seed.emplace_back (TaskSeed {"CameraUpdate", 100u, "SpriteBatching"});
+    seed.emplace_back (TaskSeed {"SpriteBatching", 500u, "RenderSubmission"});
+    seed.emplace_back (TaskSeed {"RenderSubmission", 300u, "FrameEnd"});
+    seed.emplace_back (TaskSeed {"FrameEnd", 10u, nullptr});
+    return seed;
+}
+
+/// \brief Executes synthetic platformer frame with given hints, record count is used as frame count per pass.
+template <bool PrioritizeCriticalPath, bool UseMeasuredDurations>
+void MeasureFrames (Testing::BenchmarkRun &_run) noexcept
+{
+    // Measured durations need some frames to stabilize, therefore we exclude first frames from measurement.
+    constexpr std::size_t WARM_UP_FRAMES = 128u;
+
+    static const Collection collection = GrowCollection (CreatePlatformerFrameSeed ());
+    SchedulingHints hints;
+    hints.prioritizeCriticalPath = PrioritizeCriticalPath;
+    hints.useMeasuredDurations = UseMeasuredDurations;
+    Executor executor {collection, hints};
+
+    for (std::size_t frame = 0u; frame < WARM_UP_FRAMES; ++frame)
+    {
+        executor.Execute ();
+    }
+
+    const std::size_t frameCount = _run.GetRecordCount ();
+    _run.Measure (
+        [&executor, frameCount] ()
+        {
+            for (std::size_t frame = 0u; frame < frameCount; ++frame)
+            {
+                executor.Execute ();
+            }
+
+            return frameCount * collection.tasks.size ();
+        });
+}
+
+EMERGENCE_BENCHMARK ("TaskExecutor/PlatformerFrame/RegistrationOrder", (MeasureFrames<false, false>));
+EMERGENCE_BENCHMARK ("TaskExecutor/PlatformerFrame/LongestPathFirst", (MeasureFrames<true, false>));
+EMERGENCE_BENCHMARK ("TaskExecutor/PlatformerFrame/MeasuredPathFirst", (MeasureFrames<true, true>));
+} // namespace Emergence::Task::Benchmark
@@ -0,0 +1,169 @@
+#include <array>
+
+#include <Memory/Profiler/Test/DefaultAllocationGroupStub.hpp>
+
+#include <Warehouse/Benchmark/World.hpp>
+
+namespace Emergence::Warehouse::Benchmark
+{
+/// \brief Each range scan covers 8 key values, that is 64 records on average.
+constexpr std::int32_t SCANNED_KEYS = 8;
+
+/// \brief Size of shape, used for lookups. Covers ~1/2500 of the world.
+constexpr float QUERY_SIZE = 20.0f;
+
+template <typename Record, bool Bulk>
+static void Insert (Testing::BenchmarkRun &_run) noexcept
+{
+    Container::Optional<LongTermWorld<Record>> world;
+    _run.Measure (
+        [&world] ()
+        {
+            world.reset ();
+            world.emplace ();
+        },
+        [&world, &_run] ()
+        {
+            auto cursor = Bulk ? world->insert.ExecuteBulk () : world->insert.Execute ();
+            LongTermWorld<Record>::Fill (cursor, _run.GetRecordCount ());
+            return _run.GetRecordCount ();
+        });
+}
+
+template <typename Record>
+static void FetchValue (Testing::BenchmarkRun &_run) noexcept
+{
+    auto fetch = [recordCount = _run.GetRecordCount ()] (LongTermWorld<Record> &_world)
+    {
+        std::uint64_t checksum = 0u;
+        for (std::uint64_t id = 0u; id < recordCount; ++id)
+        {
+            auto cursor = _world.fetchValue.Execute (&id);
+            if (const auto *record = static_cast<const Record *> (*cursor))
+            {
+                checksum += static_cast<std::uint64_t> (record->key);
+            }
+        }
+
+        return checksum;
+    };
+
+    MeasureOnFilledWorld<LongTermWorld<Record>> (_run, fetch);
+}
+
+template <typename Record>
+static void FetchAscendingRange (Testing::BenchmarkRun &_run) noexcept
+{
+    auto fetch = [keyCount = static_cast<std::int32_t> (_run.GetRecordCount () / 8u + 1u)] (
+                     LongTermWorld<Record> &_world)
+    {
+        std::uint64_t checksum = 0u;
+        for (std::int32_t min = 0; min < keyCount; min += SCANNED_KEYS)
+        {
+            const std::int32_t max = min + SCANNED_KEYS - 1;
+            auto cursor = _world.fetchRange.Execute (&min, &max);
+
+            while (const auto *record = static_cast<const Record *> (*cursor))
+            {
+                checksum += record->id;
+                ++cursor;
+            }
+        }
+
+        return checksum;
+    };
+
+    MeasureOnFilledWorld<LongTermWorld<Record>> (_run, fetch);
+}
+
+template <typename Record>
+static void FetchSignal (Testing::BenchmarkRun &_run) noexcept
+{
+    auto fetch = [] (LongTermWorld<Record> &_world)
+    {
+        std::uint64_t checksum = 0u;
+        auto cursor = _world.fetchSignal.Execute ();
+
+        while (const auto *record = static_cast<const Record *> (*cursor))
+        {
+            checksum += record->id;
+            ++cursor;
+        }
+
+        return checksum;
+    };
+
+    MeasureOnFilledWorld<LongTermWorld<Record>> (_run, fetch);
+}
+
+template <typename Record>
+static void FetchShapeIntersection (Testing::BenchmarkRun &_run) noexcept
+{
+    auto fetch = [queryCount = _run.GetRecordCount () / 64u + 1u] (LongTermWorld<Record> &_world)
+    {
+        Testing::BenchmarkRandom random;
+        std::uint64_t checksum = 0u;
+        constexpr auto POSITIONS = static_cast<std::uint32_t> (Testing::BENCHMARK_WORLD_SIZE - QUERY_SIZE);
+
+        for (std::size_t query = 0u; query < queryCount; ++query)
+        {
+            const std::uint32_t seed = random.Next ();
+            const auto minX = static_cast<float> (seed % POSITIONS);
+            const auto minY = static_cast<float> ((seed >> 12u) % POSITIONS);
+            const std::array<float, 4u> shape {minX, minX + QUERY_SIZE, minY, minY + QUERY_SIZE};
+            auto cursor = _world.fetchShape.Execute (shape.data ());
+
+            while (const auto *record = static_cast<const Record *> (*cursor))
+            {
+                checksum += record->id;
+                ++cursor;
+            }
+        }
+
+        return checksum;
+    };
+
+    MeasureOnFilledWorld<LongTermWorld<Record>> (_run, fetch);
+}
+
+template <typename Record>
+static void Edit (Testing::BenchmarkRun &_run) noexcept
+{
+    auto edit = [recordCount = _run.GetRecordCount ()] (LongTermWorld<Record> &_world)
+    {
+        Testing::BenchmarkRandom random;
+        return Testing::ShiftAll<Record> (_world.modifyRange.Execute (nullptr, nullptr), recordCount, random);
+    };
+
+    MeasureOnFreshWorld<LongTermWorld<Record>> (_run, edit);
+}
+
+template <typename Record>
+static void Delete (Testing::BenchmarkRun &_run) noexcept
+{
+    auto erase = [] (LongTermWorld<Record> &_world)
+    {
+        return Testing::DeleteAll (_world.modifyRange.Execute (nullptr, nullptr));
+    };
+
+    MeasureOnFreshWorld<LongTermWorld<Record>> (_run, erase);
+}
+
+EMERGENCE_BENCHMARK ("LongTerm/Insert/Compact", (Insert<Testing::CompactBenchmarkRecord, false>));
+EMERGENCE_BENCHMARK ("LongTerm/Insert/Wide", (Insert<Testing::WideBenchmarkRecord, false>));
+EMERGENCE_BENCHMARK ("LongTerm/InsertBulk/Compact", (Insert<Testing::CompactBenchmarkRecord, true>));
+EMERGENCE_BENCHMARK ("LongTerm/InsertBulk/Wide", (Insert<Testing::WideBenchmarkRecord, true>));
+EMERGENCE_BENCHMARK ("LongTerm/FetchValue/Compact", FetchValue<Testing::CompactBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("LongTerm/FetchValue/Wide", FetchValue<Testing::WideBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("LongTerm/FetchAscendingRange/Compact", FetchAscendingRange<Testing::CompactBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("LongTerm/FetchAscendingRange/Wide", FetchAscendingRange<Testing::WideBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("LongTerm/FetchSignal/Compact", FetchSignal<Testing::CompactBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("LongTerm/FetchSignal/Wide", FetchSignal<Testing::WideBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("LongTerm/FetchShapeIntersection/Compact",
+                     FetchShapeIntersection<Testing::CompactBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("LongTerm/FetchShapeIntersection/Wide", FetchShapeIntersection<Testing::WideBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("LongTerm/Edit/Compact", Edit<Testing::CompactBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("LongTerm/Edit/Wide", Edit<Testing::WideBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("LongTerm/Delete/Compact", Delete<Testing::CompactBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("LongTerm/Delete/Wide", Delete<Testing::WideBenchmarkRecord>);
+} // namespace Emergence::Warehouse::Benchmark
@@ -0,0 +1,75 @@
+#include <Memory/Profiler/Test/DefaultAllocationGroupStub.hpp>
+
+#include <Warehouse/Benchmark/World.hpp>
+
+namespace Emergence::Warehouse::Benchmark
+{
+template <typename Record>
+static void Insert (Testing::BenchmarkRun &_run) noexcept
+{
+    Container::Optional<ShortTermWorld<Record>> world;
+    _run.Measure (
+        [&world] ()
+        {
+            world.reset ();
+            world.emplace ();
+        },
+        [&world, &_run] ()
+        {
+            world->Fill (_run.GetRecordCount ());
+            return _run.GetRecordCount ();
+        });
+}
+
+template <typename Record>
+static void FetchSequence (Testing::BenchmarkRun &_run) noexcept
+{
+    auto fetch = [] (ShortTermWorld<Record> &_world)
+    {
+        std::uint64_t checksum = 0u;
+        auto cursor = _world.fetch.Execute ();
+
+        while (const auto *record = static_cast<const Record *> (*cursor))
+        {
+            checksum += record->id;
+            ++cursor;
+        }
+
+        return checksum;
+    };
+
+    MeasureOnFilledWorld<ShortTermWorld<Record>> (_run, fetch);
+}
+
+template <typename Record>
+static void Edit (Testing::BenchmarkRun &_run) noexcept
+{
+    auto edit = [recordCount = _run.GetRecordCount ()] (ShortTermWorld<Record> &_world)
+    {
+        Testing::BenchmarkRandom random;
+        return Testing::ShiftAll<Record> (_world.modify.Execute (), recordCount, random);
+    };
+
+    MeasureOnFreshWorld<ShortTermWorld<Record>> (_run, edit);
+}
+
+template <typename Record>
+static void Delete (Testing::BenchmarkRun &_run) noexcept
+{
+    auto erase = [] (ShortTermWorld<Record> &_world)
+    {
+        return Testing::DeleteAll (_world.modify.Execute ());
+    };
+
+    MeasureOnFreshWorld<ShortTermWorld<Record>> (_run, erase);
+}
+
+EMERGENCE_BENCHMARK ("ShortTerm/Insert/Compact", Insert<Testing::CompactBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("ShortTerm/Insert/Wide", Insert<Testing::WideBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("ShortTerm/FetchSequence/Compact", FetchSequence<Testing::CompactBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("ShortTerm/FetchSequence/Wide", FetchSequence<Testing::WideBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("ShortTerm/Edit/Compact", Edit<Testing::CompactBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("ShortTerm/Edit/Wide", Edit<Testing::WideBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("ShortTerm/Delete/Compact", Delete<Testing::CompactBenchmarkRecord>);
+EMERGENCE_BENCHMARK ("ShortTerm/Delete/Wide", Delete<Testing::WideBenchmarkRecord>);
+} // namespace Emergence::Warehouse::Benchmark
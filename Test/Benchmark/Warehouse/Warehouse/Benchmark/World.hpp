@@ -0,0 +1,125 @@
+#pragma once
+
+#include <Container/Optional.hpp>
+
+#include <Testing/Benchmark.hpp>
+#include <Testing/BenchmarkRecord.hpp>
+
+#include <Warehouse/Registry.hpp>
+
+namespace Emergence::Warehouse::Benchmark
+{
+/// \brief Registry with prepared queries of every long term type, so every long term record modification
+///        updates hash, ordered, signal and volumetric indices, like it happens with typical world object component.
+template <typename Record>
+class LongTermWorld final
+{
+public:
+    LongTermWorld () noexcept
+        : registry (Memory::UniqueString {"LongTermBenchmark"}),
+          insert (registry.InsertLongTerm (Record::Reflect ().mapping)),
+          fetchValue (registry.FetchValue (Record::Reflect ().mapping, {Record::Reflect ().id})),
+          fetchRange (registry.FetchAscendingRange (Record::Reflect ().mapping, Record::Reflect ().key)),
+          modifyRange (registry.ModifyAscendingRange (Record::Reflect ().mapping, Record::Reflect ().key)),
+          fetchSignal (registry.FetchSignal (
+              Record::Reflect ().mapping, Record::Reflect ().alive, {1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u})),
+          fetchShape (registry.FetchShapeIntersection (Record::Reflect ().mapping, CreateDimensions ()))
+    {
+    }
+
+    /// \brief Inserts given count of generated records using given insertion cursor.
+    template <typename Cursor>
+    static void Fill (Cursor &_cursor, std::size_t _recordCount) noexcept
+    {
+        Testing::BenchmarkRandom random;
+        for (std::size_t index = 0u; index < _recordCount; ++index)
+        {
+            auto *record = new (++_cursor) Record {};
+            record->Generate (index, _recordCount, random);
+        }
+    }
+
+    void Fill (std::size_t _recordCount) noexcept
+    {
+        auto cursor = insert.ExecuteBulk ();
+        Fill (cursor, _recordCount);
+    }
+
+    Registry registry;
+    InsertLongTermQuery insert;
+    FetchValueQuery fetchValue;
+    FetchAscendingRangeQuery fetchRange;
+    ModifyAscendingRangeQuery modifyRange;
+    FetchSignalQuery fetchSignal;
+    FetchShapeIntersectionQuery fetchShape;
+
+private:
+    static Container::Vector<Dimension> CreateDimensions () noexcept
+    {
+        static const float MIN = 0.0f;
+        static const float MAX = Testing::BENCHMARK_WORLD_SIZE;
+        const typename Record::Reflection &reflection = Record::Reflect ();
+        const StandardLayout::Mapping &mapping = reflection.mapping;
+
+        return {{&MIN, mapping.GetField (reflection.minX), &MAX, mapping.GetField (reflection.maxX)},
+                {&MIN, mapping.GetField (reflection.minY), &MAX, mapping.GetField (reflection.maxY)}};
+    }
+};
+
+/// \brief Registry with sequence queries, that are the only queries supported for short term records.
+template <typename Record>
+class ShortTermWorld final
+{
+public:
+    ShortTermWorld () noexcept
+        : registry (Memory::UniqueString {"ShortTermBenchmark"}),
+          insert (registry.InsertShortTerm (Record::Reflect ().mapping)),
+          fetch (registry.FetchSequence (Record::Reflect ().mapping)),
+          modify (registry.ModifySequence (Record::Reflect ().mapping))
+    {
+    }
+
+    void Fill (std::size_t _recordCount) noexcept
+    {
+        auto cursor = insert.Execute ();
+        LongTermWorld<Record>::Fill (cursor, _recordCount);
+    }
+
+    Registry registry;
+    InsertShortTermQuery insert;
+    FetchSequenceQuery fetch;
+    ModifySequenceQuery modify;
+};
+
+/// \brief Measures `_operation` on freshly filled world, for example edition or deletion of all records.
+template <typename World, typename Operation>
+void MeasureOnFreshWorld (Testing::BenchmarkRun &_run, Operation _operation) noexcept
+{
+    Container::Optional<World> world;
+    _run.Measure (
+        [&world, &_run] ()
+        {
+            world.reset ();
+            world.emplace ();
+            world->Fill (_run.GetRecordCount ());
+        },
+        [&world, &_operation] ()
+        {
+            return _operation (*world);
+        });
+}
+
+/// \brief Measures read only `_operation` on world, that is filled only once.
+template <typename World, typename Operation>
+void MeasureOnFilledWorld (Testing::BenchmarkRun &_run, Operation _operation) noexcept
+{
+    World world;
+    world.Fill (_run.GetRecordCount ());
+
+    _run.Measure (
+        [&world, &_operation] ()
+        {
+            return _operation (world);
+        });
+}
+} // namespace Emergence::Warehouse::Benchmark
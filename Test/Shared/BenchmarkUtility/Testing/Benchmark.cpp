@@ -0,0 +1,223 @@
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <Assert/Assert.hpp>
+
+#include <Testing/Benchmark.hpp>
+
+namespace Emergence::Testing
+{
+struct BenchmarkEntry final
+{
+    const char *name = nullptr;
+    BenchmarkFunction function = nullptr;
+};
+
+/// \brief Benchmarks are registered during static initialization, therefore we use fixed
+///        capacity storage, that does not depend on initialization order of allocators.
+constexpr std::size_t MAX_BENCHMARKS = 256u;
+
+constexpr std::size_t MAX_RECORD_COUNTS = 16u;
+
+struct BenchmarkRegister final
+{
+    std::array<BenchmarkEntry, MAX_BENCHMARKS> entries;
+    std::size_t count = 0u;
+};
+
+static BenchmarkRegister &GetRegister () noexcept
+{
+    static BenchmarkRegister benchmarkRegister;
+    return benchmarkRegister;
+}
+
+struct BenchmarkOptions final
+{
+    const char *filter = nullptr;
+    std::array<std::size_t, MAX_RECORD_COUNTS> recordCounts {1000u, 10000u, 100000u};
+    std::size_t recordCountsUsed = 3u;
+    std::size_t passes = 8u;
+    const char *jsonPath = nullptr;
+};
+
+static bool ParseRecordCounts (const char *_list, BenchmarkOptions &_options) noexcept
+{
+    _options.recordCountsUsed = 0u;
+    const char *cursor = _list;
+
+    while (*cursor)
+    {
+        char *end = nullptr;
+        const unsigned long long count = std::strtoull (cursor, &end, 10);
+
+        if (end == cursor || count == 0u || _options.recordCountsUsed >= MAX_RECORD_COUNTS)
+        {
+            return false;
+        }
+
+        _options.recordCounts[_options.recordCountsUsed++] = static_cast<std::size_t> (count);
+        cursor = *end == ',' ? end + 1u : end;
+
+        if (*end != ',' && *end != '\0')
+        {
+            return false;
+        }
+    }
+
+    return _options.recordCountsUsed > 0u;
+}
+
+static bool ParseOptions (int _argumentCount, char **_arguments, BenchmarkOptions &_options) noexcept
+{
+    for (int index = 1; index < _argumentCount; ++index)
+    {
+        const char *argument = _arguments[index];
+        const char *value = index + 1 < _argumentCount ? _arguments[index + 1] : nullptr;
+
+        if (!value)
+        {
+            std::fprintf (stderr, "Argument \"%s\" is unknown or has no value.\n", argument);
+            return false;
+        }
+
+        if (std::strcmp (argument, "--filter") == 0)
+        {
+            _options.filter = value;
+        }
+        else if (std::strcmp (argument, "--counts") == 0)
+        {
+            if (!ParseRecordCounts (value, _options))
+            {
+                std::fprintf (stderr, "Unable to parse record counts \"%s\".\n", value);
+                return false;
+            }
+        }
+        else if (std::strcmp (argument, "--passes") == 0)
+        {
+            _options.passes = static_cast<std::size_t> (std::strtoull (value, nullptr, 10));
+            if (_options.passes == 0u)
+            {
+                std::fprintf (stderr, "Pass count must be positive number.\n");
+                return false;
+            }
+        }
+        else if (std::strcmp (argument, "--json") == 0)
+        {
+            _options.jsonPath = value;
+        }
+        else
+        {
+            std::fprintf (stderr, "Argument \"%s\" is unknown.\n", argument);
+            return false;
+        }
+
+        ++index;
+    }
+
+    return true;
+}
+
+int RunBenchmarks (int _argumentCount, char **_arguments) noexcept
+{
+    BenchmarkOptions options;
+    if (!ParseOptions (_argumentCount, _arguments, options))
+    {
+        std::fprintf (stderr, "Usage: %s [--filter <substring>] [--counts <count,count,...>] [--passes <count>] "
+                              "[--json <path>]\n",
+                      _argumentCount > 0 ? _arguments[0] : "Benchmark");
+        return 1;
+    }
+
+    FILE *json = nullptr;
+    if (options.jsonPath)
+    {
+        json = std::fopen (options.jsonPath, "w");
+        if (!json)
+        {
+            std::fprintf (stderr, "Unable to open \"%s\" for writing.\n", options.jsonPath);
+            return 1;
+        }
+
+        std::fprintf (json, "{\n  \"passes\": %zu,\n  \"benchmarks\": [", options.passes);
+    }
+
+    const BenchmarkRegister &benchmarkRegister = GetRegister ();
+    bool firstResult = true;
+
+    for (std::size_t benchmarkIndex = 0u; benchmarkIndex < benchmarkRegister.count; ++benchmarkIndex)
+    {
+        const BenchmarkEntry &entry = benchmarkRegister.entries[benchmarkIndex];
+        if (options.filter && !std::strstr (entry.name, options.filter))
+        {
+            continue;
+        }
+
+        for (std::size_t countIndex = 0u; countIndex < options.recordCountsUsed; ++countIndex)
+        {
+            BenchmarkRun run {options.recordCounts[countIndex], options.passes};
+            entry.function (run);
+
+            if (run.measuredPasses == 0u)
+            {
+                std::fprintf (stderr, "Benchmark \"%s\" has not measured anything.\n", entry.name);
+                continue;
+            }
+
+            const double averageNs = static_cast<double> (run.totalNs) / static_cast<double> (run.measuredPasses);
+            const double bestNsPerRecord = static_cast<double> (run.bestNs) / static_cast<double> (run.recordCount);
+
+            std::printf ("%-48s %9zu records, best: %10.3f ms, average: %10.3f ms, %9.2f ns/record, checksum: %llu\n",
+                         entry.name, run.recordCount, static_cast<double> (run.bestNs) / 1000000.0,
+                         averageNs / 1000000.0, bestNsPerRecord, static_cast<unsigned long long> (run.checksum));
+
+            if (json)
+            {
+                std::fprintf (json,
+                              "%s\n    {\"name\": \"%s\", \"recordCount\": %zu, \"bestNs\": %llu, \"averageNs\": %.1f, "
+                              "\"bestNsPerRecord\": %.3f, \"checksum\": %llu}",
+                              firstResult ? "" : ",", entry.name, run.recordCount,
+                              static_cast<unsigned long long> (run.bestNs), averageNs, bestNsPerRecord,
+                              static_cast<unsigned long long> (run.checksum));
+                firstResult = false;
+            }
+        }
+    }
+
+    if (json)
+    {
+        std::fprintf (json, "\n  ]\n}\n");
+        std::fclose (json);
+    }
+
+    return 0;
+}
+
+std::size_t BenchmarkRun::GetRecordCount () const noexcept
+{
+    return recordCount;
+}
+
+BenchmarkRun::BenchmarkRun (std::size_t _recordCount, std::size_t _passes) noexcept
+    : recordCount (_recordCount),
+      passes (_passes)
+{
+}
+
+void BenchmarkRun::RecordPass (std::uint64_t _durationNs, std::uint64_t _checksum) noexcept
+{
+    ++measuredPasses;
+    bestNs = std::min (bestNs, _durationNs);
+    totalNs += _durationNs;
+    checksum = _checksum;
+}
+
+BenchmarkRegistrar::BenchmarkRegistrar (const char *_name, BenchmarkFunction _function) noexcept
+{
+    BenchmarkRegister &benchmarkRegister = GetRegister ();
+    EMERGENCE_ASSERT (benchmarkRegister.count < MAX_BENCHMARKS);
+    benchmarkRegister.entries[benchmarkRegister.count++] = {_name, _function};
+}
+} // namespace Emergence::Testing
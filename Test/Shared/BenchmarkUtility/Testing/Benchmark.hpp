@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+#include <Time/Time.hpp>
+
+namespace Emergence::Testing
+{
+/// \brief Parses command line, executes all registered benchmarks that match filter and reports results.
+/// \details Supported arguments:
+///          - `--filter <substring>`: execute only benchmarks which names contain given substring.
+///          - `--counts <count,count,...>`: record counts, with which every benchmark is executed.
+///          - `--passes <count>`: how many times every operation is measured.
+///          - `--json <path>`: additionally write results to given file in JSON format.
+/// \return Program exit code.
+int RunBenchmarks (int _argumentCount, char **_arguments) noexcept;
+
+/// \brief Context of benchmark execution with one set of parameters.
+class BenchmarkRun final
+{
+public:
+    /// \return Count of records, with which benchmark should work.
+    [[nodiscard]] std::size_t GetRecordCount () const noexcept;
+
+    /// \brief Measures `_operation` configured number of passes and calls `_prepare` before every pass.
+    /// \details `_prepare` is not measured and is used to reset benchmark to initial state, for example to
+    ///          recreate storage for insertion benchmark. `_operation` returns checksum of processed data,
+    ///          so compiler is not able to throw measured work away. Checksum is reported with results.
+    template <typename Prepare, typename Operation>
+    void Measure (Prepare &&_prepare, Operation &&_operation) noexcept;
+
+    /// \brief Shortcut for benchmarks, that do not need to reset anything between passes.
+    template <typename Operation>
+    void Measure (Operation &&_operation) noexcept;
+
+    BenchmarkRun (const BenchmarkRun &_other) = delete;
+
+    BenchmarkRun (BenchmarkRun &&_other) = delete;
+
+    ~BenchmarkRun () noexcept = default;
+
+    BenchmarkRun &operator= (const BenchmarkRun &_other) = delete;
+
+    BenchmarkRun &operator= (BenchmarkRun &&_other) = delete;
+
+private:
+    friend int RunBenchmarks (int _argumentCount, char **_arguments) noexcept;
+
+    BenchmarkRun (std::size_t _recordCount, std::size_t _passes) noexcept;
+
+    void RecordPass (std::uint64_t _durationNs, std::uint64_t _checksum) noexcept;
+
+    std::size_t recordCount = 0u;
+    std::size_t passes = 0u;
+
+    std::size_t measuredPasses = 0u;
+    std::uint64_t bestNs = std::numeric_limits<std::uint64_t>::max ();
+    std::uint64_t totalNs = 0u;
+    std::uint64_t checksum = 0u;
+};
+
+/// \brief Benchmark body, that is called once for every configured record count.
+using BenchmarkFunction = void (*) (BenchmarkRun &_run);
+
+/// \brief Registers benchmark during static initialization. Use through EMERGENCE_BENCHMARK.
+class BenchmarkRegistrar final
+{
+public:
+    /// \details Name is expected to be a string literal, because registrar does not copy it.
+    BenchmarkRegistrar (const char *_name, BenchmarkFunction _function) noexcept;
+};
+
+template <typename Prepare, typename Operation>
+void BenchmarkRun::Measure (Prepare &&_prepare, Operation &&_operation) noexcept
+{
+    for (std::size_t pass = 0u; pass < passes; ++pass)
+    {
+        _prepare ();
+        const std::uint64_t start = Time::NanosecondsSinceStartup ();
+        const std::uint64_t passChecksum = static_cast<std::uint64_t> (_operation ());
+        RecordPass (Time::NanosecondsSinceStartup () - start, passChecksum);
+    }
+}
+
+template <typename Operation>
+void BenchmarkRun::Measure (Operation &&_operation) noexcept
+{
+    Measure (
+        [] ()
+        {
+        },
+        std::forward<Operation> (_operation));
+}
+} // namespace Emergence::Testing
+
+#define EMERGENCE_BENCHMARK_CONCAT_IMPLEMENTATION(First, Second) First##Second
+
+#define EMERGENCE_BENCHMARK_CONCAT(First, Second) EMERGENCE_BENCHMARK_CONCAT_IMPLEMENTATION (First, Second)
+
+/// \brief Registers given function as benchmark with given name.
+/// \details Names use `Subject/Operation/Layout` format, so results could be easily filtered and grouped.
+#define EMERGENCE_BENCHMARK(Name, Function)                                                                            \
+    static const Emergence::Testing::BenchmarkRegistrar EMERGENCE_BENCHMARK_CONCAT (benchmarkRegistrar, __LINE__) {    \
+        Name, Function}
@@ -0,0 +1,9 @@
+/// \brief Include this file to automatically generate program entry point for benchmarks.
+#pragma once
+
+#include <Testing/Benchmark.hpp>
+
+int main (int _argumentCount, char **_arguments)
+{
+    return Emergence::Testing::RunBenchmarks (_argumentCount, _arguments);
+}
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <StandardLayout/MappingBuilder.hpp>
+
+namespace Emergence::Testing
+{
+/// \brief Size of the world, in which benchmark records are placed.
+constexpr float BENCHMARK_WORLD_SIZE = 1000.0f;
+
+/// \brief Size of record bounding box on every axis.
+constexpr float BENCHMARK_RECORD_SIZE = 2.0f;
+
+/// \brief Deterministic generator, so every benchmark run processes the same data.
+class BenchmarkRandom final
+{
+public:
+    std::uint32_t Next () noexcept
+    {
+        state ^= state << 13u;
+        state ^= state >> 17u;
+        state ^= state << 5u;
+        return state;
+    }
+
+private:
+    std::uint32_t state = 2463534242u;
+};
+
+/// \brief Record with fields for every index type, that is used to parameterize benchmarks by field layout.
+/// \details Indexed fields are placed at the beginning of the record and followed by `PayloadSize` bytes of
+///          cold payload, therefore layouts with bigger payload show how record size affects index operations.
+template <std::size_t PayloadSize>
+struct BenchmarkRecord final
+{
+    std::uint64_t id = 0u;
+    std::int32_t key = 0;
+    float minX = 0.0f;
+    float minY = 0.0f;
+    float maxX = 0.0f;
+    float maxY = 0.0f;
+    std::uint8_t alive = 0u;
+    std::array<std::uint8_t, PayloadSize> payload {};
+
+    struct Reflection final
+    {
+        StandardLayout::FieldId id;
+        StandardLayout::FieldId key;
+        StandardLayout::FieldId minX;
+        StandardLayout::FieldId minY;
+        StandardLayout::FieldId maxX;
+        StandardLayout::FieldId maxY;
+        StandardLayout::FieldId alive;
+        StandardLayout::FieldId payload;
+        StandardLayout::Mapping mapping;
+    };
+
+    static const Reflection &Reflect () noexcept;
+
+    /// \brief Initializes record: on average 8 records share the same key, half of records are alive.
+    void Generate (std::size_t _index, std::size_t _recordCount, BenchmarkRandom &_random) noexcept;
+
+    /// \brief Moves record to random place and changes its key, so every index needs to update it.
+    void Shift (std::size_t _recordCount, BenchmarkRandom &_random) noexcept;
+};
+
+/// \brief Layout, that only consists of indexed fields.
+using CompactBenchmarkRecord = BenchmarkRecord<1u>;
+
+/// \brief Layout, in which indexed fields are small part of the record, like in typical game object component.
+using WideBenchmarkRecord = BenchmarkRecord<224u>;
+
+template <std::size_t PayloadSize>
+const typename BenchmarkRecord<PayloadSize>::Reflection &BenchmarkRecord<PayloadSize>::Reflect () noexcept
+{
+    static const Reflection reflection = [] ()
+    {
+        using namespace Memory::Literals;
+        StandardLayout::MappingBuilder builder;
+        builder.Begin (PayloadSize > 1u ? "WideBenchmarkRecord"_us : "CompactBenchmarkRecord"_us,
+                       sizeof (BenchmarkRecord), alignof (BenchmarkRecord));
+
+        Reflection result;
+        result.id = builder.RegisterUInt64 ("id"_us, offsetof (BenchmarkRecord, id));
+        result.key = builder.RegisterInt32 ("key"_us, offsetof (BenchmarkRecord, key));
+        result.minX = builder.RegisterFloat ("minX"_us, offsetof (BenchmarkRecord, minX));
+        result.minY = builder.RegisterFloat ("minY"_us, offsetof (BenchmarkRecord, minY));
+        result.maxX = builder.RegisterFloat ("maxX"_us, offsetof (BenchmarkRecord, maxX));
+        result.maxY = builder.RegisterFloat ("maxY"_us, offsetof (BenchmarkRecord, maxY));
+        result.alive = builder.RegisterUInt8 ("alive"_us, offsetof (BenchmarkRecord, alive));
+        result.payload = builder.RegisterBlock ("payload"_us, offsetof (BenchmarkRecord, payload), PayloadSize);
+        result.mapping = builder.End ();
+        return result;
+    }();
+
+    return reflection;
+}
+
+template <std::size_t PayloadSize>
+void BenchmarkRecord<PayloadSize>::Generate (std::size_t _index,
+                                             std::size_t _recordCount,
+                                             BenchmarkRandom &_random) noexcept
+{
+    id = _index;
+    alive = static_cast<std::uint8_t> (_index % 2u);
+    Shift (_recordCount, _random);
+}
+
+template <std::size_t PayloadSize>
+void BenchmarkRecord<PayloadSize>::Shift (std::size_t _recordCount, BenchmarkRandom &_random) noexcept
+{
+    const std::uint32_t random = _random.Next ();
+    key = static_cast<std::int32_t> (random % static_cast<std::uint32_t> (_recordCount / 8u + 1u));
+
+    constexpr std::uint32_t POSITIONS = static_cast<std::uint32_t> (BENCHMARK_WORLD_SIZE - BENCHMARK_RECORD_SIZE);
+    minX = static_cast<float> (random % POSITIONS);
+    minY = static_cast<float> ((random >> 12u) % POSITIONS);
+    maxX = minX + BENCHMARK_RECORD_SIZE;
+    maxY = minY + BENCHMARK_RECORD_SIZE;
+}
+
+/// \brief Edits every record, that is returned by given edit cursor, so it is reindexed by every index.
+/// \return Count of edited records.
+template <typename Record, typename Cursor>
+std::size_t ShiftAll (Cursor _cursor, std::size_t _recordCount, BenchmarkRandom &_random) noexcept
+{
+    std::size_t edited = 0u;
+    while (auto *record = static_cast<Record *> (*_cursor))
+    {
+        record->Shift (_recordCount, _random);
+        ++_cursor;
+        ++edited;
+    }
+
+    return edited;
+}
+
+/// \brief Deletes every record, that is returned by given edit cursor.
+/// \return Count of deleted records.
+template <typename Cursor>
+std::size_t DeleteAll (Cursor _cursor) noexcept
+{
+    std::size_t deleted = 0u;
+    while (*_cursor)
+    {
+        ~_cursor;
+        ++deleted;
+    }
+
+    return deleted;
+}
+} // namespace Emergence::Testing
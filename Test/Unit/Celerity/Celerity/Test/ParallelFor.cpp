@@ -0,0 +1,238 @@
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include <Celerity/ParallelFor.hpp>
+#include <Celerity/Query/FetchAscendingRangeQuery.hpp>
+#include <Celerity/Query/FetchSequenceQuery.hpp>
+#include <Celerity/Query/ModifySequenceQuery.hpp>
+
+#include <Job/Dispatcher.hpp>
+
+#include <Memory/Profiler/Test/DefaultAllocationGroupStub.hpp>
+
+#include <StandardLayout/MappingRegistration.hpp>
+
+#include <Testing/Testing.hpp>
+
+#include <Warehouse/InsertLongTermQuery.hpp>
+#include <Warehouse/InsertShortTermQuery.hpp>
+#include <Warehouse/Registry.hpp>
+
+namespace Emergence::Celerity::Test
+{
+using namespace Emergence::Memory::Literals;
+
+struct CounterRecord final
+{
+    std::uint32_t key = 0u;
+    std::uint32_t value = 0u;
+
+    struct Reflection final
+    {
+        StandardLayout::FieldId key;
+        StandardLayout::FieldId value;
+        StandardLayout::Mapping mapping;
+    };
+
+    static const Reflection &Reflect () noexcept;
+};
+
+const CounterRecord::Reflection &CounterRecord::Reflect () noexcept
+{
+    static const Reflection reflection = [] ()
+    {
+        EMERGENCE_MAPPING_REGISTRATION_BEGIN (CounterRecord);
+        EMERGENCE_MAPPING_REGISTER_REGULAR (key);
+        EMERGENCE_MAPPING_REGISTER_REGULAR (value);
+        EMERGENCE_MAPPING_REGISTRATION_END ();
+    }();
+
+    return reflection;
+}
+
+constexpr std::uint32_t RECORD_COUNT = 10000u;
+
+constexpr std::size_t MAX_CHUNK_COUNT = 16u;
+
+constexpr std::size_t MINIMUM_CHUNK_SIZE = 64u;
+
+static void InsertShortTerm (Warehouse::Registry &_registry) noexcept
+{
+    auto cursor = _registry.InsertShortTerm (CounterRecord::Reflect ().mapping).Execute ();
+    for (std::uint32_t index = 0u; index < RECORD_COUNT; ++index)
+    {
+        *static_cast<CounterRecord *> (++cursor) = {index, index};
+    }
+}
+
+static void InsertLongTerm (Warehouse::Registry &_registry) noexcept
+{
+    auto cursor = _registry.InsertLongTerm (CounterRecord::Reflect ().mapping).Execute ();
+    for (std::uint32_t index = 0u; index < RECORD_COUNT; ++index)
+    {
+        *static_cast<CounterRecord *> (++cursor) = {index, index};
+    }
+}
+
+/// \brief Sum of values from 0 to RECORD_COUNT - 1.
+constexpr std::uint64_t EXPECTED_SUM = static_cast<std::uint64_t> (RECORD_COUNT) * (RECORD_COUNT - 1u) / 2u;
+} // namespace Emergence::Celerity::Test
+
+using namespace Emergence::Celerity;
+using namespace Emergence::Celerity::Test;
+
+BEGIN_SUITE (ParallelFor)
+
+TEST_CASE (FetchSequence)
+{
+    Emergence::Warehouse::Registry registry {"ParallelForTest"_us};
+    FetchSequenceQuery fetch = registry.FetchSequence (CounterRecord::Reflect ().mapping);
+    InsertShortTerm (registry);
+
+    auto partition = fetch.ExecutePartitioned (MAX_CHUNK_COUNT, MINIMUM_CHUNK_SIZE);
+    CHECK_EQUAL (partition.GetObjectCount (), RECORD_COUNT);
+    CHECK (partition.GetChunkCount () <= MAX_CHUNK_COUNT);
+
+    std::atomic_uint64_t sum = 0u;
+    std::atomic_size_t visited = 0u;
+
+    ParallelFor (partition,
+                 [&sum, &visited] (auto _chunk)
+                 {
+                     std::uint64_t chunkSum = 0u;
+                     for (const void *object : _chunk)
+                     {
+                         chunkSum += static_cast<const CounterRecord *> (object)->value;
+                     }
+
+                     sum += chunkSum;
+                     visited += _chunk.GetSize ();
+                 });
+
+    CHECK_EQUAL (sum.load (), EXPECTED_SUM);
+    CHECK_EQUAL (visited.load (), RECORD_COUNT);
+}
+
+TEST_CASE (ModifySequence)
+{
+    Emergence::Warehouse::Registry registry {"ParallelForTest"_us};
+    FetchSequenceQuery fetch = registry.FetchSequence (CounterRecord::Reflect ().mapping);
+    ModifySequenceQuery modify = registry.ModifySequence (CounterRecord::Reflect ().mapping);
+    InsertShortTerm (registry);
+
+    {
+        auto partition = modify.ExecutePartitioned (MAX_CHUNK_COUNT, MINIMUM_CHUNK_SIZE);
+        ParallelFor (partition,
+                     [] (auto _chunk)
+                     {
+                         for (void *object : _chunk)
+                         {
+                             auto *record = static_cast<CounterRecord *> (object);
+                             record->value = record->key * 2u;
+                         }
+                     });
+    }
+
+    std::size_t checked = 0u;
+    for (auto cursor = fetch.Execute (); const auto *record = static_cast<const CounterRecord *> (*cursor); ++cursor)
+    {
+        CHECK_EQUAL (record->value, record->key * 2u);
+        ++checked;
+    }
+
+    CHECK_EQUAL (checked, RECORD_COUNT);
+}
+
+TEST_CASE (FetchAscendingRangeKeepsOrder)
+{
+    Emergence::Warehouse::Registry registry {"ParallelForTest"_us};
+    FetchAscendingRangeQuery fetch =
+        registry.FetchAscendingRange (CounterRecord::Reflect ().mapping, CounterRecord::Reflect ().key);
+    InsertLongTerm (registry);
+
+    const std::uint32_t min = 1000u;
+    const std::uint32_t max = 8999u;
+    auto partition = fetch.ExecutePartitioned (MAX_CHUNK_COUNT, MINIMUM_CHUNK_SIZE, &min, &max);
+    REQUIRE (partition.GetChunkCount () > 1u);
+
+    std::uint32_t expectedKey = min;
+    for (std::size_t chunkIndex = 0u; chunkIndex < partition.GetChunkCount (); ++chunkIndex)
+    {
+        for (const void *object : partition.GetChunk (chunkIndex))
+        {
+            CHECK_EQUAL (static_cast<const CounterRecord *> (object)->key, expectedKey);
+            ++expectedKey;
+        }
+    }
+
+    CHECK_EQUAL (expectedKey, max + 1u);
+}
+
+TEST_CASE (SmallResultIsNotSplit)
+{
+    Emergence::Warehouse::Registry registry {"ParallelForTest"_us};
+    FetchAscendingRangeQuery fetch =
+        registry.FetchAscendingRange (CounterRecord::Reflect ().mapping, CounterRecord::Reflect ().key);
+    InsertLongTerm (registry);
+
+    const std::uint32_t min = 100u;
+    const std::uint32_t max = 109u;
+    auto partition = fetch.ExecutePartitioned (MAX_CHUNK_COUNT, MINIMUM_CHUNK_SIZE, &min, &max);
+    CHECK_EQUAL (partition.GetChunkCount (), 1u);
+    CHECK_EQUAL (partition.GetChunk (0u).GetSize (), 10u);
+
+    const std::uint32_t emptyMin = RECORD_COUNT;
+    auto emptyPartition = fetch.ExecutePartitioned (MAX_CHUNK_COUNT, MINIMUM_CHUNK_SIZE, &emptyMin, nullptr);
+    CHECK_EQUAL (emptyPartition.GetChunkCount (), 0u);
+
+    bool called = false;
+    ParallelFor (emptyPartition,
+                 [&called] (auto /*unused*/)
+                 {
+                     called = true;
+                 });
+
+    CHECK (!called);
+}
+
+TEST_CASE (CalledFromJobOfSingleThreadDispatcher)
+{
+    Emergence::Warehouse::Registry registry {"ParallelForTest"_us};
+    FetchSequenceQuery fetch = registry.FetchSequence (CounterRecord::Reflect ().mapping);
+    InsertShortTerm (registry);
+
+    auto partition = fetch.ExecutePartitioned (MAX_CHUNK_COUNT, MINIMUM_CHUNK_SIZE);
+    REQUIRE (partition.GetChunkCount () > 1u);
+
+    // Calling job occupies the only dispatcher thread, therefore dispatched chunk jobs
+    // can only start after ParallelFor returns and calling thread must process everything.
+    Emergence::Job::Dispatcher dispatcher {1u};
+    std::uint64_t sum = 0u;
+    std::atomic_flag finished;
+
+    dispatcher.Dispatch (Emergence::Job::Priority::FOREGROUND,
+                         [&dispatcher, &partition, &sum, &finished] ()
+                         {
+                             ParallelFor (dispatcher,
+                                          partition,
+                                          [&sum] (auto _chunk)
+                                          {
+                                              for (const void *object : _chunk)
+                                              {
+                                                  sum += static_cast<const CounterRecord *> (object)->value;
+                                              }
+                                          });
+
+                             finished.test_and_set (std::memory_order_release);
+                         });
+
+    while (!finished.test (std::memory_order_acquire))
+    {
+        std::this_thread::yield ();
+    }
+
+    CHECK_EQUAL (sum, EXPECTED_SUM);
+}
+
+END_SUITE
@@ -0,0 +1,186 @@
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <tuple>
+#include <vector>
+
+#include <Celerity/Render/2d/Test/HeadlessWorld.hpp>
+
+#include <Render/Backend/Null/Statistics.hpp>
+
+#include <Testing/Testing.hpp>
+
+namespace Emergence::Celerity::Test
+{
+/// \brief Layers are chosen so that batch keys differ in several radix digits, including the highest one.
+static const std::uint16_t LAYERS[] = {300u, 0u, 2u, 256u, 1u};
+
+static constexpr std::size_t LAYER_COUNT = sizeof (LAYERS) / sizeof (LAYERS[0u]);
+
+/// \brief Places sprites with given indices on grid, that is fully visible through headless world camera.
+static Math::Transform2d GetGridTransform (std::size_t _index, std::size_t _gridSide) noexcept
+{
+    const float step = 80.0f / static_cast<float> (_gridSide);
+    return {{-40.0f + step * static_cast<float> (_index % _gridSide),
+             -40.0f + step * static_cast<float> (_index / _gridSide)},
+            0.0f,
+            {1.0f, 1.0f}};
+}
+
+/// \brief Creates sprites on grid with layers and material instances chosen by round-robin with different periods,
+///        so sprite table order has nothing in common with batch order.
+static std::vector<UniqueId> CreateMixedSprites (HeadlessWorld &_world, std::size_t _count)
+{
+    std::vector<UniqueId> spriteIds;
+    _world.Update (
+        [&spriteIds, _count] (SceneEditor &_editor)
+        {
+            for (std::size_t index = 0u; index < _count; ++index)
+            {
+                const UniqueId objectId = index + 1u;
+                _editor.CreateTransform (objectId, INVALID_UNIQUE_ID, GetGridTransform (index, 16u));
+                spriteIds.emplace_back (_editor.CreateSprite (objectId,
+                                                              GetMaterialInstanceId (index % MATERIAL_INSTANCE_COUNT),
+                                                              LAYERS[index % LAYER_COUNT], {0.4f, 0.4f}));
+            }
+        });
+
+    return spriteIds;
+}
+
+/// \brief Checks that batches contain all dynamic sprites except given invisible ones, ordered by layer and then
+///        by material instance, and that sprites inside every batch are listed in sprite table order.
+static void CheckBatchesMatchSpriteTable (const BatchingSnapshot &_snapshot,
+                                          const std::vector<UniqueId> &_invisibleSprites = {})
+{
+    // Material instances are ordered inside layer in the same way as in Batching2dSingleton::GetBatch.
+    using Key = std::tuple<std::uint16_t, const char *>;
+    std::map<Key, std::vector<std::size_t>> expectedBatches;
+
+    for (std::size_t spriteIndex = 0u; spriteIndex < _snapshot.sprites.size (); ++spriteIndex)
+    {
+        const Sprite2dRenderData &sprite = _snapshot.sprites[spriteIndex];
+        if (std::find (_invisibleSprites.begin (), _invisibleSprites.end (), sprite.spriteId) ==
+            _invisibleSprites.end ())
+        {
+            expectedBatches[Key {sprite.layer, *sprite.materialInstanceId}].emplace_back (spriteIndex);
+        }
+    }
+
+    REQUIRE_EQUAL (_snapshot.batches.size (), expectedBatches.size ());
+    auto expectedIterator = expectedBatches.begin ();
+
+    for (const Batch2d &batch : _snapshot.batches)
+    {
+        const auto &[expectedKey, expectedIndices] = *expectedIterator;
+        CHECK_EQUAL (batch.layer, std::get<0u> (expectedKey));
+        CHECK_EQUAL (*batch.materialInstanceId, std::get<1u> (expectedKey));
+        CHECK (batch.staticGeometryIndices.empty ());
+
+        REQUIRE_EQUAL (batch.spriteIndices.size (), expectedIndices.size ());
+        for (std::size_t index = 0u; index < expectedIndices.size (); ++index)
+        {
+            CHECK_EQUAL (batch.spriteIndices[index], expectedIndices[index]);
+        }
+
+        ++expectedIterator;
+    }
+}
+} // namespace Emergence::Celerity::Test
+
+using namespace Emergence::Celerity;
+using namespace Emergence::Celerity::Test;
+
+BEGIN_SUITE (Batching2d)
+
+TEST_CASE (BatchesAreOrderedByLayerAndMaterialInstance)
+{
+    HeadlessWorld world;
+    const std::vector<UniqueId> spriteIds = CreateMixedSprites (world, 60u);
+
+    CHECK_EQUAL (world.GetSnapshot ().sprites.size (), spriteIds.size ());
+    CHECK_EQUAL (world.GetSnapshot ().batches.size (), LAYER_COUNT * MATERIAL_INSTANCE_COUNT);
+    CheckBatchesMatchSpriteTable (world.GetSnapshot ());
+}
+
+TEST_CASE (BatchesFollowSpriteTableOrderAfterRemoval)
+{
+    HeadlessWorld world;
+    const std::vector<UniqueId> spriteIds = CreateMixedSprites (world, 60u);
+
+    // Removed sprites are replaced by sprites from the end of the table, so batches must follow new table order.
+    world.Update (
+        [&spriteIds] (SceneEditor &_editor)
+        {
+            for (std::size_t index = 0u; index < spriteIds.size (); index += 7u)
+            {
+                _editor.RemoveSprite (spriteIds[index]);
+            }
+        });
+
+    world.Update ();
+    CHECK_EQUAL (world.GetSnapshot ().sprites.size (), spriteIds.size () - (spriteIds.size () + 6u) / 7u);
+    CheckBatchesMatchSpriteTable (world.GetSnapshot ());
+}
+
+TEST_CASE (InvisibleSpritesAreNotBatched)
+{
+    HeadlessWorld world;
+    CreateMixedSprites (world, 20u);
+
+    std::vector<UniqueId> invisibleSprites;
+    world.Update (
+        [&invisibleSprites] (SceneEditor &_editor)
+        {
+            constexpr UniqueId OUT_OF_CAMERA_OBJECT_ID = 1000u;
+            _editor.CreateTransform (OUT_OF_CAMERA_OBJECT_ID, INVALID_UNIQUE_ID,
+                                     {{500.0f, 500.0f}, 0.0f, {1.0f, 1.0f}});
+            invisibleSprites.emplace_back (
+                _editor.CreateSprite (OUT_OF_CAMERA_OBJECT_ID, GetMaterialInstanceId (0u), LAYERS[0u]));
+
+            constexpr UniqueId MASKED_OBJECT_ID = 1001u;
+            _editor.CreateTransform (MASKED_OBJECT_ID, INVALID_UNIQUE_ID, {});
+            invisibleSprites.emplace_back (
+                _editor.CreateSprite (MASKED_OBJECT_ID, GetMaterialInstanceId (1u), LAYERS[1u]));
+
+            _editor.EditSprite (invisibleSprites.back (),
+                                [] (Sprite2dComponent &_sprite)
+                                {
+                                    _sprite.visibilityMask = 0u;
+                                });
+        });
+
+    world.Update ();
+    CHECK_EQUAL (world.GetSnapshot ().sprites.size (), 22u);
+    CheckBatchesMatchSpriteTable (world.GetSnapshot (), invisibleSprites);
+}
+
+TEST_CASE (GeometryIsGeneratedInMultipleChunks)
+{
+    // Geometry is generated in chunks of 2048 sprites, therefore this batch is split between several jobs.
+    constexpr std::size_t SPRITE_COUNT = 5000u;
+    constexpr std::size_t GRID_SIDE = 80u;
+
+    HeadlessWorld world;
+    world.Update (
+        [] (SceneEditor &_editor)
+        {
+            for (std::size_t index = 0u; index < SPRITE_COUNT; ++index)
+            {
+                const UniqueId objectId = index + 1u;
+                _editor.CreateTransform (objectId, INVALID_UNIQUE_ID, GetGridTransform (index, GRID_SIDE));
+                _editor.CreateSprite (objectId, GetMaterialInstanceId (0u), 0u, {0.4f, 0.4f});
+            }
+        });
+
+    world.Update ();
+    REQUIRE_EQUAL (world.GetSnapshot ().batches.size (), 1u);
+    CHECK_EQUAL (world.GetSnapshot ().batches.front ().spriteIndices.size (), SPRITE_COUNT);
+
+    const Emergence::Render::Backend::Null::FrameStatistics &statistics =
+        Emergence::Render::Backend::Null::GetLastFrameStatistics ();
+    CHECK_EQUAL (statistics.submittedVertices, SPRITE_COUNT * 4u);
+    CHECK_EQUAL (statistics.submittedIndices, SPRITE_COUNT * 6u);
+}
+
+END_SUITE
@@ -0,0 +1,468 @@
+#include <Celerity/Asset/AssetManagement.hpp>
+#include <Celerity/Asset/AssetManagerSingleton.hpp>
+#include <Celerity/Asset/Events.hpp>
+#include <Celerity/Asset/Render/2d/Sprite2dUvAnimation.hpp>
+#include <Celerity/Asset/Render/2d/Sprite2dUvAnimationManagement.hpp>
+#include <Celerity/Asset/Render/Foundation/FrameBufferManagement.hpp>
+#include <Celerity/Asset/Render/Foundation/Material.hpp>
+#include <Celerity/Asset/Render/Foundation/MaterialInstance.hpp>
+#include <Celerity/Asset/Render/Foundation/MaterialInstanceManagement.hpp>
+#include <Celerity/Asset/Render/Foundation/MaterialManagement.hpp>
+#include <Celerity/Asset/Render/Foundation/Texture.hpp>
+#include <Celerity/Asset/Render/Foundation/TextureManagement.hpp>
+#include <Celerity/Event/EventRegistrar.hpp>
+#include <Celerity/PipelineBuilderMacros.hpp>
+#include <Celerity/Render/2d/AssetUsage.hpp>
+#include <Celerity/Render/2d/Camera2dComponent.hpp>
+#include <Celerity/Render/2d/Events.hpp>
+#include <Celerity/Render/2d/Render2dSingleton.hpp>
+#include <Celerity/Render/2d/Rendering2d.hpp>
+#include <Celerity/Render/2d/Sprite2dUvAnimation.hpp>
+#include <Celerity/Render/2d/Sprite2dUvAnimationComponent.hpp>
+#include <Celerity/Render/2d/Test/HeadlessWorld.hpp>
+#include <Celerity/Render/2d/World2dRenderPass.hpp>
+#include <Celerity/Render/Foundation/AssetUsage.hpp>
+#include <Celerity/Render/Foundation/Events.hpp>
+#include <Celerity/Render/Foundation/Material.hpp>
+#include <Celerity/Render/Foundation/MaterialInstance.hpp>
+#include <Celerity/Render/Foundation/PostProcess.hpp>
+#include <Celerity/Render/Foundation/RenderPipelineFoundation.hpp>
+#include <Celerity/Render/Foundation/Viewport.hpp>
+#include <Celerity/Transform/Events.hpp>
+#include <Celerity/Transform/TransformComponent.hpp>
+#include <Celerity/Transform/TransformHierarchyCleanup.hpp>
+#include <Celerity/Transform/TransformVisualSync.hpp>
+#include <Celerity/Transform/TransformWorldPropagation.hpp>
+
+#include <Container/StringBuilder.hpp>
+
+#include <Log/Log.hpp>
+
+#include <Render/Backend/Configuration.hpp>
+
+namespace Emergence::Celerity::Test
+{
+using namespace Memory::Literals;
+
+static constexpr UniqueId CAMERA_OBJECT_ID = 0u;
+
+static constexpr std::uint32_t VIEWPORT_WIDTH = 400u;
+
+static constexpr std::uint32_t VIEWPORT_HEIGHT = 300u;
+
+/// \brief With this size camera sees [-66, 66] x [-50, 50] rect around the origin.
+static constexpr float CAMERA_HALF_ORTHOGRAPHIC_SIZE = 50.0f;
+
+/// \brief Null backend never parses shaders, but still requires them to be non-empty.
+static const std::uint8_t DUMMY_SHADER[] = {0u};
+
+static const Memory::UniqueString MATERIAL_ID {"HeadlessMaterial"};
+
+static const Memory::UniqueString VIEWPORT_NAME {"HeadlessViewport"};
+
+/// \brief Animation asset is ready, but has no frames, therefore animations never change sprites.
+static const Memory::UniqueString UV_ANIMATION_ID {"HeadlessUvAnimation"};
+
+Memory::UniqueString GetMaterialInstanceId (std::size_t _index) noexcept
+{
+    return Memory::UniqueString {EMERGENCE_BUILD_STRING ("HeadlessMaterialInstance", _index)};
+}
+
+SceneEditor::SceneEditor (TaskConstructor &_constructor) noexcept
+    : fetchRender (FETCH_SINGLETON (Render2dSingleton)),
+      modifyAssetManager (MODIFY_SINGLETON (AssetManagerSingleton)),
+
+      insertMaterial (INSERT_LONG_TERM (Material)),
+      insertMaterialInstance (INSERT_LONG_TERM (MaterialInstance)),
+      insertViewport (INSERT_LONG_TERM (Viewport)),
+      insertWorldPass (INSERT_LONG_TERM (World2dRenderPass)),
+      insertCamera (INSERT_LONG_TERM (Camera2dComponent)),
+
+      insertTransform (INSERT_LONG_TERM (Transform2dComponent)),
+      modifyTransformById (MODIFY_VALUE_1F (Transform2dComponent, objectId)),
+
+      insertSprite (INSERT_LONG_TERM (Sprite2dComponent)),
+      modifySpriteBySpriteId (MODIFY_VALUE_1F (Sprite2dComponent, spriteId)),
+
+      insertUvAnimation (INSERT_LONG_TERM (Sprite2dUvAnimationComponent)),
+      modifyUvAnimationBySpriteId (MODIFY_VALUE_1F (Sprite2dUvAnimationComponent, spriteId)),
+
+      manualAssetConstructor (_constructor)
+{
+}
+
+void SceneEditor::CreateTransform (UniqueId _objectId,
+                                   UniqueId _parentId,
+                                   const Math::Transform2d &_localTransform) noexcept
+{
+    auto cursor = insertTransform.Execute ();
+    auto *transform = static_cast<Transform2dComponent *> (++cursor);
+    transform->SetObjectId (_objectId);
+    transform->SetParentObjectId (_parentId);
+    transform->SetVisualLocalTransform (_localTransform);
+}
+
+void SceneEditor::SetLocalTransform (UniqueId _objectId, const Math::Transform2d &_localTransform) noexcept
+{
+    auto cursor = modifyTransformById.Execute (&_objectId);
+    if (auto *transform = static_cast<Transform2dComponent *> (*cursor))
+    {
+        transform->SetVisualLocalTransform (_localTransform);
+    }
+}
+
+void SceneEditor::SetParent (UniqueId _objectId, UniqueId _parentId) noexcept
+{
+    auto cursor = modifyTransformById.Execute (&_objectId);
+    if (auto *transform = static_cast<Transform2dComponent *> (*cursor))
+    {
+        transform->SetParentObjectId (_parentId);
+    }
+}
+
+void SceneEditor::RemoveTransform (UniqueId _objectId) noexcept
+{
+    auto cursor = modifyTransformById.Execute (&_objectId);
+    if (*cursor)
+    {
+        ~cursor;
+    }
+}
+
+UniqueId SceneEditor::CreateSprite (UniqueId _objectId,
+                                    Memory::UniqueString _materialInstanceId,
+                                    std::uint16_t _layer,
+                                    const Math::Vector2f &_halfSize) noexcept
+{
+    auto renderCursor = fetchRender.Execute ();
+    const auto *render = static_cast<const Render2dSingleton *> (*renderCursor);
+
+    auto cursor = insertSprite.Execute ();
+    auto *sprite = static_cast<Sprite2dComponent *> (++cursor);
+    sprite->objectId = _objectId;
+    sprite->spriteId = render->GenerateSprite2dId ();
+    sprite->materialInstanceId = _materialInstanceId;
+    sprite->layer = _layer;
+    sprite->halfSize = _halfSize;
+    return sprite->spriteId;
+}
+
+void SceneEditor::RemoveSprite (UniqueId _spriteId) noexcept
+{
+    auto cursor = modifySpriteBySpriteId.Execute (&_spriteId);
+    if (*cursor)
+    {
+        ~cursor;
+    }
+}
+
+void SceneEditor::AddUvAnimation (UniqueId _objectId, UniqueId _spriteId) noexcept
+{
+    auto cursor = insertUvAnimation.Execute ();
+    auto *animation = static_cast<Sprite2dUvAnimationComponent *> (++cursor);
+    animation->objectId = _objectId;
+    animation->spriteId = _spriteId;
+    animation->animationId = UV_ANIMATION_ID;
+}
+
+void SceneEditor::RemoveUvAnimation (UniqueId _spriteId) noexcept
+{
+    auto cursor = modifyUvAnimationBySpriteId.Execute (&_spriteId);
+    if (*cursor)
+    {
+        ~cursor;
+    }
+}
+
+void SceneEditor::CreateEnvironment () noexcept
+{
+    // Material instances are not used until test creates sprites, therefore they must not be cleaned up.
+    {
+        auto assetManagerCursor = modifyAssetManager.Execute ();
+        static_cast<AssetManagerSingleton *> (*assetManagerCursor)->automaticallyCleanUnusedAssets = false;
+    }
+
+    // Materials are constructed manually, so tests do not depend on shader compilation and resources.
+    manualAssetConstructor.ConstructManualAsset (MATERIAL_ID, Material::Reflect ().mapping);
+    auto materialCursor = insertMaterial.Execute ();
+    auto *material = static_cast<Material *> (++materialCursor);
+    material->assetId = MATERIAL_ID;
+    material->program = Render::Backend::Program {DUMMY_SHADER, sizeof (DUMMY_SHADER), DUMMY_SHADER,
+                                                  sizeof (DUMMY_SHADER)};
+
+    auto materialInstanceCursor = insertMaterialInstance.Execute ();
+    for (std::size_t index = 0u; index < MATERIAL_INSTANCE_COUNT; ++index)
+    {
+        const Memory::UniqueString materialInstanceId = GetMaterialInstanceId (index);
+        manualAssetConstructor.ConstructManualAsset (materialInstanceId, MaterialInstance::Reflect ().mapping);
+
+        auto *materialInstance = static_cast<MaterialInstance *> (++materialInstanceCursor);
+        materialInstance->assetId = materialInstanceId;
+        materialInstance->materialId = MATERIAL_ID;
+    }
+
+    manualAssetConstructor.ConstructManualAsset (UV_ANIMATION_ID, Sprite2dUvAnimation::Reflect ().mapping);
+
+    auto viewportCursor = insertViewport.Execute ();
+    auto *viewport = static_cast<Viewport *> (++viewportCursor);
+    viewport->name = VIEWPORT_NAME;
+    viewport->width = VIEWPORT_WIDTH;
+    viewport->height = VIEWPORT_HEIGHT;
+
+    auto passCursor = insertWorldPass.Execute ();
+    auto *pass = static_cast<World2dRenderPass *> (++passCursor);
+    pass->name = VIEWPORT_NAME;
+    pass->cameraObjectId = CAMERA_OBJECT_ID;
+
+    CreateTransform (CAMERA_OBJECT_ID, INVALID_UNIQUE_ID, {});
+    auto cameraCursor = insertCamera.Execute ();
+    auto *camera = static_cast<Camera2dComponent *> (++cameraCursor);
+    camera->objectId = CAMERA_OBJECT_ID;
+    camera->halfOrthographicSize = CAMERA_HALF_ORTHOGRAPHIC_SIZE;
+}
+
+/// \brief Creates environment during first frame and applies scene edits, requested by test, after that.
+class SceneExecutor final : public TaskExecutorBase<SceneExecutor>
+{
+public:
+    SceneExecutor (TaskConstructor &_constructor, SceneEdit *_pendingEdit) noexcept;
+
+    void Execute () noexcept;
+
+private:
+    SceneEditor editor;
+    SceneEdit *pendingEdit = nullptr;
+    bool environmentCreated = false;
+};
+
+SceneExecutor::SceneExecutor (TaskConstructor &_constructor, SceneEdit *_pendingEdit) noexcept
+    : TaskExecutorBase (_constructor),
+      editor (_constructor),
+      pendingEdit (_pendingEdit)
+{
+    _constructor.DependOn (AssetManagement::Checkpoint::FINISHED);
+    _constructor.DependOn (TransformHierarchyCleanup::Checkpoint::FINISHED);
+    _constructor.MakeDependencyOf (RenderPipelineFoundation::Checkpoint::RENDER_STARTED);
+    _constructor.MakeDependencyOf (TransformVisualSync::Checkpoint::STARTED);
+}
+
+void SceneExecutor::Execute () noexcept
+{
+    if (!environmentCreated)
+    {
+        editor.CreateEnvironment ();
+        environmentCreated = true;
+    }
+
+    if (*pendingEdit)
+    {
+        (*pendingEdit) (editor);
+        *pendingEdit = {};
+    }
+}
+
+// Batching checkpoints are private to render logic, therefore we refer to them by name.
+static const Memory::UniqueString BATCHING_FINISHED {"Batching2d::Finished"};
+static const Memory::UniqueString WORLD_RENDERING_STARTED {"WorldRendering2d::Started"};
+
+/// \brief Copies sprite table and batches between batching and rendering, because renderer resets batches.
+class BatchingInspector final : public TaskExecutorBase<BatchingInspector>
+{
+public:
+    BatchingInspector (TaskConstructor &_constructor, BatchingSnapshot *_snapshot) noexcept;
+
+    void Execute () noexcept;
+
+private:
+    FetchSingletonQuery fetchBatching;
+    BatchingSnapshot *snapshot = nullptr;
+};
+
+BatchingInspector::BatchingInspector (TaskConstructor &_constructor, BatchingSnapshot *_snapshot) noexcept
+    : TaskExecutorBase (_constructor),
+      fetchBatching (FETCH_SINGLETON (Batching2dSingleton)),
+      snapshot (_snapshot)
+{
+    _constructor.DependOn (BATCHING_FINISHED);
+    _constructor.MakeDependencyOf (WORLD_RENDERING_STARTED);
+}
+
+void BatchingInspector::Execute () noexcept
+{
+    auto batchingCursor = fetchBatching.Execute ();
+    const auto *batching = static_cast<const Batching2dSingleton *> (*batchingCursor);
+
+    snapshot->sprites = batching->sprites;
+    snapshot->spriteLocations = batching->spriteLocations;
+    snapshot->batches.clear ();
+
+    if (!batching->viewports.empty ())
+    {
+        snapshot->batches = batching->viewports.front ().batches;
+    }
+}
+
+/// \brief Copies static geometries after rendering, so dirty geometries are already rebuilt.
+class StaticGeometryInspector final : public TaskExecutorBase<StaticGeometryInspector>
+{
+public:
+    StaticGeometryInspector (TaskConstructor &_constructor, BatchingSnapshot *_snapshot) noexcept;
+
+    void Execute () noexcept;
+
+private:
+    FetchSingletonQuery fetchBatching;
+    BatchingSnapshot *snapshot = nullptr;
+};
+
+StaticGeometryInspector::StaticGeometryInspector (TaskConstructor &_constructor, BatchingSnapshot *_snapshot) noexcept
+    : TaskExecutorBase (_constructor),
+      fetchBatching (FETCH_SINGLETON (Batching2dSingleton)),
+      snapshot (_snapshot)
+{
+    _constructor.DependOn (RenderPipelineFoundation::Checkpoint::RENDER_FINISHED);
+}
+
+void StaticGeometryInspector::Execute () noexcept
+{
+    auto batchingCursor = fetchBatching.Execute ();
+    const auto *batching = static_cast<const Batching2dSingleton *> (*batchingCursor);
+
+    snapshot->staticGeometry.clear ();
+    for (const StaticGeometry2d &geometry : batching->staticGeometry)
+    {
+        snapshot->staticGeometry.emplace_back (StaticGeometrySnapshot {
+            geometry.key, geometry.globalBounds, geometry.sprites, geometry.dirty,
+            geometry.vertices.IsValid () && geometry.indices.IsValid ()});
+    }
+
+    snapshot->staticGeometryKeyCount = batching->staticGeometryByKey.size ();
+}
+
+static Container::MappingRegistry GetResourceTypes () noexcept
+{
+    Container::MappingRegistry registry;
+    registry.Register (MaterialAsset::Reflect ().mapping);
+    registry.Register (MaterialInstanceAsset::Reflect ().mapping);
+    registry.Register (Sprite2dUvAnimationAsset::Reflect ().mapping);
+    registry.Register (TextureAsset::Reflect ().mapping);
+    return registry;
+}
+
+/// \brief Initializes null render backend once per test executable, because backends do not support reinit.
+static void EnsureRenderBackendInitialized () noexcept
+{
+    static const bool initialized = [] ()
+    {
+        Render::Backend::Config config;
+        config.width = VIEWPORT_WIDTH;
+        config.height = VIEWPORT_HEIGHT;
+        return Render::Backend::Init (config, nullptr, nullptr, false);
+    }();
+
+    if (!initialized)
+    {
+        EMERGENCE_LOG (ERROR, "CelerityRender2dHeadlessTests: Unable to initialize render backend.");
+    }
+}
+
+HeadlessWorld::HeadlessWorld () noexcept
+    : resourceProvider (&virtualFileSystem, GetResourceTypes (), {}),
+      world ("HeadlessWorld"_us, {{1.0f / 60.0f}})
+{
+    EnsureRenderBackendInitialized ();
+    AssetReferenceBindingList binding {GetAssetBindingAllocationGroup ()};
+    GetRender2dAssetUsage (binding);
+    GetRenderFoundationAssetUsage (binding);
+    AssetReferenceBindingEventMap assetReferenceBindingEventMap;
+
+    {
+        EventRegistrar registrar {&world};
+        assetReferenceBindingEventMap = RegisterAssetEvents (registrar, binding);
+        RegisterTransform2dEvents (registrar);
+        RegisterTransformCommonEvents (registrar);
+        RegisterRender2dEvents (registrar);
+        RegisterRenderFoundationEvents (registrar);
+    }
+
+    static const Math::AxisAlignedBox2d worldBox {{-1000.0f, -1000.0f}, {1000.0f, 1000.0f}};
+    PipelineBuilder pipelineBuilder {world.GetRootView ()};
+
+    pipelineBuilder.Begin ("NormalUpdate"_us, PipelineType::NORMAL);
+    AssetManagement::AddToNormalUpdate (pipelineBuilder, binding, assetReferenceBindingEventMap);
+    FrameBufferManagement::AddToNormalUpdate (pipelineBuilder);
+    TransformHierarchyCleanup::Add2dToNormalUpdate (pipelineBuilder);
+    MaterialInstanceManagement::AddToNormalUpdate (pipelineBuilder, &resourceProvider, assetReferenceBindingEventMap);
+    MaterialManagement::AddToNormalUpdate (pipelineBuilder, &resourceProvider, assetReferenceBindingEventMap);
+    PostProcess::AddToNormalUpdate (pipelineBuilder);
+    RenderPipelineFoundation::AddToNormalUpdate (pipelineBuilder);
+    Rendering2d::AddToNormalUpdate (pipelineBuilder, worldBox);
+    Sprite2dUvAnimationManagement::AddToNormalUpdate (pipelineBuilder, &resourceProvider,
+                                                      assetReferenceBindingEventMap);
+    TextureManagement::AddToNormalUpdate (pipelineBuilder, &resourceProvider, assetReferenceBindingEventMap);
+    TransformVisualSync::Add2dToNormalUpdate (pipelineBuilder);
+    TransformWorldPropagation::Add2dToNormalUpdate (pipelineBuilder);
+    pipelineBuilder.AddCheckpointDependency (TransformWorldPropagation::Checkpoint::FINISHED,
+                                             RenderPipelineFoundation::Checkpoint::RENDER_STARTED);
+
+    pipelineBuilder.AddTask ("SceneExecutor"_us).SetExecutor<SceneExecutor> (&pendingEdit);
+    pipelineBuilder.AddTask ("BatchingInspector"_us).SetExecutor<BatchingInspector> (&snapshot);
+    pipelineBuilder.AddTask ("StaticGeometryInspector"_us).SetExecutor<StaticGeometryInspector> (&snapshot);
+
+    if (!pipelineBuilder.End ())
+    {
+        EMERGENCE_LOG (ERROR, "CelerityRender2dHeadlessTests: Unable to build pipeline.");
+        return;
+    }
+
+    // First frame creates environment, second one registers asset usages and third one finishes material loading.
+    Skip (3u);
+}
+
+void HeadlessWorld::Update (SceneEdit _edit) noexcept
+{
+    pendingEdit = std::move (_edit);
+    world.Update ();
+}
+
+void HeadlessWorld::Skip (std::size_t _frameCount) noexcept
+{
+    for (std::size_t frame = 0u; frame < _frameCount; ++frame)
+    {
+        world.Update ();
+    }
+}
+
+const BatchingSnapshot &HeadlessWorld::GetSnapshot () const noexcept
+{
+    return snapshot;
+}
+
+const Sprite2dLocation *HeadlessWorld::FindLocation (UniqueId _spriteId) const noexcept
+{
+    auto iterator = snapshot.spriteLocations.find (_spriteId);
+    return iterator != snapshot.spriteLocations.end () ? &iterator->second : nullptr;
+}
+
+const Sprite2dRenderData *HeadlessWorld::FindSprite (UniqueId _spriteId) const noexcept
+{
+    const Sprite2dLocation *location = FindLocation (_spriteId);
+    if (!location)
+    {
+        return nullptr;
+    }
+
+    if (location->staticGeometryIndex == Sprite2dLocation::DYNAMIC)
+    {
+        return location->spriteIndex < snapshot.sprites.size () ? &snapshot.sprites[location->spriteIndex] : nullptr;
+    }
+
+    if (location->staticGeometryIndex >= snapshot.staticGeometry.size ())
+    {
+        return nullptr;
+    }
+
+    const StaticGeometrySnapshot &geometry = snapshot.staticGeometry[location->staticGeometryIndex];
+    return location->spriteIndex < geometry.sprites.size () ? &geometry.sprites[location->spriteIndex] : nullptr;
+}
+} // namespace Emergence::Celerity::Test
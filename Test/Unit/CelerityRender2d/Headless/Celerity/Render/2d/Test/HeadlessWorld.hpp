@@ -0,0 +1,175 @@
+#pragma once
+
+#include <functional>
+
+#include <Celerity/Asset/ManualAssetConstructor.hpp>
+#include <Celerity/PipelineBuilder.hpp>
+#include <Celerity/Render/2d/Batching2dSingleton.hpp>
+#include <Celerity/Render/2d/Sprite2dComponent.hpp>
+#include <Celerity/Standard/UniqueId.hpp>
+#include <Celerity/World.hpp>
+
+#include <Container/HashMap.hpp>
+#include <Container/Vector.hpp>
+
+#include <Math/Transform2d.hpp>
+
+#include <Memory/Profiler/Test/DefaultAllocationGroupStub.hpp>
+
+#include <Resource/Provider/ResourceProvider.hpp>
+
+#include <VirtualFileSystem/Context.hpp>
+
+namespace Emergence::Celerity::Test
+{
+/// \brief Count of material instances, that are created for every headless world.
+constexpr std::size_t MATERIAL_INSTANCE_COUNT = 3u;
+
+/// \return Id of one of material instances, that are created for every headless world.
+Memory::UniqueString GetMaterialInstanceId (std::size_t _index) noexcept;
+
+/// \brief Applies scene changes, requested by test, from inside world pipeline.
+/// \details Objects with zero id are reserved by headless world for its camera.
+class SceneEditor final
+{
+public:
+    explicit SceneEditor (TaskConstructor &_constructor) noexcept;
+
+    SceneEditor (const SceneEditor &_other) = delete;
+
+    SceneEditor (SceneEditor &&_other) = delete;
+
+    ~SceneEditor () noexcept = default;
+
+    void CreateTransform (UniqueId _objectId, UniqueId _parentId, const Math::Transform2d &_localTransform) noexcept;
+
+    void SetLocalTransform (UniqueId _objectId, const Math::Transform2d &_localTransform) noexcept;
+
+    void SetParent (UniqueId _objectId, UniqueId _parentId) noexcept;
+
+    void RemoveTransform (UniqueId _objectId) noexcept;
+
+    /// \return Id of the new sprite.
+    UniqueId CreateSprite (UniqueId _objectId,
+                           Memory::UniqueString _materialInstanceId,
+                           std::uint16_t _layer,
+                           const Math::Vector2f &_halfSize = {0.5f, 0.5f}) noexcept;
+
+    /// \brief Calls `_functor (sprite)` for sprite with given id, so test can change any of its fields.
+    template <typename Functor>
+    void EditSprite (UniqueId _spriteId, Functor &&_functor) noexcept;
+
+    void RemoveSprite (UniqueId _spriteId) noexcept;
+
+    /// \brief Attaches uv animation, that waits for its animation asset forever, to given sprite.
+    void AddUvAnimation (UniqueId _objectId, UniqueId _spriteId) noexcept;
+
+    void RemoveUvAnimation (UniqueId _spriteId) noexcept;
+
+    EMERGENCE_DELETE_ASSIGNMENT (SceneEditor);
+
+private:
+    friend class SceneExecutor;
+
+    /// \brief Creates viewport, world render pass, camera and manual material instances.
+    void CreateEnvironment () noexcept;
+
+    FetchSingletonQuery fetchRender;
+    ModifySingletonQuery modifyAssetManager;
+
+    InsertLongTermQuery insertMaterial;
+    InsertLongTermQuery insertMaterialInstance;
+    InsertLongTermQuery insertViewport;
+    InsertLongTermQuery insertWorldPass;
+    InsertLongTermQuery insertCamera;
+
+    InsertLongTermQuery insertTransform;
+    ModifyValueQuery modifyTransformById;
+
+    InsertLongTermQuery insertSprite;
+    ModifyValueQuery modifySpriteBySpriteId;
+
+    InsertLongTermQuery insertUvAnimation;
+    ModifyValueQuery modifyUvAnimationBySpriteId;
+
+    ManualAssetConstructor manualAssetConstructor;
+};
+
+template <typename Functor>
+void SceneEditor::EditSprite (UniqueId _spriteId, Functor &&_functor) noexcept
+{
+    auto cursor = modifySpriteBySpriteId.Execute (&_spriteId);
+    if (auto *sprite = static_cast<Sprite2dComponent *> (*cursor))
+    {
+        _functor (*sprite);
+    }
+}
+
+/// \brief Function that changes scene before the next frame.
+using SceneEdit = std::function<void (SceneEditor &)>;
+
+/// \brief Copy of static geometry, made after rendering, so geometry is already rebuilt if it was dirty.
+struct StaticGeometrySnapshot final
+{
+    StaticGeometry2dKey key;
+    Math::AxisAlignedBox2d globalBounds {Math::Vector2f::ZERO, Math::Vector2f::ZERO};
+    Container::Vector<Sprite2dRenderData> sprites;
+    bool dirty = false;
+    bool buffersValid = false;
+};
+
+/// \brief Copy of Batching2dSingleton state, made during the last frame.
+struct BatchingSnapshot final
+{
+    /// \brief Dynamic sprite table after batching.
+    Container::Vector<Sprite2dRenderData> sprites;
+
+    Container::HashMap<UniqueId, Sprite2dLocation> spriteLocations;
+
+    /// \brief Batches of the only viewport after batching.
+    Container::Vector<Batch2d> batches;
+
+    Container::Vector<StaticGeometrySnapshot> staticGeometry;
+
+    std::size_t staticGeometryKeyCount = 0u;
+};
+
+/// \brief World with full 2d render pipeline on top of null render backend.
+/// \details Allows tests to change scene between frames and to check batching state after every frame.
+class HeadlessWorld final
+{
+public:
+    /// \brief Creates world and updates it until material instances are loaded.
+    HeadlessWorld () noexcept;
+
+    HeadlessWorld (const HeadlessWorld &_other) = delete;
+
+    HeadlessWorld (HeadlessWorld &&_other) = delete;
+
+    ~HeadlessWorld () noexcept = default;
+
+    /// \brief Applies given edit, if any, and updates world once.
+    void Update (SceneEdit _edit = {}) noexcept;
+
+    /// \brief Updates world given count of times without scene changes.
+    void Skip (std::size_t _frameCount) noexcept;
+
+    [[nodiscard]] const BatchingSnapshot &GetSnapshot () const noexcept;
+
+    /// \return Location of given sprite or `nullptr` if batching does not know about this sprite.
+    [[nodiscard]] const Sprite2dLocation *FindLocation (UniqueId _spriteId) const noexcept;
+
+    /// \return Data of given sprite from dynamic sprite table or static geometry or `nullptr` if there is no data.
+    [[nodiscard]] const Sprite2dRenderData *FindSprite (UniqueId _spriteId) const noexcept;
+
+    EMERGENCE_DELETE_ASSIGNMENT (HeadlessWorld);
+
+private:
+    VirtualFileSystem::Context virtualFileSystem;
+    Resource::Provider::ResourceProvider resourceProvider;
+    World world;
+
+    SceneEdit pendingEdit;
+    BatchingSnapshot snapshot;
+};
+} // namespace Emergence::Celerity::Test
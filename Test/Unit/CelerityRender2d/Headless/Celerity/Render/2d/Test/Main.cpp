@@ -0,0 +1 @@
+#include <Testing/SetupMain.hpp>
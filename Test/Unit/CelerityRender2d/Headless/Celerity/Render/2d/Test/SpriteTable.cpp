@@ -0,0 +1,180 @@
+#include <Celerity/Render/2d/Test/HeadlessWorld.hpp>
+
+#include <Testing/Testing.hpp>
+
+namespace Emergence::Celerity::Test
+{
+static constexpr UniqueId PARENT_OBJECT_ID = 1u;
+
+static constexpr UniqueId CHILD_OBJECT_ID = 2u;
+
+static constexpr UniqueId GRANDCHILD_OBJECT_ID = 3u;
+
+static void CheckBounds (const Math::AxisAlignedBox2d &_bounds,
+                         const Math::Vector2f &_expectedMin,
+                         const Math::Vector2f &_expectedMax)
+{
+    CHECK_EQUAL (_bounds.min.x, _expectedMin.x);
+    CHECK_EQUAL (_bounds.min.y, _expectedMin.y);
+    CHECK_EQUAL (_bounds.max.x, _expectedMax.x);
+    CHECK_EQUAL (_bounds.max.y, _expectedMax.y);
+}
+
+/// \brief Checks that every sprite table row has location that points to it and that there are no other locations.
+static void CheckLocationsMatchTable (const BatchingSnapshot &_snapshot)
+{
+    CHECK_EQUAL (_snapshot.spriteLocations.size (), _snapshot.sprites.size ());
+    for (std::size_t spriteIndex = 0u; spriteIndex < _snapshot.sprites.size (); ++spriteIndex)
+    {
+        auto iterator = _snapshot.spriteLocations.find (_snapshot.sprites[spriteIndex].spriteId);
+        REQUIRE (iterator != _snapshot.spriteLocations.end ());
+        CHECK_EQUAL (iterator->second.staticGeometryIndex, Sprite2dLocation::DYNAMIC);
+        CHECK_EQUAL (iterator->second.spriteIndex, spriteIndex);
+    }
+}
+} // namespace Emergence::Celerity::Test
+
+using namespace Emergence::Celerity;
+using namespace Emergence::Celerity::Test;
+
+BEGIN_SUITE (SpriteTable2d)
+
+TEST_CASE (AddedSpriteIsCopiedToTable)
+{
+    HeadlessWorld world;
+    UniqueId spriteId = INVALID_UNIQUE_ID;
+
+    world.Update (
+        [&spriteId] (SceneEditor &_editor)
+        {
+            _editor.CreateTransform (PARENT_OBJECT_ID, INVALID_UNIQUE_ID, {{10.0f, 5.0f}, 0.0f, {1.0f, 1.0f}});
+            spriteId = _editor.CreateSprite (PARENT_OBJECT_ID, GetMaterialInstanceId (1u), 7u, {1.0f, 2.0f});
+        });
+
+    const BatchingSnapshot &snapshot = world.GetSnapshot ();
+    REQUIRE_EQUAL (snapshot.sprites.size (), 1u);
+    CheckLocationsMatchTable (snapshot);
+
+    const Sprite2dRenderData *sprite = world.FindSprite (spriteId);
+    REQUIRE (sprite);
+    CHECK_EQUAL (sprite->objectId, PARENT_OBJECT_ID);
+    CHECK (sprite->materialInstanceId == GetMaterialInstanceId (1u));
+    CHECK_EQUAL (sprite->layer, 7u);
+    CHECK_EQUAL (sprite->halfSize.x, 1.0f);
+    CHECK_EQUAL (sprite->halfSize.y, 2.0f);
+    CHECK (sprite->attachedToTransform);
+    CHECK (!sprite->uvAnimated);
+    CheckBounds (sprite->globalBounds, {9.0f, 3.0f}, {11.0f, 7.0f});
+}
+
+TEST_CASE (RemovalReplacesSpriteWithLastOne)
+{
+    constexpr std::size_t SPRITE_COUNT = 4u;
+    HeadlessWorld world;
+
+    world.Update (
+        [] (SceneEditor &_editor)
+        {
+            for (std::size_t index = 0u; index < SPRITE_COUNT; ++index)
+            {
+                const UniqueId objectId = index + 1u;
+                _editor.CreateTransform (objectId, INVALID_UNIQUE_ID,
+                                         {{static_cast<float> (index), 0.0f}, 0.0f, {1.0f, 1.0f}});
+                _editor.CreateSprite (objectId, GetMaterialInstanceId (0u), 0u);
+            }
+        });
+
+    REQUIRE_EQUAL (world.GetSnapshot ().sprites.size (), SPRITE_COUNT);
+    const UniqueId firstSpriteId = world.GetSnapshot ().sprites[0u].spriteId;
+    const UniqueId removedSpriteId = world.GetSnapshot ().sprites[1u].spriteId;
+    const UniqueId thirdSpriteId = world.GetSnapshot ().sprites[2u].spriteId;
+    const UniqueId lastSpriteId = world.GetSnapshot ().sprites[3u].spriteId;
+    const Emergence::Math::AxisAlignedBox2d lastSpriteBounds = world.GetSnapshot ().sprites[3u].globalBounds;
+
+    world.Update (
+        [removedSpriteId] (SceneEditor &_editor)
+        {
+            _editor.RemoveSprite (removedSpriteId);
+        });
+
+    const BatchingSnapshot &snapshot = world.GetSnapshot ();
+    REQUIRE_EQUAL (snapshot.sprites.size (), SPRITE_COUNT - 1u);
+    CHECK (!world.FindLocation (removedSpriteId));
+    CheckLocationsMatchTable (snapshot);
+
+    CHECK_EQUAL (snapshot.sprites[0u].spriteId, firstSpriteId);
+    CHECK_EQUAL (snapshot.sprites[1u].spriteId, lastSpriteId);
+    CHECK_EQUAL (snapshot.sprites[2u].spriteId, thirdSpriteId);
+
+    // Row is moved as a whole, so its data must stay intact.
+    CheckBounds (snapshot.sprites[1u].globalBounds, lastSpriteBounds.min, lastSpriteBounds.max);
+}
+
+TEST_CASE (ReparentRefreshesWholeSubtree)
+{
+    HeadlessWorld world;
+    UniqueId childSpriteId = INVALID_UNIQUE_ID;
+    UniqueId grandchildSpriteId = INVALID_UNIQUE_ID;
+
+    world.Update (
+        [&childSpriteId, &grandchildSpriteId] (SceneEditor &_editor)
+        {
+            _editor.CreateTransform (PARENT_OBJECT_ID, INVALID_UNIQUE_ID, {{20.0f, 0.0f}, 0.0f, {1.0f, 1.0f}});
+            _editor.CreateTransform (CHILD_OBJECT_ID, INVALID_UNIQUE_ID, {});
+            _editor.CreateTransform (GRANDCHILD_OBJECT_ID, CHILD_OBJECT_ID, {{0.0f, 10.0f}, 0.0f, {1.0f, 1.0f}});
+
+            childSpriteId = _editor.CreateSprite (CHILD_OBJECT_ID, GetMaterialInstanceId (0u), 0u);
+            grandchildSpriteId = _editor.CreateSprite (GRANDCHILD_OBJECT_ID, GetMaterialInstanceId (0u), 0u);
+        });
+
+    REQUIRE (world.FindSprite (childSpriteId));
+    REQUIRE (world.FindSprite (grandchildSpriteId));
+    CheckBounds (world.FindSprite (childSpriteId)->globalBounds, {-0.5f, -0.5f}, {0.5f, 0.5f});
+    CheckBounds (world.FindSprite (grandchildSpriteId)->globalBounds, {-0.5f, 9.5f}, {0.5f, 10.5f});
+
+    // Only child transform is changed, but grandchild world transform depends on it too.
+    world.Update (
+        [] (SceneEditor &_editor)
+        {
+            _editor.SetParent (CHILD_OBJECT_ID, PARENT_OBJECT_ID);
+        });
+
+    REQUIRE (world.FindSprite (childSpriteId));
+    REQUIRE (world.FindSprite (grandchildSpriteId));
+    CheckBounds (world.FindSprite (childSpriteId)->globalBounds, {19.5f, -0.5f}, {20.5f, 0.5f});
+    CheckBounds (world.FindSprite (grandchildSpriteId)->globalBounds, {19.5f, 9.5f}, {20.5f, 10.5f});
+    CheckLocationsMatchTable (world.GetSnapshot ());
+}
+
+TEST_CASE (TransformRemovalLeavesStaleRowUntilCleanup)
+{
+    HeadlessWorld world;
+    UniqueId spriteId = INVALID_UNIQUE_ID;
+
+    world.Update (
+        [&spriteId] (SceneEditor &_editor)
+        {
+            _editor.CreateTransform (PARENT_OBJECT_ID, INVALID_UNIQUE_ID, {});
+            spriteId = _editor.CreateSprite (PARENT_OBJECT_ID, GetMaterialInstanceId (0u), 0u);
+        });
+
+    REQUIRE (world.FindSprite (spriteId));
+    CHECK (world.FindSprite (spriteId)->attachedToTransform);
+
+    world.Update (
+        [] (SceneEditor &_editor)
+        {
+            _editor.RemoveTransform (PARENT_OBJECT_ID);
+        });
+
+    // Synchronizer does not track transform removal, therefore row stays as is until sprite is removed by cleanup.
+    REQUIRE (world.FindSprite (spriteId));
+    CHECK (world.FindSprite (spriteId)->attachedToTransform);
+    CheckLocationsMatchTable (world.GetSnapshot ());
+
+    world.Update ();
+    CHECK (!world.FindLocation (spriteId));
+    CHECK (world.GetSnapshot ().sprites.empty ());
+}
+
+END_SUITE
@@ -0,0 +1,286 @@
+#include <cstdint>
+#include <functional>
+
+#include <Celerity/Render/2d/Test/HeadlessWorld.hpp>
+
+#include <Render/Backend/Null/Statistics.hpp>
+
+#include <Testing/Testing.hpp>
+
+namespace Emergence::Celerity::Test
+{
+/// \brief Must be equal to count of frames without changes, after which sprite is baked into static geometry.
+static constexpr std::size_t PROMOTION_FRAMES = 16u;
+
+static constexpr UniqueId FIRST_OBJECT_ID = 1u;
+
+static constexpr UniqueId SECOND_OBJECT_ID = 2u;
+
+static UniqueId CreateSprite (HeadlessWorld &_world,
+                              UniqueId _objectId,
+                              const Math::Vector2f &_translation,
+                              std::size_t _materialInstanceIndex = 0u)
+{
+    UniqueId spriteId = INVALID_UNIQUE_ID;
+    _world.Update (
+        [&spriteId, _objectId, &_translation, _materialInstanceIndex] (SceneEditor &_editor)
+        {
+            _editor.CreateTransform (_objectId, INVALID_UNIQUE_ID, {_translation, 0.0f, {1.0f, 1.0f}});
+            spriteId = _editor.CreateSprite (_objectId, GetMaterialInstanceId (_materialInstanceIndex), 0u);
+        });
+
+    return spriteId;
+}
+
+static bool IsStatic (const HeadlessWorld &_world, UniqueId _spriteId)
+{
+    const Sprite2dLocation *location = _world.FindLocation (_spriteId);
+    return location && location->staticGeometryIndex != Sprite2dLocation::DYNAMIC;
+}
+
+static bool IsDynamic (const HeadlessWorld &_world, UniqueId _spriteId)
+{
+    const Sprite2dLocation *location = _world.FindLocation (_spriteId);
+    return location && location->staticGeometryIndex == Sprite2dLocation::DYNAMIC;
+}
+
+static void CheckBounds (const Math::AxisAlignedBox2d &_bounds,
+                         const Math::Vector2f &_expectedMin,
+                         const Math::Vector2f &_expectedMax)
+{
+    CHECK_EQUAL (_bounds.min.x, _expectedMin.x);
+    CHECK_EQUAL (_bounds.min.y, _expectedMin.y);
+    CHECK_EQUAL (_bounds.max.x, _expectedMax.x);
+    CHECK_EQUAL (_bounds.max.y, _expectedMax.y);
+}
+
+/// \brief Creates sprite at the origin and waits until it is baked into static geometry.
+static UniqueId CreateStaticSprite (HeadlessWorld &_world)
+{
+    const UniqueId spriteId = CreateSprite (_world, FIRST_OBJECT_ID, Math::Vector2f::ZERO);
+    _world.Skip (PROMOTION_FRAMES - 1u);
+    REQUIRE (IsStatic (_world, spriteId));
+    return spriteId;
+}
+
+/// \brief Checks that static sprite becomes dynamic after given change and is baked again after it stops changing.
+static void CheckDemotion (const std::function<void (SceneEditor &, UniqueId)> &_change)
+{
+    HeadlessWorld world;
+    const UniqueId spriteId = CreateStaticSprite (world);
+
+    world.Update (
+        [&_change, spriteId] (SceneEditor &_editor)
+        {
+            _change (_editor, spriteId);
+        });
+    CHECK (IsDynamic (world, spriteId));
+    CHECK_EQUAL (world.GetSnapshot ().sprites.size (), 1u);
+
+    // Geometry is empty, therefore its key is released and its buffers are destroyed, but entry stays for reuse.
+    REQUIRE_EQUAL (world.GetSnapshot ().staticGeometry.size (), 1u);
+    CHECK (world.GetSnapshot ().staticGeometry.front ().sprites.empty ());
+    CHECK (!world.GetSnapshot ().staticGeometry.front ().buffersValid);
+    CHECK_EQUAL (world.GetSnapshot ().staticGeometryKeyCount, 0u);
+
+    world.Skip (PROMOTION_FRAMES - 2u);
+    CHECK (IsDynamic (world, spriteId));
+
+    world.Update ();
+    CHECK (IsStatic (world, spriteId));
+    CHECK_EQUAL (world.GetSnapshot ().staticGeometry.size (), 1u);
+    CHECK_EQUAL (world.GetSnapshot ().staticGeometryKeyCount, 1u);
+}
+} // namespace Emergence::Celerity::Test
+
+using namespace Emergence::Celerity;
+using namespace Emergence::Celerity::Test;
+
+BEGIN_SUITE (StaticGeometry2d)
+
+TEST_CASE (SpriteIsPromotedAfterPromotionFrames)
+{
+    HeadlessWorld world;
+    const UniqueId spriteId = CreateSprite (world, FIRST_OBJECT_ID, Emergence::Math::Vector2f::ZERO);
+
+    world.Skip (PROMOTION_FRAMES - 2u);
+    CHECK (IsDynamic (world, spriteId));
+    CHECK (world.GetSnapshot ().staticGeometry.empty ());
+
+    world.Update ();
+    REQUIRE (IsStatic (world, spriteId));
+    CHECK (world.GetSnapshot ().sprites.empty ());
+
+    REQUIRE_EQUAL (world.GetSnapshot ().staticGeometry.size (), 1u);
+    const StaticGeometrySnapshot &geometry = world.GetSnapshot ().staticGeometry.front ();
+    CHECK_EQUAL (geometry.sprites.size (), 1u);
+    CHECK_EQUAL (geometry.key.materialInstanceId, GetMaterialInstanceId (0u));
+    CHECK (!geometry.dirty);
+    CHECK (geometry.buffersValid);
+    CheckBounds (geometry.globalBounds, {-0.5f, -0.5f}, {0.5f, 0.5f});
+
+    REQUIRE_EQUAL (world.GetSnapshot ().batches.size (), 1u);
+    const Batch2d &batch = world.GetSnapshot ().batches.front ();
+    CHECK (batch.spriteIndices.empty ());
+    REQUIRE_EQUAL (batch.staticGeometryIndices.size (), 1u);
+    CHECK_EQUAL (batch.staticGeometryIndices.front (), 0u);
+    CHECK_EQUAL (Emergence::Render::Backend::Null::GetLastFrameStatistics ().submittedVertices, 4u);
+}
+
+TEST_CASE (TransformChangeDemotesSprite)
+{
+    CheckDemotion (
+        [] (SceneEditor &_editor, UniqueId /*unused*/)
+        {
+            _editor.SetLocalTransform (FIRST_OBJECT_ID, {{1.0f, 0.0f}, 0.0f, {1.0f, 1.0f}});
+        });
+}
+
+TEST_CASE (SizeChangeDemotesSprite)
+{
+    CheckDemotion (
+        [] (SceneEditor &_editor, UniqueId _spriteId)
+        {
+            _editor.EditSprite (_spriteId,
+                                [] (Sprite2dComponent &_sprite)
+                                {
+                                    _sprite.halfSize = {1.0f, 1.0f};
+                                });
+        });
+}
+
+TEST_CASE (BatchingDataChangeDemotesSprite)
+{
+    CheckDemotion (
+        [] (SceneEditor &_editor, UniqueId _spriteId)
+        {
+            _editor.EditSprite (_spriteId,
+                                [] (Sprite2dComponent &_sprite)
+                                {
+                                    _sprite.layer = 1u;
+                                });
+        });
+}
+
+TEST_CASE (UvChangeUpdatesStaticSpriteInPlace)
+{
+    HeadlessWorld world;
+    const UniqueId spriteId = CreateStaticSprite (world);
+    const Emergence::Math::AxisAlignedBox2d newUv {{0.0f, 0.0f}, {0.5f, 0.5f}};
+
+    world.Update (
+        [spriteId, &newUv] (SceneEditor &_editor)
+        {
+            _editor.EditSprite (spriteId,
+                                [&newUv] (Sprite2dComponent &_sprite)
+                                {
+                                    _sprite.uv = newUv;
+                                });
+        });
+
+    // Uv is changed after batching, so sprite is updated inside static geometry, which is rebuilt before rendering.
+    REQUIRE (IsStatic (world, spriteId));
+    REQUIRE_EQUAL (world.GetSnapshot ().staticGeometry.size (), 1u);
+    const StaticGeometrySnapshot &geometry = world.GetSnapshot ().staticGeometry.front ();
+    REQUIRE_EQUAL (geometry.sprites.size (), 1u);
+    CheckBounds (geometry.sprites.front ().uv, newUv.min, newUv.max);
+    CHECK (!geometry.dirty);
+    CHECK (geometry.buffersValid);
+
+    // Demotion is deferred until next synchronization.
+    world.Update ();
+    CHECK (IsDynamic (world, spriteId));
+    REQUIRE (world.FindSprite (spriteId));
+    CheckBounds (world.FindSprite (spriteId)->uv, newUv.min, newUv.max);
+    CHECK (world.GetSnapshot ().staticGeometry.front ().sprites.empty ());
+}
+
+TEST_CASE (RemovingBakedSpriteRebuildsGeometry)
+{
+    HeadlessWorld world;
+    const UniqueId firstSpriteId = CreateSprite (world, FIRST_OBJECT_ID, Emergence::Math::Vector2f::ZERO);
+    const UniqueId secondSpriteId = CreateSprite (world, SECOND_OBJECT_ID, {3.0f, 0.0f});
+    world.Skip (PROMOTION_FRAMES - 1u);
+
+    REQUIRE (IsStatic (world, firstSpriteId));
+    REQUIRE (IsStatic (world, secondSpriteId));
+    REQUIRE_EQUAL (world.GetSnapshot ().staticGeometry.size (), 1u);
+    CHECK_EQUAL (world.GetSnapshot ().staticGeometry.front ().sprites.size (), 2u);
+    CheckBounds (world.GetSnapshot ().staticGeometry.front ().globalBounds, {-0.5f, -0.5f}, {3.5f, 0.5f});
+    CHECK_EQUAL (Emergence::Render::Backend::Null::GetLastFrameStatistics ().submittedVertices, 8u);
+
+    world.Update (
+        [secondSpriteId] (SceneEditor &_editor)
+        {
+            _editor.RemoveSprite (secondSpriteId);
+        });
+
+    // Bounds are recalculated during rebuild, therefore they are shrunk to the remaining sprite.
+    CHECK (!world.FindLocation (secondSpriteId));
+    REQUIRE_EQUAL (world.GetSnapshot ().staticGeometry.size (), 1u);
+    CHECK_EQUAL (world.GetSnapshot ().staticGeometry.front ().sprites.size (), 1u);
+    CHECK (world.GetSnapshot ().staticGeometry.front ().buffersValid);
+    CheckBounds (world.GetSnapshot ().staticGeometry.front ().globalBounds, {-0.5f, -0.5f}, {0.5f, 0.5f});
+    CHECK_EQUAL (Emergence::Render::Backend::Null::GetLastFrameStatistics ().submittedVertices, 4u);
+
+    world.Update (
+        [firstSpriteId] (SceneEditor &_editor)
+        {
+            _editor.RemoveSprite (firstSpriteId);
+        });
+
+    CHECK (world.GetSnapshot ().spriteLocations.empty ());
+    REQUIRE_EQUAL (world.GetSnapshot ().staticGeometry.size (), 1u);
+    CHECK (world.GetSnapshot ().staticGeometry.front ().sprites.empty ());
+    CHECK (!world.GetSnapshot ().staticGeometry.front ().buffersValid);
+    CHECK_EQUAL (world.GetSnapshot ().staticGeometryKeyCount, 0u);
+    CHECK (world.GetSnapshot ().batches.empty ());
+
+    // Empty geometry entry is reused for the new key.
+    const UniqueId thirdSpriteId = CreateSprite (world, SECOND_OBJECT_ID, Emergence::Math::Vector2f::ZERO, 1u);
+    world.Skip (PROMOTION_FRAMES - 1u);
+
+    REQUIRE (IsStatic (world, thirdSpriteId));
+    REQUIRE_EQUAL (world.GetSnapshot ().staticGeometry.size (), 1u);
+    CHECK_EQUAL (world.GetSnapshot ().staticGeometry.front ().key.materialInstanceId, GetMaterialInstanceId (1u));
+    CHECK_EQUAL (world.GetSnapshot ().staticGeometry.front ().sprites.size (), 1u);
+    CHECK (world.GetSnapshot ().staticGeometry.front ().buffersValid);
+    CHECK_EQUAL (world.GetSnapshot ().staticGeometryKeyCount, 1u);
+}
+
+TEST_CASE (UvAnimationRemovalAllowsPromotion)
+{
+    HeadlessWorld world;
+    UniqueId spriteId = INVALID_UNIQUE_ID;
+
+    world.Update (
+        [&spriteId] (SceneEditor &_editor)
+        {
+            _editor.CreateTransform (FIRST_OBJECT_ID, INVALID_UNIQUE_ID, {});
+            spriteId = _editor.CreateSprite (FIRST_OBJECT_ID, GetMaterialInstanceId (0u), 0u);
+            _editor.AddUvAnimation (FIRST_OBJECT_ID, spriteId);
+        });
+
+    world.Skip (PROMOTION_FRAMES * 2u);
+    REQUIRE (IsDynamic (world, spriteId));
+    CHECK (world.FindSprite (spriteId)->uvAnimated);
+
+    world.Update (
+        [spriteId] (SceneEditor &_editor)
+        {
+            _editor.RemoveUvAnimation (spriteId);
+        });
+
+    // Animation removal is processed right before rendering, therefore it is visible only during next frame.
+    world.Update ();
+    REQUIRE (IsDynamic (world, spriteId));
+    CHECK (!world.FindSprite (spriteId)->uvAnimated);
+
+    world.Skip (PROMOTION_FRAMES - 2u);
+    CHECK (IsDynamic (world, spriteId));
+
+    world.Update ();
+    CHECK (IsStatic (world, spriteId));
+}
+
+END_SUITE
@@ -7,6 +7,7 @@ BEGIN_MUTING_PADDING_WARNING
 #include <Celerity/Transform/Test/Task.hpp>
 #include <Celerity/Transform/TransformHierarchyCleanup.hpp>
 #include <Celerity/Transform/TransformVisualSync.hpp>
+#include <Celerity/Transform/TransformWorldPropagation.hpp>
 
 #include <Memory/Profiler/Test/DefaultAllocationGroupStub.hpp>
 
@@ -17,7 +18,10 @@ namespace Emergence::Celerity::Test
 using namespace Memory::Literals;
 using namespace Requests;
 
-void HierarchyCleanupTest (Container::Vector<RequestExecutor::RequestPacket> _scenario, bool _fixed, bool _use2d)
+void HierarchyCleanupTest (Container::Vector<RequestExecutor::RequestPacket> _scenario,
+                           bool _fixed,
+                           bool _use2d,
+                           bool _propagate = false)
 {
     World world {"TestWorld"_us};
     {
@@ -45,12 +49,32 @@ void HierarchyCleanupTest (Container::Vector<RequestExecutor::RequestPacket> _sc
         if (_use2d)
         {
             TransformHierarchyCleanup::Add2dToFixedUpdate (builder);
-            RequestExecutor::Add2dToFixedUpdate (builder, std::move (_scenario));
+            if (_propagate)
+            {
+                // Removals are executed right before propagation, so it must not touch removed transforms.
+                TransformWorldPropagation::Add2dToFixedUpdate (builder);
+                RequestExecutor::Add2dToFixedUpdate (builder, std::move (_scenario),
+                                                     RequestExecutor::PropagationOrder::BEFORE);
+            }
+            else
+            {
+                RequestExecutor::Add2dToFixedUpdate (builder, std::move (_scenario));
+            }
         }
         else
         {
             TransformHierarchyCleanup::Add3dToFixedUpdate (builder);
-            RequestExecutor::Add3dToFixedUpdate (builder, std::move (_scenario));
+            if (_propagate)
+            {
+                // Removals are executed right before propagation, so it must not touch removed transforms.
+                TransformWorldPropagation::Add3dToFixedUpdate (builder);
+                RequestExecutor::Add3dToFixedUpdate (builder, std::move (_scenario),
+                                                     RequestExecutor::PropagationOrder::BEFORE);
+            }
+            else
+            {
+                RequestExecutor::Add3dToFixedUpdate (builder, std::move (_scenario));
+            }
         }
     }
     else
@@ -62,12 +86,32 @@ void HierarchyCleanupTest (Container::Vector<RequestExecutor::RequestPacket> _sc
         if (_use2d)
         {
             TransformHierarchyCleanup::Add2dToNormalUpdate (builder);
-            RequestExecutor::Add2dToNormalUpdate (builder, std::move (_scenario));
+            if (_propagate)
+            {
+                // Removals are executed right before propagation, so it must not touch removed transforms.
+                TransformWorldPropagation::Add2dToNormalUpdate (builder);
+                RequestExecutor::Add2dToNormalUpdate (builder, std::move (_scenario),
+                                                     RequestExecutor::PropagationOrder::BEFORE);
+            }
+            else
+            {
+                RequestExecutor::Add2dToNormalUpdate (builder, std::move (_scenario));
+            }
         }
         else
         {
             TransformHierarchyCleanup::Add3dToNormalUpdate (builder);
-            RequestExecutor::Add3dToNormalUpdate (builder, std::move (_scenario));
+            if (_propagate)
+            {
+                // Removals are executed right before propagation, so it must not touch removed transforms.
+                TransformWorldPropagation::Add3dToNormalUpdate (builder);
+                RequestExecutor::Add3dToNormalUpdate (builder, std::move (_scenario),
+                                                     RequestExecutor::PropagationOrder::BEFORE);
+            }
+            else
+            {
+                RequestExecutor::Add3dToNormalUpdate (builder, std::move (_scenario));
+            }
         }
     }
 
@@ -236,4 +280,28 @@ TEST_CASE (IntermediateTransformRemoval)
 
 END_SUITE
 
+BEGIN_SUITE (HierarchyCleanupWithPropagation)
+
+TEST_CASE (Fixed2d)
+{
+    HierarchyCleanupTest (INTERMEDIATE_TRANSFORM_REMOVAL_TEST, true, true, true);
+}
+
+TEST_CASE (Normal2d)
+{
+    HierarchyCleanupTest (INTERMEDIATE_TRANSFORM_REMOVAL_TEST, false, true, true);
+}
+
+TEST_CASE (Fixed3d)
+{
+    HierarchyCleanupTest (INTERMEDIATE_TRANSFORM_REMOVAL_TEST, true, false, true);
+}
+
+TEST_CASE (Normal3d)
+{
+    HierarchyCleanupTest (INTERMEDIATE_TRANSFORM_REMOVAL_TEST, false, false, true);
+}
+
+END_SUITE
+
 END_MUTING_WARNINGS
@@ -1,5 +1,7 @@
 #include <Celerity/Transform/Test/Task.hpp>
 #include <Celerity/Transform/TransformHierarchyCleanup.hpp>
+#include <Celerity/Transform/TransformVisualSync.hpp>
+#include <Celerity/Transform/TransformWorldPropagation.hpp>
 
 #include <Math/Constants.hpp>
 
@@ -32,6 +34,67 @@ void OperationsTest (RequestExecutor::RequestPacket _scenario, bool _use2d)
     WorldTestingUtility::RunFixedUpdateOnce (world);
 }
 
+/// \brief Executes every packet during separate update before world transform propagation,
+///        therefore every packet observes caches propagated after previous packet.
+void PropagationTest (Container::Vector<RequestExecutor::RequestPacket> _frames, bool _logical, bool _use2d)
+{
+    World world {"TestWorld"_us};
+    PipelineBuilder builder {world.GetRootView ()};
+    const std::size_t frameCount = _frames.size ();
+
+    if (_logical)
+    {
+        builder.Begin ("FixedUpdate"_us, PipelineType::FIXED);
+        builder.AddCheckpoint (TransformHierarchyCleanup::Checkpoint::FINISHED);
+
+        if (_use2d)
+        {
+            TransformWorldPropagation::Add2dToFixedUpdate (builder);
+            RequestExecutor::Add2dToFixedUpdate (builder, std::move (_frames),
+                                                 RequestExecutor::PropagationOrder::BEFORE);
+        }
+        else
+        {
+            TransformWorldPropagation::Add3dToFixedUpdate (builder);
+            RequestExecutor::Add3dToFixedUpdate (builder, std::move (_frames),
+                                                 RequestExecutor::PropagationOrder::BEFORE);
+        }
+    }
+    else
+    {
+        builder.Begin ("NormalUpdate"_us, PipelineType::NORMAL);
+        builder.AddCheckpoint (TransformHierarchyCleanup::Checkpoint::FINISHED);
+        builder.AddCheckpoint (TransformVisualSync::Checkpoint::STARTED);
+        builder.AddCheckpoint (TransformVisualSync::Checkpoint::FINISHED);
+
+        if (_use2d)
+        {
+            TransformWorldPropagation::Add2dToNormalUpdate (builder);
+            RequestExecutor::Add2dToNormalUpdate (builder, std::move (_frames),
+                                                 RequestExecutor::PropagationOrder::BEFORE);
+        }
+        else
+        {
+            TransformWorldPropagation::Add3dToNormalUpdate (builder);
+            RequestExecutor::Add3dToNormalUpdate (builder, std::move (_frames),
+                                                 RequestExecutor::PropagationOrder::BEFORE);
+        }
+    }
+
+    REQUIRE (builder.End ());
+    for (std::size_t index = 0u; index < frameCount; ++index)
+    {
+        if (_logical)
+        {
+            WorldTestingUtility::RunFixedUpdateOnce (world);
+        }
+        else
+        {
+            WorldTestingUtility::RunNormalUpdateOnce (world, 1u);
+        }
+    }
+}
+
 template <typename Transform>
 void HierarchyTest (bool _logical,
                     bool _useModifyQuery,
@@ -87,6 +150,81 @@ void HierarchyTest (bool _logical,
         std::is_same_v<Transform, Math::Transform2d>);
 }
 
+template <typename Transform>
+void PropagationHierarchyTest (bool _logical,
+                               const Transform &_initial0,
+                               const Transform &_initial1,
+                               const Transform &_initial2,
+                               const Transform &_changed0,
+                               const Transform &_expected1,
+                               const Transform &_expected2,
+                               const Transform &_expected1Changed,
+                               const Transform &_expected2Changed,
+                               const Transform &_expected2OtherParent)
+{
+    using namespace Requests;
+
+    PropagationTest (
+        {
+            {
+                CreateTransform {0u, INVALID_UNIQUE_ID},
+                SetLocalTransform {0u, _logical, false, _initial0},
+
+                CreateTransform {1u, 0u},
+                SetLocalTransform {1u, _logical, false, _initial1},
+
+                CreateTransform {2u, 1u},
+                SetLocalTransform {2u, _logical, false, _initial2},
+            },
+            {
+                // Check propagated transforms.
+                CheckTransform {1u, _logical, false, false, _expected1},
+                CheckTransform {2u, _logical, false, false, _expected2},
+
+                // Check that lazy update reacts to grandparent change even if parent was updated first.
+                SetLocalTransform {0u, _logical, false, _changed0},
+                CheckTransform {1u, _logical, false, false, _expected1Changed},
+                CheckTransform {2u, _logical, false, false, _expected2Changed},
+            },
+            {
+                CheckTransform {2u, _logical, false, false, _expected2Changed},
+                CheckTransform {1u, _logical, false, false, _expected1Changed},
+                ChangeParent {2u, 0u},
+            },
+            {
+                CheckTransform {2u, _logical, false, false, _expected2OtherParent},
+                CheckTransform {1u, _logical, false, false, _expected1Changed},
+                RemoveTransform {1u},
+            },
+            {
+                CheckTransform {2u, _logical, false, false, _expected2OtherParent},
+                CheckTransform {0u, _logical, false, false, _changed0},
+            },
+        },
+        _logical, std::is_same_v<Transform, Math::Transform2d>);
+}
+
+void PropagationHierarchyTest3d (bool _logical)
+{
+    using namespace Math;
+
+    PropagationHierarchyTest<Transform3d> (
+        _logical, {{1.0f, 2.0f, 3.0f}, Quaternion::IDENTITY, {2.0f, 2.0f, 2.0f}}, {{3.0f, 0.0f, 0.0f}},
+        {{0.0f, 1.0f, 0.0f}}, {{-1.0f, 0.0f, 0.0f}}, {{7.0f, 2.0f, 3.0f}, Quaternion::IDENTITY, {2.0f, 2.0f, 2.0f}},
+        {{7.0f, 4.0f, 3.0f}, Quaternion::IDENTITY, {2.0f, 2.0f, 2.0f}}, {{2.0f, 0.0f, 0.0f}}, {{2.0f, 1.0f, 0.0f}},
+        {{-1.0f, 1.0f, 0.0f}});
+}
+
+void PropagationHierarchyTest2d (bool _logical)
+{
+    using namespace Math;
+
+    PropagationHierarchyTest<Transform2d> (_logical, {{1.0f, 2.0f}, 0.0f, {2.0f, 2.0f}}, {{3.0f, 0.0f}},
+                                           {{0.0f, 1.0f}}, {{-1.0f, 0.0f}}, {{7.0f, 2.0f}, 0.0f, {2.0f, 2.0f}},
+                                           {{7.0f, 4.0f}, 0.0f, {2.0f, 2.0f}}, {{2.0f, 0.0f}}, {{2.0f, 1.0f}},
+                                           {{-1.0f, 1.0f}});
+}
+
 void HierarchyTest3d (bool _logical, bool _useModifyQuery)
 {
     using namespace Math;
@@ -153,6 +291,16 @@ TEST_CASE (WorldTransformUsingModifyQuery)
     HierarchyTest2d (true, true);
 }
 
+TEST_CASE (LogicalTransformPropagation)
+{
+    PropagationHierarchyTest2d (true);
+}
+
+TEST_CASE (VisualTransformPropagation)
+{
+    PropagationHierarchyTest2d (false);
+}
+
 END_SUITE
 
 BEGIN_SUITE (TransformOperations3d)
@@ -192,4 +340,14 @@ TEST_CASE (WorldTransformUsingModifyQuery)
     HierarchyTest3d (true, true);
 }
 
+TEST_CASE (LogicalTransformPropagation)
+{
+    PropagationHierarchyTest3d (true);
+}
+
+TEST_CASE (VisualTransformPropagation)
+{
+    PropagationHierarchyTest3d (false);
+}
+
 END_SUITE
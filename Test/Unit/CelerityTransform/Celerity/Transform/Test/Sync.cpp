@@ -3,6 +3,7 @@
 #include <Celerity/Transform/Test/Task.hpp>
 #include <Celerity/Transform/TransformHierarchyCleanup.hpp>
 #include <Celerity/Transform/TransformVisualSync.hpp>
+#include <Celerity/Transform/TransformWorldPropagation.hpp>
 
 #include <Math/Constants.hpp>
 
@@ -23,7 +24,8 @@ constexpr float TEST_FIXED_FRAME_TIME_S = 0.000001f;
 void SyncTest (Container::Vector<std::uint64_t> _timeSamples,
                Container::Vector<RequestExecutor::RequestPacket> _fixedRequests,
                Container::Vector<RequestExecutor::RequestPacket> _normalRequests,
-               bool _use2d)
+               bool _use2d,
+               bool _propagate = false)
 {
     World world {"TestWorld"_us, WorldConfiguration {{TEST_FIXED_FRAME_TIME_S}}};
     PipelineBuilder builder {world.GetRootView ()};
@@ -31,7 +33,23 @@ void SyncTest (Container::Vector<std::uint64_t> _timeSamples,
     builder.Begin ("FixedUpdate"_us, PipelineType::FIXED);
     builder.AddCheckpoint (TransformHierarchyCleanup::Checkpoint::FINISHED);
 
-    if (_use2d)
+    if (_propagate)
+    {
+        // Fixed requests change logical transforms, therefore they are executed before logical propagation.
+        if (_use2d)
+        {
+            TransformWorldPropagation::Add2dToFixedUpdate (builder);
+            RequestExecutor::Add2dToFixedUpdate (builder, std::move (_fixedRequests),
+                                                 RequestExecutor::PropagationOrder::BEFORE);
+        }
+        else
+        {
+            TransformWorldPropagation::Add3dToFixedUpdate (builder);
+            RequestExecutor::Add3dToFixedUpdate (builder, std::move (_fixedRequests),
+                                                 RequestExecutor::PropagationOrder::BEFORE);
+        }
+    }
+    else if (_use2d)
     {
         RequestExecutor::Add2dToFixedUpdate (builder, std::move (_fixedRequests));
     }
@@ -44,7 +62,25 @@ void SyncTest (Container::Vector<std::uint64_t> _timeSamples,
     builder.Begin ("NormalUpdate"_us, PipelineType::NORMAL);
     builder.AddCheckpoint (TransformHierarchyCleanup::Checkpoint::FINISHED);
 
-    if (_use2d)
+    if (_propagate)
+    {
+        // Normal requests only check visual transforms, therefore they are executed after visual propagation.
+        if (_use2d)
+        {
+            TransformVisualSync::Add2dToNormalUpdate (builder);
+            TransformWorldPropagation::Add2dToNormalUpdate (builder);
+            RequestExecutor::Add2dToNormalUpdate (builder, std::move (_normalRequests),
+                                                  RequestExecutor::PropagationOrder::AFTER);
+        }
+        else
+        {
+            TransformVisualSync::Add3dToNormalUpdate (builder);
+            TransformWorldPropagation::Add3dToNormalUpdate (builder);
+            RequestExecutor::Add3dToNormalUpdate (builder, std::move (_normalRequests),
+                                                  RequestExecutor::PropagationOrder::AFTER);
+        }
+    }
+    else if (_use2d)
     {
         TransformVisualSync::Add2dToNormalUpdate (builder);
         RequestExecutor::Add2dToNormalUpdate (builder, std::move (_normalRequests));
@@ -130,7 +166,8 @@ void InterpolationAndWorldTransformTest (const Transform &_parentInitialTransfor
                                          const Transform &_childInitialTransform,
                                          const Transform &_childTargetTransform,
                                          const Transform &_childWorldTransform025,
-                                         const Transform &_childWorldTransform080)
+                                         const Transform &_childWorldTransform080,
+                                         bool _propagate = false)
 {
     SyncTest (
         {
@@ -159,7 +196,7 @@ void InterpolationAndWorldTransformTest (const Transform &_parentInitialTransfor
             {{CheckTransform {1u, false, false, false, _childWorldTransform080}}},
             {{CheckTransform {1u, false, false, false, _parentTargetTransform * _childTargetTransform}}},
         },
-        std::is_same_v<Transform, Math::Transform2d>);
+        std::is_same_v<Transform, Math::Transform2d>, _propagate);
 }
 
 template <typename Transform>
@@ -228,6 +265,13 @@ TEST_CASE (InterpolationAndWorldTransform)
                                                      Transform2d {{1.6f, 0.0f}} * Transform2d {{0.6f, 0.0f}});
 }
 
+TEST_CASE (InterpolationAndWorldTransformWithPropagation)
+{
+    InterpolationAndWorldTransformTest<Transform2d> ({}, {{2.0f, 0.0f}}, {{-1.0f, 0.0f}}, {{1.0f, 0.0f}},
+                                                     Transform2d {{0.5f, 0.0f}} * Transform2d {{-0.5f, 0.0f}},
+                                                     Transform2d {{1.6f, 0.0f}} * Transform2d {{0.6f, 0.0f}}, true);
+}
+
 TEST_CASE (InterpolationWithPause)
 {
     InterpolationWithPauseTest<Transform2d> ({{2.0f, 4.0f}}, {{9.0f, 8.0f}}, {{24.4f, 16.8f}}, {{30.0f, 20.0f}});
@@ -260,6 +304,14 @@ TEST_CASE (InterpolationAndWorldTransform)
         Transform3d {{1.6f, 0.0f, 1.6f}} * Transform3d {{0.6f, 0.0f, 0.0f}});
 }
 
+TEST_CASE (InterpolationAndWorldTransformWithPropagation)
+{
+    InterpolationAndWorldTransformTest<Transform3d> (
+        {}, {{2.0f, 0.0f, 2.0f}}, {{-1.0f, 0.0f, 0.0f}}, {{1.0f, 0.0f, 0.0f}},
+        Transform3d {{0.5f, 0.0f, 0.5f}} * Transform3d {{-0.5f, 0.0f, 0.0f}},
+        Transform3d {{1.6f, 0.0f, 1.6f}} * Transform3d {{0.6f, 0.0f, 0.0f}}, true);
+}
+
 TEST_CASE (InterpolationWithPause)
 {
     InterpolationWithPauseTest<Transform3d> ({{2.0f, 4.0f, 10.0f}}, {{9.0f, 8.0f, 15.0f}}, {{24.4f, 16.8f, 26.0f}},
@@ -8,6 +8,7 @@ BEGIN_MUTING_PADDING_WARNING
 #include <Celerity/Transform/TransformHierarchyCleanup.hpp>
 #include <Celerity/Transform/TransformVisualSync.hpp>
 #include <Celerity/Transform/TransformWorldAccessor.hpp>
+#include <Celerity/Transform/TransformWorldPropagation.hpp>
 
 #include <Memory/Profiler/Test/DefaultAllocationGroupStub.hpp>
 
@@ -309,6 +310,62 @@ void Add3dToNormalUpdate (PipelineBuilder &_pipelineBuilder, Container::Vector<R
     constructor.DependOn (TransformVisualSync::Checkpoint::FINISHED);
     constructor.SetExecutor<Executor<Math::Transform3d>> (std::move (_requests));
 }
+
+static void AddPropagationDependency (TaskConstructor &_constructor, PropagationOrder _order) noexcept
+{
+    switch (_order)
+    {
+    case PropagationOrder::BEFORE:
+        _constructor.MakeDependencyOf (TransformWorldPropagation::Checkpoint::STARTED);
+        break;
+
+    case PropagationOrder::AFTER:
+        _constructor.DependOn (TransformWorldPropagation::Checkpoint::FINISHED);
+        break;
+    }
+}
+
+void Add2dToFixedUpdate (PipelineBuilder &_pipelineBuilder,
+                         Container::Vector<RequestPacket> _requests,
+                         PropagationOrder _order) noexcept
+{
+    TaskConstructor constructor = _pipelineBuilder.AddTask (Memory::UniqueString {"TransformRequestExecutor"});
+    constructor.DependOn (TransformHierarchyCleanup::Checkpoint::FINISHED);
+    AddPropagationDependency (constructor, _order);
+    constructor.SetExecutor<Executor<Math::Transform2d>> (std::move (_requests));
+}
+
+void Add2dToNormalUpdate (PipelineBuilder &_pipelineBuilder,
+                          Container::Vector<RequestPacket> _requests,
+                          PropagationOrder _order) noexcept
+{
+    TaskConstructor constructor = _pipelineBuilder.AddTask (Memory::UniqueString {"TransformRequestExecutor"});
+    constructor.DependOn (TransformHierarchyCleanup::Checkpoint::FINISHED);
+    constructor.DependOn (TransformVisualSync::Checkpoint::FINISHED);
+    AddPropagationDependency (constructor, _order);
+    constructor.SetExecutor<Executor<Math::Transform2d>> (std::move (_requests));
+}
+
+void Add3dToFixedUpdate (PipelineBuilder &_pipelineBuilder,
+                         Container::Vector<RequestPacket> _requests,
+                         PropagationOrder _order) noexcept
+{
+    TaskConstructor constructor = _pipelineBuilder.AddTask (Memory::UniqueString {"TransformRequestExecutor"});
+    constructor.DependOn (TransformHierarchyCleanup::Checkpoint::FINISHED);
+    AddPropagationDependency (constructor, _order);
+    constructor.SetExecutor<Executor<Math::Transform3d>> (std::move (_requests));
+}
+
+void Add3dToNormalUpdate (PipelineBuilder &_pipelineBuilder,
+                          Container::Vector<RequestPacket> _requests,
+                          PropagationOrder _order) noexcept
+{
+    TaskConstructor constructor = _pipelineBuilder.AddTask (Memory::UniqueString {"TransformRequestExecutor"});
+    constructor.DependOn (TransformHierarchyCleanup::Checkpoint::FINISHED);
+    constructor.DependOn (TransformVisualSync::Checkpoint::FINISHED);
+    AddPropagationDependency (constructor, _order);
+    constructor.SetExecutor<Executor<Math::Transform3d>> (std::move (_requests));
+}
 } // namespace RequestExecutor
 } // namespace Emergence::Celerity::Test
 
@@ -118,6 +118,32 @@ void Add3dToFixedUpdate (Emergence::Celerity::PipelineBuilder &_pipelineBuilder,
 
 void Add3dToNormalUpdate (Emergence::Celerity::PipelineBuilder &_pipelineBuilder,
                           Container::Vector<RequestPacket> _requests) noexcept;
+
+/// \brief Describes how executor is ordered relative to tasks from TransformWorldPropagation.
+enum class PropagationOrder
+{
+    /// \brief Executor is executed before propagation, therefore it observes caches propagated during previous update.
+    BEFORE,
+
+    /// \brief Executor is executed after propagation, therefore it observes caches propagated during this update.
+    AFTER,
+};
+
+void Add2dToFixedUpdate (Emergence::Celerity::PipelineBuilder &_pipelineBuilder,
+                         Container::Vector<RequestPacket> _requests,
+                         PropagationOrder _order) noexcept;
+
+void Add2dToNormalUpdate (Emergence::Celerity::PipelineBuilder &_pipelineBuilder,
+                          Container::Vector<RequestPacket> _requests,
+                          PropagationOrder _order) noexcept;
+
+void Add3dToFixedUpdate (Emergence::Celerity::PipelineBuilder &_pipelineBuilder,
+                         Container::Vector<RequestPacket> _requests,
+                         PropagationOrder _order) noexcept;
+
+void Add3dToNormalUpdate (Emergence::Celerity::PipelineBuilder &_pipelineBuilder,
+                          Container::Vector<RequestPacket> _requests,
+                          PropagationOrder _order) noexcept;
 } // namespace RequestExecutor
 } // namespace Emergence::Celerity::Test
 
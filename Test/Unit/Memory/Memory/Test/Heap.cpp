@@ -1,6 +1,8 @@
 #define _CRT_SECURE_NO_WARNINGS
 
+#include <algorithm>
 #include <cstring>
+#include <thread>
 #include <vector>
 
 #include <Memory/Heap.hpp>
@@ -108,4 +110,134 @@ TEST_CASE (Profiling)
     CHECK_EQUAL (group.GetAcquired (), 0u);
 }
 
+TEST_CASE (AcquireManySizes)
+{
+    Emergence::Memory::Heap heap {GetUniqueAllocationGroup ()};
+    std::vector<std::pair<std::uint8_t *, std::size_t>> records;
+
+    for (std::size_t alignment = 1u; alignment <= 64u; alignment *= 2u)
+    {
+        for (std::size_t requestedSize = 1u; requestedSize <= 2048u; requestedSize += 37u)
+        {
+            // Aligned allocation functions require size to be multiple of alignment.
+            const std::size_t size = (requestedSize + alignment - 1u) / alignment * alignment;
+            auto *record = static_cast<std::uint8_t *> (heap.Acquire (size, alignment));
+            CHECK_EQUAL (reinterpret_cast<std::uintptr_t> (record) % alignment, 0u);
+            memset (record, static_cast<int> (records.size () % 256u), size);
+            records.emplace_back (record, size);
+        }
+    }
+
+    for (std::size_t index = 0u; index < records.size (); ++index)
+    {
+        auto [record, size] = records[index];
+        for (std::size_t offset = 0u; offset < size; ++offset)
+        {
+            if (record[offset] != static_cast<std::uint8_t> (index % 256u))
+            {
+                CHECK_EQUAL (record[offset], static_cast<std::uint8_t> (index % 256u));
+                break;
+            }
+        }
+
+        heap.Release (record, size);
+    }
+}
+
+TEST_CASE (ResizeAcrossSizeClasses)
+{
+    Emergence::Memory::Heap heap {GetUniqueAllocationGroup ()};
+    std::size_t size = 8u;
+    auto *record = static_cast<std::uint8_t *> (heap.Acquire (size, sizeof (std::uintptr_t)));
+    record[0u] = 42u;
+
+    while (size < 4096u)
+    {
+        record = static_cast<std::uint8_t *> (heap.Resize (record, sizeof (std::uintptr_t), size, size * 2u));
+        CHECK_EQUAL (record[0u], 42u);
+        size *= 2u;
+    }
+
+    while (size > 8u)
+    {
+        record = static_cast<std::uint8_t *> (heap.Resize (record, sizeof (std::uintptr_t), size, size / 2u));
+        CHECK_EQUAL (record[0u], 42u);
+        size /= 2u;
+    }
+
+    heap.Release (record, size);
+}
+
+TEST_CASE (ReleaseFromOtherThread)
+{
+    constexpr std::size_t COUNT = 1024u;
+    constexpr std::size_t SIZE = 48u;
+
+    Emergence::Memory::Heap heap {GetUniqueAllocationGroup ()};
+    std::vector<void *> records;
+
+    std::thread producer {[&heap, &records] ()
+                          {
+                              for (std::size_t index = 0u; index < COUNT; ++index)
+                              {
+                                  records.emplace_back (heap.Acquire (SIZE, sizeof (std::uintptr_t)));
+                              }
+                          }};
+    producer.join ();
+
+    for (void *record : records)
+    {
+        heap.Release (record, SIZE);
+    }
+
+    CHECK_EQUAL (heap.GetAllocationGroup ().GetTotal (), 0u);
+}
+
+TEST_CASE (SizesAroundSmallRecordLimit)
+{
+    // Implementations might select allocation strategy by size, therefore records around typical small record
+    // limits are resized across it and released with exactly the same size that was acquired. Records are
+    // prefixed with their acquired size, like adapters for third party allocators do.
+    Emergence::Memory::Heap heap {GetUniqueAllocationGroup ()};
+    std::vector<std::uintptr_t *> records;
+
+    for (std::size_t payload = 960u; payload <= 1088u; payload += sizeof (std::uintptr_t))
+    {
+        const std::size_t size = payload + sizeof (std::uintptr_t);
+        auto *record = static_cast<std::uintptr_t *> (heap.Acquire (size, alignof (std::uintptr_t)));
+        record[0u] = size;
+        memset (record + 1u, static_cast<int> (records.size () % 256u), payload);
+        records.emplace_back (record);
+    }
+
+    for (std::size_t index = 0u; index < records.size (); ++index)
+    {
+        std::uintptr_t *&record = records[index];
+        const std::size_t oldSize = record[0u];
+        const std::size_t newSize = oldSize < 1024u ? oldSize + 128u : oldSize - 128u;
+
+        record = static_cast<std::uintptr_t *> (heap.Resize (record, alignof (std::uintptr_t), oldSize, newSize));
+        record[0u] = newSize;
+
+        const auto *payload = reinterpret_cast<const std::uint8_t *> (record + 1u);
+        const std::size_t checkedBytes = std::min (oldSize, newSize) - sizeof (std::uintptr_t);
+
+        for (std::size_t offset = 0u; offset < checkedBytes; ++offset)
+        {
+            if (payload[offset] != static_cast<std::uint8_t> (index % 256u))
+            {
+                CHECK_EQUAL (payload[offset], static_cast<std::uint8_t> (index % 256u));
+                break;
+            }
+        }
+    }
+
+    for (std::uintptr_t *record : records)
+    {
+        heap.Release (record, record[0u]);
+    }
+
+    CHECK_EQUAL (heap.GetAllocationGroup ().GetTotal (), 0u);
+}
+
 END_SUITE
@@ -1,7 +1,10 @@
 #define _CRT_SECURE_NO_WARNINGS
 
 #include <cstring>
+#include <string>
 #include <string_view>
+#include <thread>
+#include <vector>
 
 #include <Memory/UniqueString.hpp>
 
@@ -57,4 +60,56 @@ TEST_CASE (Hash)
            std::hash<Emergence::Memory::UniqueString> {}(firstAgain));
 }
 
+TEST_CASE (StableHash)
+{
+    using namespace Emergence::Memory::Literals;
+
+    Emergence::Memory::UniqueString first {"First!"};
+    Emergence::Memory::UniqueString second {"Second!"};
+
+    CHECK (first.StableHash () != second.StableHash ());
+    CHECK (first.StableHash () == "First!"_us.StableHash ());
+    CHECK (Emergence::Memory::UniqueString {}.StableHash () == 0u);
+
+    // Stable hash depends only on content, therefore it must be the same in every run.
+    CHECK_EQUAL ("Hello, world!"_us.StableHash (), 0xec4d0a0cfd791203u);
+}
+
+TEST_CASE (ConcurrentRegistration)
+{
+    constexpr std::size_t THREAD_COUNT = 4u;
+    constexpr std::size_t STRING_COUNT = 10000u;
+    std::vector<std::vector<Emergence::Memory::UniqueString>> results (THREAD_COUNT);
+    std::vector<std::thread> threads;
+
+    for (std::size_t threadIndex = 0u; threadIndex < THREAD_COUNT; ++threadIndex)
+    {
+        threads.emplace_back (
+            [&results, threadIndex] ()
+            {
+                for (std::size_t index = 0u; index < STRING_COUNT; ++index)
+                {
+                    results[threadIndex].emplace_back (
+                        std::string {"ConcurrentRegistration"} + std::to_string (index));
+                }
+            });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join ();
+    }
+
+    for (std::size_t index = 0u; index < STRING_COUNT; ++index)
+    {
+        const std::string expected = std::string {"ConcurrentRegistration"} + std::to_string (index);
+        CHECK (strcmp (*results[0u][index], expected.c_str ()) == 0);
+
+        for (std::size_t threadIndex = 1u; threadIndex < THREAD_COUNT; ++threadIndex)
+        {
+            CHECK (results[threadIndex][index] == results[0u][index]);
+        }
+    }
+}
+
 END_SUITE
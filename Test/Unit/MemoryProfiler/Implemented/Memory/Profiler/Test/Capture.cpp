@@ -1,3 +1,5 @@
+#include <thread>
+
 #include <Container/Optional.hpp>
 #include <Container/Vector.hpp>
 
@@ -201,4 +203,93 @@ TEST_CASE (EventCapture)
     checkEvents (expectation);
 }
 
+TEST_CASE (MultithreadedCapture)
+{
+    static const Emergence::Memory::UniqueString groupId {"MultithreadedCapture::Group"};
+    AllocationGroup group {AllocationGroup::Root (), groupId};
+
+    constexpr std::size_t THREAD_COUNT = 4u;
+    constexpr std::size_t ITERATIONS = 10000u;
+    Vector<std::thread> threads;
+
+    for (std::size_t index = 0u; index < THREAD_COUNT; ++index)
+    {
+        threads.emplace_back (
+            [&group] ()
+            {
+                for (std::size_t iteration = 0u; iteration < ITERATIONS; ++iteration)
+                {
+                    group.Allocate (16u);
+                    group.Acquire (16u);
+                    group.Release (8u);
+                    group.Free (8u);
+                }
+            });
+    }
+
+    // Capture is done while other threads are still working, therefore
+    // captured state and events after it must sum up into the final state.
+    auto [capturedRoot, observer] = Capture::Start ();
+    for (std::thread &thread : threads)
+    {
+        thread.join ();
+    }
+
+    Optional<CapturedAllocationGroup> capturedGroup;
+    for (auto iterator = capturedRoot.BeginChildren (); iterator != capturedRoot.EndChildren (); ++iterator)
+    {
+        if ((*iterator).GetId () == groupId)
+        {
+            capturedGroup.emplace (*iterator);
+        }
+    }
+
+    REQUIRE (capturedGroup);
+    std::size_t reserved = capturedGroup->GetReserved ();
+    std::size_t acquired = capturedGroup->GetAcquired ();
+    std::uint64_t previousEventTime = capturedRoot.GetCaptureTimeNs ();
+
+    while (const Event *event = observer.NextEvent ())
+    {
+        CHECK (previousEventTime <= event->timeNs);
+        previousEventTime = event->timeNs;
+
+        if (event->group != group)
+        {
+            continue;
+        }
+
+        switch (event->type)
+        {
+        case EventType::ALLOCATE:
+            reserved += event->bytes;
+            break;
+
+        case EventType::ACQUIRE:
+            REQUIRE (reserved >= event->bytes);
+            reserved -= event->bytes;
+            acquired += event->bytes;
+            break;
+
+        case EventType::RELEASE:
+            REQUIRE (acquired >= event->bytes);
+            acquired -= event->bytes;
+            reserved += event->bytes;
+            break;
+
+        case EventType::FREE:
+            REQUIRE (reserved >= event->bytes);
+            reserved -= event->bytes;
+            break;
+
+        case EventType::MARKER:
+            break;
+        }
+    }
+
+    CHECK_EQUAL (reserved, group.GetReserved ());
+    CHECK_EQUAL (acquired, group.GetAcquired ());
+    CHECK_EQUAL (acquired, THREAD_COUNT * ITERATIONS * 8u);
+}
+
 END_SUITE
@@ -114,6 +114,27 @@ static void TrivialCaptureCheck (Recording::Track &_track, Recording::RuntimeRep
     _reporter.End ();
 }
 
+static void CompareRecorded (const Recording::RecordedAllocationGroup &_first,
+                             const Recording::RecordedAllocationGroup &_second)
+{
+    CHECK_EQUAL (_first.GetId (), _second.GetId ());
+    CHECK_EQUAL (_first.GetReserved (), _second.GetReserved ());
+    CHECK_EQUAL (_first.GetAcquired (), _second.GetAcquired ());
+
+    auto firstIterator = _first.BeginChildren ();
+    auto secondIterator = _second.BeginChildren ();
+
+    while (firstIterator != _first.EndChildren () && secondIterator != _second.EndChildren ())
+    {
+        CompareRecorded (**firstIterator, **secondIterator);
+        ++firstIterator;
+        ++secondIterator;
+    }
+
+    CHECK (firstIterator == _first.EndChildren ());
+    CHECK (secondIterator == _second.EndChildren ());
+}
+
 // Check if given profiler group is source of recorded group by comparing ids from root-to-group path.
 static bool IsSource (const Profiler::AllocationGroup &_source, const Recording::RecordedAllocationGroup &_recorded)
 {
@@ -473,6 +494,112 @@ TEST_CASE (CorruptedEvents)
     });
 }
 
+TEST_CASE (Seeking)
+{
+    // Seeking track is compared with the track, that is moved only through sequential event application and undo.
+    Recording::Track seekingTrack;
+    Recording::Track sequentialTrack;
+    auto [capturedRoot, observer] = Profiler::Capture::Start ();
+
+    Recording::RuntimeReporter seekingReporter;
+    seekingReporter.Begin (&seekingTrack, capturedRoot);
+    Recording::RuntimeReporter sequentialReporter;
+    sequentialReporter.Begin (&sequentialTrack, capturedRoot);
+
+    Profiler::AllocationGroup parentGroup {"Seeking::Parent"_us};
+    Profiler::AllocationGroup childGroup {parentGroup, "Seeking::Child"_us};
+
+    // Generate enough events for several keyframes.
+    constexpr std::size_t ITERATIONS = Recording::Track::KEYFRAME_INTERVAL;
+    for (std::size_t index = 0u; index < ITERATIONS; ++index)
+    {
+        childGroup.Allocate (64u + index % 7u);
+        childGroup.Acquire (32u + index % 5u);
+
+        if (index % 3u == 0u)
+        {
+            childGroup.Release (32u + index % 5u);
+        }
+    }
+
+    while (const Profiler::Event *sourceEvent = observer.NextEvent ())
+    {
+        seekingReporter.ReportEvent (*sourceEvent);
+        sequentialReporter.ReportEvent (*sourceEvent);
+    }
+
+    REQUIRE_EQUAL (seekingTrack.GetEventCount (), sequentialTrack.GetEventCount ());
+    REQUIRE (seekingTrack.GetEventCount () > 2u * Recording::Track::KEYFRAME_INTERVAL);
+
+    auto checkSameState = [&seekingTrack, &sequentialTrack] ()
+    {
+        CHECK_EQUAL (seekingTrack.GetAppliedEventCount (), sequentialTrack.GetAppliedEventCount ());
+        if (seekingTrack.Root () && sequentialTrack.Root ())
+        {
+            CompareRecorded (*seekingTrack.Root (), *sequentialTrack.Root ());
+        }
+    };
+
+    auto moveSequentially = [&sequentialTrack] (std::size_t _appliedEventCount)
+    {
+        while (sequentialTrack.GetAppliedEventCount () < _appliedEventCount)
+        {
+            REQUIRE (sequentialTrack.MoveToNextEvent ());
+        }
+
+        while (sequentialTrack.GetAppliedEventCount () > _appliedEventCount)
+        {
+            REQUIRE (sequentialTrack.MoveToPreviousEvent ());
+        }
+    };
+
+    const std::size_t eventCount = seekingTrack.GetEventCount ();
+    const std::size_t targets[] {eventCount,
+                                 Recording::Track::KEYFRAME_INTERVAL + 1u,
+                                 eventCount / 2u,
+                                 Recording::Track::KEYFRAME_INTERVAL,
+                                 eventCount / 2u - 10u,
+                                 0u,
+                                 eventCount - 1u,
+                                 1u};
+
+    for (std::size_t target : targets)
+    {
+        REQUIRE (seekingTrack.MoveToAppliedEventCount (target));
+        moveSequentially (target);
+        checkSameState ();
+    }
+
+    CHECK (!seekingTrack.MoveToAppliedEventCount (eventCount + 1u));
+
+    // Seek to time of some events and check that exactly all events before or at that time are applied.
+    std::size_t eventIndex = 0u;
+    for (auto iterator = seekingTrack.EventBegin (); iterator != seekingTrack.EventEnd ();
+         ++iterator, ++eventIndex)
+    {
+        if (eventIndex % (Recording::Track::KEYFRAME_INTERVAL / 2u + 1u) != 0u)
+        {
+            continue;
+        }
+
+        const std::uint64_t timeNs = (*iterator)->timeNs;
+        REQUIRE (seekingTrack.MoveToTime (timeNs));
+        REQUIRE (*seekingTrack.EventCurrent ());
+        CHECK ((*seekingTrack.EventCurrent ())->timeNs <= timeNs);
+
+        auto next = seekingTrack.EventCurrent ();
+        ++next;
+        CHECK ((next == seekingTrack.EventEnd () || (*next)->timeNs > timeNs));
+
+        moveSequentially (seekingTrack.GetAppliedEventCount ());
+        checkSameState ();
+    }
+
+    REQUIRE (seekingTrack.MoveToTime (0u));
+    moveSequentially (seekingTrack.GetAppliedEventCount ());
+    checkSameState ();
+}
+
 TEST_CASE (EventIteratorCircling)
 {
     Recording::Track track;
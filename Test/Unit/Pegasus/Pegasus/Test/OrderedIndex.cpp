@@ -0,0 +1,304 @@
+#include <algorithm>
+
+#include <Container/Vector.hpp>
+
+#include <Memory/Profiler/Test/DefaultAllocationGroupStub.hpp>
+
+#include <Pegasus/Storage.hpp>
+
+#include <StandardLayout/MappingBuilder.hpp>
+
+#include <Testing/Testing.hpp>
+
+namespace Emergence::Pegasus::Test
+{
+struct KeyedRecord final
+{
+    std::uint32_t id = 0u;
+    std::int32_t key = 0;
+
+    struct Reflection final
+    {
+        StandardLayout::FieldId id;
+        StandardLayout::FieldId key;
+        StandardLayout::Mapping mapping;
+    };
+
+    static const Reflection &Reflect () noexcept;
+};
+
+const KeyedRecord::Reflection &KeyedRecord::Reflect () noexcept
+{
+    static const Reflection reflection = [] ()
+    {
+        using namespace Memory::Literals;
+        StandardLayout::MappingBuilder builder;
+        builder.Begin ("KeyedRecord"_us, sizeof (KeyedRecord), alignof (KeyedRecord));
+
+        Reflection result;
+        result.id = builder.RegisterUInt32 ("id"_us, offsetof (KeyedRecord, id));
+        result.key = builder.RegisterInt32 ("key"_us, offsetof (KeyedRecord, key));
+        result.mapping = builder.End ();
+        return result;
+    }();
+
+    return reflection;
+}
+
+/// \brief Deterministic generator, so failures are reproducible.
+class Random final
+{
+public:
+    std::uint32_t Next () noexcept
+    {
+        state ^= state << 13u;
+        state ^= state >> 17u;
+        state ^= state << 5u;
+        return state;
+    }
+
+    std::int32_t NextKey (std::int32_t _range) noexcept
+    {
+        return static_cast<std::int32_t> (Next () % static_cast<std::uint32_t> (_range));
+    }
+
+private:
+    std::uint32_t state = 2463534242u;
+};
+
+/// \brief Keeps storage with index on key field and index on id field, that is used to edit records
+///        through cursors of other index, and sorted vector of keys, that are expected to be in storage.
+struct Environment final
+{
+    Environment () noexcept
+        : storage (KeyedRecord::Reflect ().mapping),
+          keyIndex (storage.CreateOrderedIndex (KeyedRecord::Reflect ().key)),
+          idIndex (storage.CreateOrderedIndex (KeyedRecord::Reflect ().id)),
+          expected (Memory::Profiler::AllocationGroup::Top ())
+    {
+    }
+
+    void Insert (std::size_t _count, std::int32_t _keyRange, bool _bulk = false) noexcept
+    {
+        Storage::Allocator allocator = _bulk ? storage.AllocateAndInsertBulk () : storage.AllocateAndInsert ();
+        for (std::size_t index = 0u; index < _count; ++index)
+        {
+            // Mapping has no constructor, therefore we construct records manually.
+            auto *record = new (allocator.Next ()) KeyedRecord {};
+            record->id = nextId++;
+            record->key = random.NextKey (_keyRange);
+            expected.emplace_back (record->key);
+        }
+
+        std::sort (expected.begin (), expected.end ());
+    }
+
+    /// \brief Uses edit cursor of key index to delete every `_deletionPeriod`-th record
+    ///        and to change key of every `_changePeriod`-th record.
+    template <typename Cursor>
+    void EditThroughKeyIndex (Cursor _cursor, std::size_t _deletionPeriod, std::size_t _changePeriod)
+    {
+        Edit (std::move (_cursor), _deletionPeriod, _changePeriod);
+    }
+
+    /// \brief Same as ::EditThroughKeyIndex, but uses cursor of id index, therefore key index is updated right away.
+    void EditThroughIdIndex (std::size_t _deletionPeriod, std::size_t _changePeriod)
+    {
+        Edit (idIndex->LookupToEditDescending ({nullptr}, {nullptr}), _deletionPeriod, _changePeriod);
+    }
+
+    template <typename Cursor>
+    void Edit (Cursor _cursor, std::size_t _deletionPeriod, std::size_t _changePeriod)
+    {
+        std::size_t visited = 0u;
+        while (auto *record = static_cast<KeyedRecord *> (*_cursor))
+        {
+            ++visited;
+            auto iterator = std::lower_bound (expected.begin (), expected.end (), record->key);
+            REQUIRE (iterator != expected.end ());
+            REQUIRE (*iterator == record->key);
+
+            if (visited % _deletionPeriod == 0u)
+            {
+                expected.erase (iterator);
+                ~_cursor;
+            }
+            else
+            {
+                if (visited % _changePeriod == 0u)
+                {
+                    expected.erase (iterator);
+                    record->key = random.NextKey (1000);
+                    expected.insert (std::upper_bound (expected.begin (), expected.end (), record->key), record->key);
+                }
+
+                ++_cursor;
+            }
+        }
+    }
+
+    void CheckRange (const std::int32_t *_min, const std::int32_t *_max)
+    {
+        auto begin = _min ? std::lower_bound (expected.begin (), expected.end (), *_min) : expected.begin ();
+        auto end = _max ? std::upper_bound (expected.begin (), expected.end (), *_max) : expected.end ();
+
+        {
+            auto iterator = begin;
+            OrderedIndex::AscendingReadCursor cursor = keyIndex->LookupToReadAscending ({_min}, {_max});
+
+            while (const auto *record = static_cast<const KeyedRecord *> (*cursor))
+            {
+                REQUIRE (iterator != end);
+                CHECK_EQUAL (record->key, *iterator);
+                ++iterator;
+                ++cursor;
+            }
+
+            CHECK (iterator == end);
+        }
+
+        {
+            auto iterator = end;
+            OrderedIndex::DescendingReadCursor cursor = keyIndex->LookupToReadDescending ({_min}, {_max});
+
+            while (const auto *record = static_cast<const KeyedRecord *> (*cursor))
+            {
+                REQUIRE (iterator != begin);
+                --iterator;
+                CHECK_EQUAL (record->key, *iterator);
+                ++cursor;
+            }
+
+            CHECK (iterator == begin);
+        }
+    }
+
+    void CheckRandomRanges (std::size_t _count)
+    {
+        CheckRange (nullptr, nullptr);
+        for (std::size_t index = 0u; index < _count; ++index)
+        {
+            std::int32_t min = random.NextKey (1100) - 50;
+            std::int32_t max = min + random.NextKey (200);
+
+            CheckRange (&min, &max);
+            CheckRange (&min, nullptr);
+            CheckRange (nullptr, &max);
+        }
+    }
+
+    Storage storage;
+    Handling::Handle<OrderedIndex> keyIndex;
+    Handling::Handle<OrderedIndex> idIndex;
+    Container::Vector<std::int32_t> expected;
+    Random random;
+    std::uint32_t nextId = 0u;
+};
+} // namespace Emergence::Pegasus::Test
+
+using namespace Emergence::Pegasus;
+using namespace Emergence::Pegasus::Test;
+
+BEGIN_SUITE (OrderedIndex)
+
+TEST_CASE (ManyDuplicates)
+{
+    Environment environment;
+    environment.Insert (5000u, 10);
+    environment.CheckRandomRanges (16u);
+}
+
+TEST_CASE (InsertionsSplitNodes)
+{
+    Environment environment;
+    for (std::size_t round = 0u; round < 10u; ++round)
+    {
+        environment.Insert (1000u, 1000);
+        environment.CheckRandomRanges (8u);
+    }
+}
+
+TEST_CASE (EditThroughOwnCursors)
+{
+    Environment environment;
+    environment.Insert (5000u, 1000);
+
+    environment.EditThroughKeyIndex (environment.keyIndex->LookupToEditAscending ({nullptr}, {nullptr}), 3u, 5u);
+    environment.CheckRandomRanges (16u);
+
+    environment.EditThroughKeyIndex (environment.keyIndex->LookupToEditDescending ({nullptr}, {nullptr}), 4u, 7u);
+    environment.CheckRandomRanges (16u);
+
+    // Changing most of the records triggers full rebuild instead of reinsertion.
+    environment.EditThroughKeyIndex (environment.keyIndex->LookupToEditAscending ({nullptr}, {nullptr}), 1000000u,
+                                     1u);
+    environment.CheckRandomRanges (16u);
+
+    const std::int32_t min = 200;
+    const std::int32_t max = 600;
+    environment.EditThroughKeyIndex (environment.keyIndex->LookupToEditAscending ({&min}, {&max}), 2u, 3u);
+    environment.CheckRandomRanges (16u);
+}
+
+TEST_CASE (EditThroughOtherIndex)
+{
+    Environment environment;
+    environment.Insert (5000u, 1000);
+
+    environment.EditThroughIdIndex (3u, 5u);
+    environment.CheckRandomRanges (16u);
+
+    environment.EditThroughIdIndex (2u, 1u);
+    environment.CheckRandomRanges (16u);
+}
+
+TEST_CASE (DeleteEverythingAndRefill)
+{
+    Environment environment;
+    environment.Insert (5000u, 1000);
+
+    environment.EditThroughKeyIndex (environment.keyIndex->LookupToEditAscending ({nullptr}, {nullptr}), 1u, 1u);
+    CHECK (environment.expected.empty ());
+    environment.CheckRandomRanges (4u);
+
+    environment.Insert (3000u, 1000);
+    environment.CheckRandomRanges (16u);
+
+    environment.EditThroughIdIndex (1u, 1u);
+    CHECK (environment.expected.empty ());
+    environment.CheckRandomRanges (4u);
+
+    environment.Insert (3000u, 1000);
+    environment.CheckRandomRanges (16u);
+}
+
+TEST_CASE (BulkInsertion)
+{
+    Environment environment;
+    environment.Insert (5000u, 1000, true);
+    environment.CheckRandomRanges (16u);
+
+    // Small batch is inserted record by record, big batch is merged with existing records.
+    environment.Insert (10u, 1000, true);
+    environment.CheckRandomRanges (16u);
+
+    environment.Insert (5000u, 1000, true);
+    environment.CheckRandomRanges (16u);
+
+    environment.EditThroughIdIndex (3u, 5u);
+    environment.CheckRandomRanges (16u);
+}
+
+TEST_CASE (ClearAndRefill)
+{
+    Environment environment;
+    environment.Insert (5000u, 1000);
+    environment.storage.Clear ();
+    environment.expected.clear ();
+    environment.CheckRandomRanges (4u);
+
+    environment.Insert (5000u, 1000);
+    environment.CheckRandomRanges (16u);
+}
+
+END_SUITE
@@ -0,0 +1,284 @@
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+
+#include <Container/Vector.hpp>
+
+#include <Memory/Profiler/Test/DefaultAllocationGroupStub.hpp>
+
+#include <Pegasus/Storage.hpp>
+
+#include <StandardLayout/MappingBuilder.hpp>
+
+#include <Testing/Testing.hpp>
+
+namespace Emergence::Pegasus::Test
+{
+struct BoxRecord final
+{
+    std::uint32_t id = 0u;
+    float minX = 0.0f;
+    float minY = 0.0f;
+    float maxX = 0.0f;
+    float maxY = 0.0f;
+
+    struct Reflection final
+    {
+        StandardLayout::FieldId id;
+        StandardLayout::FieldId minX;
+        StandardLayout::FieldId minY;
+        StandardLayout::FieldId maxX;
+        StandardLayout::FieldId maxY;
+        StandardLayout::Mapping mapping;
+    };
+
+    static const Reflection &Reflect () noexcept;
+};
+
+const BoxRecord::Reflection &BoxRecord::Reflect () noexcept
+{
+    static const Reflection reflection = [] ()
+    {
+        using namespace Memory::Literals;
+        StandardLayout::MappingBuilder builder;
+        builder.Begin ("BoxRecord"_us, sizeof (BoxRecord), alignof (BoxRecord));
+
+        Reflection result;
+        result.id = builder.RegisterUInt32 ("id"_us, offsetof (BoxRecord, id));
+        result.minX = builder.RegisterFloat ("minX"_us, offsetof (BoxRecord, minX));
+        result.minY = builder.RegisterFloat ("minY"_us, offsetof (BoxRecord, minY));
+        result.maxX = builder.RegisterFloat ("maxX"_us, offsetof (BoxRecord, maxX));
+        result.maxY = builder.RegisterFloat ("maxY"_us, offsetof (BoxRecord, maxY));
+        result.mapping = builder.End ();
+        return result;
+    }();
+
+    return reflection;
+}
+
+constexpr float WORLD_SIZE = 1000.0f;
+
+/// \brief Deterministic generator, so failures are reproducible.
+class Random final
+{
+public:
+    std::uint32_t Next () noexcept
+    {
+        state ^= state << 13u;
+        state ^= state >> 17u;
+        state ^= state << 5u;
+        return state;
+    }
+
+    float NextCoordinate (float _range) noexcept
+    {
+        return static_cast<float> (Next () % 100000u) / 100000.0f * _range;
+    }
+
+private:
+    std::uint32_t state = 2463534242u;
+};
+
+/// \brief Shape in the same layout as volumetric index expects: min and max for every dimension.
+using QueryShape = std::array<float, 4u>;
+
+/// \brief Keeps storage with volumetric index, index on id field, that is used to edit records
+///        through cursors of other index, and copies of records, that are expected to be in storage.
+struct Environment final
+{
+    Environment () noexcept
+        : storage (BoxRecord::Reflect ().mapping),
+          volumetricIndex (storage.CreateVolumetricIndex (CreateDimensions ())),
+          idIndex (storage.CreateOrderedIndex (BoxRecord::Reflect ().id)),
+          expected (Memory::Profiler::AllocationGroup::Top ())
+    {
+    }
+
+    static Container::Vector<VolumetricIndex::DimensionDescriptor> CreateDimensions () noexcept
+    {
+        auto toPlaceholder = [] (float _value)
+        {
+            VolumetricIndex::ValuePlaceholder placeholder {};
+            memcpy (placeholder.data (), &_value, sizeof (_value));
+            return placeholder;
+        };
+
+        const BoxRecord::Reflection &reflection = BoxRecord::Reflect ();
+        return {{reflection.minX, toPlaceholder (0.0f), reflection.maxX, toPlaceholder (WORLD_SIZE)},
+                {reflection.minY, toPlaceholder (0.0f), reflection.maxY, toPlaceholder (WORLD_SIZE)}};
+    }
+
+    void Insert (std::size_t _count) noexcept
+    {
+        Storage::Allocator allocator = storage.AllocateAndInsert ();
+        for (std::size_t index = 0u; index < _count; ++index)
+        {
+            // Mapping has no constructor, therefore we construct records manually.
+            auto *record = new (allocator.Next ()) BoxRecord {};
+            record->id = static_cast<std::uint32_t> (expected.size ());
+            Place (*record);
+            expected.emplace_back (*record);
+        }
+    }
+
+    /// \brief Moves record to random place, so its partitioning is most likely changed.
+    void Place (BoxRecord &_record) noexcept
+    {
+        const float size = 1.0f + random.NextCoordinate (8.0f);
+        _record.minX = random.NextCoordinate (WORLD_SIZE - size);
+        _record.minY = random.NextCoordinate (WORLD_SIZE - size);
+        _record.maxX = _record.minX + size;
+        _record.maxY = _record.minY + size;
+    }
+
+    /// \brief Shifts record by small distance, so its partitioning is most likely unchanged.
+    void Nudge (BoxRecord &_record) noexcept
+    {
+        const float offset = random.NextCoordinate (0.5f);
+        if (_record.minX > offset)
+        {
+            _record.minX -= offset;
+            _record.maxX -= offset;
+        }
+
+        if (_record.minY > offset)
+        {
+            _record.minY -= offset;
+        }
+    }
+
+    /// \brief Visits records through given edit cursor, deletes every `_deletionPeriod`-th record,
+    ///        moves every `_placePeriod`-th record and nudges every other record.
+    template <typename Cursor>
+    void Edit (Cursor _cursor, std::size_t _deletionPeriod, std::size_t _placePeriod)
+    {
+        std::size_t visited = 0u;
+        while (auto *record = static_cast<BoxRecord *> (*_cursor))
+        {
+            ++visited;
+            REQUIRE (record->id < expected.size ());
+            REQUIRE (expected[record->id].id == record->id);
+
+            if (visited % _deletionPeriod == 0u)
+            {
+                // Deleted records are marked by id, that never matches their index.
+                expected[record->id].id = std::numeric_limits<std::uint32_t>::max ();
+                ~_cursor;
+            }
+            else
+            {
+                if (visited % _placePeriod == 0u)
+                {
+                    Place (*record);
+                }
+                else
+                {
+                    Nudge (*record);
+                }
+
+                expected[record->id] = *record;
+                ++_cursor;
+            }
+        }
+    }
+
+    void CheckShape (const QueryShape &_shape)
+    {
+        Container::Vector<std::uint32_t> expectedIds {Memory::Profiler::AllocationGroup::Top ()};
+        for (std::size_t index = 0u; index < expected.size (); ++index)
+        {
+            const BoxRecord &record = expected[index];
+            if (record.id == index && record.maxX >= _shape[0u] && record.minX <= _shape[1u] &&
+                record.maxY >= _shape[2u] && record.minY <= _shape[3u])
+            {
+                expectedIds.emplace_back (record.id);
+            }
+        }
+
+        Container::Vector<std::uint32_t> foundIds {Memory::Profiler::AllocationGroup::Top ()};
+        VolumetricIndex::ShapeIntersectionReadCursor cursor =
+            volumetricIndex->LookupShapeIntersectionToRead (_shape.data ());
+
+        while (const auto *record = static_cast<const BoxRecord *> (*cursor))
+        {
+            foundIds.emplace_back (record->id);
+            ++cursor;
+        }
+
+        std::sort (foundIds.begin (), foundIds.end ());
+        CHECK (foundIds == expectedIds);
+    }
+
+    void CheckRandomShapes (std::size_t _count)
+    {
+        CheckShape ({0.0f, WORLD_SIZE, 0.0f, WORLD_SIZE});
+        for (std::size_t index = 0u; index < _count; ++index)
+        {
+            const float size = 1.0f + random.NextCoordinate (200.0f);
+            const float minX = random.NextCoordinate (WORLD_SIZE - size);
+            const float minY = random.NextCoordinate (WORLD_SIZE - size);
+            CheckShape ({minX, minX + size, minY, minY + size});
+        }
+    }
+
+    Storage storage;
+    Handling::Handle<VolumetricIndex> volumetricIndex;
+    Handling::Handle<OrderedIndex> idIndex;
+
+    /// \brief Copies of records, indexed by id.
+    Container::Vector<BoxRecord> expected;
+
+    Random random;
+};
+} // namespace Emergence::Pegasus::Test
+
+using namespace Emergence::Pegasus;
+using namespace Emergence::Pegasus::Test;
+
+BEGIN_SUITE (VolumetricIndex)
+
+TEST_CASE (Lookup)
+{
+    Environment environment;
+    environment.Insert (3000u);
+    environment.CheckRandomShapes (64u);
+}
+
+TEST_CASE (EditThroughOwnCursor)
+{
+    Environment environment;
+    environment.Insert (3000u);
+
+    const QueryShape center {200.0f, 800.0f, 200.0f, 800.0f};
+    environment.Edit (environment.volumetricIndex->LookupShapeIntersectionToEdit (center.data ()), 5u, 3u);
+    environment.CheckRandomShapes (64u);
+
+    const QueryShape everything {0.0f, WORLD_SIZE, 0.0f, WORLD_SIZE};
+    environment.Edit (environment.volumetricIndex->LookupShapeIntersectionToEdit (everything.data ()), 1000000u, 7u);
+    environment.CheckRandomShapes (64u);
+}
+
+TEST_CASE (EditThroughOtherIndex)
+{
+    Environment environment;
+    environment.Insert (3000u);
+
+    environment.Edit (environment.idIndex->LookupToEditAscending ({nullptr}, {nullptr}), 4u, 5u);
+    environment.CheckRandomShapes (64u);
+}
+
+TEST_CASE (DeleteEverythingAndRefill)
+{
+    Environment environment;
+    environment.Insert (3000u);
+
+    const QueryShape everything {0.0f, WORLD_SIZE, 0.0f, WORLD_SIZE};
+    environment.Edit (environment.volumetricIndex->LookupShapeIntersectionToEdit (everything.data ()), 1u, 1u);
+    environment.CheckRandomShapes (8u);
+
+    environment.Insert (3000u);
+    environment.CheckRandomShapes (64u);
+}
+
+END_SUITE
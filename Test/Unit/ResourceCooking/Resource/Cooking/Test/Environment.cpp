@@ -64,12 +64,15 @@ void PrepareEnvironmentAndSetupContext (Context &_context, const Environment &_e
         REQUIRE (std::filesystem::remove_all (ENVIRONMENT_ROOT));
     }
 
+    UpdateEnvironment (_environment);
+    SetupContext (_context);
+}
+
+void UpdateEnvironment (const Environment &_environment)
+{
     const Container::Utf8String inputRoot =
         EMERGENCE_BUILD_STRING (ENVIRONMENT_ROOT, VirtualFileSystem::PATH_SEPARATOR, INPUT_ROOT);
 
-    const Container::Utf8String workspaceRoot =
-        EMERGENCE_BUILD_STRING (ENVIRONMENT_ROOT, VirtualFileSystem::PATH_SEPARATOR, WORKSPACE_ROOT);
-
     std::filesystem::create_directories (inputRoot);
     auto serializeObject = [&inputRoot] (const auto &_resourceObject)
     {
@@ -119,6 +122,15 @@ void PrepareEnvironmentAndSetupContext (Context &_context, const Environment &_e
         output.write (reinterpret_cast<const char *> (resource.data.data ()),
                       static_cast<std::streamsize> (resource.data.size ()));
     }
+}
+
+void SetupContext (Context &_context)
+{
+    const Container::Utf8String inputRoot =
+        EMERGENCE_BUILD_STRING (ENVIRONMENT_ROOT, VirtualFileSystem::PATH_SEPARATOR, INPUT_ROOT);
+
+    const Container::Utf8String workspaceRoot =
+        EMERGENCE_BUILD_STRING (ENVIRONMENT_ROOT, VirtualFileSystem::PATH_SEPARATOR, WORKSPACE_ROOT);
 
     REQUIRE (
         _context.Setup ({{{VirtualFileSystem::MountSource::FILE_SYSTEM, inputRoot, "TestResources"}}}, workspaceRoot));
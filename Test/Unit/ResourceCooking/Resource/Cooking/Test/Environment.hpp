@@ -60,5 +60,9 @@ const Container::MappingRegistry &GetResourceObjectTypes () noexcept;
 
 void PrepareEnvironmentAndSetupContext (Context &_context, const Environment &_environment);
 
+void UpdateEnvironment (const Environment &_environment);
+
+void SetupContext (Context &_context);
+
 Container::Utf8String GetFinalResultRealPath (const Context &_context, const std::string_view &_resultName) noexcept;
 } // namespace Emergence::Resource::Cooking::Test
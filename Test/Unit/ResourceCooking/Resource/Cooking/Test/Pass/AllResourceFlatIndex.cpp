@@ -58,6 +58,42 @@ TEST_CASE (AllResourceFlatIndex)
     REQUIRE (checkProvider.LoadThirdPartyResource ("Something.someformat"_us, heap, size, content) ==
              Emergence::Resource::Provider::LoadingOperationResponse::SUCCESSFUL);
     heap.Release (content, static_cast<std::size_t> (size));
+
+    // Package is not mapped, therefore view is not available.
+    CHECK (checkProvider.GetThirdPartyResourceView ("Something.someformat"_us).empty ());
+}
+
+TEST_CASE (ThirdPartyResourceViewFromMappedPackage)
+{
+    Context context {GetResourceObjectTypes (), {}};
+    PrepareEnvironmentAndSetupContext (context,
+                                       {{}, {}, {{"ThirdParty/Something.someformat", {13u, 11u, 111u, 174u}}}});
+
+    REQUIRE (AllResourceImportPass (context));
+    REQUIRE (AllResourceFlatIndexPass (context));
+    REQUIRE (ProduceFlatPackage (context, "CoreResources.pack"));
+
+    Emergence::VirtualFileSystem::Context checkSystem;
+    REQUIRE (checkSystem.Mount (checkSystem.GetRoot (),
+                                {Emergence::VirtualFileSystem::MountSource::MAPPED_PACKAGE,
+                                 GetFinalResultRealPath (context, "CoreResources.pack"), "Package"}));
+
+    Emergence::Resource::Provider::ResourceProvider checkProvider {&checkSystem, GetResourceObjectTypes (), {}};
+    REQUIRE (checkProvider.AddSource ("Package"_us) ==
+             Emergence::Resource::Provider::SourceOperationResponse::SUCCESSFUL);
+
+    const std::span<const std::uint8_t> view = checkProvider.GetThirdPartyResourceView ("Something.someformat"_us);
+    REQUIRE_EQUAL (view.size (), 4u);
+    CHECK_EQUAL (view[0u], 13u);
+    CHECK_EQUAL (view[1u], 11u);
+    CHECK_EQUAL (view[2u], 111u);
+    CHECK_EQUAL (view[3u], 174u);
+
+    // View is owned by the mount, therefore removing source does not invalidate it.
+    REQUIRE (checkProvider.RemoveSource ("Package"_us) ==
+             Emergence::Resource::Provider::SourceOperationResponse::SUCCESSFUL);
+    CHECK_EQUAL (view[3u], 174u);
+    CHECK (checkProvider.GetThirdPartyResourceView ("Something.someformat"_us).empty ());
 }
 
 END_SUITE
@@ -1,16 +1,44 @@
+#include <iterator>
+
 #include <Container/StringBuilder.hpp>
 
 #include <Resource/Cooking/Pass/AllResourceImport.hpp>
 #include <Resource/Cooking/Pass/BinaryConversion.hpp>
 #include <Resource/Cooking/Test/Environment.hpp>
 
+#include <Serialization/Binary.hpp>
+
 #include <Testing/Testing.hpp>
 
+#include <VirtualFileSystem/Reader.hpp>
+
 using namespace Emergence::Container;
 using namespace Emergence::Memory::Literals;
 using namespace Emergence::Resource::Cooking::Test;
 using namespace Emergence::Resource::Cooking;
 
+static FirstObjectType ReadConvertedFirstObject (const Context &_context, Emergence::Memory::UniqueString _id)
+{
+    Optional<ObjectData> objectData = _context.GetResourceList ().QueryObject (_id);
+    REQUIRE (objectData);
+    REQUIRE (objectData->format == Emergence::Resource::Provider::ObjectFormat::BINARY);
+
+    Emergence::VirtualFileSystem::Reader reader {objectData->entry};
+    REQUIRE (reader);
+    const Vector<std::uint8_t> content {std::istreambuf_iterator<char> {reader.InputStream ()},
+                                        std::istreambuf_iterator<char> {}};
+
+    std::span<const std::uint8_t> input {content.data (), content.size ()};
+    Emergence::Serialization::Binary::FormatVersion version;
+    REQUIRE (Emergence::Serialization::Binary::DeserializeTypeName (input, version) ==
+             FirstObjectType::Reflect ().mapping.GetName ());
+
+    FirstObjectType object;
+    REQUIRE (Emergence::Serialization::Binary::DeserializeObject (input, &object, FirstObjectType::Reflect ().mapping,
+                                                                  {}, version));
+    return object;
+}
+
 BEGIN_SUITE (PassBinaryConversion)
 
 TEST_CASE (AllResourceImport)
@@ -50,4 +78,38 @@ TEST_CASE (AllResourceImport)
     CHECK (thirdPartyData->entry);
 }
 
+TEST_CASE (IncrementalConversion)
+{
+    const Environment initialEnvironment {
+        {{"Building/B_Tower.yaml", {"Tower"_us, 3, 3}}, {"Building/B_Barrack.yaml", {"Barack"_us, 4, 2}}},
+        {},
+        {},
+    };
+
+    std::chrono::time_point<std::chrono::file_clock> barrackConversionTime;
+    {
+        Context context {GetResourceObjectTypes (), {}};
+        PrepareEnvironmentAndSetupContext (context, initialEnvironment);
+        REQUIRE (AllResourceImportPass (context));
+        REQUIRE (BinaryConversionPass (context));
+
+        CHECK_EQUAL (ReadConvertedFirstObject (context, "B_Tower"_us).width, 3u);
+        CHECK_EQUAL (ReadConvertedFirstObject (context, "B_Barrack"_us).width, 4u);
+        barrackConversionTime = context.GetResourceList ().QueryObject ("B_Barrack"_us)->entry.GetLastWriteTime ();
+    }
+
+    // Tower source is changed, therefore it must be converted again. Barrack must be taken from cache.
+    UpdateEnvironment ({{{"Building/B_Tower.yaml", {"Tower"_us, 5, 3}}}, {}, {}});
+
+    Context context {GetResourceObjectTypes (), {}};
+    SetupContext (context);
+    REQUIRE (AllResourceImportPass (context));
+    REQUIRE (BinaryConversionPass (context));
+
+    CHECK_EQUAL (ReadConvertedFirstObject (context, "B_Tower"_us).width, 5u);
+    CHECK_EQUAL (ReadConvertedFirstObject (context, "B_Barrack"_us).width, 4u);
+    CHECK (context.GetResourceList ().QueryObject ("B_Barrack"_us)->entry.GetLastWriteTime () ==
+           barrackConversionTime);
+}
+
 END_SUITE
@@ -1,6 +1,7 @@
 #include <sstream>
 
 #include <Container/InplaceVector.hpp>
+#include <Container/Vector.hpp>
 
 #include <Memory/Profiler/Test/DefaultAllocationGroupStub.hpp>
 
@@ -26,6 +27,43 @@ void ObjectSerializationDeserializationTest (const Type &_value)
     CHECK (DeserializeObject (buffer, &deserialized, Type::Reflect ().mapping, GetPatchableTypesRegistry ()));
     CHECK_EQUAL (_value, deserialized);
 }
+
+template <typename Type>
+void ObjectBufferSerializationDeserializationTest (const Type &_value)
+{
+    Emergence::Container::Vector<std::uint8_t> buffer;
+    SerializeTypeName (buffer, Type::Reflect ().mapping.GetName ());
+    SerializeObject (buffer, &_value, Type::Reflect ().mapping);
+
+    std::span<const std::uint8_t> input {buffer.data (), buffer.size ()};
+    FormatVersion version = FormatVersion::STREAM;
+    CHECK_EQUAL (DeserializeTypeName (input, version), Type::Reflect ().mapping.GetName ());
+    CHECK (version == FormatVersion::PLANNED);
+
+    Type deserialized;
+    CHECK (DeserializeObject (input, &deserialized, Type::Reflect ().mapping, GetPatchableTypesRegistry (), version));
+    CHECK (input.empty ());
+    CHECK_EQUAL (_value, deserialized);
+}
+
+template <typename Type>
+void ObjectStreamToSpanCompatibilityTest (const Type &_value)
+{
+    std::stringstream stream;
+    SerializeTypeName (stream, Type::Reflect ().mapping.GetName ());
+    SerializeObject (stream, &_value, Type::Reflect ().mapping);
+    const std::string data = stream.str ();
+
+    std::span<const std::uint8_t> input {reinterpret_cast<const std::uint8_t *> (data.data ()), data.size ()};
+    FormatVersion version = FormatVersion::PLANNED;
+    CHECK_EQUAL (DeserializeTypeName (input, version), Type::Reflect ().mapping.GetName ());
+    CHECK (version == FormatVersion::STREAM);
+
+    Type deserialized;
+    CHECK (DeserializeObject (input, &deserialized, Type::Reflect ().mapping, GetPatchableTypesRegistry (), version));
+    CHECK (input.empty ());
+    CHECK_EQUAL (_value, deserialized);
+}
 } // namespace Emergence::Serialization::Binary::Test
 
 using namespace Emergence::Serialization::Test;
@@ -36,3 +74,15 @@ BEGIN_SUITE (Binary)
 OBJECT_SERIALIZATION_TESTS (ObjectSerializationDeserializationTest)
 
 END_SUITE
+
+BEGIN_SUITE (BinaryBuffer)
+
+OBJECT_SERIALIZATION_TESTS (ObjectBufferSerializationDeserializationTest)
+
+END_SUITE
+
+BEGIN_SUITE (BinaryStreamToSpan)
+
+OBJECT_SERIALIZATION_TESTS (ObjectStreamToSpanCompatibilityTest)
+
+END_SUITE
@@ -8,6 +8,8 @@
 #include <Serialization/Test/Types.hpp>
 #include <Serialization/Yaml.hpp>
 
+#include <StandardLayout/PatchBuilder.hpp>
+
 #include <Testing/Testing.hpp>
 
 namespace Emergence::Serialization::Yaml::Test
@@ -24,6 +26,13 @@ void ObjectSerializationDeserializationTest (const Type &_value)
     CHECK (DeserializeObject (buffer, &deserialized, Type::Reflect ().mapping, GetPatchableTypesRegistry ()));
     CHECK_EQUAL (_value, deserialized);
 }
+
+template <typename Type>
+bool DeserializeFromString (const std::string &_input, Type &_output)
+{
+    std::stringstream buffer {_input};
+    return DeserializeObject (buffer, &_output, Type::Reflect ().mapping, GetPatchableTypesRegistry ());
+}
 } // namespace Emergence::Serialization::Yaml::Test
 
 using namespace Emergence::Serialization::Test;
@@ -34,4 +43,56 @@ BEGIN_SUITE (Yaml)
 
 OBJECT_SERIALIZATION_TESTS (ObjectSerializationDeserializationTest)
 
+TEST_CASE (HandwrittenScalars)
+{
+    NonTrivialStruct value;
+    REQUIRE (DeserializeFromString ("# NonTrivialStruct\n"
+                                    "alive: Yes\n"
+                                    "poisoned: off\n"
+                                    "stunned: TRUE\n"
+                                    "string: \"Quoted text\"\n"
+                                    "uniqueString: Plain text\n",
+                                    value));
+
+    CHECK_EQUAL (value, (NonTrivialStruct {
+                            (1u << NonTrivialStruct::ALIVE_OFFSET) | (1u << NonTrivialStruct::STUNNED_OFFSET),
+                            {"Quoted text\0"},
+                            Emergence::Memory::UniqueString {"Plain text"},
+                        }));
+
+    SimpleTestStruct numbers;
+    REQUIRE (DeserializeFromString ("{a: 0x1F, b: +42}", numbers));
+    CHECK_EQUAL (numbers, (SimpleTestStruct {31u, 42u}));
+}
+
+TEST_CASE (PatchContentBeforeType)
+{
+    const OneLevelNestingStruct initial {{13u, 197u}, {1738u, 219874132u}};
+    const OneLevelNestingStruct changed {{14u, 197u}, {1739u, 219874132u}};
+    const PatchStruct expected {Emergence::StandardLayout::PatchBuilder::FromDifference (
+        OneLevelNestingStruct::Reflect ().mapping, &changed, &initial)};
+
+    PatchStruct value;
+    REQUIRE (DeserializeFromString (std::string {"patch:\n"
+                                                 "  content:\n"
+                                                 "    first:\n"
+                                                 "      a: 14\n"
+                                                 "    second:\n"
+                                                 "      a: 1739\n"
+                                                 "  type: "} +
+                                        *OneLevelNestingStruct::Reflect ().mapping.GetName () + "\n",
+                                    value));
+    CHECK_EQUAL (value, expected);
+}
+
+TEST_CASE (InvalidInput)
+{
+    SimpleTestStruct value;
+    CHECK (!DeserializeFromString ("a: 1\nc: 2\n", value));
+    CHECK (!DeserializeFromString ("a: -1\n", value));
+    CHECK (!DeserializeFromString ("a: [1, 2]\n", value));
+    CHECK (!DeserializeFromString ("- a: 1\n", value));
+    CHECK (!DeserializeFromString ("a: {b: 1\n", value));
+}
+
 END_SUITE
@@ -27,7 +27,7 @@ struct TimeInterval
     std::chrono::high_resolution_clock::time_point end;
 };
 
-void GrowAndTest (const Seed &_seed)
+void GrowAndTest (const Seed &_seed, std::size_t _executions = 2u)
 {
     Container::Vector<TimeInterval> intervals;
     intervals.reserve (_seed.size ());
@@ -60,8 +60,7 @@ void GrowAndTest (const Seed &_seed)
         }
     }
 
-    Executor executor {collection};
-    auto executeAndTest = [&executor, &intervals, &collection] ()
+    auto executeAndTest = [&intervals, &collection] (Executor &executor)
     {
         executor.Execute ();
         for (std::size_t sourceIndex = 0u; sourceIndex < collection.tasks.size (); ++sourceIndex)
@@ -83,9 +82,20 @@ void GrowAndTest (const Seed &_seed)
         }
     };
 
-    // Execute and test twice to make sure that executors are reusable.
-    executeAndTest ();
-    executeAndTest ();
+    // Scheduling hints must never affect correctness, therefore we test every combination.
+    for (const SchedulingHints &hints : {SchedulingHints {false, false}, SchedulingHints {true, false},
+                                         SchedulingHints {true, true}})
+    {
+        LOG ("Prioritize critical path: ", hints.prioritizeCriticalPath,
+             ", use measured durations: ", hints.useMeasuredDurations, ".");
+        Executor executor {collection, hints};
+
+        // Execute and test several times to make sure that executors are reusable.
+        for (std::size_t execution = 0u; execution < _executions; ++execution)
+        {
+            executeAndTest (executor);
+        }
+    }
 }
 } // namespace Emergence::Task::Test
 
@@ -140,4 +150,17 @@ TEST_CASE (ReversedRegistrationOrder)
     GrowAndTest ({{"C"_us, {}}, {"B"_us, {"C"_us}}, {"A"_us, {"B"_us}}});
 }
 
+TEST_CASE (UnbalancedBranchesReprioritization)
+{
+    // Enough executions for executors that measure durations to recalculate priorities several times.
+    GrowAndTest ({{"A"_us, {"B1"_us, "B2"_us, "C"_us}},
+                  {"B1"_us, {"B2"_us}},
+                  {"B2"_us, {"B3"_us}},
+                  {"B3"_us, {"D"_us}},
+                  {"C"_us, {"D"_us}},
+                  {"E"_us, {"D"_us}},
+                  {"D"_us, {}}},
+                 200u);
+}
+
 END_SUITE
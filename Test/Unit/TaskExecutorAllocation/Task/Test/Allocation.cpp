@@ -0,0 +1,160 @@
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+#include <Memory/Profiler/Capture.hpp>
+#include <Memory/Profiler/Test/DefaultAllocationGroupStub.hpp>
+#include <Memory/UniqueString.hpp>
+
+#include <Task/Executor.hpp>
+
+#include <Testing/Testing.hpp>
+
+// We replace global allocation functions to count allocations that bypass memory profiler, for example
+// heap allocations of std::function captures. This test is built as separate executable, so replacement
+// does not affect other tests. Array, sized and nothrow versions forward to these functions by default,
+// but aligned versions do not, therefore they are replaced too.
+static std::atomic_size_t globalAllocationCount = 0u;
+
+void *operator new (std::size_t _size)
+{
+    globalAllocationCount.fetch_add (1u, std::memory_order_relaxed);
+    if (void *memory = std::malloc (_size > 0u ? _size : 1u))
+    {
+        return memory;
+    }
+
+    throw std::bad_alloc {};
+}
+
+void *operator new (std::size_t _size, std::align_val_t _alignment)
+{
+    globalAllocationCount.fetch_add (1u, std::memory_order_relaxed);
+
+    // Alignment is done manually, because std::aligned_alloc is not available on every platform.
+    // Pointer to allocated block is stored right before aligned address in order to free it later.
+    const auto alignment = static_cast<std::size_t> (_alignment);
+    void *block = std::malloc (_size + alignment + sizeof (void *));
+
+    if (!block)
+    {
+        throw std::bad_alloc {};
+    }
+
+    const std::uintptr_t address =
+        (reinterpret_cast<std::uintptr_t> (block) + sizeof (void *) + alignment - 1u) & ~(alignment - 1u);
+    reinterpret_cast<void **> (address)[-1] = block;
+    return reinterpret_cast<void *> (address);
+}
+
+void operator delete (void *_pointer) noexcept
+{
+    std::free (_pointer);
+}
+
+void operator delete (void *_pointer, [[maybe_unused]] std::size_t _size) noexcept
+{
+    std::free (_pointer);
+}
+
+void operator delete (void *_pointer, [[maybe_unused]] std::align_val_t _alignment) noexcept
+{
+    if (_pointer)
+    {
+        std::free (static_cast<void **> (_pointer)[-1]);
+    }
+}
+
+void operator delete (void *_pointer, [[maybe_unused]] std::size_t _size, std::align_val_t _alignment) noexcept
+{
+    operator delete (_pointer, _alignment);
+}
+
+namespace Emergence::Task::Test
+{
+/// \brief Creates fork-join graph with given width and depth, every task increments given counter.
+/// \details Width is kept small enough to fit into preallocated job dispatcher queues,
+///          otherwise first frames might allocate memory to grow these queues.
+static Collection CreateForkJoinCollection (std::size_t _width, std::size_t _depth, std::atomic_size_t &_counter)
+{
+    Collection collection;
+    for (std::size_t layer = 0u; layer < _depth; ++layer)
+    {
+        // Join task that is executed after all fork tasks of previous layer.
+        const std::size_t joinIndex = collection.tasks.size ();
+        Collection::Item &join = collection.tasks.emplace_back ();
+        join.name = Memory::UniqueString {"Join"};
+        join.task = [&_counter] ()
+        {
+            _counter.fetch_add (1u, std::memory_order_relaxed);
+        };
+
+        if (layer > 0u)
+        {
+            for (std::size_t forkIndex = joinIndex - _width; forkIndex < joinIndex; ++forkIndex)
+            {
+                collection.tasks[forkIndex].dependantTasksIndices.emplace_back (joinIndex);
+            }
+        }
+
+        for (std::size_t fork = 0u; fork < _width; ++fork)
+        {
+            collection.tasks[joinIndex].dependantTasksIndices.emplace_back (collection.tasks.size ());
+            Collection::Item &item = collection.tasks.emplace_back ();
+            item.name = Memory::UniqueString {"Fork"};
+            item.task = [&_counter] ()
+            {
+                _counter.fetch_add (1u, std::memory_order_relaxed);
+            };
+        }
+    }
+
+    return collection;
+}
+} // namespace Emergence::Task::Test
+
+using namespace Emergence;
+using namespace Emergence::Task::Test;
+
+BEGIN_SUITE (Allocation)
+
+TEST_CASE (NoAllocationsDuringExecution)
+{
+    constexpr std::size_t WIDTH = 16u;
+    constexpr std::size_t DEPTH = 8u;
+    constexpr std::size_t FRAMES = 16u;
+
+    std::atomic_size_t counter = 0u;
+    Task::Collection collection = CreateForkJoinCollection (WIDTH, DEPTH, counter);
+    Task::Executor executor {collection};
+
+    // Warmup frame: lets implementation initialize lazy structures like worker threads.
+    executor.Execute ();
+
+    auto [capturedRoot, observer] = Memory::Profiler::Capture::Start ();
+    const std::size_t allocationsBefore = globalAllocationCount.load (std::memory_order_relaxed);
+
+    for (std::size_t frame = 0u; frame < FRAMES; ++frame)
+    {
+        executor.Execute ();
+    }
+
+    const std::size_t allocationsAfter = globalAllocationCount.load (std::memory_order_relaxed);
+    CHECK_EQUAL (allocationsAfter - allocationsBefore, 0u);
+
+    std::size_t profiledAllocations = 0u;
+    while (const Memory::Profiler::Event *event = observer.NextEvent ())
+    {
+        if (event->type == Memory::Profiler::EventType::ALLOCATE ||
+            event->type == Memory::Profiler::EventType::ACQUIRE)
+        {
+            ++profiledAllocations;
+        }
+    }
+
+    CHECK_EQUAL (profiledAllocations, 0u);
+    CHECK_EQUAL (counter.load (), (FRAMES + 1u) * DEPTH * (WIDTH + 1u));
+}
+
+END_SUITE
@@ -0,0 +1,204 @@
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+
+#include <Container/StringBuilder.hpp>
+
+#include <Memory/Profiler/Test/DefaultAllocationGroupStub.hpp>
+
+#include <Testing/Testing.hpp>
+
+#include <VirtualFileSystem/Context.hpp>
+#include <VirtualFileSystem/PackageBuilder.hpp>
+#include <VirtualFileSystem/Writer.hpp>
+
+namespace Emergence::VirtualFileSystem::Test
+{
+static const char *testDirectory = "AsyncReadTest";
+
+using namespace Container;
+
+/// \brief Results are stored and checked on test thread, because callbacks are executed on IO thread.
+struct AsyncReadResult final
+{
+    bool successful = false;
+    Utf8String content;
+};
+
+static AsyncReadCallback MakeStoringCallback (AsyncReadResult &_result, std::atomic_uintptr_t &_finishedCounter)
+{
+    return [&_result, &_finishedCounter] (bool _successful, std::span<const std::uint8_t> _content)
+    {
+        _result.successful = _successful;
+        _result.content = Utf8String {reinterpret_cast<const char *> (_content.data ()), _content.size ()};
+        _finishedCounter.fetch_add (1u, std::memory_order_release);
+        _finishedCounter.notify_all ();
+    };
+}
+
+static void WaitForReads (std::atomic_uintptr_t &_finishedCounter, std::uintptr_t _expected)
+{
+    std::uintptr_t finished;
+    while ((finished = _finishedCounter.load (std::memory_order_acquire)) < _expected)
+    {
+        _finishedCounter.wait (finished, std::memory_order_acquire);
+    }
+}
+
+static void PreparePackage (Context &_context, const Vector<std::pair<Utf8String, Utf8String>> &_files)
+{
+    std::filesystem::remove_all (testDirectory);
+    std::filesystem::create_directories (testDirectory);
+
+    const Utf8String packageSourcePath = EMERGENCE_BUILD_STRING (testDirectory, PATH_SEPARATOR, "PackageSource");
+    const Utf8String packageOutputPath = EMERGENCE_BUILD_STRING (testDirectory, PATH_SEPARATOR, "PackageOutput");
+    std::filesystem::create_directories (packageSourcePath);
+    std::filesystem::create_directories (packageOutputPath);
+
+    for (const auto &[name, content] : _files)
+    {
+        std::ofstream file {EMERGENCE_BUILD_STRING (packageSourcePath, PATH_SEPARATOR, name)};
+        file << content;
+    }
+
+    REQUIRE (_context.Mount (_context.GetRoot (), {MountSource::FILE_SYSTEM, packageSourcePath, "Source"}));
+    REQUIRE (_context.Mount (_context.GetRoot (), {MountSource::FILE_SYSTEM, packageOutputPath, "Output"}));
+
+    {
+        PackageBuilder builder;
+        REQUIRE (builder.Begin (_context, _context.CreateFile (Entry {_context, "Output"}, "Package.bin")));
+
+        for (const auto &[name, content] : _files)
+        {
+            REQUIRE (builder.Add (Entry {_context, EMERGENCE_BUILD_STRING ("Source", PATH_SEPARATOR, name)}, name));
+        }
+
+        REQUIRE (builder.End ());
+    }
+
+    REQUIRE (_context.Mount (
+        _context.GetRoot (),
+        {MountSource::PACKAGE, EMERGENCE_BUILD_STRING (packageOutputPath, PATH_SEPARATOR, "Package.bin"), "Package"}));
+}
+} // namespace Emergence::VirtualFileSystem::Test
+
+using namespace Emergence::Container;
+using namespace Emergence::VirtualFileSystem;
+using namespace Emergence::VirtualFileSystem::Test;
+
+BEGIN_SUITE (AsyncRead)
+
+TEST_CASE (DifferentSources)
+{
+    Context context;
+    PreparePackage (context, {{"1.txt", "First one!"}, {"2.txt", "Second one!"}, {"3.txt", "Third one!"}});
+
+    const Utf8String virtualText = "Virtual one!";
+    {
+        Writer writer {context.CreateFile (context.CreateDirectory (context.GetRoot (), "Virtual"), "Text.txt")};
+        REQUIRE (writer);
+        writer.OutputStream () << virtualText;
+    }
+
+    std::atomic_uintptr_t finishedCounter = 0u;
+    AsyncReadResult results[6u];
+
+    // Package entries are intentionally submitted in reversed order to check that sorting does not break them.
+    const AsyncReadRequest requests[] {
+        {Entry {context, EMERGENCE_BUILD_STRING ("Package", PATH_SEPARATOR, "3.txt")},
+         MakeStoringCallback (results[0u], finishedCounter)},
+        {Entry {context, EMERGENCE_BUILD_STRING ("Package", PATH_SEPARATOR, "2.txt")},
+         MakeStoringCallback (results[1u], finishedCounter)},
+        {Entry {context, EMERGENCE_BUILD_STRING ("Package", PATH_SEPARATOR, "1.txt")},
+         MakeStoringCallback (results[2u], finishedCounter)},
+        {Entry {context, EMERGENCE_BUILD_STRING ("Virtual", PATH_SEPARATOR, "Text.txt")},
+         MakeStoringCallback (results[3u], finishedCounter)},
+        {Entry {context, EMERGENCE_BUILD_STRING ("Source", PATH_SEPARATOR, "1.txt")},
+         MakeStoringCallback (results[4u], finishedCounter)},
+        {Entry {context, "ThisShouldNotExist.txt"}, MakeStoringCallback (results[5u], finishedCounter)},
+    };
+
+    context.SubmitReads (requests);
+    WaitForReads (finishedCounter, std::size (requests));
+
+    CHECK (results[0u].successful);
+    CHECK_EQUAL (results[0u].content, "Third one!");
+    CHECK (results[1u].successful);
+    CHECK_EQUAL (results[1u].content, "Second one!");
+    CHECK (results[2u].successful);
+    CHECK_EQUAL (results[2u].content, "First one!");
+    CHECK (results[3u].successful);
+    CHECK_EQUAL (results[3u].content, virtualText);
+    CHECK (results[4u].successful);
+    CHECK_EQUAL (results[4u].content, "First one!");
+    CHECK (!results[5u].successful);
+}
+
+TEST_CASE (SubmitFromCallback)
+{
+    Context context;
+    PreparePackage (context, {{"1.txt", "First one!"}, {"2.txt", "Second one!"}});
+
+    std::atomic_uintptr_t finishedCounter = 0u;
+    AsyncReadResult firstResult;
+    AsyncReadResult secondResult;
+
+    const AsyncReadRequest request {
+        Entry {context, EMERGENCE_BUILD_STRING ("Package", PATH_SEPARATOR, "1.txt")},
+        [&context, &firstResult, &secondResult, &finishedCounter] (bool _successful,
+                                                                  std::span<const std::uint8_t> _content)
+        {
+            firstResult.successful = _successful;
+            firstResult.content = Utf8String {reinterpret_cast<const char *> (_content.data ()), _content.size ()};
+
+            const AsyncReadRequest nextRequest {
+                Entry {context, EMERGENCE_BUILD_STRING ("Package", PATH_SEPARATOR, "2.txt")},
+                MakeStoringCallback (secondResult, finishedCounter)};
+            context.SubmitReads ({&nextRequest, 1u});
+        }};
+
+    context.SubmitReads ({&request, 1u});
+    WaitForReads (finishedCounter, 1u);
+
+    CHECK (firstResult.successful);
+    CHECK_EQUAL (firstResult.content, "First one!");
+    CHECK (secondResult.successful);
+    CHECK_EQUAL (secondResult.content, "Second one!");
+}
+
+TEST_CASE (FinishedBeforeDestruction)
+{
+    constexpr std::size_t FILE_COUNT = 16u;
+    std::atomic_uintptr_t finishedCounter = 0u;
+    AsyncReadResult results[FILE_COUNT];
+
+    {
+        Vector<std::pair<Utf8String, Utf8String>> files;
+        for (std::size_t index = 0u; index < FILE_COUNT; ++index)
+        {
+            files.emplace_back (EMERGENCE_BUILD_STRING (index, ".txt"), EMERGENCE_BUILD_STRING ("File #", index));
+        }
+
+        Context context;
+        PreparePackage (context, files);
+        Vector<AsyncReadRequest> requests;
+
+        for (std::size_t index = 0u; index < FILE_COUNT; ++index)
+        {
+            requests.emplace_back (AsyncReadRequest {
+                Entry {context, EMERGENCE_BUILD_STRING ("Package", PATH_SEPARATOR, index, ".txt")},
+                MakeStoringCallback (results[index], finishedCounter)});
+        }
+
+        context.SubmitReads (requests);
+    }
+
+    CHECK_EQUAL (finishedCounter.load (std::memory_order_acquire), FILE_COUNT);
+    for (std::size_t index = 0u; index < FILE_COUNT; ++index)
+    {
+        CHECK (results[index].successful);
+        CHECK_EQUAL (results[index].content, EMERGENCE_BUILD_STRING ("File #", index));
+    }
+}
+
+END_SUITE
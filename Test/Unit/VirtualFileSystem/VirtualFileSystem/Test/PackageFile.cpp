@@ -15,15 +15,10 @@
 namespace Emergence::VirtualFileSystem::Test
 {
 static const char *testDirectory = "PackageFileTest";
-} // namespace Emergence::VirtualFileSystem::Test
 
-using namespace Emergence::Container;
-using namespace Emergence::VirtualFileSystem;
-using namespace Emergence::VirtualFileSystem::Test;
+using namespace Container;
 
-BEGIN_SUITE (PackageFile)
-
-TEST_CASE (PackageFileWithNesting)
+static void CheckPackageFileWithNesting (MountSource _source)
 {
     std::filesystem::remove_all (testDirectory);
     std::filesystem::create_directories (testDirectory);
@@ -70,7 +65,7 @@ TEST_CASE (PackageFileWithNesting)
 
     REQUIRE (context.Mount (
         context.GetRoot (),
-        {MountSource::PACKAGE, EMERGENCE_BUILD_STRING (packageOutputPath, PATH_SEPARATOR, "Package.bin"), "Package"}));
+        {_source, EMERGENCE_BUILD_STRING (packageOutputPath, PATH_SEPARATOR, "Package.bin"), "Package"}));
 
     // Test that entries exist.
 
@@ -86,11 +81,27 @@ TEST_CASE (PackageFileWithNesting)
     // Test that entries readable.
 
     {
-        auto testReadFile = [] (const Entry &_entry, const Utf8String &_expected)
+        auto testReadFile = [_source] (const Entry &_entry, const Utf8String &_expected)
         {
             Reader reader {_entry};
             REQUIRE (reader);
 
+            const std::span<const std::uint8_t> view = reader.GetView ();
+            if (_source == MountSource::MAPPED_PACKAGE)
+            {
+                CHECK_EQUAL (std::string_view (reinterpret_cast<const char *> (view.data ()), view.size ()),
+                             std::string_view {_expected});
+            }
+            else
+            {
+                CHECK (view.empty ());
+            }
+
+            // Check that seeking works for all types of readers.
+            reader.InputStream ().seekg (0u, std::ios::end);
+            CHECK_EQUAL (static_cast<std::size_t> (reader.InputStream ().tellg ()), _expected.size ());
+            reader.InputStream ().seekg (0u, std::ios::beg);
+
             StringBuilder textBuffer;
             int next;
 
@@ -137,6 +148,23 @@ TEST_CASE (PackageFileWithNesting)
     CHECK (std::find (children.begin (), children.end (), "~/Package/2.txt") != children.end ());
     CHECK (std::find (children.begin (), children.end (), "~/Package/Nested") != children.end ());
 }
+} // namespace Emergence::VirtualFileSystem::Test
+
+using namespace Emergence::Container;
+using namespace Emergence::VirtualFileSystem;
+using namespace Emergence::VirtualFileSystem::Test;
+
+BEGIN_SUITE (PackageFile)
+
+TEST_CASE (PackageFileWithNesting)
+{
+    CheckPackageFileWithNesting (MountSource::PACKAGE);
+}
+
+TEST_CASE (MappedPackageFileWithNesting)
+{
+    CheckPackageFileWithNesting (MountSource::MAPPED_PACKAGE);
+}
 
 TEST_CASE (InvalidOutput)
 {
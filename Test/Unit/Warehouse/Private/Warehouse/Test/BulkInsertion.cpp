@@ -0,0 +1,156 @@
+#include <API/Common/BlockCast.hpp>
+
+#include <Query/Test/Data.hpp>
+
+#include <Testing/Testing.hpp>
+
+#include <Warehouse/Test/Scenario.hpp>
+
+using namespace Emergence;
+using namespace Emergence::Warehouse::Test;
+
+/// \brief Prepares inserter and fetch queries for every long term index type.
+static Container::Vector<Task> PrepareQueries ()
+{
+    using namespace Emergence::Query::Test;
+    const PlayerWithBoundingBox::Reflection &reflection = PlayerWithBoundingBox::Reflect ();
+    const BoundingBox::Reflection &boxReflection = BoundingBox::Reflect ();
+
+    Container::Vector<Sources::Volumetric::Dimension> dimensions {
+        {-100.0f, StandardLayout::ProjectNestedField (reflection.boundingBox, boxReflection.minX), 100.0f,
+         StandardLayout::ProjectNestedField (reflection.boundingBox, boxReflection.maxX)},
+        {-100.0f, StandardLayout::ProjectNestedField (reflection.boundingBox, boxReflection.minY), 100.0f,
+         StandardLayout::ProjectNestedField (reflection.boundingBox, boxReflection.maxY)},
+    };
+
+    return {
+        PrepareInsertLongTermQuery {{reflection.mapping, "Insert"}},
+        PrepareFetchValueQuery {{reflection.mapping, "FetchId"},
+                                {StandardLayout::ProjectNestedField (reflection.player, Player::Reflect ().id)}},
+        PrepareFetchAscendingRangeQuery {
+            {reflection.mapping, "FetchName"},
+            StandardLayout::ProjectNestedField (reflection.player, Player::Reflect ().name)},
+        PrepareFetchSignalQuery {
+            {reflection.mapping, "FetchStunned"},
+            StandardLayout::ProjectNestedField (reflection.player, Player::Reflect ().stunned),
+            array_cast<std::uint8_t, sizeof (std::uint64_t)> (Player::Status::FLAG_STUNNED)},
+        PrepareFetchSignalQuery {
+            {reflection.mapping, "FetchImmobilized"},
+            StandardLayout::ProjectNestedField (reflection.player, Player::Reflect ().immobilized),
+            array_cast<std::uint8_t, sizeof (std::uint64_t)> (Player::Status::FLAG_IMMOBILIZED)},
+        PrepareFetchShapeIntersectionQuery {{reflection.mapping, "FetchShape"}, dimensions},
+    };
+}
+
+/// \brief Checks that every index contains all three players.
+static Container::Vector<Task> CheckAllPlayersAreIndexed ()
+{
+    using namespace Emergence::Query::Test;
+    return {
+        QueryValueToRead {{{"FetchId", "0"}, &Queries::ID_0}},
+        CursorCheckAllUnordered {"0", {&HUGO_0_MIN_10_8_4_MAX_11_9_5}},
+        CursorClose {"0"},
+
+        QueryValueToRead {{{"FetchId", "1"}, &Queries::ID_1}},
+        CursorCheckAllUnordered {"1", {&KARL_1_MIN_M2_1_0_MAX_0_4_2}},
+        CursorClose {"1"},
+
+        QueryValueToRead {{{"FetchId", "2"}, &Queries::ID_2}},
+        CursorCheckAllUnordered {"2", {&XAVIER_2_MIN_15_8_50_MAX_19_11_60}},
+        CursorClose {"2"},
+
+        QueryAscendingRangeToRead {{{"FetchName", "names"}, nullptr, nullptr}},
+        CursorCheckAllOrdered {
+            "names", {&HUGO_0_MIN_10_8_4_MAX_11_9_5, &KARL_1_MIN_M2_1_0_MAX_0_4_2, &XAVIER_2_MIN_15_8_50_MAX_19_11_60}},
+        CursorClose {"names"},
+
+        QuerySignalToRead {{"FetchStunned", "stunned"}},
+        CursorCheckAllUnordered {"stunned", {&HUGO_0_MIN_10_8_4_MAX_11_9_5}},
+        CursorClose {"stunned"},
+
+        QuerySignalToRead {{"FetchImmobilized", "immobilized"}},
+        CursorCheckAllUnordered {"immobilized", {&KARL_1_MIN_M2_1_0_MAX_0_4_2}},
+        CursorClose {"immobilized"},
+
+        QueryShapeIntersectionToRead {{{"FetchShape", "min = (-3, 0), max = (11, 11)"}, {-3.0f, 0.0f}, {11.0f, 11.0f}}},
+        CursorCheckAllUnordered {"min = (-3, 0), max = (11, 11)",
+                                 {&HUGO_0_MIN_10_8_4_MAX_11_9_5, &KARL_1_MIN_M2_1_0_MAX_0_4_2}},
+        CursorClose {"min = (-3, 0), max = (11, 11)"},
+
+        QueryShapeIntersectionToRead {{{"FetchShape", "min = (12, 0), max = (20, 11)"}, {12.0f, 0.0f}, {20.0f, 11.0f}}},
+        CursorCheckAllUnordered {"min = (12, 0), max = (20, 11)", {&XAVIER_2_MIN_15_8_50_MAX_19_11_60}},
+        CursorClose {"min = (12, 0), max = (20, 11)"},
+    };
+}
+
+BEGIN_SUITE (BulkInsertion)
+
+TEST_CASE (IntoEmptyStorage)
+{
+    using namespace Emergence::Query::Test;
+
+    Warehouse::Test::Scenario scenario {PrepareQueries ()};
+    scenario.tasks += {
+        InsertObjects {"Insert",
+                       {&HUGO_0_MIN_10_8_4_MAX_11_9_5, &KARL_1_MIN_M2_1_0_MAX_0_4_2, &XAVIER_2_MIN_15_8_50_MAX_19_11_60},
+                       true},
+    };
+
+    scenario.tasks += CheckAllPlayersAreIndexed ();
+    scenario.Execute ();
+}
+
+TEST_CASE (IntoFilledStorage)
+{
+    using namespace Emergence::Query::Test;
+
+    // Karl is inserted as usual, therefore bulk insertion must merge new records with already indexed ones.
+    Warehouse::Test::Scenario scenario {PrepareQueries ()};
+    scenario.tasks += {
+        InsertObjects {"Insert", {&KARL_1_MIN_M2_1_0_MAX_0_4_2}},
+        InsertObjects {"Insert", {&HUGO_0_MIN_10_8_4_MAX_11_9_5, &XAVIER_2_MIN_15_8_50_MAX_19_11_60}, true},
+    };
+
+    scenario.tasks += CheckAllPlayersAreIndexed ();
+    scenario.Execute ();
+}
+
+TEST_CASE (EditAndDeleteAfterBulkInsertion)
+{
+    using namespace Emergence::Query::Test;
+
+    Warehouse::Test::Scenario scenario {PrepareQueries ()};
+    scenario.tasks += {
+        InsertObjects {"Insert",
+                       {&HUGO_0_MIN_10_8_4_MAX_11_9_5, &KARL_1_MIN_M2_1_0_MAX_0_4_2, &XAVIER_2_MIN_15_8_50_MAX_19_11_60},
+                       true},
+        PrepareModifyValueQuery {
+            {PlayerWithBoundingBox::Reflect ().mapping, "ModifyId"},
+            {StandardLayout::ProjectNestedField (PlayerWithBoundingBox::Reflect ().player, Player::Reflect ().id)}},
+
+        QueryValueToEdit {{{"ModifyId", "0"}, &Queries::ID_0}},
+        CursorCheck {"0", &HUGO_0_MIN_10_8_4_MAX_11_9_5},
+        CursorDeleteObject {"0"},
+        CursorClose {"0"},
+
+        QueryValueToRead {{{"FetchId", "0"}, &Queries::ID_0}},
+        CursorCheckAllUnordered {"0", {}},
+        CursorClose {"0"},
+
+        QuerySignalToRead {{"FetchStunned", "stunned"}},
+        CursorCheckAllUnordered {"stunned", {}},
+        CursorClose {"stunned"},
+
+        QueryAscendingRangeToRead {{{"FetchName", "names"}, nullptr, nullptr}},
+        CursorCheckAllOrdered {"names", {&KARL_1_MIN_M2_1_0_MAX_0_4_2, &XAVIER_2_MIN_15_8_50_MAX_19_11_60}},
+        CursorClose {"names"},
+
+        QueryShapeIntersectionToRead {{{"FetchShape", "min = (-3, 0), max = (11, 11)"}, {-3.0f, 0.0f}, {11.0f, 11.0f}}},
+        CursorCheckAllUnordered {"min = (-3, 0), max = (11, 11)", {&KARL_1_MIN_M2_1_0_MAX_0_4_2}},
+        CursorClose {"min = (-3, 0), max = (11, 11)"},
+    };
+
+    scenario.Execute ();
+}
+
+END_SUITE
@@ -305,7 +305,22 @@ void ExecuteTask (ExecutionContext &_context, const InsertObjects &_task)
             if constexpr (std::is_same_v<QueryType, InsertShortTermQuery> ||
                           std::is_same_v<QueryType, InsertLongTermQuery>)
             {
-                auto cursor = _query.Execute ();
+                auto cursor = [&_task, &_query] ()
+                {
+                    if constexpr (std::is_same_v<QueryType, InsertLongTermQuery>)
+                    {
+                        if (_task.bulk)
+                        {
+                            return _query.ExecuteBulk ();
+                        }
+                    }
+                    else
+                    {
+                        REQUIRE (!_task.bulk);
+                    }
+
+                    return _query.Execute ();
+                }();
                 for (const void *source : _task.copyFrom)
                 {
                     void *target = ++cursor;
@@ -596,7 +611,8 @@ std::ostream &operator<< (std::ostream &_output, const PrepareModifyRayIntersect
 
 std::ostream &operator<< (std::ostream &_output, const InsertObjects &_task)
 {
-    _output << "Allocate objects using query \"" << _task.name << "\" and init from";
+    _output << "Allocate objects" << (_task.bulk ? " in bulk" : "") << " using query \"" << _task.name
+            << "\" and init from";
     for (const void *object : _task.copyFrom)
     {
         _output << " " << object;
@@ -116,6 +116,9 @@ struct InsertObjects
 {
     Container::String name;
     Container::Vector<const void *> copyFrom;
+
+    /// \brief If true, objects are inserted through InsertLongTermQuery::ExecuteBulk.
+    bool bulk = false;
 };
 
 using Task = Container::Variant<PrepareFetchSingletonQuery,
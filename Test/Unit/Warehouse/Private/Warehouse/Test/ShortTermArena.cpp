@@ -0,0 +1,110 @@
+#include <Query/Test/DataTypes.hpp>
+
+#include <Testing/Testing.hpp>
+
+#include <Warehouse/Registry.hpp>
+
+using namespace Emergence;
+using namespace Emergence::Memory::Literals;
+using Emergence::Query::Test::Player;
+
+static void InsertPlayers (Warehouse::InsertShortTermQuery &_insert, std::uint32_t _count)
+{
+    auto cursor = _insert.Execute ();
+    for (std::uint32_t index = 0u; index < _count; ++index)
+    {
+        auto *player = static_cast<Player *> (++cursor);
+        player->id = index;
+    }
+}
+
+static std::uint32_t CountPlayers (Warehouse::ModifySequenceQuery &_modify)
+{
+    std::uint32_t count = 0u;
+    for (auto cursor = _modify.Execute (); *cursor; ++cursor)
+    {
+        ++count;
+    }
+
+    return count;
+}
+
+static void DeleteAllPlayers (Warehouse::ModifySequenceQuery &_modify)
+{
+    auto cursor = _modify.Execute ();
+    while (*cursor)
+    {
+        ~cursor;
+    }
+}
+
+BEGIN_SUITE (ShortTermArena)
+
+TEST_CASE (PartialDeletionAndReset)
+{
+    constexpr std::uint32_t COUNT = 1000u;
+    Warehouse::Registry registry {"Test"_us};
+    registry.SetShortTermArenaEnabled (Player::Reflect ().mapping, true);
+
+    Warehouse::InsertShortTermQuery insert = registry.InsertShortTerm (Player::Reflect ().mapping);
+    Warehouse::ModifySequenceQuery modify = registry.ModifySequence (Player::Reflect ().mapping);
+
+    // Several passes to check that arena pages are correctly reused after reset.
+    for (std::size_t pass = 0u; pass < 3u; ++pass)
+    {
+        InsertPlayers (insert, COUNT);
+        CHECK_EQUAL (CountPlayers (modify), COUNT);
+
+        {
+            auto cursor = modify.Execute ();
+            while (auto *player = static_cast<Player *> (*cursor))
+            {
+                if (player->id % 2u == 0u)
+                {
+                    ~cursor;
+                }
+                else
+                {
+                    ++cursor;
+                }
+            }
+        }
+
+        std::uint32_t remaining = 0u;
+        for (auto cursor = modify.Execute (); const auto *player = static_cast<const Player *> (*cursor); ++cursor)
+        {
+            CHECK_EQUAL (player->id % 2u, 1u);
+            ++remaining;
+        }
+
+        CHECK_EQUAL (remaining, COUNT / 2u);
+        DeleteAllPlayers (modify);
+        CHECK_EQUAL (CountPlayers (modify), 0u);
+    }
+}
+
+TEST_CASE (EnableWhenNotEmpty)
+{
+    constexpr std::uint32_t COUNT = 100u;
+    Warehouse::Registry registry {"Test"_us};
+    Warehouse::InsertShortTermQuery insert = registry.InsertShortTerm (Player::Reflect ().mapping);
+    Warehouse::ModifySequenceQuery modify = registry.ModifySequence (Player::Reflect ().mapping);
+
+    // Records, allocated before arena is enabled, must be correctly deleted and only then arena is used.
+    InsertPlayers (insert, COUNT);
+    registry.SetShortTermArenaEnabled (Player::Reflect ().mapping, true);
+    InsertPlayers (insert, COUNT);
+    CHECK_EQUAL (CountPlayers (modify), COUNT * 2u);
+    DeleteAllPlayers (modify);
+
+    InsertPlayers (insert, COUNT);
+    CHECK_EQUAL (CountPlayers (modify), COUNT);
+    registry.SetShortTermArenaEnabled (Player::Reflect ().mapping, false);
+    DeleteAllPlayers (modify);
+
+    InsertPlayers (insert, COUNT);
+    CHECK_EQUAL (CountPlayers (modify), COUNT);
+    DeleteAllPlayers (modify);
+}
+
+END_SUITE
@@ -0,0 +1,197 @@
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include <API/Common/Shortcuts.hpp>
+
+#include <Job/Dispatcher.hpp>
+
+#include <Memory/Heap.hpp>
+#include <Memory/UniqueString.hpp>
+
+#include <Warehouse/Partition.hpp>
+
+namespace Emergence::Celerity
+{
+namespace Detail
+{
+/// \brief Shared state of ParallelFor fan-out.
+/// \details Dispatched jobs might start long after the caller has processed all the chunks, for example when every
+///          dispatcher thread is busy or is waiting inside another ParallelFor. Therefore state is allocated on heap
+///          and counts its references manually: late jobs find no chunks to claim, release their reference and
+///          exit without touching partition or functor, which might already be destroyed at that moment.
+template <typename Cursor, typename Functor>
+class ParallelForState final
+{
+public:
+    ParallelForState (const Warehouse::Partition<Cursor> *_partition,
+                      Functor *_functor,
+                      std::size_t _references) noexcept;
+
+    ParallelForState (const ParallelForState &_other) = delete;
+
+    ParallelForState (ParallelForState &&_other) = delete;
+
+    ~ParallelForState () noexcept = default;
+
+    void *operator new (std::size_t /*unused*/) noexcept;
+
+    void operator delete (void *_pointer) noexcept;
+
+    /// \brief Claims next unprocessed chunk and processes it.
+    /// \return Whether chunk was claimed.
+    bool ProcessNextChunk () noexcept;
+
+    /// \return Whether all chunks are processed.
+    /// \details Only claimed chunks might still be in progress, therefore waiting for this never depends
+    ///          on dispatched jobs that are still waiting in dispatcher queue.
+    [[nodiscard]] bool IsFinished () const noexcept;
+
+    /// \brief Releases one reference and deletes the state if it was the last one.
+    void Release () noexcept;
+
+    EMERGENCE_DELETE_ASSIGNMENT (ParallelForState);
+
+private:
+    static Memory::Heap &GetHeap () noexcept;
+
+    const Warehouse::Partition<Cursor> *partition;
+    Functor *functor;
+    const std::size_t chunkCount;
+    std::atomic_size_t nextChunk = 0u;
+    std::atomic_size_t finishedChunks = 0u;
+    std::atomic_size_t references;
+};
+
+template <typename Cursor, typename Functor>
+ParallelForState<Cursor, Functor>::ParallelForState (const Warehouse::Partition<Cursor> *_partition,
+                                                     Functor *_functor,
+                                                     std::size_t _references) noexcept
+    : partition (_partition),
+      functor (_functor),
+      chunkCount (_partition->GetChunkCount ()),
+      references (_references)
+{
+}
+
+template <typename Cursor, typename Functor>
+void *ParallelForState<Cursor, Functor>::operator new (std::size_t /*unused*/) noexcept
+{
+    return GetHeap ().Acquire (sizeof (ParallelForState), alignof (ParallelForState));
+}
+
+template <typename Cursor, typename Functor>
+void ParallelForState<Cursor, Functor>::operator delete (void *_pointer) noexcept
+{
+    GetHeap ().Release (_pointer, sizeof (ParallelForState));
+}
+
+template <typename Cursor, typename Functor>
+bool ParallelForState<Cursor, Functor>::ProcessNextChunk () noexcept
+{
+    const std::size_t index = nextChunk.fetch_add (1u, std::memory_order_relaxed);
+    if (index >= chunkCount)
+    {
+        return false;
+    }
+
+    (*functor) (partition->GetChunk (index));
+    finishedChunks.fetch_add (1u, std::memory_order_release);
+    return true;
+}
+
+template <typename Cursor, typename Functor>
+bool ParallelForState<Cursor, Functor>::IsFinished () const noexcept
+{
+    return finishedChunks.load (std::memory_order_acquire) == chunkCount;
+}
+
+template <typename Cursor, typename Functor>
+void ParallelForState<Cursor, Functor>::Release () noexcept
+{
+    if (references.fetch_sub (1u, std::memory_order_acq_rel) == 1u)
+    {
+        delete this;
+    }
+}
+
+template <typename Cursor, typename Functor>
+Memory::Heap &ParallelForState<Cursor, Functor>::GetHeap () noexcept
+{
+    using namespace Memory::Literals;
+    static Memory::Heap heap {Memory::Profiler::AllocationGroup {
+        Memory::Profiler::AllocationGroup {Memory::Profiler::AllocationGroup::Top (), "Celerity"_us},
+        "ParallelFor"_us}};
+    return heap;
+}
+} // namespace Detail
+
+/// \brief Calls `_functor (chunk)` for every chunk of given partition, distributing chunks between calling thread
+///        and threads of given job dispatcher.
+/// \details Chunks are claimed dynamically and calling thread claims chunks too, so it processes all chunks by itself
+///          if dispatcher threads are busy. Returns after every claimed chunk is processed, therefore partition and
+///          its cursor, that guards access to the type, outlive every call to the functor. Jobs that start later
+///          find nothing to claim and exit without touching partition or functor.
+///
+///          Calling thread never waits for dispatched jobs to be started, therefore it is safe to call this function
+///          from dispatcher jobs, including tasks of parallel task executor, even if every dispatcher thread is
+///          inside ParallelFor.
+template <typename Cursor, typename Functor>
+void ParallelFor (Job::Dispatcher &_dispatcher,
+                  const Warehouse::Partition<Cursor> &_partition,
+                  Functor &&_functor) noexcept
+{
+    const std::size_t chunkCount = _partition.GetChunkCount ();
+    if (chunkCount <= 1u)
+    {
+        if (chunkCount == 1u)
+        {
+            _functor (_partition.GetChunk (0u));
+        }
+
+        return;
+    }
+
+    using State = Detail::ParallelForState<Cursor, std::remove_reference_t<Functor>>;
+    const std::size_t jobCount = chunkCount - 1u;
+    // Every job and calling thread own one reference.
+    auto *state = new State {&_partition, &_functor, jobCount + 1u};
+
+    {
+        Job::Dispatcher::Batch batch {_dispatcher};
+        for (std::size_t index = 0u; index < jobCount; ++index)
+        {
+            batch.Dispatch (Job::Priority::FOREGROUND,
+                            [state] ()
+                            {
+                                while (state->ProcessNextChunk ())
+                                {
+                                }
+
+                                state->Release ();
+                            });
+        }
+    }
+
+    while (state->ProcessNextChunk ())
+    {
+    }
+
+    while (!state->IsFinished ())
+    {
+        std::this_thread::yield ();
+    }
+
+    state->Release ();
+}
+
+/// \brief Shortcut for ParallelFor that uses global job dispatcher.
+template <typename Cursor, typename Functor>
+void ParallelFor (const Warehouse::Partition<Cursor> &_partition, Functor &&_functor) noexcept
+{
+    ParallelFor (Job::Dispatcher::Global (), _partition, std::forward<Functor> (_functor));
+}
+} // namespace Emergence::Celerity
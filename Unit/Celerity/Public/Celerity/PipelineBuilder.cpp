@@ -901,6 +901,14 @@ void PipelineBuilder::FinishTaskRegistration (Flow::Task _task) noexcept
     taskRegister.RegisterTask (std::move (_task));
 }
 
+TaskConstructor PipelineBuilder::AddEventCleaner (const StandardLayout::Mapping &_eventType) noexcept
+{
+    worldView->localRegistry.SetShortTermArenaEnabled (_eventType, true);
+    TaskConstructor constructor = AddTask (GetEventCleanerName (_eventType));
+    constructor.SetExecutor<EventCleaner> (_eventType);
+    return constructor;
+}
+
 void PipelineBuilder::PostProcessContinuousEventRoutine (const PipelineBuilder::EventUsageMap &_production,
                                                          const PipelineBuilder::EventUsageMap &_consumption)
 {
@@ -926,8 +934,7 @@ void PipelineBuilder::PostProcessContinuousEventRoutine (const PipelineBuilder::
             continue;
         }
 
-        TaskConstructor constructor = AddTask (GetEventCleanerName (eventType));
-        constructor.SetExecutor<EventCleaner> (eventType);
+        TaskConstructor constructor = AddEventCleaner (eventType);
 
         for (const Memory::UniqueString &producerTask : producers)
         {
@@ -1071,8 +1078,7 @@ void PipelineBuilder::PostProcessLocalEventRoutine (const PipelineBuilder::Event
             continue;
         }
 
-        TaskConstructor constructor = AddTask (GetEventCleanerName (eventType));
-        constructor.SetExecutor<EventCleaner> (eventType);
+        TaskConstructor constructor = AddEventCleaner (eventType);
 
         for (const Memory::UniqueString &consumerTask : consumptionIterator->second)
         {
@@ -1122,8 +1128,7 @@ void PipelineBuilder::PostProcessSharedEventRoutine (const PipelineBuilder::Even
         auto consumptionIterator = _consumption.find (eventType);
         if (consumptionIterator != _consumption.end ())
         {
-            TaskConstructor constructor = AddTask (GetEventCleanerName (eventType));
-            constructor.SetExecutor<EventCleaner> (eventType);
+            TaskConstructor constructor = AddEventCleaner (eventType);
 
             for (const Memory::UniqueString &consumerTask : consumptionIterator->second)
             {
@@ -471,6 +471,10 @@ private:
 
     void FinishTaskRegistration (Flow::Task _task) noexcept;
 
+    /// \brief Adds task that deletes all events of given type.
+    /// \details As cleaner deletes all events together, events of this type are allocated from linear arena.
+    [[nodiscard]] TaskConstructor AddEventCleaner (const StandardLayout::Mapping &_eventType) noexcept;
+
     /// \details In continuous routine, events from current execution can be processed by next execution.
     ///          Therefore, for each event type pipeline tasks can be separate into ordered category list:
     ///          PreviousExecutionConsumers -> ClearingTask -> Producers -> CurrentExecutionConsumers.
@@ -46,6 +46,11 @@ InsertLongTermQuery::Cursor InsertLongTermQuery::Execute () noexcept
     return Cursor {source.Execute (), eventsOnAdd};
 }
 
+InsertLongTermQuery::Cursor InsertLongTermQuery::ExecuteBulk () noexcept
+{
+    return Cursor {source.ExecuteBulk (), eventsOnAdd};
+}
+
 InsertLongTermQuery::~InsertLongTermQuery () noexcept = default;
 
 InsertLongTermQuery::InsertLongTermQuery (const InsertLongTermQuery &_other) noexcept = default;
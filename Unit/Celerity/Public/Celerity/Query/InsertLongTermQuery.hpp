@@ -47,6 +47,10 @@ public:
 
     EMERGENCE_EDITABLE_PREPARED_QUERY_OPERATIONS (InsertLongTermQuery, Cursor);
 
+    /// \brief Wrapper for Warehouse::InsertLongTermQuery::ExecuteBulk.
+    /// \details On add events are still fired right after object initialization, not after index update.
+    Cursor ExecuteBulk () noexcept;
+
 private:
     /// TaskConstructor constructs prepared queries wrappers.
     friend class TaskConstructor;
@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <array>
 #include <limits>
 
 #include <Celerity/Asset/Asset.hpp>
@@ -7,16 +9,23 @@
 #include <Celerity/Render/2d/BoundsCalculation2d.hpp>
 #include <Celerity/Render/2d/Camera2dComponent.hpp>
 #include <Celerity/Render/2d/DebugShape2dComponent.hpp>
+#include <Celerity/Render/2d/Events.hpp>
 #include <Celerity/Render/2d/RenderObject2dComponent.hpp>
 #include <Celerity/Render/2d/Sprite2dComponent.hpp>
+#include <Celerity/Render/2d/Sprite2dUvAnimationComponent.hpp>
 #include <Celerity/Render/2d/World2dRenderPass.hpp>
 #include <Celerity/Render/2d/WorldRendering2d.hpp>
 #include <Celerity/Render/Foundation/Events.hpp>
 #include <Celerity/Render/Foundation/RenderPipelineFoundation.hpp>
 #include <Celerity/Render/Foundation/Viewport.hpp>
+#include <Celerity/Transform/Events.hpp>
 #include <Celerity/Transform/TransformComponent.hpp>
+#include <Celerity/Transform/TransformVisualSync.hpp>
 #include <Celerity/Transform/TransformWorldAccessor.hpp>
 
+#include <Container/HashMap.hpp>
+#include <Container/HashSet.hpp>
+
 #include <Render/Backend/Renderer.hpp>
 
 namespace Emergence::Celerity::Batching2d
@@ -24,6 +33,326 @@ namespace Emergence::Celerity::Batching2d
 const Memory::UniqueString Checkpoint::STARTED {"Batching2d::Started"};
 const Memory::UniqueString Checkpoint::FINISHED {"Batching2d::Finished"};
 
+/// \brief Sprites are baked into static geometry only after this count of frames without changes,
+///        so sprites that are moved from time to time do not trigger static geometry rebuilds every frame.
+static constexpr std::uint32_t STATIC_GEOMETRY_PROMOTION_FRAMES = 16u;
+
+/// \brief Static geometries are split by world grid with this count of cells on every axis.
+static constexpr std::uint32_t STATIC_GEOMETRY_GRID_SIZE = 16u;
+
+class SpriteTableSynchronizer final : public TaskExecutorBase<SpriteTableSynchronizer>
+{
+public:
+    SpriteTableSynchronizer (TaskConstructor &_constructor, const Math::AxisAlignedBox2d &_worldBounds) noexcept;
+
+    void Execute () noexcept;
+
+private:
+    void CopySpriteData (Sprite2dRenderData &_data) noexcept;
+
+    void UpdateSpriteTransform (Sprite2dRenderData &_data) noexcept;
+
+    void UpdateChangedTransforms (Batching2dSingleton *_batching) noexcept;
+
+    void PromoteUnchangedSprites (Batching2dSingleton *_batching) const noexcept;
+
+    [[nodiscard]] std::uint32_t GetStaticGeometryCell (const Math::AxisAlignedBox2d &_bounds) const noexcept;
+
+    static void UpdateGlobalBounds (Sprite2dRenderData &_data) noexcept;
+
+    ModifySingletonQuery modifyBatching;
+
+    FetchSequenceQuery fetchSpriteAddedEvents;
+    FetchSequenceQuery fetchSpriteSizeChangedEvents;
+    FetchSequenceQuery fetchSpriteBatchingDataChangedEvents;
+    FetchSequenceQuery fetchSpriteRemovedEvents;
+    FetchSequenceQuery fetchUvAnimationAddedEvents;
+
+    FetchSequenceQuery fetchDebugShapeAddedNormalEvents;
+    FetchSequenceQuery fetchDebugShapeRemovedNormalEvents;
+    FetchSequenceQuery fetchDebugShapeAddedFixedEvents;
+    FetchSequenceQuery fetchDebugShapeRemovedFixedEvents;
+
+    FetchSequenceQuery fetchTransformParentChangedEventsFixed;
+    FetchSequenceQuery fetchTransformParentChangedEventsNormal;
+
+    FetchSequenceQuery fetchVisualLocalTransformChangedEventsFixed;
+    FetchSequenceQuery fetchVisualLocalTransformChangedEventsNormal;
+
+    FetchValueQuery fetchSpriteBySpriteId;
+    FetchValueQuery fetchSpriteByObjectId;
+    FetchValueQuery fetchUvAnimationBySpriteId;
+
+    FetchValueQuery fetchTransformById;
+    FetchValueQuery fetchTransformByParentId;
+    Transform2dWorldAccessor transformWorldAccessor;
+
+    Math::AxisAlignedBox2d worldBounds;
+
+    Container::Vector<UniqueId> changedObjects {Memory::Profiler::AllocationGroup::Top ()};
+    Container::HashSet<UniqueId> updatedObjects {Memory::Profiler::AllocationGroup::Top ()};
+};
+
+SpriteTableSynchronizer::SpriteTableSynchronizer (TaskConstructor &_constructor,
+                                                  const Math::AxisAlignedBox2d &_worldBounds) noexcept
+    : TaskExecutorBase (_constructor),
+
+      modifyBatching (MODIFY_SINGLETON (Batching2dSingleton)),
+
+      fetchSpriteAddedEvents (FETCH_SEQUENCE (Sprite2dAddedNormalEvent)),
+      fetchSpriteSizeChangedEvents (FETCH_SEQUENCE (Sprite2dSizeChangedNormalEvent)),
+      fetchSpriteBatchingDataChangedEvents (FETCH_SEQUENCE (Sprite2dBatchingDataChangedNormalEvent)),
+      fetchSpriteRemovedEvents (FETCH_SEQUENCE (Sprite2dRemovedNormalEvent)),
+      fetchUvAnimationAddedEvents (FETCH_SEQUENCE (Sprite2dUvAnimationAddedNormalEvent)),
+
+      fetchDebugShapeAddedNormalEvents (FETCH_SEQUENCE (DebugShape2dAddedNormalEvent)),
+      fetchDebugShapeRemovedNormalEvents (FETCH_SEQUENCE (DebugShape2dRemovedNormalEvent)),
+      fetchDebugShapeAddedFixedEvents (FETCH_SEQUENCE (DebugShape2dAddedFixedToNormalEvent)),
+      fetchDebugShapeRemovedFixedEvents (FETCH_SEQUENCE (DebugShape2dRemovedFixedToNormalEvent)),
+
+      fetchTransformParentChangedEventsFixed (FETCH_SEQUENCE (Transform2dComponentParentChangedFixedToNormalEvent)),
+      fetchTransformParentChangedEventsNormal (FETCH_SEQUENCE (Transform2dComponentParentChangedNormalEvent)),
+
+      fetchVisualLocalTransformChangedEventsFixed (
+          FETCH_SEQUENCE (Transform2dComponentVisualLocalTransformChangedFixedToNormalEvent)),
+      fetchVisualLocalTransformChangedEventsNormal (
+          FETCH_SEQUENCE (Transform2dComponentVisualLocalTransformChangedNormalEvent)),
+
+      fetchSpriteBySpriteId (FETCH_VALUE_1F (Sprite2dComponent, spriteId)),
+      fetchSpriteByObjectId (FETCH_VALUE_1F (Sprite2dComponent, objectId)),
+      fetchUvAnimationBySpriteId (FETCH_VALUE_1F (Sprite2dUvAnimationComponent, spriteId)),
+
+      fetchTransformById (FETCH_VALUE_1F (Transform2dComponent, objectId)),
+      fetchTransformByParentId (FETCH_VALUE_1F (Transform2dComponent, parentObjectId)),
+      transformWorldAccessor (_constructor),
+
+      worldBounds (_worldBounds)
+{
+    _constructor.DependOn (TransformVisualSync::Checkpoint::FINISHED);
+    _constructor.DependOn (RenderPipelineFoundation::Checkpoint::RENDER_STARTED);
+
+    // Sprite changes from pre-batching tasks are guaranteed to be done before bounds calculation.
+    _constructor.DependOn (BoundsCalculation2d::Checkpoint::STARTED);
+    _constructor.MakeDependencyOf (Checkpoint::STARTED);
+}
+
+void SpriteTableSynchronizer::Execute () noexcept
+{
+    auto batchingCursor = modifyBatching.Execute ();
+    auto *batching = static_cast<Batching2dSingleton *> (*batchingCursor);
+
+    for (auto eventCursor = fetchSpriteAddedEvents.Execute ();
+         const auto *event = static_cast<const Sprite2dAddedNormalEvent *> (*eventCursor); ++eventCursor)
+    {
+        Sprite2dRenderData &data = batching->AddSprite (event->spriteId);
+        CopySpriteData (data);
+        UpdateSpriteTransform (data);
+
+        auto animationCursor = fetchUvAnimationBySpriteId.Execute (&event->spriteId);
+        data.uvAnimated = *animationCursor != nullptr;
+    }
+
+    for (auto eventCursor = fetchSpriteSizeChangedEvents.Execute ();
+         const auto *event = static_cast<const Sprite2dSizeChangedNormalEvent *> (*eventCursor); ++eventCursor)
+    {
+        if (Sprite2dRenderData *data = batching->FindSpriteForChange (event->spriteId))
+        {
+            CopySpriteData (*data);
+        }
+    }
+
+    for (auto eventCursor = fetchSpriteBatchingDataChangedEvents.Execute ();
+         const auto *event = static_cast<const Sprite2dBatchingDataChangedNormalEvent *> (*eventCursor);
+         ++eventCursor)
+    {
+        if (Sprite2dRenderData *data = batching->FindSpriteForChange (event->spriteId))
+        {
+            CopySpriteData (*data);
+        }
+    }
+
+    for (auto eventCursor = fetchSpriteRemovedEvents.Execute ();
+         const auto *event = static_cast<const Sprite2dRemovedNormalEvent *> (*eventCursor); ++eventCursor)
+    {
+        batching->RemoveSprite (event->spriteId);
+    }
+
+    // Uv animation changes sprite uv after batching, therefore animated sprites are never baked into static geometry.
+    for (auto eventCursor = fetchUvAnimationAddedEvents.Execute ();
+         const auto *event = static_cast<const Sprite2dUvAnimationAddedNormalEvent *> (*eventCursor); ++eventCursor)
+    {
+        if (Sprite2dRenderData *data = batching->FindSpriteForChange (event->spriteId))
+        {
+            data->uvAnimated = true;
+        }
+    }
+
+    for (UniqueId spriteId : batching->spritesToDemote)
+    {
+        batching->DemoteSprite (spriteId);
+    }
+
+    batching->spritesToDemote.clear ();
+
+    for (auto eventCursor = fetchDebugShapeAddedNormalEvents.Execute (); *eventCursor; ++eventCursor)
+    {
+        ++batching->debugShapeCount;
+    }
+
+    for (auto eventCursor = fetchDebugShapeAddedFixedEvents.Execute (); *eventCursor; ++eventCursor)
+    {
+        ++batching->debugShapeCount;
+    }
+
+    for (auto eventCursor = fetchDebugShapeRemovedNormalEvents.Execute (); *eventCursor; ++eventCursor)
+    {
+        EMERGENCE_ASSERT (batching->debugShapeCount > 0u);
+        --batching->debugShapeCount;
+    }
+
+    for (auto eventCursor = fetchDebugShapeRemovedFixedEvents.Execute (); *eventCursor; ++eventCursor)
+    {
+        EMERGENCE_ASSERT (batching->debugShapeCount > 0u);
+        --batching->debugShapeCount;
+    }
+
+    for (auto eventCursor = fetchTransformParentChangedEventsFixed.Execute ();
+         const auto *event = static_cast<const Transform2dComponentParentChangedFixedToNormalEvent *> (*eventCursor);
+         ++eventCursor)
+    {
+        changedObjects.emplace_back (event->objectId);
+    }
+
+    for (auto eventCursor = fetchTransformParentChangedEventsNormal.Execute ();
+         const auto *event = static_cast<const Transform2dComponentParentChangedNormalEvent *> (*eventCursor);
+         ++eventCursor)
+    {
+        changedObjects.emplace_back (event->objectId);
+    }
+
+    for (auto eventCursor = fetchVisualLocalTransformChangedEventsFixed.Execute ();
+         const auto *event =
+             static_cast<const Transform2dComponentVisualLocalTransformChangedFixedToNormalEvent *> (*eventCursor);
+         ++eventCursor)
+    {
+        changedObjects.emplace_back (event->objectId);
+    }
+
+    for (auto eventCursor = fetchVisualLocalTransformChangedEventsNormal.Execute ();
+         const auto *event =
+             static_cast<const Transform2dComponentVisualLocalTransformChangedNormalEvent *> (*eventCursor);
+         ++eventCursor)
+    {
+        changedObjects.emplace_back (event->objectId);
+    }
+
+    UpdateChangedTransforms (batching);
+    PromoteUnchangedSprites (batching);
+}
+
+void SpriteTableSynchronizer::CopySpriteData (Sprite2dRenderData &_data) noexcept
+{
+    auto spriteCursor = fetchSpriteBySpriteId.Execute (&_data.spriteId);
+    const auto *sprite = static_cast<const Sprite2dComponent *> (*spriteCursor);
+
+    if (!sprite)
+    {
+        // Sprite was already removed, removal event will be processed later.
+        return;
+    }
+
+    _data.objectId = sprite->objectId;
+    _data.materialInstanceId = sprite->materialInstanceId;
+    _data.uv = sprite->uv;
+    _data.halfSize = sprite->halfSize;
+    _data.layer = sprite->layer;
+    _data.visibilityMask = sprite->visibilityMask;
+    UpdateGlobalBounds (_data);
+}
+
+void SpriteTableSynchronizer::UpdateSpriteTransform (Sprite2dRenderData &_data) noexcept
+{
+    auto transformCursor = fetchTransformById.Execute (&_data.objectId);
+    const auto *transform = static_cast<const Transform2dComponent *> (*transformCursor);
+    _data.attachedToTransform = transform != nullptr;
+
+    if (transform)
+    {
+        _data.worldMatrix = Math::Matrix3x3f {transform->GetVisualWorldTransform (transformWorldAccessor)};
+        UpdateGlobalBounds (_data);
+    }
+}
+
+void SpriteTableSynchronizer::UpdateChangedTransforms (Batching2dSingleton *_batching) noexcept
+{
+    // World transforms of all children are changed too, therefore we need to update sprites of the whole subtree.
+    updatedObjects.clear ();
+
+    while (!changedObjects.empty ())
+    {
+        const UniqueId objectId = changedObjects.back ();
+        changedObjects.pop_back ();
+
+        if (!updatedObjects.emplace (objectId).second)
+        {
+            continue;
+        }
+
+        for (auto spriteCursor = fetchSpriteByObjectId.Execute (&objectId);
+             const auto *sprite = static_cast<const Sprite2dComponent *> (*spriteCursor); ++spriteCursor)
+        {
+            if (Sprite2dRenderData *data = _batching->FindSpriteForChange (sprite->spriteId))
+            {
+                UpdateSpriteTransform (*data);
+            }
+        }
+
+        for (auto childCursor = fetchTransformByParentId.Execute (&objectId);
+             const auto *child = static_cast<const Transform2dComponent *> (*childCursor); ++childCursor)
+        {
+            changedObjects.emplace_back (child->GetObjectId ());
+        }
+    }
+}
+
+void SpriteTableSynchronizer::PromoteUnchangedSprites (Batching2dSingleton *_batching) const noexcept
+{
+    // Promoted sprite is replaced by the last sprite, therefore backward pass visits every sprite only once.
+    for (std::size_t spriteIndex = _batching->sprites.size (); spriteIndex > 0u; --spriteIndex)
+    {
+        Sprite2dRenderData &sprite = _batching->sprites[spriteIndex - 1u];
+        if (sprite.attachedToTransform && !sprite.uvAnimated &&
+            ++sprite.framesWithoutChanges >= STATIC_GEOMETRY_PROMOTION_FRAMES)
+        {
+            _batching->PromoteSprite (spriteIndex - 1u, GetStaticGeometryCell (sprite.globalBounds));
+        }
+    }
+}
+
+std::uint32_t SpriteTableSynchronizer::GetStaticGeometryCell (const Math::AxisAlignedBox2d &_bounds) const noexcept
+{
+    const Math::Vector2f center = (_bounds.min + _bounds.max) * 0.5f;
+    auto getCellCoordinate = [] (float _value, float _min, float _max) -> std::uint32_t
+    {
+        if (_max <= _min)
+        {
+            return 0u;
+        }
+
+        const float cell = (_value - _min) / (_max - _min) * static_cast<float> (STATIC_GEOMETRY_GRID_SIZE);
+        return static_cast<std::uint32_t> (
+            std::clamp (cell, 0.0f, static_cast<float> (STATIC_GEOMETRY_GRID_SIZE - 1u)));
+    };
+
+    return getCellCoordinate (center.y, worldBounds.min.y, worldBounds.max.y) * STATIC_GEOMETRY_GRID_SIZE +
+           getCellCoordinate (center.x, worldBounds.min.x, worldBounds.max.x);
+}
+
+void SpriteTableSynchronizer::UpdateGlobalBounds (Sprite2dRenderData &_data) noexcept
+{
+    _data.globalBounds = _data.worldMatrix * Math::AxisAlignedBox2d {-_data.halfSize, _data.halfSize};
+}
+
 class Batching2dExecutor final : public TaskExecutorBase<Batching2dExecutor>
 {
 public:
@@ -32,6 +361,27 @@ public:
     void Execute () noexcept;
 
 private:
+    /// \brief Visible sprite with its batch key: layer in high 16 bits and material instance rank in low 16 bits.
+    struct VisibleSprite final
+    {
+        std::uint32_t key = 0u;
+        std::uint32_t spriteIndex = 0u;
+    };
+
+    void CollectVisibleSprites (const Batching2dSingleton *_batching,
+                                const Math::AxisAlignedBox2d &_globalVisibilityBox,
+                                std::uint64_t _visibilityMask) noexcept;
+
+    void RankMaterialInstances () noexcept;
+
+    void SortVisibleSprites () noexcept;
+
+    void BuildSpriteBatches (Batching2dSingleton *_batching) noexcept;
+
+    static void CollectVisibleStaticGeometry (Batching2dSingleton *_batching,
+                                              const Math::AxisAlignedBox2d &_globalVisibilityBox,
+                                              std::uint64_t _visibilityMask) noexcept;
+
     ModifySingletonQuery modifyBatching;
     FetchAscendingRangeQuery fetchRenderPassesByNameAscending;
     FetchValueQuery fetchViewportByName;
@@ -42,8 +392,16 @@ private:
 
     FetchShapeIntersectionQuery fetchVisibleRenderObjects;
     FetchValueQuery fetchLocalBoundsByRenderObjectId;
-    FetchValueQuery fetchSpriteByObjectId;
     FetchValueQuery fetchDebugShapeByObjectId;
+
+    Container::Vector<VisibleSprite> visibleSprites {Memory::Profiler::AllocationGroup::Top ()};
+    Container::Vector<VisibleSprite> sortBuffer {Memory::Profiler::AllocationGroup::Top ()};
+
+    /// \brief Material instances of visible sprites in order of appearance, sorted by ::RankMaterialInstances.
+    Container::Vector<Memory::UniqueString> materialInstances {Memory::Profiler::AllocationGroup::Top ()};
+    Container::Vector<std::uint16_t> materialInstanceRanks {Memory::Profiler::AllocationGroup::Top ()};
+    Container::HashMap<Memory::UniqueString, std::uint16_t> materialInstanceIndices {
+        Memory::Profiler::AllocationGroup::Top ()};
 };
 
 static Container::Vector<Warehouse::Dimension> GetDimensions (const Math::AxisAlignedBox2d &_worldBounds)
@@ -93,7 +451,6 @@ Batching2dExecutor::Batching2dExecutor (TaskConstructor &_constructor,
       fetchVisibleRenderObjects (_constructor.FetchShapeIntersection (RenderObject2dComponent::Reflect ().mapping,
                                                                       GetDimensions (_worldBounds))),
       fetchLocalBoundsByRenderObjectId (FETCH_VALUE_1F (LocalBounds2dComponent, renderObjectId)),
-      fetchSpriteByObjectId (FETCH_VALUE_1F (Sprite2dComponent, objectId)),
       fetchDebugShapeByObjectId (FETCH_VALUE_1F (DebugShape2dComponent, objectId))
 {
     _constructor.DependOn (BoundsCalculation2d::Checkpoint::FINISHED);
@@ -151,6 +508,17 @@ void Batching2dExecutor::Execute () noexcept
         const Math::Matrix3x3f cameraTransformMatrix {viewportInfo.cameraTransform};
         const Math::AxisAlignedBox2d globalVisibilityBox = cameraTransformMatrix * localVisibilityBox;
 
+        CollectVisibleSprites (batching, globalVisibilityBox, camera->visibilityMask);
+        RankMaterialInstances ();
+        SortVisibleSprites ();
+        BuildSpriteBatches (batching);
+        CollectVisibleStaticGeometry (batching, globalVisibilityBox, camera->visibilityMask);
+
+        if (batching->debugShapeCount == 0u)
+        {
+            continue;
+        }
+
         struct
         {
             float minX;
@@ -178,16 +546,6 @@ void Batching2dExecutor::Execute () noexcept
                 // We do not check local bounds intersection here as it is unneeded in most cases and may throw the
                 // visual out only on rare occasion. Therefore, it is better for performance to avoid this check.
 
-                for (auto spriteCursor = fetchSpriteByObjectId.Execute (&localBounds->objectId);
-                     const auto *sprite = static_cast<const Sprite2dComponent *> (*spriteCursor); ++spriteCursor)
-                {
-                    if (sprite->visibilityMask & camera->visibilityMask)
-                    {
-                        batching->GetBatch (batching->viewports.size () - 1u, sprite->layer, sprite->materialInstanceId)
-                            .sprites.emplace_back (sprite->spriteId);
-                    }
-                }
-
                 for (auto debugShapeCursor = fetchDebugShapeByObjectId.Execute (&localBounds->objectId);
                      const auto *debugShape = static_cast<const DebugShape2dComponent *> (*debugShapeCursor);
                      ++debugShapeCursor)
@@ -202,6 +560,167 @@ void Batching2dExecutor::Execute () noexcept
     }
 }
 
+void Batching2dExecutor::CollectVisibleSprites (const Batching2dSingleton *_batching,
+                                                const Math::AxisAlignedBox2d &_globalVisibilityBox,
+                                                std::uint64_t _visibilityMask) noexcept
+{
+    visibleSprites.clear ();
+    materialInstances.clear ();
+    materialInstanceIndices.clear ();
+
+    // Neighbour sprites usually share material instance, therefore we cache last lookup.
+    Memory::UniqueString lastMaterialInstanceId;
+    std::uint16_t lastMaterialInstanceIndex = 0u;
+
+    // Sprites are culled by their own bounds through linear pass over sprite table, because it is
+    // faster than looking up sprites of every render object returned by spatial query. Static sprites
+    // are not in the table, they are culled by their static geometry bounds instead.
+    for (std::size_t spriteIndex = 0u; spriteIndex < _batching->sprites.size (); ++spriteIndex)
+    {
+        const Sprite2dRenderData &sprite = _batching->sprites[spriteIndex];
+        if (!sprite.attachedToTransform || !(sprite.visibilityMask & _visibilityMask) ||
+            sprite.globalBounds.min.x > _globalVisibilityBox.max.x ||
+            sprite.globalBounds.max.x < _globalVisibilityBox.min.x ||
+            sprite.globalBounds.min.y > _globalVisibilityBox.max.y ||
+            sprite.globalBounds.max.y < _globalVisibilityBox.min.y)
+        {
+            continue;
+        }
+
+        if (materialInstances.empty () || sprite.materialInstanceId != lastMaterialInstanceId)
+        {
+            auto [iterator, inserted] = materialInstanceIndices.emplace (
+                sprite.materialInstanceId, static_cast<std::uint16_t> (materialInstances.size ()));
+
+            if (inserted)
+            {
+                EMERGENCE_ASSERT (materialInstances.size () < std::numeric_limits<std::uint16_t>::max ());
+                materialInstances.emplace_back (sprite.materialInstanceId);
+            }
+
+            lastMaterialInstanceId = sprite.materialInstanceId;
+            lastMaterialInstanceIndex = iterator->second;
+        }
+
+        visibleSprites.emplace_back (VisibleSprite {
+            (static_cast<std::uint32_t> (sprite.layer) << 16u) | lastMaterialInstanceIndex,
+            static_cast<std::uint32_t> (spriteIndex)});
+    }
+}
+
+void Batching2dExecutor::RankMaterialInstances () noexcept
+{
+    // Batches are ordered by material instance name inside layer, therefore material instance indices in keys
+    // are replaced with ranks of material instances in name order. There are only few material instances,
+    // so sorting them is cheap in comparison with sprite sorting.
+    materialInstanceRanks.resize (materialInstances.size ());
+    std::sort (materialInstances.begin (), materialInstances.end (),
+               [] (Memory::UniqueString _first, Memory::UniqueString _second)
+               {
+                   return *_first < *_second;
+               });
+
+    for (std::size_t rank = 0u; rank < materialInstances.size (); ++rank)
+    {
+        materialInstanceRanks[materialInstanceIndices[materialInstances[rank]]] = static_cast<std::uint16_t> (rank);
+    }
+
+    for (VisibleSprite &sprite : visibleSprites)
+    {
+        sprite.key = (sprite.key & 0xFFFF0000u) | materialInstanceRanks[sprite.key & 0x0000FFFFu];
+    }
+}
+
+void Batching2dExecutor::SortVisibleSprites () noexcept
+{
+    // Least significant digit radix sort is stable, therefore sprites inside batch keep sprite table order.
+    constexpr std::size_t DIGIT_BITS = 8u;
+    constexpr std::size_t DIGIT_VALUES = 1u << DIGIT_BITS;
+    constexpr std::uint32_t DIGIT_MASK = DIGIT_VALUES - 1u;
+
+    sortBuffer.resize (visibleSprites.size ());
+    for (std::size_t shift = 0u; shift < sizeof (std::uint32_t) * 8u; shift += DIGIT_BITS)
+    {
+        std::array<std::size_t, DIGIT_VALUES> offsets {};
+        for (const VisibleSprite &sprite : visibleSprites)
+        {
+            ++offsets[(sprite.key >> shift) & DIGIT_MASK];
+        }
+
+        // Usually there are few layers and material instances, therefore most digits are the same for all sprites.
+        if (visibleSprites.empty () ||
+            offsets[(visibleSprites.front ().key >> shift) & DIGIT_MASK] == visibleSprites.size ())
+        {
+            continue;
+        }
+
+        std::size_t offset = 0u;
+        for (std::size_t &digitOffset : offsets)
+        {
+            const std::size_t count = digitOffset;
+            digitOffset = offset;
+            offset += count;
+        }
+
+        for (const VisibleSprite &sprite : visibleSprites)
+        {
+            sortBuffer[offsets[(sprite.key >> shift) & DIGIT_MASK]++] = sprite;
+        }
+
+        visibleSprites.swap (sortBuffer);
+    }
+}
+
+void Batching2dExecutor::BuildSpriteBatches (Batching2dSingleton *_batching) noexcept
+{
+    const std::size_t viewportIndex = _batching->viewports.size () - 1u;
+    std::size_t runBegin = 0u;
+
+    while (runBegin < visibleSprites.size ())
+    {
+        const std::uint32_t key = visibleSprites[runBegin].key;
+        std::size_t runEnd = runBegin + 1u;
+
+        while (runEnd < visibleSprites.size () && visibleSprites[runEnd].key == key)
+        {
+            ++runEnd;
+        }
+
+        Batch2d &batch = _batching->AddBatch (viewportIndex, static_cast<std::uint16_t> (key >> 16u),
+                                              materialInstances[key & 0x0000FFFFu]);
+        batch.spriteIndices.reserve (runEnd - runBegin);
+
+        for (std::size_t index = runBegin; index < runEnd; ++index)
+        {
+            batch.spriteIndices.emplace_back (visibleSprites[index].spriteIndex);
+        }
+
+        runBegin = runEnd;
+    }
+}
+
+void Batching2dExecutor::CollectVisibleStaticGeometry (Batching2dSingleton *_batching,
+                                                       const Math::AxisAlignedBox2d &_globalVisibilityBox,
+                                                       std::uint64_t _visibilityMask) noexcept
+{
+    const std::size_t viewportIndex = _batching->viewports.size () - 1u;
+    for (std::size_t geometryIndex = 0u; geometryIndex < _batching->staticGeometry.size (); ++geometryIndex)
+    {
+        const StaticGeometry2d &geometry = _batching->staticGeometry[geometryIndex];
+        if (geometry.sprites.empty () || !(geometry.key.visibilityMask & _visibilityMask) ||
+            geometry.globalBounds.min.x > _globalVisibilityBox.max.x ||
+            geometry.globalBounds.max.x < _globalVisibilityBox.min.x ||
+            geometry.globalBounds.min.y > _globalVisibilityBox.max.y ||
+            geometry.globalBounds.max.y < _globalVisibilityBox.min.y)
+        {
+            continue;
+        }
+
+        _batching->GetBatch (viewportIndex, geometry.key.layer, geometry.key.materialInstanceId)
+            .staticGeometryIndices.emplace_back (geometryIndex);
+    }
+}
+
 void AddToNormalUpdate (PipelineBuilder &_pipelineBuilder, const Math::AxisAlignedBox2d &_worldBounds) noexcept
 {
     using namespace Memory::Literals;
@@ -214,6 +733,7 @@ void AddToNormalUpdate (PipelineBuilder &_pipelineBuilder, const Math::AxisAlign
 
     _pipelineBuilder.AddCheckpoint (Checkpoint::STARTED);
     _pipelineBuilder.AddCheckpoint (Checkpoint::FINISHED);
+    _pipelineBuilder.AddTask ("Sprite2dRenderTableSynchronizer"_us).SetExecutor<SpriteTableSynchronizer> (_worldBounds);
     _pipelineBuilder.AddTask ("Batching2dExecutor"_us).SetExecutor<Batching2dExecutor> (_worldBounds);
 }
 } // namespace Emergence::Celerity::Batching2d
@@ -192,8 +192,9 @@ void PostBatchingSynchronizer::Execute () noexcept
     {
         for (const Batch2d &batch : viewport.batches)
         {
-            for (UniqueId spriteId : batch.sprites)
+            for (std::size_t spriteIndex : batch.spriteIndices)
             {
+                const UniqueId spriteId = batching->sprites[spriteIndex].spriteId;
                 auto animationCursor = modifyAnimationBySpriteId.Execute (&spriteId);
                 auto *animation = static_cast<Sprite2dUvAnimationComponent *> (*animationCursor);
 
@@ -1,3 +1,4 @@
+#include <atomic>
 #include <limits>
 
 #include <Celerity/Asset/Asset.hpp>
@@ -6,8 +7,10 @@
 #include <Celerity/Render/2d/Batching2dSingleton.hpp>
 #include <Celerity/Render/2d/Camera2dComponent.hpp>
 #include <Celerity/Render/2d/DebugShape2dComponent.hpp>
+#include <Celerity/Render/2d/Events.hpp>
 #include <Celerity/Render/2d/RenderObject2dComponent.hpp>
 #include <Celerity/Render/2d/Sprite2dComponent.hpp>
+#include <Celerity/Render/2d/Sprite2dUvAnimationComponent.hpp>
 #include <Celerity/Render/2d/WorldRendering2d.hpp>
 #include <Celerity/Render/Foundation/MaterialInstanceSubmitter.hpp>
 #include <Celerity/Render/Foundation/RenderFoundationSingleton.hpp>
@@ -16,11 +19,15 @@
 #include <Celerity/Transform/TransformComponent.hpp>
 #include <Celerity/Transform/TransformWorldAccessor.hpp>
 
+#include <Job/Dispatcher.hpp>
+
 #include <Log/Log.hpp>
 
 #include <Math/Constants.hpp>
 #include <Math/Scalar.hpp>
 
+#include <Memory/Heap.hpp>
+
 #include <Render/Backend/Renderer.hpp>
 
 namespace Emergence::Celerity::WorldRendering2d
@@ -48,6 +55,139 @@ static const RectVertex QUAD_VERTICES[4u] = {
 
 static const std::uint16_t QUAD_INDICES[6u] = {2u, 1u, 0u, 0u, 3u, 2u};
 
+static constexpr std::uint64_t SPRITE_STATE =
+    Render::Backend::STATE_WRITE_R | Render::Backend::STATE_WRITE_G | Render::Backend::STATE_WRITE_B |
+    Render::Backend::STATE_WRITE_A | Render::Backend::STATE_BLEND_ALPHA | Render::Backend::STATE_CULL_CW |
+    Render::Backend::STATE_MSAA | Render::Backend::STATE_PRIMITIVE_TRIANGLES;
+
+/// \brief Sprite geometry is generated in chunks of this size, so every job writes into its own buffer range.
+static constexpr std::uint32_t SPRITES_PER_GENERATION_CHUNK = 2048u;
+
+/// \brief Shared state of sprite geometry generation for one batch.
+/// \details Helper jobs might start after renderer has already generated all the chunks, therefore state is
+///          allocated on heap and counts its references: late helpers find no chunks to claim, release their
+///          reference and exit without touching sprites or buffers.
+struct SpriteGeometryGeneration final
+{
+    void *operator new (std::size_t /*unused*/) noexcept;
+
+    void operator delete (void *_pointer) noexcept;
+
+    /// \brief Releases one reference and deletes generation if it was the last one.
+    void Release () noexcept;
+
+    const Container::Vector<Sprite2dRenderData> *sprites = nullptr;
+    const Batch2d *batch = nullptr;
+    RectVertex *vertices = nullptr;
+    void *indices = nullptr;
+    bool use32BitIndices = false;
+    std::uint32_t spriteCount = 0u;
+    std::uint32_t chunkCount = 0u;
+
+    std::atomic<std::uint32_t> nextChunk {0u};
+    std::atomic<std::uint32_t> finishedChunks {0u};
+    std::atomic<std::uint32_t> references {0u};
+};
+
+static Memory::Heap &GetSpriteGeometryGenerationHeap () noexcept
+{
+    static Memory::Heap heap {Memory::Profiler::AllocationGroup {Memory::Profiler::AllocationGroup::Root (),
+                                                                 Memory::UniqueString {"SpriteGeometryGeneration"}}};
+    return heap;
+}
+
+void *SpriteGeometryGeneration::operator new (std::size_t /*unused*/) noexcept
+{
+    return GetSpriteGeometryGenerationHeap ().Acquire (sizeof (SpriteGeometryGeneration),
+                                                       alignof (SpriteGeometryGeneration));
+}
+
+void SpriteGeometryGeneration::operator delete (void *_pointer) noexcept
+{
+    GetSpriteGeometryGenerationHeap ().Release (_pointer, sizeof (SpriteGeometryGeneration));
+}
+
+void SpriteGeometryGeneration::Release () noexcept
+{
+    if (references.fetch_sub (1u, std::memory_order_acq_rel) == 1u)
+    {
+        delete this;
+    }
+}
+
+/// \brief Writes geometry of given sprite as rect with given index in vertex and index buffers.
+template <typename Index>
+static void WriteSpriteRect (const Sprite2dRenderData &_sprite,
+                             std::uint32_t _rectIndex,
+                             RectVertex *_vertices,
+                             Index *_indices) noexcept
+{
+    RectVertex *vertices = _vertices + static_cast<ptrdiff_t> (_rectIndex * 4u);
+    for (std::uint32_t vertexIndex = 0u; vertexIndex < 4u; ++vertexIndex)
+    {
+        RectVertex &vertex = vertices[vertexIndex];
+        const Math::Vector2f localPoint = QUAD_VERTICES[vertexIndex].translation * _sprite.halfSize;
+        const Math::Vector3f globalPoint3f = _sprite.worldMatrix * Math::Vector3f {localPoint.x, localPoint.y, 1.0f};
+
+        vertex.translation.x = globalPoint3f.x;
+        vertex.translation.y = globalPoint3f.y;
+
+        vertex.uv.x = _sprite.uv.min.x + QUAD_VERTICES[vertexIndex].uv.x * (_sprite.uv.max.x - _sprite.uv.min.x);
+        vertex.uv.y = _sprite.uv.min.y + QUAD_VERTICES[vertexIndex].uv.y * (_sprite.uv.max.y - _sprite.uv.min.y);
+    }
+
+    Index *indices = _indices + static_cast<ptrdiff_t> (_rectIndex * 6u);
+    for (std::uint32_t indexIndex = 0u; indexIndex < 6u; ++indexIndex)
+    {
+        indices[indexIndex] = static_cast<Index> (QUAD_INDICES[indexIndex] + _rectIndex * 4u);
+    }
+}
+
+template <typename Index>
+static void GenerateSpriteGeometry (const SpriteGeometryGeneration &_generation,
+                                    std::uint32_t _begin,
+                                    std::uint32_t _end) noexcept
+{
+    for (std::uint32_t index = _begin; index < _end; ++index)
+    {
+        WriteSpriteRect ((*_generation.sprites)[_generation.batch->spriteIndices[index]], index, _generation.vertices,
+                         static_cast<Index *> (_generation.indices));
+    }
+}
+
+/// \brief 16-bit indices are preferred, but they are unable to address vertices of really big batches.
+static bool ShouldUse32BitIndices (std::uint32_t _vertexCount) noexcept
+{
+    return _vertexCount > static_cast<std::uint32_t> (std::numeric_limits<std::uint16_t>::max ()) + 1u;
+}
+
+/// \brief Generates geometry for chunks until there are no chunks left.
+/// \details Chunks are claimed dynamically, therefore caller thread makes progress even if helper jobs
+///          were not started yet, and it only needs to wait for chunks that are already claimed.
+static void ProcessSpriteGeometryChunks (SpriteGeometryGeneration &_generation) noexcept
+{
+    for (std::uint32_t chunk = _generation.nextChunk.fetch_add (1u, std::memory_order_relaxed);
+         chunk < _generation.chunkCount; chunk = _generation.nextChunk.fetch_add (1u, std::memory_order_relaxed))
+    {
+        const std::uint32_t begin = chunk * SPRITES_PER_GENERATION_CHUNK;
+        const std::uint32_t end = std::min (begin + SPRITES_PER_GENERATION_CHUNK, _generation.spriteCount);
+
+        if (_generation.use32BitIndices)
+        {
+            GenerateSpriteGeometry<std::uint32_t> (_generation, begin, end);
+        }
+        else
+        {
+            GenerateSpriteGeometry<std::uint16_t> (_generation, begin, end);
+        }
+
+        if (_generation.finishedChunks.fetch_add (1u, std::memory_order_acq_rel) + 1u == _generation.chunkCount)
+        {
+            _generation.finishedChunks.notify_one ();
+        }
+    }
+}
+
 class WorldRenderer final : public TaskExecutorBase<WorldRenderer>
 {
 public:
@@ -56,9 +196,17 @@ public:
     void Execute () noexcept;
 
 private:
+    void RebuildStaticGeometry (StaticGeometry2d &_geometry) noexcept;
+
+    void SubmitStaticGeometry (Render::Backend::SubmissionAgent &_agent,
+                               const Viewport *_viewport,
+                               Memory::UniqueString _materialInstanceId,
+                               const StaticGeometry2d &_geometry) noexcept;
+
     void SubmitSprites (Render::Backend::SubmissionAgent &_agent,
                         const Viewport *_viewport,
                         const Render::Backend::ProgramId &_programId,
+                        const Container::Vector<Sprite2dRenderData> &_sprites,
                         const Batch2d &_batch) noexcept;
 
     void SubmitDebugShapes (Render::Backend::SubmissionAgent &_agent,
@@ -73,13 +221,19 @@ private:
     FetchValueQuery fetchTransformById;
     Transform2dWorldAccessor transformWorldAccessor;
 
+    FetchSequenceQuery fetchSpriteUvChangedEvents;
+    FetchSequenceQuery fetchUvAnimationRemovedEvents;
     FetchValueQuery fetchSpriteBySpriteId;
+    FetchValueQuery fetchUvAnimationBySpriteId;
     FetchValueQuery fetchDebugShapeByDebugShapeId;
 
     Render::Backend::VertexLayout rectVertexLayout;
     Render::Backend::VertexLayout lineVertexLayout;
 
     MaterialInstanceSubmitter materialInstanceSubmitter;
+
+    Container::Vector<std::uint8_t> bakedVertices {Memory::Profiler::AllocationGroup::Top ()};
+    Container::Vector<std::uint32_t> bakedIndices {Memory::Profiler::AllocationGroup::Top ()};
 };
 
 WorldRenderer::WorldRenderer (TaskConstructor &_constructor) noexcept
@@ -92,7 +246,10 @@ WorldRenderer::WorldRenderer (TaskConstructor &_constructor) noexcept
       fetchTransformById (FETCH_VALUE_1F (Transform2dComponent, objectId)),
       transformWorldAccessor (_constructor),
 
+      fetchSpriteUvChangedEvents (FETCH_SEQUENCE (Sprite2dUvChangedNormalEvent)),
+      fetchUvAnimationRemovedEvents (FETCH_SEQUENCE (Sprite2dUvAnimationRemovedNormalEvent)),
       fetchSpriteBySpriteId (FETCH_VALUE_1F (Sprite2dComponent, spriteId)),
+      fetchUvAnimationBySpriteId (FETCH_VALUE_1F (Sprite2dUvAnimationComponent, spriteId)),
       fetchDebugShapeByDebugShapeId (FETCH_VALUE_1F (DebugShape2dComponent, debugShapeId)),
 
       rectVertexLayout (
@@ -120,6 +277,57 @@ void WorldRenderer::Execute () noexcept
     auto batchingCursor = modifyBatching.Execute ();
     auto *batching = static_cast<Batching2dSingleton *> (*batchingCursor);
 
+    // Uv animation changes uv after batching, therefore uv changes are applied to sprite table right before rendering.
+    for (auto eventCursor = fetchSpriteUvChangedEvents.Execute ();
+         const auto *event = static_cast<const Sprite2dUvChangedNormalEvent *> (*eventCursor); ++eventCursor)
+    {
+        auto locationIterator = batching->spriteLocations.find (event->spriteId);
+        auto spriteCursor = fetchSpriteBySpriteId.Execute (&event->spriteId);
+        const auto *sprite = static_cast<const Sprite2dComponent *> (*spriteCursor);
+
+        if (locationIterator == batching->spriteLocations.end () || !sprite)
+        {
+            continue;
+        }
+
+        const Sprite2dLocation &location = locationIterator->second;
+        if (location.staticGeometryIndex == Sprite2dLocation::DYNAMIC)
+        {
+            Sprite2dRenderData &data = batching->sprites[location.spriteIndex];
+            data.uv = sprite->uv;
+            data.framesWithoutChanges = 0u;
+        }
+        else
+        {
+            // Batches reference sprites and static geometries by indices, therefore sprite is updated in place
+            // and is moved to dynamic sprite table during next synchronization.
+            StaticGeometry2d &geometry = batching->staticGeometry[location.staticGeometryIndex];
+            geometry.sprites[location.spriteIndex].uv = sprite->uv;
+            geometry.dirty = true;
+            batching->spritesToDemote.emplace_back (event->spriteId);
+        }
+    }
+
+    // Uv animations are also removed after batching, therefore sprites are allowed to become static only here.
+    // Animation might be replaced during the same frame, so we check whether sprite is still animated.
+    for (auto eventCursor = fetchUvAnimationRemovedEvents.Execute ();
+         const auto *event = static_cast<const Sprite2dUvAnimationRemovedNormalEvent *> (*eventCursor); ++eventCursor)
+    {
+        if (Sprite2dRenderData *data = batching->FindSprite (event->spriteId))
+        {
+            auto animationCursor = fetchUvAnimationBySpriteId.Execute (&event->spriteId);
+            data->uvAnimated = *animationCursor != nullptr;
+        }
+    }
+
+    for (StaticGeometry2d &geometry : batching->staticGeometry)
+    {
+        if (geometry.dirty)
+        {
+            RebuildStaticGeometry (geometry);
+        }
+    }
+
     auto renderFoundationCursor = fetchRenderFoundation.Execute ();
     const auto *renderFoundation = static_cast<const RenderFoundationSingleton *> (*renderFoundationCursor);
     Render::Backend::SubmissionAgent agent = renderFoundation->renderer.BeginSubmission ();
@@ -140,10 +348,21 @@ void WorldRenderer::Execute () noexcept
 
         for (const Batch2d &batch : viewportInfo.batches)
         {
+            for (std::size_t geometryIndex : batch.staticGeometryIndices)
+            {
+                SubmitStaticGeometry (agent, viewport, batch.materialInstanceId,
+                                      batching->staticGeometry[geometryIndex]);
+            }
+
+            if (batch.spriteIndices.empty () && batch.debugShapes.empty ())
+            {
+                continue;
+            }
+
             if (Container::Optional<Render::Backend::ProgramId> programId =
                     materialInstanceSubmitter.Submit (agent, batch.materialInstanceId))
             {
-                SubmitSprites (agent, viewport, programId.value (), batch);
+                SubmitSprites (agent, viewport, programId.value (), batching->sprites, batch);
                 SubmitDebugShapes (agent, viewport, programId.value (), batch);
             }
         }
@@ -154,24 +373,89 @@ void WorldRenderer::Execute () noexcept
     batching->Reset ();
 }
 
+void WorldRenderer::RebuildStaticGeometry (StaticGeometry2d &_geometry) noexcept
+{
+    _geometry.dirty = false;
+    if (_geometry.sprites.empty ())
+    {
+        _geometry.vertices = {};
+        _geometry.indices = {};
+        return;
+    }
+
+    const auto totalVertices = static_cast<std::uint32_t> (_geometry.sprites.size () * 4u);
+    const auto totalIndices = static_cast<std::uint32_t> (_geometry.sprites.size () * 6u);
+    const bool use32BitIndices = ShouldUse32BitIndices (totalVertices);
+
+    bakedVertices.resize (totalVertices * sizeof (RectVertex));
+    auto *vertices = reinterpret_cast<RectVertex *> (bakedVertices.data ());
+    // Index storage is shared by both index types, 16-bit indices just use first half of it.
+    bakedIndices.resize (use32BitIndices ? totalIndices : (totalIndices + 1u) / 2u);
+
+    // Bounds are only expanded when sprites are added, therefore we recalculate exact bounds here.
+    _geometry.globalBounds = _geometry.sprites.front ().globalBounds;
+
+    for (std::size_t index = 0u; index < _geometry.sprites.size (); ++index)
+    {
+        const Sprite2dRenderData &sprite = _geometry.sprites[index];
+        _geometry.globalBounds = Math::Combine (_geometry.globalBounds, sprite.globalBounds);
+
+        if (use32BitIndices)
+        {
+            WriteSpriteRect (sprite, static_cast<std::uint32_t> (index), vertices, bakedIndices.data ());
+        }
+        else
+        {
+            WriteSpriteRect (sprite, static_cast<std::uint32_t> (index), vertices,
+                             reinterpret_cast<std::uint16_t *> (bakedIndices.data ()));
+        }
+    }
+
+    _geometry.vertices = Render::Backend::VertexBuffer {vertices, totalVertices, rectVertexLayout};
+    _geometry.indices = Render::Backend::IndexBuffer {bakedIndices.data (), totalIndices, use32BitIndices};
+}
+
+void WorldRenderer::SubmitStaticGeometry (Render::Backend::SubmissionAgent &_agent,
+                                          const Viewport *_viewport,
+                                          Memory::UniqueString _materialInstanceId,
+                                          const StaticGeometry2d &_geometry) noexcept
+{
+    if (!_geometry.vertices.IsValid () || !_geometry.indices.IsValid ())
+    {
+        return;
+    }
+
+    // Geometry submission resets uniforms and state, therefore material instance is submitted for every geometry.
+    if (Container::Optional<Render::Backend::ProgramId> programId =
+            materialInstanceSubmitter.Submit (_agent, _materialInstanceId))
+    {
+        _agent.SetState (SPRITE_STATE);
+        _agent.SubmitGeometry (_viewport->viewport.GetId (), programId.value (), _geometry.vertices,
+                               _geometry.indices);
+    }
+}
+
 void WorldRenderer::SubmitSprites (Render::Backend::SubmissionAgent &_agent,
                                    const Viewport *_viewport,
                                    const Render::Backend::ProgramId &_programId,
+                                   const Container::Vector<Sprite2dRenderData> &_sprites,
                                    const Batch2d &_batch) noexcept
 {
-    if (_batch.sprites.empty ())
+    if (_batch.spriteIndices.empty ())
     {
         return;
     }
 
-    const auto totalVertices = static_cast<std::uint32_t> (_batch.sprites.size () * 4u);
-    const auto totalIndices = static_cast<std::uint32_t> (_batch.sprites.size () * 6u);
+    const auto totalVertices = static_cast<std::uint32_t> (_batch.spriteIndices.size () * 4u);
+    const auto totalIndices = static_cast<std::uint32_t> (_batch.spriteIndices.size () * 6u);
+
+    const bool use32BitIndices = ShouldUse32BitIndices (totalVertices);
 
     const std::uint32_t availableVertices =
         Render::Backend::TransientVertexBuffer::TruncateSizeToAvailability (totalVertices, rectVertexLayout);
 
     const std::uint32_t availableIndices =
-        Render::Backend::TransientIndexBuffer::TruncateSizeToAvailability (totalIndices, false);
+        Render::Backend::TransientIndexBuffer::TruncateSizeToAvailability (totalIndices, use32BitIndices);
 
     if (availableVertices != totalVertices || availableIndices != totalIndices)
     {
@@ -179,62 +463,54 @@ void WorldRenderer::SubmitSprites (Render::Backend::SubmissionAgent &_agent,
     }
 
     const std::uint32_t maxRects = std::min (availableVertices / 4u, availableIndices / 6u);
-    const std::uint32_t size = std::min (maxRects, static_cast<std::uint32_t> (_batch.sprites.size ()));
+    const std::uint32_t size = std::min (maxRects, static_cast<std::uint32_t> (_batch.spriteIndices.size ()));
 
     Render::Backend::TransientVertexBuffer vertexBuffer {totalVertices, rectVertexLayout};
-    Render::Backend::TransientIndexBuffer indexBuffer {totalIndices, false};
-
-    for (std::uint32_t index = 0u; index < size; ++index)
+    Render::Backend::TransientIndexBuffer indexBuffer {totalIndices, use32BitIndices};
+
+    auto *generation = new SpriteGeometryGeneration;
+    generation->sprites = &_sprites;
+    generation->batch = &_batch;
+    generation->vertices = static_cast<RectVertex *> (vertexBuffer.GetData ());
+    generation->indices = indexBuffer.GetData ();
+    generation->use32BitIndices = use32BitIndices;
+    generation->spriteCount = size;
+    generation->chunkCount = (size + SPRITES_PER_GENERATION_CHUNK - 1u) / SPRITES_PER_GENERATION_CHUNK;
+
+    // Idle thread count is only a hint: helpers that start late just find no chunks, so we never wait for them.
+    const auto helperCount =
+        generation->chunkCount > 1u ?
+            static_cast<std::uint32_t> (std::min<std::size_t> (
+                generation->chunkCount - 1u, Job::Dispatcher::Global ().GetAvailableThreadsCount ())) :
+            0u;
+
+    // Every helper and renderer own one reference.
+    generation->references.store (helperCount + 1u, std::memory_order_relaxed);
+
+    if (helperCount > 0u)
     {
-        auto spriteCursor = fetchSpriteBySpriteId.Execute (&_batch.sprites[index]);
-        const auto *sprite = static_cast<const Sprite2dComponent *> (*spriteCursor);
-
-        if (!sprite)
-        {
-            continue;
-        }
-
-        // Assert that neither material instance neither layer was changed after batching.
-        EMERGENCE_ASSERT (sprite->materialInstanceId == _batch.materialInstanceId);
-        EMERGENCE_ASSERT (sprite->layer == _batch.layer);
-
-        auto transformCursor = fetchTransformById.Execute (&sprite->objectId);
-        const auto *transform = static_cast<const Transform2dComponent *> (*transformCursor);
-
-        if (!transform)
+        Job::Dispatcher::Batch jobBatch {Job::Dispatcher::Global ()};
+        for (std::uint32_t helperIndex = 0u; helperIndex < helperCount; ++helperIndex)
         {
-            continue;
-        }
-
-        const Math::Matrix3x3f transformMatrix {transform->GetVisualWorldTransform (transformWorldAccessor)};
-        RectVertex *vertices =
-            reinterpret_cast<RectVertex *> (vertexBuffer.GetData ()) + static_cast<ptrdiff_t> (index * 4u);
-
-        for (std::uint32_t vertexIndex = 0u; vertexIndex < 4u; ++vertexIndex)
-        {
-            RectVertex &vertex = vertices[vertexIndex];
-            const Math::Vector2f localPoint = QUAD_VERTICES[vertexIndex].translation * sprite->halfSize;
-            const Math::Vector3f globalPoint3f = transformMatrix * Math::Vector3f {localPoint.x, localPoint.y, 1.0f};
-
-            vertex.translation.x = globalPoint3f.x;
-            vertex.translation.y = globalPoint3f.y;
-
-            vertex.uv.x = sprite->uv.min.x + QUAD_VERTICES[vertexIndex].uv.x * (sprite->uv.max.x - sprite->uv.min.x);
-            vertex.uv.y = sprite->uv.min.y + QUAD_VERTICES[vertexIndex].uv.y * (sprite->uv.max.y - sprite->uv.min.y);
+            jobBatch.Dispatch (Job::Priority::FOREGROUND,
+                               [generation] ()
+                               {
+                                   ProcessSpriteGeometryChunks (*generation);
+                                   generation->Release ();
+                               });
         }
+    }
 
-        std::uint16_t *indices =
-            reinterpret_cast<std::uint16_t *> (indexBuffer.GetData ()) + static_cast<ptrdiff_t> (index * 6u);
-        for (std::uint32_t indexIndex = 0u; indexIndex < 6u; ++indexIndex)
-        {
-            indices[indexIndex] = static_cast<std::uint16_t> (QUAD_INDICES[indexIndex] + index * 4u);
-        }
+    ProcessSpriteGeometryChunks (*generation);
+    for (std::uint32_t finishedChunks = generation->finishedChunks.load (std::memory_order_acquire);
+         finishedChunks < generation->chunkCount;
+         finishedChunks = generation->finishedChunks.load (std::memory_order_acquire))
+    {
+        generation->finishedChunks.wait (finishedChunks, std::memory_order_acquire);
     }
 
-    _agent.SetState (Render::Backend::STATE_WRITE_R | Render::Backend::STATE_WRITE_G | Render::Backend::STATE_WRITE_B |
-                     Render::Backend::STATE_WRITE_A | Render::Backend::STATE_BLEND_ALPHA |
-                     Render::Backend::STATE_CULL_CW | Render::Backend::STATE_MSAA |
-                     Render::Backend::STATE_PRIMITIVE_TRIANGLES);
+    generation->Release ();
+    _agent.SetState (SPRITE_STATE);
 
     _agent.SubmitGeometry (_viewport->viewport.GetId (), _programId, vertexBuffer, indexBuffer);
 }
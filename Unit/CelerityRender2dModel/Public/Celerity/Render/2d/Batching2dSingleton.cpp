@@ -4,6 +4,14 @@
 
 namespace Emergence::Celerity
 {
+std::size_t StaticGeometry2dKey::Hasher::operator() (const StaticGeometry2dKey &_key) const noexcept
+{
+    std::size_t result = std::hash<Memory::UniqueString> {}(_key.materialInstanceId);
+    result = result * 31u + _key.layer;
+    result = result * 31u + static_cast<std::size_t> (_key.visibilityMask);
+    return result * 31u + _key.cell;
+}
+
 const Batching2dSingleton::Reflection &Batching2dSingleton::Reflect () noexcept
 {
     static const Reflection reflection = [] ()
@@ -15,6 +23,32 @@ const Batching2dSingleton::Reflection &Batching2dSingleton::Reflect () noexcept
     return reflection;
 }
 
+static Batch2d &AcquireBatch (Batching2dSingleton &_batching,
+                              ViewportInfoContainer &_viewport,
+                              Container::Vector<Batch2d>::iterator _position,
+                              std::uint16_t _layer,
+                              Memory::UniqueString _materialInstanceId) noexcept
+{
+    if (_batching.freeBatches.empty ())
+    {
+        return *_viewport.batches.emplace (
+            _position, Batch2d {_layer, _materialInstanceId,
+                                Container::Vector<std::size_t> {_viewport.batches.get_allocator ()},
+                                Container::Vector<std::size_t> {_viewport.batches.get_allocator ()},
+                                Container::Vector<UniqueId> {_viewport.batches.get_allocator ()}});
+    }
+
+    Batch2d &pooledBatch = *_viewport.batches.emplace (_position, std::move (_batching.freeBatches.back ()));
+    _batching.freeBatches.pop_back ();
+
+    pooledBatch.layer = _layer;
+    pooledBatch.materialInstanceId = _materialInstanceId;
+    pooledBatch.spriteIndices.clear ();
+    pooledBatch.staticGeometryIndices.clear ();
+    pooledBatch.debugShapes.clear ();
+    return pooledBatch;
+}
+
 Batch2d &Batching2dSingleton::GetBatch (std::size_t _viewportIndex,
                                         std::uint16_t _layer,
                                         Memory::UniqueString _materialInstanceId) noexcept
@@ -43,21 +77,21 @@ Batch2d &Batching2dSingleton::GetBatch (std::size_t _viewportIndex,
         }
     }
 
-    if (freeBatches.empty ())
-    {
-        return *viewport.batches.emplace (
-            next, Batch2d {_layer, _materialInstanceId, Container::Vector<UniqueId> {viewport.batches.get_allocator ()},
-                           Container::Vector<UniqueId> {viewport.batches.get_allocator ()}});
-    }
+    return AcquireBatch (*this, viewport, next, _layer, _materialInstanceId);
+}
 
-    Batch2d &pooledBatch = *viewport.batches.emplace (next, std::move (freeBatches.back ()));
-    freeBatches.pop_back ();
+Batch2d &Batching2dSingleton::AddBatch (std::size_t _viewportIndex,
+                                        std::uint16_t _layer,
+                                        Memory::UniqueString _materialInstanceId) noexcept
+{
+    EMERGENCE_ASSERT (_viewportIndex < viewports.size ());
+    ViewportInfoContainer &viewport = viewports[_viewportIndex];
 
-    pooledBatch.layer = _layer;
-    pooledBatch.materialInstanceId = _materialInstanceId;
-    pooledBatch.sprites.clear ();
-    pooledBatch.debugShapes.clear ();
-    return pooledBatch;
+    EMERGENCE_ASSERT (viewport.batches.empty () || viewport.batches.back ().layer < _layer ||
+                      (viewport.batches.back ().layer == _layer &&
+                       *viewport.batches.back ().materialInstanceId < *_materialInstanceId));
+
+    return AcquireBatch (*this, viewport, viewport.batches.end (), _layer, _materialInstanceId);
 }
 
 void Batching2dSingleton::Reset () noexcept
@@ -81,4 +115,161 @@ void Batching2dSingleton::Reset () noexcept
 
     viewports.clear ();
 }
+
+Sprite2dRenderData &Batching2dSingleton::AddSprite (UniqueId _spriteId) noexcept
+{
+    auto [iterator, inserted] = spriteLocations.emplace (_spriteId, Sprite2dLocation {});
+    if (!inserted)
+    {
+        return iterator->second.staticGeometryIndex == Sprite2dLocation::DYNAMIC ?
+                   sprites[iterator->second.spriteIndex] :
+                   DemoteSprite (iterator->second);
+    }
+
+    iterator->second.spriteIndex = sprites.size ();
+    Sprite2dRenderData &sprite = sprites.emplace_back ();
+    sprite.spriteId = _spriteId;
+    return sprite;
+}
+
+Sprite2dRenderData *Batching2dSingleton::FindSprite (UniqueId _spriteId) noexcept
+{
+    auto iterator = spriteLocations.find (_spriteId);
+    if (iterator == spriteLocations.end ())
+    {
+        return nullptr;
+    }
+
+    const Sprite2dLocation &location = iterator->second;
+    return location.staticGeometryIndex == Sprite2dLocation::DYNAMIC ?
+               &sprites[location.spriteIndex] :
+               &staticGeometry[location.staticGeometryIndex].sprites[location.spriteIndex];
+}
+
+Sprite2dRenderData *Batching2dSingleton::FindSpriteForChange (UniqueId _spriteId) noexcept
+{
+    auto iterator = spriteLocations.find (_spriteId);
+    if (iterator == spriteLocations.end ())
+    {
+        return nullptr;
+    }
+
+    Sprite2dRenderData &sprite = iterator->second.staticGeometryIndex == Sprite2dLocation::DYNAMIC ?
+                                     sprites[iterator->second.spriteIndex] :
+                                     DemoteSprite (iterator->second);
+
+    sprite.framesWithoutChanges = 0u;
+    return &sprite;
+}
+
+void Batching2dSingleton::DemoteSprite (UniqueId _spriteId) noexcept
+{
+    auto iterator = spriteLocations.find (_spriteId);
+    if (iterator != spriteLocations.end () && iterator->second.staticGeometryIndex != Sprite2dLocation::DYNAMIC)
+    {
+        DemoteSprite (iterator->second);
+    }
+}
+
+/// \brief Removes sprite from given table by swapping it with the last one, because sprite order does not matter.
+static void RemoveFromSpriteTable (Container::Vector<Sprite2dRenderData> &_table,
+                                   Container::HashMap<UniqueId, Sprite2dLocation> &_locations,
+                                   std::size_t _index) noexcept
+{
+    if (_index + 1u != _table.size ())
+    {
+        _table[_index] = _table.back ();
+        _locations[_table[_index].spriteId].spriteIndex = _index;
+    }
+
+    _table.pop_back ();
+}
+
+void Batching2dSingleton::RemoveSprite (UniqueId _spriteId) noexcept
+{
+    auto iterator = spriteLocations.find (_spriteId);
+    if (iterator == spriteLocations.end ())
+    {
+        return;
+    }
+
+    const Sprite2dLocation location = iterator->second;
+    spriteLocations.erase (iterator);
+
+    if (location.staticGeometryIndex == Sprite2dLocation::DYNAMIC)
+    {
+        RemoveFromSpriteTable (sprites, spriteLocations, location.spriteIndex);
+    }
+    else
+    {
+        RemoveFromStaticGeometry (location.staticGeometryIndex, location.spriteIndex);
+    }
+}
+
+void Batching2dSingleton::PromoteSprite (std::size_t _spriteIndex, std::uint32_t _cell) noexcept
+{
+    EMERGENCE_ASSERT (_spriteIndex < sprites.size ());
+    const Sprite2dRenderData &sprite = sprites[_spriteIndex];
+    const StaticGeometry2dKey key {sprite.layer, sprite.materialInstanceId, sprite.visibilityMask, _cell};
+
+    auto [indexIterator, inserted] = staticGeometryByKey.emplace (
+        key, freeStaticGeometry.empty () ? staticGeometry.size () : freeStaticGeometry.back ());
+
+    if (inserted)
+    {
+        if (freeStaticGeometry.empty ())
+        {
+            staticGeometry.emplace_back (
+                StaticGeometry2d {key,
+                                  sprite.globalBounds,
+                                  Container::Vector<Sprite2dRenderData> {sprites.get_allocator ()},
+                                  false,
+                                  {},
+                                  {}});
+        }
+        else
+        {
+            // Buffers of reused geometry are replaced during rebuild, because geometry is marked dirty below.
+            staticGeometry[freeStaticGeometry.back ()].key = key;
+            freeStaticGeometry.pop_back ();
+        }
+    }
+
+    StaticGeometry2d &geometry = staticGeometry[indexIterator->second];
+    geometry.globalBounds =
+        geometry.sprites.empty () ? sprite.globalBounds : Math::Combine (geometry.globalBounds, sprite.globalBounds);
+    geometry.dirty = true;
+
+    spriteLocations[sprite.spriteId] = {indexIterator->second, geometry.sprites.size ()};
+    geometry.sprites.emplace_back (sprite);
+    RemoveFromSpriteTable (sprites, spriteLocations, _spriteIndex);
+}
+
+Sprite2dRenderData &Batching2dSingleton::DemoteSprite (Sprite2dLocation &_location) noexcept
+{
+    EMERGENCE_ASSERT (_location.staticGeometryIndex != Sprite2dLocation::DYNAMIC);
+    Sprite2dRenderData &sprite =
+        sprites.emplace_back (staticGeometry[_location.staticGeometryIndex].sprites[_location.spriteIndex]);
+    sprite.framesWithoutChanges = 0u;
+
+    const Sprite2dLocation oldLocation = _location;
+    _location = {Sprite2dLocation::DYNAMIC, sprites.size () - 1u};
+    RemoveFromStaticGeometry (oldLocation.staticGeometryIndex, oldLocation.spriteIndex);
+    return sprite;
+}
+
+void Batching2dSingleton::RemoveFromStaticGeometry (std::size_t _geometryIndex, std::size_t _spriteIndex) noexcept
+{
+    StaticGeometry2d &geometry = staticGeometry[_geometryIndex];
+    RemoveFromSpriteTable (geometry.sprites, spriteLocations, _spriteIndex);
+
+    // Geometry bounds are not shrunk here: they are recalculated during geometry rebuild.
+    geometry.dirty = true;
+
+    if (geometry.sprites.empty ())
+    {
+        staticGeometryByKey.erase (geometry.key);
+        freeStaticGeometry.emplace_back (_geometryIndex);
+    }
+}
 } // namespace Emergence::Celerity
@@ -2,23 +2,93 @@
 
 #include <CelerityRender2dModelApi.hpp>
 
+#include <limits>
+
 #include <Celerity/Standard/UniqueId.hpp>
 
+#include <Container/HashMap.hpp>
 #include <Container/Vector.hpp>
 
+#include <Math/AxisAlignedBox2d.hpp>
+#include <Math/Matrix3x3f.hpp>
 #include <Math/Transform2d.hpp>
 
+#include <Render/Backend/IndexBuffer.hpp>
+#include <Render/Backend/VertexBuffer.hpp>
+
 #include <StandardLayout/Mapping.hpp>
 
 namespace Emergence::Celerity
 {
+/// \brief Denormalized copy of sprite data, required for batching and rendering.
+/// \details Intended for use only inside CelerityRender2dLogic, therefore undocumented.
+struct CelerityRender2dModelApi Sprite2dRenderData final
+{
+    UniqueId objectId = INVALID_UNIQUE_ID;
+    UniqueId spriteId = INVALID_UNIQUE_ID;
+    Memory::UniqueString materialInstanceId;
+    Math::Matrix3x3f worldMatrix {Math::Matrix3x3f::IDENTITY};
+    Math::AxisAlignedBox2d globalBounds {Math::Vector2f::ZERO, Math::Vector2f::ZERO};
+    Math::AxisAlignedBox2d uv {{0.0f, 0.0f}, {1.0f, 1.0f}};
+    Math::Vector2f halfSize {0.5f, 0.5f};
+    std::uint16_t layer = 0u;
+    std::uint64_t visibilityMask = ~0u;
+    std::uint32_t framesWithoutChanges = 0u;
+    bool attachedToTransform = false;
+    bool uvAnimated = false;
+};
+
+/// \brief Describes where sprite is stored: in dynamic sprite table or in one of static geometries.
+/// \details Intended for use only inside CelerityRender2dLogic, therefore undocumented.
+struct CelerityRender2dModelApi Sprite2dLocation final
+{
+    static constexpr std::size_t DYNAMIC = std::numeric_limits<std::size_t>::max ();
+
+    std::size_t staticGeometryIndex = DYNAMIC;
+    std::size_t spriteIndex = 0u;
+};
+
+/// \brief Sprites with the same key are baked into the same static geometry.
+/// \details Intended for use only inside CelerityRender2dLogic, therefore undocumented.
+struct CelerityRender2dModelApi StaticGeometry2dKey final
+{
+    struct Hasher final
+    {
+        std::size_t operator() (const StaticGeometry2dKey &_key) const noexcept;
+    };
+
+    [[nodiscard]] bool operator== (const StaticGeometry2dKey &_other) const noexcept = default;
+
+    std::uint16_t layer = 0u;
+    Memory::UniqueString materialInstanceId;
+    std::uint64_t visibilityMask = ~0u;
+
+    /// \details Static geometries are split by world grid cells, otherwise they could not be culled effectively.
+    std::uint32_t cell = 0u;
+};
+
+/// \brief Sprites that were not changed for several frames, baked into persistent buffers.
+/// \details Intended for use only inside CelerityRender2dLogic, therefore undocumented.
+struct CelerityRender2dModelApi StaticGeometry2d final
+{
+    StaticGeometry2dKey key;
+    Math::AxisAlignedBox2d globalBounds {Math::Vector2f::ZERO, Math::Vector2f::ZERO};
+    Container::Vector<Sprite2dRenderData> sprites {Memory::Profiler::AllocationGroup::Top ()};
+
+    /// \details Dirty geometry buffers are rebuilt by renderer before submission.
+    bool dirty = false;
+    Render::Backend::VertexBuffer vertices;
+    Render::Backend::IndexBuffer indices;
+};
+
 /// \brief Describes 2d batch instance.
 /// \details Intended for use only inside CelerityRender2dLogic, therefore undocumented.
 struct CelerityRender2dModelApi Batch2d final
 {
     std::uint16_t layer = 0u;
     Memory::UniqueString materialInstanceId;
-    Container::Vector<UniqueId> sprites;
+    Container::Vector<std::size_t> spriteIndices;
+    Container::Vector<std::size_t> staticGeometryIndices;
     Container::Vector<UniqueId> debugShapes;
 };
 
@@ -42,16 +112,67 @@ struct CelerityRender2dModelApi Batching2dSingleton final
                        std::uint16_t _layer,
                        Memory::UniqueString _materialInstanceId) noexcept;
 
+    /// \details Appends batch to the end of viewport batch list without searching, therefore batches must be added
+    ///          in (layer, material instance) order. Used when visible sprites are already sorted by batch key.
+    Batch2d &AddBatch (std::size_t _viewportIndex,
+                       std::uint16_t _layer,
+                       Memory::UniqueString _materialInstanceId) noexcept;
+
     void Reset () noexcept;
 
+    Sprite2dRenderData &AddSprite (UniqueId _spriteId) noexcept;
+
+    /// \details Pure lookup: static sprite is returned from its static geometry and stays there.
+    Sprite2dRenderData *FindSprite (UniqueId _spriteId) noexcept;
+
+    /// \details Sprite is going to be changed, therefore static sprite is moved back to dynamic sprite table.
+    Sprite2dRenderData *FindSpriteForChange (UniqueId _spriteId) noexcept;
+
+    /// \details Moves static sprite back to dynamic sprite table. Does nothing for dynamic or unknown sprites.
+    void DemoteSprite (UniqueId _spriteId) noexcept;
+
+    void RemoveSprite (UniqueId _spriteId) noexcept;
+
+    /// \details Moves dynamic sprite to static geometry with given cell. Sprite from the end of dynamic sprite table
+    ///          takes place of promoted sprite, therefore it is advised to promote sprites during backward pass.
+    void PromoteSprite (std::size_t _spriteIndex, std::uint32_t _cell) noexcept;
+
     Container::Vector<ViewportInfoContainer> viewports {Memory::Profiler::AllocationGroup::Top ()};
     Container::Vector<Batch2d> freeBatches {Memory::Profiler::AllocationGroup::Top ()};
 
+    /// \details Sprite table is persistent, unlike batches: it is updated only when sprites or their transforms
+    ///          are changed, so batching and geometry generation are just linear passes over this table.
+    Container::Vector<Sprite2dRenderData> sprites {Memory::Profiler::AllocationGroup::Top ()};
+    Container::HashMap<UniqueId, Sprite2dLocation> spriteLocations {Memory::Profiler::AllocationGroup::Top ()};
+
+    /// \details Sprites that were not changed for several frames are moved from sprite table to static geometries,
+    ///          so they are culled by geometry bounds and their vertices are not generated every frame.
+    ///          Sprite locations reference static geometries by indices, therefore static geometries are never
+    ///          erased: when geometry becomes empty, its key is released and its entry is reused for the next key.
+    Container::Vector<StaticGeometry2d> staticGeometry {Memory::Profiler::AllocationGroup::Top ()};
+    Container::HashMap<StaticGeometry2dKey, std::size_t, StaticGeometry2dKey::Hasher> staticGeometryByKey {
+        Memory::Profiler::AllocationGroup::Top ()};
+
+    /// \details Indices of empty static geometries without keys.
+    Container::Vector<std::size_t> freeStaticGeometry {Memory::Profiler::AllocationGroup::Top ()};
+
+    /// \details Renderer is unable to move sprites between tables, because batches reference sprites by indices,
+    ///          therefore it asks to make static sprites dynamic during next synchronization.
+    Container::Vector<UniqueId> spritesToDemote {Memory::Profiler::AllocationGroup::Top ()};
+
+    /// \details Debug shapes are batched through render object spatial query, but only if there are any.
+    std::size_t debugShapeCount = 0u;
+
     struct CelerityRender2dModelApi Reflection final
     {
         StandardLayout::Mapping mapping;
     };
 
     static const Reflection &Reflect () noexcept;
+
+private:
+    Sprite2dRenderData &DemoteSprite (Sprite2dLocation &_location) noexcept;
+
+    void RemoveFromStaticGeometry (std::size_t _geometryIndex, std::size_t _spriteIndex) noexcept;
 };
 } // namespace Emergence::Celerity
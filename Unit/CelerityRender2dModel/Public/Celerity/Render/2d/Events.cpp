@@ -7,10 +7,13 @@ namespace Emergence::Celerity
 {
 EMERGENCE_CELERITY_EVENT2_IMPLEMENTATION (Sprite2dAddedNormalEvent, objectId, spriteId)
 EMERGENCE_CELERITY_EVENT2_IMPLEMENTATION (Sprite2dSizeChangedNormalEvent, objectId, spriteId)
-EMERGENCE_CELERITY_EVENT1_IMPLEMENTATION (Sprite2dRemovedNormalEvent, objectId)
+EMERGENCE_CELERITY_EVENT2_IMPLEMENTATION (Sprite2dBatchingDataChangedNormalEvent, objectId, spriteId)
+EMERGENCE_CELERITY_EVENT2_IMPLEMENTATION (Sprite2dUvChangedNormalEvent, objectId, spriteId)
+EMERGENCE_CELERITY_EVENT2_IMPLEMENTATION (Sprite2dRemovedNormalEvent, objectId, spriteId)
 
 EMERGENCE_CELERITY_EVENT2_IMPLEMENTATION (Sprite2dUvAnimationAddedNormalEvent, objectId, spriteId);
 EMERGENCE_CELERITY_EVENT2_IMPLEMENTATION (Sprite2dUvAnimationSyncedValuesChangedNormalEvent, objectId, spriteId);
+EMERGENCE_CELERITY_EVENT2_IMPLEMENTATION (Sprite2dUvAnimationRemovedNormalEvent, objectId, spriteId);
 
 EMERGENCE_CELERITY_EVENT2_IMPLEMENTATION (DebugShape2dAddedNormalEvent, objectId, debugShapeId)
 EMERGENCE_CELERITY_EVENT2_IMPLEMENTATION (DebugShape2dAddedFixedToNormalEvent, objectId, debugShapeId)
@@ -36,10 +39,34 @@ void RegisterRender2dEvents (EventRegistrar &_registrar) noexcept
          {{Sprite2dComponent::Reflect ().objectId, Sprite2dSizeChangedNormalEvent::Reflect ().objectId},
           {Sprite2dComponent::Reflect ().spriteId, Sprite2dSizeChangedNormalEvent::Reflect ().spriteId}}});
 
+    // Batching data fields are declared next to each other, therefore they are tracked as one zone.
+    // Otherwise, sprite change tracker would need more zones than it is able to store.
+    _registrar.OnChangeEvent (
+        {{Sprite2dBatchingDataChangedNormalEvent::Reflect ().mapping, EventRoute::NORMAL},
+         Sprite2dComponent::Reflect ().mapping,
+         {
+             Sprite2dComponent::Reflect ().materialInstanceId,
+             Sprite2dComponent::Reflect ().visibilityMask,
+             Sprite2dComponent::Reflect ().layer,
+         },
+         {},
+         {{Sprite2dComponent::Reflect ().objectId, Sprite2dBatchingDataChangedNormalEvent::Reflect ().objectId},
+          {Sprite2dComponent::Reflect ().spriteId, Sprite2dBatchingDataChangedNormalEvent::Reflect ().spriteId}}});
+
+    // Uv changes are tracked separately, because uv animation changes uv after batching.
+    _registrar.OnChangeEvent (
+        {{Sprite2dUvChangedNormalEvent::Reflect ().mapping, EventRoute::NORMAL},
+         Sprite2dComponent::Reflect ().mapping,
+         {Sprite2dComponent::Reflect ().uv},
+         {},
+         {{Sprite2dComponent::Reflect ().objectId, Sprite2dUvChangedNormalEvent::Reflect ().objectId},
+          {Sprite2dComponent::Reflect ().spriteId, Sprite2dUvChangedNormalEvent::Reflect ().spriteId}}});
+
     _registrar.OnRemoveEvent (
         {{Sprite2dRemovedNormalEvent::Reflect ().mapping, EventRoute::NORMAL},
          Sprite2dComponent::Reflect ().mapping,
-         {{Sprite2dComponent::Reflect ().objectId, Sprite2dRemovedNormalEvent::Reflect ().objectId}}});
+         {{Sprite2dComponent::Reflect ().objectId, Sprite2dRemovedNormalEvent::Reflect ().objectId},
+          {Sprite2dComponent::Reflect ().spriteId, Sprite2dRemovedNormalEvent::Reflect ().spriteId}}});
 
     // Sprite2dUvAnimationComponent
 
@@ -64,6 +91,14 @@ void RegisterRender2dEvents (EventRegistrar &_registrar) noexcept
           {Sprite2dUvAnimationComponent::Reflect ().spriteId,
            Sprite2dUvAnimationSyncedValuesChangedNormalEvent::Reflect ().spriteId}}});
 
+    _registrar.OnRemoveEvent (
+        {{Sprite2dUvAnimationRemovedNormalEvent::Reflect ().mapping, EventRoute::NORMAL},
+         Sprite2dUvAnimationComponent::Reflect ().mapping,
+         {{Sprite2dUvAnimationComponent::Reflect ().objectId,
+           Sprite2dUvAnimationRemovedNormalEvent::Reflect ().objectId},
+          {Sprite2dUvAnimationComponent::Reflect ().spriteId,
+           Sprite2dUvAnimationRemovedNormalEvent::Reflect ().spriteId}}});
+
     // DebugShape2dComponent
 
     _registrar.OnAddEvent (
@@ -10,11 +10,15 @@ namespace Emergence::Celerity
 #define EventsApi CelerityRender2dModelApi
 EMERGENCE_CELERITY_EVENT2_DECLARATION (Sprite2dAddedNormalEvent, UniqueId, objectId, UniqueId, spriteId);
 EMERGENCE_CELERITY_EVENT2_DECLARATION (Sprite2dSizeChangedNormalEvent, UniqueId, objectId, UniqueId, spriteId);
-EMERGENCE_CELERITY_EVENT1_DECLARATION (Sprite2dRemovedNormalEvent, UniqueId, objectId);
+EMERGENCE_CELERITY_EVENT2_DECLARATION (
+    Sprite2dBatchingDataChangedNormalEvent, UniqueId, objectId, UniqueId, spriteId);
+EMERGENCE_CELERITY_EVENT2_DECLARATION (Sprite2dUvChangedNormalEvent, UniqueId, objectId, UniqueId, spriteId);
+EMERGENCE_CELERITY_EVENT2_DECLARATION (Sprite2dRemovedNormalEvent, UniqueId, objectId, UniqueId, spriteId);
 
 EMERGENCE_CELERITY_EVENT2_DECLARATION (Sprite2dUvAnimationAddedNormalEvent, UniqueId, objectId, UniqueId, spriteId);
 EMERGENCE_CELERITY_EVENT2_DECLARATION (
     Sprite2dUvAnimationSyncedValuesChangedNormalEvent, UniqueId, objectId, UniqueId, spriteId);
+EMERGENCE_CELERITY_EVENT2_DECLARATION (Sprite2dUvAnimationRemovedNormalEvent, UniqueId, objectId, UniqueId, spriteId);
 
 EMERGENCE_CELERITY_EVENT2_DECLARATION (DebugShape2dAddedNormalEvent, UniqueId, objectId, UniqueId, debugShapeId);
 EMERGENCE_CELERITY_EVENT2_DECLARATION (DebugShape2dAddedFixedToNormalEvent, UniqueId, objectId, UniqueId, debugShapeId);
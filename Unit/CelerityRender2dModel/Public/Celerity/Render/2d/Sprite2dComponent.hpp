@@ -26,12 +26,8 @@ struct CelerityRender2dModelApi Sprite2dComponent final
     /// \brief Material instance that should be used to render the sprite.
     Memory::UniqueString materialInstanceId;
 
-    /// \brief Sprite UV-mapping used for texture projection.
-    Math::AxisAlignedBox2d uv {{0.0f, 0.0f}, {1.0f, 1.0f}};
-
-    /// \brief Half size of the sprite.
-    /// \details We expect half size in order to make geometry generation during rendering a little bit faster.
-    Math::Vector2f halfSize {0.5f, 0.5f};
+    /// \brief Visibility mask used for filtering out unwanted drawables. See Camera2dComponent::visibilityMask.
+    std::uint64_t visibilityMask = ~0u;
 
     /// \brief Sprites are sorted by their layer.
     /// \details Sprites with higher value appear on top of the sprites with lower value.
@@ -39,18 +35,22 @@ struct CelerityRender2dModelApi Sprite2dComponent final
     ///          from the different layers cannot be batched together.
     std::uint16_t layer = 0u;
 
-    /// \brief Visibility mask used for filtering out unwanted drawables. See Camera2dComponent::visibilityMask.
-    std::uint64_t visibilityMask = ~0u;
+    /// \brief Sprite UV-mapping used for texture projection.
+    Math::AxisAlignedBox2d uv {{0.0f, 0.0f}, {1.0f, 1.0f}};
+
+    /// \brief Half size of the sprite.
+    /// \details We expect half size in order to make geometry generation during rendering a little bit faster.
+    Math::Vector2f halfSize {0.5f, 0.5f};
 
     struct CelerityRender2dModelApi Reflection final
     {
         StandardLayout::FieldId objectId;
         StandardLayout::FieldId spriteId;
         StandardLayout::FieldId materialInstanceId;
+        StandardLayout::FieldId visibilityMask;
+        StandardLayout::FieldId layer;
         StandardLayout::FieldId uv;
         StandardLayout::FieldId halfSize;
-        StandardLayout::FieldId layer;
-        StandardLayout::FieldId visibilityMask;
         StandardLayout::Mapping mapping;
     };
 
@@ -100,51 +100,66 @@ AssetState Manager::StartLoading (MaterialLoadingState *_loadingState) noexcept
             const Memory::UniqueString vertexShaderId {EMERGENCE_BUILD_STRING (
                 sharedState->asset.vertexShader, ".vertex", Render::Backend::Program::GetShaderSuffix ())};
 
-            switch (cachedResourceProvider->LoadThirdPartyResource (vertexShaderId, sharedState->shaderDataHeap,
-                                                                    sharedState->vertexSharedSize,
-                                                                    sharedState->vertexShaderData))
+            // Shaders from mapped packages are passed to render backend directly, without intermediate copy.
+            sharedState->vertexShader = cachedResourceProvider->GetThirdPartyResourceView (vertexShaderId);
+            if (sharedState->vertexShader.empty ())
             {
-            case Resource::Provider::LoadingOperationResponse::SUCCESSFUL:
-                break;
-
-            case Resource::Provider::LoadingOperationResponse::NOT_FOUND:
-                EMERGENCE_LOG (ERROR, "MaterialManagement: Unable to find vertex shader \"", vertexShaderId, "\".");
-                sharedState->state = AssetState::MISSING;
-                return;
-
-            case Resource::Provider::LoadingOperationResponse::IO_ERROR:
-                EMERGENCE_LOG (ERROR, "MaterialManagement: Failed to read vertex shader \"", vertexShaderId, "\".");
-                sharedState->state = AssetState::CORRUPTED;
-                return;
-
-            case Resource::Provider::LoadingOperationResponse::WRONG_TYPE:
-                sharedState->state = AssetState::CORRUPTED;
-                return;
+                switch (cachedResourceProvider->LoadThirdPartyResource (vertexShaderId, sharedState->shaderDataHeap,
+                                                                        sharedState->vertexSharedSize,
+                                                                        sharedState->vertexShaderData))
+                {
+                case Resource::Provider::LoadingOperationResponse::SUCCESSFUL:
+                    sharedState->vertexShader = {sharedState->vertexShaderData, sharedState->vertexSharedSize};
+                    break;
+
+                case Resource::Provider::LoadingOperationResponse::NOT_FOUND:
+                    EMERGENCE_LOG (ERROR, "MaterialManagement: Unable to find vertex shader \"", vertexShaderId,
+                                   "\".");
+                    sharedState->state = AssetState::MISSING;
+                    return;
+
+                case Resource::Provider::LoadingOperationResponse::IO_ERROR:
+                    EMERGENCE_LOG (ERROR, "MaterialManagement: Failed to read vertex shader \"", vertexShaderId,
+                                   "\".");
+                    sharedState->state = AssetState::CORRUPTED;
+                    return;
+
+                case Resource::Provider::LoadingOperationResponse::WRONG_TYPE:
+                    sharedState->state = AssetState::CORRUPTED;
+                    return;
+                }
             }
 
             const Memory::UniqueString fragmentShaderId {EMERGENCE_BUILD_STRING (
                 sharedState->asset.fragmentShader, ".fragment", Render::Backend::Program::GetShaderSuffix ())};
 
-            switch (cachedResourceProvider->LoadThirdPartyResource (fragmentShaderId, sharedState->shaderDataHeap,
-                                                                    sharedState->fragmentSharedSize,
-                                                                    sharedState->fragmentShaderData))
+            sharedState->fragmentShader = cachedResourceProvider->GetThirdPartyResourceView (fragmentShaderId);
+            if (sharedState->fragmentShader.empty ())
             {
-            case Resource::Provider::LoadingOperationResponse::SUCCESSFUL:
-                break;
-
-            case Resource::Provider::LoadingOperationResponse::NOT_FOUND:
-                EMERGENCE_LOG (ERROR, "MaterialManagement: Unable to find fragment shader \"", fragmentShaderId, "\".");
-                sharedState->state = AssetState::MISSING;
-                return;
-
-            case Resource::Provider::LoadingOperationResponse::IO_ERROR:
-                EMERGENCE_LOG (ERROR, "MaterialManagement: Failed to read fragment shader \"", fragmentShaderId, "\".");
-                sharedState->state = AssetState::CORRUPTED;
-                return;
-
-            case Resource::Provider::LoadingOperationResponse::WRONG_TYPE:
-                sharedState->state = AssetState::CORRUPTED;
-                return;
+                switch (cachedResourceProvider->LoadThirdPartyResource (fragmentShaderId, sharedState->shaderDataHeap,
+                                                                        sharedState->fragmentSharedSize,
+                                                                        sharedState->fragmentShaderData))
+                {
+                case Resource::Provider::LoadingOperationResponse::SUCCESSFUL:
+                    sharedState->fragmentShader = {sharedState->fragmentShaderData, sharedState->fragmentSharedSize};
+                    break;
+
+                case Resource::Provider::LoadingOperationResponse::NOT_FOUND:
+                    EMERGENCE_LOG (ERROR, "MaterialManagement: Unable to find fragment shader \"", fragmentShaderId,
+                                   "\".");
+                    sharedState->state = AssetState::MISSING;
+                    return;
+
+                case Resource::Provider::LoadingOperationResponse::IO_ERROR:
+                    EMERGENCE_LOG (ERROR, "MaterialManagement: Failed to read fragment shader \"", fragmentShaderId,
+                                   "\".");
+                    sharedState->state = AssetState::CORRUPTED;
+                    return;
+
+                case Resource::Provider::LoadingOperationResponse::WRONG_TYPE:
+                    sharedState->state = AssetState::CORRUPTED;
+                    return;
+                }
             }
 
             sharedState->state = AssetState::READY;
@@ -161,9 +176,9 @@ AssetState Manager::TryFinishLoading (MaterialLoadingState *_loadingState) noexc
     material->vertexShader = _loadingState->sharedState->asset.vertexShader;
     material->fragmentShader = _loadingState->sharedState->asset.fragmentShader;
 
-    material->program = {_loadingState->sharedState->vertexShaderData, _loadingState->sharedState->vertexSharedSize,
-                         _loadingState->sharedState->fragmentShaderData,
-                         _loadingState->sharedState->fragmentSharedSize};
+    const std::span<const std::uint8_t> &vertexShader = _loadingState->sharedState->vertexShader;
+    const std::span<const std::uint8_t> &fragmentShader = _loadingState->sharedState->fragmentShader;
+    material->program = {vertexShader.data (), vertexShader.size (), fragmentShader.data (), fragmentShader.size ()};
 
     if (!material->program.IsValid ())
     {
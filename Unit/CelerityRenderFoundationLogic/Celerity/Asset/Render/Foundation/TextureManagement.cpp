@@ -1,3 +1,5 @@
+#include <cstring>
+
 #include <Celerity/Asset/Asset.hpp>
 #include <Celerity/Asset/Events.hpp>
 #include <Celerity/Asset/Render/Foundation/TextureLoadingState.hpp>
@@ -6,7 +8,7 @@
 #include <Celerity/PipelineBuilderMacros.hpp>
 #include <Celerity/Render/Foundation/Texture.hpp>
 
-#include <Job/Dispatcher.hpp>
+#include <CPU/Profiler.hpp>
 
 #include <Log/Log.hpp>
 
@@ -55,15 +57,34 @@ Manager::Manager (TaskConstructor &_constructor,
 
 AssetState Manager::StartLoading (TextureLoadingState *_loadingState) noexcept
 {
-    Job::Dispatcher::Global ().Dispatch (
-        Job::Priority::BACKGROUND,
+    const VirtualFileSystem::Entry assetEntry =
+        resourceProvider->GetObjectEntry (TextureAsset::Reflect ().mapping, _loadingState->assetId);
+
+    if (!assetEntry)
+    {
+        EMERGENCE_LOG (ERROR, "TextureManagement: Unable to find texture \"", _loadingState->assetId, "\".");
+        return AssetState::MISSING;
+    }
+
+    // Both asset object and texture data are read through virtual file system IO thread, so textures that are
+    // requested during the same frame are read together instead of occupying background jobs with blocking reads.
+    const VirtualFileSystem::AsyncReadRequest request {
+        assetEntry,
         [assetId {_loadingState->assetId}, cachedResourceProvider {resourceProvider},
-         sharedState {_loadingState->sharedState}] ()
+         sharedState {_loadingState->sharedState}] (bool _successful, std::span<const std::uint8_t> _content)
         {
             static CPU::Profiler::SectionDefinition loadingSection {*"TextureLoading"_us, 0xFF999900u};
             CPU::Profiler::SectionInstance section {loadingSection};
 
-            switch (cachedResourceProvider->LoadObject (TextureAsset::Reflect ().mapping, assetId, &sharedState->asset))
+            if (!_successful)
+            {
+                EMERGENCE_LOG (ERROR, "TextureManagement: Failed to read texture \"", assetId, "\".");
+                sharedState->state = AssetState::CORRUPTED;
+                return;
+            }
+
+            switch (cachedResourceProvider->LoadObjectFromData (TextureAsset::Reflect ().mapping, assetId, _content,
+                                                                &sharedState->asset))
             {
             case Resource::Provider::LoadingOperationResponse::SUCCESSFUL:
                 break;
@@ -84,33 +105,40 @@ AssetState Manager::StartLoading (TextureLoadingState *_loadingState) noexcept
                 return;
             }
 
-            switch (cachedResourceProvider->LoadThirdPartyResource (
-                sharedState->asset.textureId, sharedState->textureDataHeap, sharedState->textureDataSize,
-                sharedState->textureData))
-            {
-            case Resource::Provider::LoadingOperationResponse::SUCCESSFUL:
-                break;
+            const VirtualFileSystem::Entry textureEntry =
+                cachedResourceProvider->GetThirdPartyEntry (sharedState->asset.textureId);
 
-            case Resource::Provider::LoadingOperationResponse::NOT_FOUND:
+            if (!textureEntry)
+            {
                 EMERGENCE_LOG (ERROR, "TextureManagement: Unable to find texture source \"",
                                sharedState->asset.textureId, "\".");
                 sharedState->state = AssetState::MISSING;
                 return;
-
-            case Resource::Provider::LoadingOperationResponse::IO_ERROR:
-                EMERGENCE_LOG (ERROR, "TextureManagement: Failed to read texture source \"",
-                               sharedState->asset.textureId, "\".");
-                sharedState->state = AssetState::CORRUPTED;
-                return;
-
-            case Resource::Provider::LoadingOperationResponse::WRONG_TYPE:
-                sharedState->state = AssetState::CORRUPTED;
-                return;
             }
 
-            sharedState->state = AssetState::READY;
-        });
-
+            const VirtualFileSystem::AsyncReadRequest textureRequest {
+                textureEntry,
+                [sharedState] (bool _successful, std::span<const std::uint8_t> _content)
+                {
+                    if (!_successful)
+                    {
+                        EMERGENCE_LOG (ERROR, "TextureManagement: Failed to read texture source \"",
+                                       sharedState->asset.textureId, "\".");
+                        sharedState->state = AssetState::CORRUPTED;
+                        return;
+                    }
+
+                    sharedState->textureDataSize = _content.size ();
+                    sharedState->textureData = static_cast<std::uint8_t *> (
+                        sharedState->textureDataHeap.Acquire (_content.size (), alignof (std::uint64_t)));
+                    memcpy (sharedState->textureData, _content.data (), _content.size ());
+                    sharedState->state = AssetState::READY;
+                }};
+
+            cachedResourceProvider->GetVirtualFileSystemContext ()->SubmitReads ({&textureRequest, 1u});
+        }};
+
+    resourceProvider->GetVirtualFileSystemContext ()->SubmitReads ({&request, 1u});
     return AssetState::LOADING;
 }
 
@@ -2,6 +2,8 @@
 
 #include <CelerityRenderFoundationModelApi.hpp>
 
+#include <span>
+
 #include <Celerity/Asset/Asset.hpp>
 #include <Celerity/Asset/Render/Foundation/Material.hpp>
 #include <Celerity/Standard/ContextEscape.hpp>
@@ -27,6 +29,10 @@ public:
 
     Memory::Heap shaderDataHeap {GetAllocationGroup ()};
 
+    std::span<const std::uint8_t> vertexShader;
+
+    std::span<const std::uint8_t> fragmentShader;
+
     std::uint64_t vertexSharedSize = 0u;
 
     std::uint8_t *vertexShaderData = nullptr;
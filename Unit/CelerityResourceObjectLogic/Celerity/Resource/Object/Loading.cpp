@@ -16,6 +16,113 @@ using namespace Memory::Literals;
 const Memory::UniqueString Checkpoint::STARTED {"ResourceObjectLoadingStarted"};
 const Memory::UniqueString Checkpoint::FINISHED {"ResourceObjectLoadingFinished"};
 
+static void DispatchLibraryLoading (const Handling::Handle<ResourceObjectLoadingSharedState> &_loadingState) noexcept
+{
+    Job::Dispatcher::Global ().Dispatch (
+        Job::Priority::BACKGROUND,
+        [loadingState {_loadingState}] ()
+        {
+            static CPU::Profiler::SectionDefinition loadingSection {*"ResourceObjectLoading"_us, 0xFF999900u};
+            CPU::Profiler::SectionInstance section {loadingSection};
+            Container::Vector<Resource::Object::LibraryLoadingTask> tasks;
+
+            for (Memory::UniqueString objectId : loadingState->requestedObjectList)
+            {
+                tasks.emplace_back () = {objectId};
+            }
+
+            loadingState->library =
+                loadingState->libraryLoader.Load (tasks, std::move (loadingState->preloadedObjects));
+            loadingState->loaded.test_and_set (std::memory_order::release);
+        });
+}
+
+static void FinishPrefetchRead (const Handling::Handle<ResourceObjectLoadingSharedState> &_loadingState) noexcept
+{
+    if (_loadingState->pendingPrefetchReads.fetch_sub (1u, std::memory_order::acq_rel) == 1u)
+    {
+        DispatchLibraryLoading (_loadingState);
+    }
+}
+
+/// \brief Adds asynchronous read request for given object unless it was already requested.
+/// \details Prefetch follows parents and injected objects, so the whole library is usually read by several batched
+///          reads instead of blocking reads from library loading job. Objects that are missed by prefetch,
+///          for example injections inherited from parents, are loaded by library loader through resource provider.
+static void PrefetchObject (const Handling::Handle<ResourceObjectLoadingSharedState> &_loadingState,
+                            Memory::UniqueString _objectId,
+                            bool _scanInjections,
+                            Container::Vector<VirtualFileSystem::AsyncReadRequest> &_output) noexcept
+{
+    if (!_loadingState->prefetchedObjectIds.emplace (_objectId).second)
+    {
+        return;
+    }
+
+    VirtualFileSystem::Entry entry =
+        _loadingState->resourceProvider->GetObjectEntry (Resource::Object::Object::Reflect ().mapping, _objectId);
+
+    if (!entry)
+    {
+        // Library loader will report this error.
+        return;
+    }
+
+    _loadingState->pendingPrefetchReads.fetch_add (1u, std::memory_order::acq_rel);
+    _output.emplace_back () = {
+        std::move (entry),
+        [loadingState {_loadingState}, _objectId, _scanInjections] (bool _successful,
+                                                                    std::span<const std::uint8_t> _content)
+        {
+            Resource::Object::Object object;
+            if (_successful &&
+                loadingState->resourceProvider->LoadObjectFromData (Resource::Object::Object::Reflect ().mapping,
+                                                                    _objectId, _content, &object) ==
+                    Resource::Provider::LoadingOperationResponse::SUCCESSFUL)
+            {
+                Container::Vector<VirtualFileSystem::AsyncReadRequest> requests {
+                    Memory::Profiler::AllocationGroup {"ResourceObjectPrefetch"_us}};
+
+                if (*object.parent)
+                {
+                    PrefetchObject (loadingState, object.parent, false, requests);
+                }
+
+                if (_scanInjections)
+                {
+                    for (const Resource::Object::ObjectComponent &component : object.changelist)
+                    {
+                        for (const Resource::Object::DependencyInjectionInfo &injection :
+                             loadingState->typeManifest.GetInjections ())
+                        {
+                            if (component.component.GetTypeMapping () != injection.injectorType)
+                            {
+                                continue;
+                            }
+
+                            for (const StandardLayout::Patch::ChangeInfo &change : component.component)
+                            {
+                                if (change.field == injection.injectorIdField)
+                                {
+                                    PrefetchObject (loadingState,
+                                                    *static_cast<const Memory::UniqueString *> (change.newValue),
+                                                    true, requests);
+                                    break;
+                                }
+                            }
+                        }
+                    }
+                }
+
+                loadingState->preloadedObjects.emplace (_objectId, std::move (object));
+                loadingState->resourceProvider->GetVirtualFileSystemContext ()->SubmitReads (requests);
+            }
+
+            // Objects that failed to be prefetched are loaded once again by library loader, which reports errors.
+            FinishPrefetchRead (loadingState);
+        }};
+}
+
 class LoadingProcessor final : public TaskExecutorBase<LoadingProcessor>
 {
 public:
@@ -128,23 +235,19 @@ void LoadingProcessor::ProcessRequests (const WorldSingleton *_world,
     if (!loadingState->requestedObjectList.empty ())
     {
         loadingState->ReportEscaped (_world);
-        Job::Dispatcher::Global ().Dispatch (
-            Job::Priority::BACKGROUND,
-            [loadingState] ()
-            {
-                static CPU::Profiler::SectionDefinition loadingSection {*"ResourceObjectLoading"_us, 0xFF999900u};
-                CPU::Profiler::SectionInstance section {loadingSection};
-                Container::Vector<Resource::Object::LibraryLoadingTask> tasks;
+        Container::Vector<VirtualFileSystem::AsyncReadRequest> prefetchRequests {
+            Memory::Profiler::AllocationGroup {"ResourceObjectPrefetch"_us}};
 
-                for (Memory::UniqueString objectId : loadingState->requestedObjectList)
-                {
-                    tasks.emplace_back () = {objectId};
-                }
+        // Additional pending read guards against dispatching library loading before all requests are submitted.
+        loadingState->pendingPrefetchReads.store (1u, std::memory_order::release);
 
-                loadingState->library = loadingState->libraryLoader.Load (tasks);
-                loadingState->loaded.test_and_set (std::memory_order::release);
-            });
+        for (Memory::UniqueString objectId : loadingState->requestedObjectList)
+        {
+            PrefetchObject (loadingState, objectId, true, prefetchRequests);
+        }
 
+        resourceProvider->GetVirtualFileSystemContext ()->SubmitReads (prefetchRequests);
+        FinishPrefetchRead (loadingState);
         _state->sharedStates.emplace_back (std::move (loadingState));
     }
 }
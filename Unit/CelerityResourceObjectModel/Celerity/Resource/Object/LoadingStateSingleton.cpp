@@ -6,7 +6,9 @@ namespace Emergence::Celerity
 {
 ResourceObjectLoadingSharedState::ResourceObjectLoadingSharedState (
     Resource::Provider::ResourceProvider *_resourceProvider, Resource::Object::TypeManifest _typeManifest) noexcept
-    : libraryLoader (_resourceProvider, std::move (_typeManifest))
+    : resourceProvider (_resourceProvider),
+      typeManifest (_typeManifest),
+      libraryLoader (_resourceProvider, std::move (_typeManifest))
 {
 }
 
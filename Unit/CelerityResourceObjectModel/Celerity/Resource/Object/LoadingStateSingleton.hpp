@@ -15,7 +15,7 @@
 
 namespace Emergence::Celerity
 {
-/// \brief Contains resource object library loading state that is shared with background job.
+/// \brief Contains resource object library loading state that is shared with prefetch reads and background job.
 class CelerityResourceObjectModelApi ResourceObjectLoadingSharedState final
     : public ContextEscape<ResourceObjectLoadingSharedState>
 {
@@ -36,6 +36,24 @@ public:
     /// \brief Whether loading is finished.
     std::atomic_flag loaded;
 
+    /// \brief Resource provider from which objects are read.
+    Resource::Provider::ResourceProvider *resourceProvider;
+
+    /// \brief Type manifest that is used to find injected objects during prefetch.
+    Resource::Object::TypeManifest typeManifest;
+
+    /// \brief Count of object prefetch reads that are not finished yet.
+    /// \details Library loading job is dispatched when all prefetch reads are finished.
+    std::atomic_uintptr_t pendingPrefetchReads = 0u;
+
+    /// \brief Ids of all objects, for which prefetch was already requested.
+    /// \details Only accessed from virtual file system IO thread after prefetch is started.
+    Container::HashSet<Memory::UniqueString> prefetchedObjectIds {GetAllocationGroup ()};
+
+    /// \brief Objects that were read and deserialized during prefetch.
+    /// \details Only accessed from virtual file system IO thread until library loading job is dispatched.
+    Resource::Object::LibraryLoader::PreloadedObjectMap preloadedObjects {GetAllocationGroup ()};
+
     /// \brief Library loading state.
     Resource::Object::LibraryLoader libraryLoader;
 
@@ -0,0 +1,289 @@
+#include <Celerity/PipelineBuilderMacros.hpp>
+#include <Celerity/Transform/TransformComponent.hpp>
+#include <Celerity/Transform/TransformHierarchyCleanup.hpp>
+#include <Celerity/Transform/TransformVisualSync.hpp>
+#include <Celerity/Transform/TransformWorldCacheSingleton.hpp>
+#include <Celerity/Transform/TransformWorldPropagation.hpp>
+
+#include <Container/Vector.hpp>
+
+#include <Math/Matrix3x3f.hpp>
+#include <Math/Matrix4x4f.hpp>
+
+#include <Threading/AtomicFlagGuard.hpp>
+
+namespace Emergence::Celerity
+{
+template <typename Transform>
+using WorldMatrix =
+    std::conditional_t<std::is_same_v<Transform, Math::Transform2d>, Math::Matrix3x3f, Math::Matrix4x4f>;
+
+template <typename Transform>
+WorldMatrix<Transform> ComposeWorldMatrix (const WorldMatrix<Transform> &_parent, const WorldMatrix<Transform> &_local);
+
+template <>
+Math::Matrix3x3f ComposeWorldMatrix<Math::Transform2d> (const Math::Matrix3x3f &_parent, const Math::Matrix3x3f &_local)
+{
+    return _parent * _local;
+}
+
+template <>
+Math::Matrix4x4f ComposeWorldMatrix<Math::Transform3d> (const Math::Matrix4x4f &_parent, const Math::Matrix4x4f &_local)
+{
+    return Math::MultiplyTransformMatrices (_parent, _local);
+}
+
+template <typename PropagatedTransform, bool Visual>
+class TransformWorldPropagator final : public TaskExecutorBase<TransformWorldPropagator<PropagatedTransform, Visual>>
+{
+public:
+    TransformWorldPropagator (TaskConstructor &_constructor) noexcept;
+
+    void Execute () noexcept;
+
+private:
+    using Component = TransformComponent<PropagatedTransform>;
+
+    using Matrix = WorldMatrix<PropagatedTransform>;
+
+    static constexpr std::size_t ROOT_INDEX = std::numeric_limits<std::size_t>::max ();
+
+    // Propagator works with either logical or visual transforms, therefore it accesses fields through pointers.
+
+    static constexpr auto LOCAL_TRANSFORM =
+        Visual ? &Component::visualLocalTransform : &Component::logicalLocalTransform;
+
+    static constexpr auto LOCAL_TRANSFORM_REVISION =
+        Visual ? &Component::visualLocalTransformRevision : &Component::logicalLocalTransformRevision;
+
+    static constexpr auto LAST_UPDATE_PARENT_TRANSFORM_REVISION =
+        Visual ? &Component::visualLastUpdateParentTransformRevision :
+                 &Component::logicalLastUpdateParentTransformRevision;
+
+    static constexpr auto LOCAL_TRANSFORM_CHANGED_SINCE_LAST_UPDATE =
+        Visual ? &Component::visualLocalTransformChangedSinceLastUpdate :
+                 &Component::logicalLocalTransformChangedSinceLastUpdate;
+
+    static constexpr auto WORLD_TRANSFORM_CACHE =
+        Visual ? &Component::visualWorldTransformCache : &Component::logicalWorldTransformCache;
+
+    static constexpr auto WORLD_TRANSFORM_REVISION =
+        Visual ? &Component::visualWorldTransformRevision : &Component::logicalWorldTransformRevision;
+
+    static constexpr auto WORLD_TRANSFORM_VALIDATED_REVISION =
+        Visual ? &Component::visualWorldTransformValidatedRevision :
+                 &Component::logicalWorldTransformValidatedRevision;
+
+    static constexpr auto WORLD_CACHE = Visual ? &TransformWorldCacheState::visual : &TransformWorldCacheState::logical;
+
+    struct Node final
+    {
+        /// \brief Propagator only changes mutable cache fields, but pointers to members ignore `mutable`.
+        Component *transform = nullptr;
+        std::size_t parentIndex = ROOT_INDEX;
+        std::uint64_t localTransformRevision = 0u;
+    };
+
+    void RebuildHierarchy (TransformWorldCacheState *_state) noexcept;
+
+    FetchSingletonQuery fetchWorldCache;
+    FetchValueQuery fetchTransformByParentObjectId;
+
+    /// \brief Whether ::nodes were built at least once by this executor.
+    bool hierarchyBuilt = false;
+
+    /// \brief Transform hierarchy nodes, sorted by depth, so parents are always processed before their children.
+    Container::Vector<Node> nodes {Memory::Profiler::AllocationGroup::Top ()};
+
+    /// \brief World matrices of ::nodes, cached in order to avoid transform-matrix conversion for parents.
+    Container::Vector<Matrix> worldMatrices {Memory::Profiler::AllocationGroup::Top ()};
+
+    /// \brief Whether world transform of node was changed during current propagation.
+    Container::Vector<std::uint8_t> changed {Memory::Profiler::AllocationGroup::Top ()};
+};
+
+template <typename PropagatedTransform, bool Visual>
+TransformWorldPropagator<PropagatedTransform, Visual>::TransformWorldPropagator (TaskConstructor &_constructor) noexcept
+    : TaskExecutorBase<TransformWorldPropagator> (_constructor),
+
+      fetchWorldCache (FETCH_SINGLETON (TransformWorldCacheSingleton<PropagatedTransform>)),
+      fetchTransformByParentObjectId (FETCH_VALUE_1F (Component, parentObjectId))
+{
+    _constructor.DependOn (TransformHierarchyCleanup::Checkpoint::FINISHED);
+    if constexpr (Visual)
+    {
+        _constructor.DependOn (TransformVisualSync::Checkpoint::FINISHED);
+    }
+
+    _constructor.DependOn (TransformWorldPropagation::Checkpoint::STARTED);
+    _constructor.MakeDependencyOf (TransformWorldPropagation::Checkpoint::FINISHED);
+}
+
+template <typename PropagatedTransform, bool Visual>
+void TransformWorldPropagator<PropagatedTransform, Visual>::Execute () noexcept
+{
+    auto worldCacheCursor = fetchWorldCache.Execute ();
+    const auto *worldCache = static_cast<const TransformWorldCacheSingleton<PropagatedTransform> *> (*worldCacheCursor);
+    TransformWorldCacheState *state = worldCache->state.Get ();
+    TransformWorldCacheState::Cache &cache = state->*WORLD_CACHE;
+
+    const bool transformsChanged = cache.changed.load (std::memory_order_acquire);
+    if (!transformsChanged && !cache.rebuildRequested.load (std::memory_order_acquire))
+    {
+        // Nothing was changed since last propagation.
+        return;
+    }
+
+    // Lazy world transform updates might be requested by other tasks in parallel.
+    AtomicFlagGuard guard {cache.lock};
+    const bool structureChanged = !hierarchyBuilt || cache.rebuildRequested.load (std::memory_order_acquire);
+
+    if (structureChanged)
+    {
+        // Request is cleared before traversal, therefore requests from parallel readers can not be lost.
+        cache.rebuildRequested.store (false, std::memory_order_relaxed);
+        RebuildHierarchy (state);
+        hierarchyBuilt = true;
+    }
+
+    // If transforms were not changed, rebuild was requested by readers of components that are not yet propagated.
+    // Already validated caches are correct and might be read right now, therefore revision is kept in that case.
+    const std::uint64_t revision = cache.revision.load (std::memory_order_relaxed) + (transformsChanged ? 1u : 0u);
+
+    for (std::size_t index = 0u; index < nodes.size (); ++index)
+    {
+        Node &node = nodes[index];
+        Component &transform = *node.transform;
+        const std::uint64_t localRevision = transform.*LOCAL_TRANSFORM_REVISION;
+
+        changed[index] = structureChanged || localRevision != node.localTransformRevision ||
+                         (node.parentIndex != ROOT_INDEX && changed[node.parentIndex]);
+
+        std::atomic_ref validatedRevision {transform.*WORLD_TRANSFORM_VALIDATED_REVISION};
+        if (!changed[index])
+        {
+            // Neither this transform nor its ancestors were changed, therefore cache is still correct.
+            validatedRevision.store (revision, std::memory_order_release);
+            continue;
+        }
+
+        node.localTransformRevision = localRevision;
+        const Matrix localMatrix {transform.*LOCAL_TRANSFORM};
+
+        if (node.parentIndex == ROOT_INDEX)
+        {
+            worldMatrices[index] = localMatrix;
+        }
+        else
+        {
+            worldMatrices[index] =
+                ComposeWorldMatrix<PropagatedTransform> (worldMatrices[node.parentIndex], localMatrix);
+        }
+
+        // Cache, that was already validated during this revision, might be read right now by other tasks.
+        if (validatedRevision.load (std::memory_order_acquire) == revision)
+        {
+            continue;
+        }
+
+        if (node.parentIndex == ROOT_INDEX)
+        {
+            transform.*WORLD_TRANSFORM_CACHE = transform.*LOCAL_TRANSFORM;
+        }
+        else
+        {
+            transform.*WORLD_TRANSFORM_CACHE = PropagatedTransform {worldMatrices[index]};
+            const Component &parent = *nodes[node.parentIndex].transform;
+            transform.*LAST_UPDATE_PARENT_TRANSFORM_REVISION = parent.*WORLD_TRANSFORM_REVISION;
+        }
+
+        // Keep lazy update state in sync, so lazy update would not recalculate propagated caches.
+        transform.*LOCAL_TRANSFORM_CHANGED_SINCE_LAST_UPDATE = false;
+        ++(transform.*WORLD_TRANSFORM_REVISION);
+        validatedRevision.store (revision, std::memory_order_release);
+    }
+
+    cache.revision.store (revision, std::memory_order_release);
+    cache.changed.store (false, std::memory_order_release);
+}
+
+template <typename PropagatedTransform, bool Visual>
+void TransformWorldPropagator<PropagatedTransform, Visual>::RebuildHierarchy (TransformWorldCacheState *_state) noexcept
+{
+    nodes.clear ();
+    for (auto cursor = fetchTransformByParentObjectId.Execute (&INVALID_UNIQUE_ID);
+         const auto *transform = static_cast<const Component *> (*cursor); ++cursor)
+    {
+        nodes.emplace_back (Node {const_cast<Component *> (transform), ROOT_INDEX, 0u});
+    }
+
+    // Breadth first traversal: nodes of every depth level are added after all nodes of previous level.
+    for (std::size_t index = 0u; index < nodes.size (); ++index)
+    {
+        const UniqueId objectId = nodes[index].transform->GetObjectId ();
+        if (objectId == INVALID_UNIQUE_ID)
+        {
+            // Children of invalid object are roots, therefore they are already added.
+            continue;
+        }
+
+        for (auto cursor = fetchTransformByParentObjectId.Execute (&objectId);
+             const auto *transform = static_cast<const Component *> (*cursor); ++cursor)
+        {
+            nodes.emplace_back (Node {const_cast<Component *> (transform), index, 0u});
+        }
+    }
+
+    // Linked components report their changes to the state of this world.
+    for (Node &node : nodes)
+    {
+        node.transform->worldCacheLink.Link (_state);
+    }
+
+    worldMatrices.clear ();
+    worldMatrices.reserve (nodes.size ());
+
+    for (std::size_t index = 0u; index < nodes.size (); ++index)
+    {
+        worldMatrices.emplace_back (Math::NoInitializationFlag::Confirm ());
+    }
+
+    changed.resize (nodes.size ());
+}
+
+namespace TransformWorldPropagation
+{
+const Memory::UniqueString Checkpoint::STARTED {"TransformWorldPropagationStarted"};
+const Memory::UniqueString Checkpoint::FINISHED {"TransformWorldPropagationFinished"};
+
+template <typename Transform, bool Visual>
+static void AddToPipeline (PipelineBuilder &_pipelineBuilder, const char *_taskName) noexcept
+{
+    auto visualGroup = _pipelineBuilder.OpenVisualGroup ("TransformWorldPropagation");
+    _pipelineBuilder.AddCheckpoint (Checkpoint::STARTED);
+    _pipelineBuilder.AddCheckpoint (Checkpoint::FINISHED);
+    _pipelineBuilder.AddTask (Memory::UniqueString {_taskName})
+        .SetExecutor<TransformWorldPropagator<Transform, Visual>> ();
+}
+
+void Add2dToFixedUpdate (PipelineBuilder &_pipelineBuilder) noexcept
+{
+    AddToPipeline<Math::Transform2d, false> (_pipelineBuilder, "Transform2dLogicalWorldPropagation");
+}
+
+void Add2dToNormalUpdate (PipelineBuilder &_pipelineBuilder) noexcept
+{
+    AddToPipeline<Math::Transform2d, true> (_pipelineBuilder, "Transform2dVisualWorldPropagation");
+}
+
+void Add3dToFixedUpdate (PipelineBuilder &_pipelineBuilder) noexcept
+{
+    AddToPipeline<Math::Transform3d, false> (_pipelineBuilder, "Transform3dLogicalWorldPropagation");
+}
+
+void Add3dToNormalUpdate (PipelineBuilder &_pipelineBuilder) noexcept
+{
+    AddToPipeline<Math::Transform3d, true> (_pipelineBuilder, "Transform3dVisualWorldPropagation");
+}
+} // namespace TransformWorldPropagation
+} // namespace Emergence::Celerity
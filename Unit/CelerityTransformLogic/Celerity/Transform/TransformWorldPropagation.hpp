@@ -0,0 +1,43 @@
+#pragma once
+
+#include <CelerityTransformLogicApi.hpp>
+
+#include <Celerity/PipelineBuilder.hpp>
+
+namespace Emergence::Celerity::TransformWorldPropagation
+{
+/// \brief Contains checkpoints, supported by tasks from ::Add2dToFixedUpdate, ::Add3dToFixedUpdate,
+///        ::Add2dToNormalUpdate and ::Add3dToNormalUpdate.
+/// \details Propagation updates world transform caches of all dirty components at once: hierarchy is stored as
+///          flat array of nodes sorted by depth with parent indices, therefore every world matrix is calculated
+///          exactly once from already calculated parent world matrix. After propagation, world transform getters
+///          of TransformComponent just read cached values until any transform of the same type is changed in the same
+///          world.
+///
+///          All tasks that change transforms of propagated type must be executed before ::STARTED, otherwise
+///          propagated caches will be invalidated and getters will fall back to lazy hierarchy update.
+struct CelerityTransformLogicApi Checkpoint final
+{
+    Checkpoint () = delete;
+
+    /// \brief World transform propagation is started after this checkpoint.
+    static const Memory::UniqueString STARTED;
+
+    /// \brief World transform propagation is finished before this checkpoint.
+    static const Memory::UniqueString FINISHED;
+};
+
+/// \brief Adds tasks required to propagate logical 2d world transforms to fixed update pipeline.
+CelerityTransformLogicApi void Add2dToFixedUpdate (PipelineBuilder &_pipelineBuilder) noexcept;
+
+/// \brief Adds tasks required to propagate visual 2d world transforms to normal update pipeline.
+/// \invariant Tasks from TransformVisualSync::Add2dToNormalUpdate must be added to this pipeline.
+CelerityTransformLogicApi void Add2dToNormalUpdate (PipelineBuilder &_pipelineBuilder) noexcept;
+
+/// \brief Adds tasks required to propagate logical 3d world transforms to fixed update pipeline.
+CelerityTransformLogicApi void Add3dToFixedUpdate (PipelineBuilder &_pipelineBuilder) noexcept;
+
+/// \brief Adds tasks required to propagate visual 3d world transforms to normal update pipeline.
+/// \invariant Tasks from TransformVisualSync::Add3dToNormalUpdate must be added to this pipeline.
+CelerityTransformLogicApi void Add3dToNormalUpdate (PipelineBuilder &_pipelineBuilder) noexcept;
+} // namespace Emergence::Celerity::TransformWorldPropagation
@@ -17,6 +17,7 @@ template <typename Transform>
 void TransformComponent<Transform>::SetObjectId (UniqueId _objectId) noexcept
 {
     objectId = _objectId;
+    worldCacheLink.ReportStructureChanged ();
 }
 
 template <typename Transform>
@@ -30,7 +31,10 @@ void TransformComponent<Transform>::SetParentObjectId (UniqueId _parentObjectId)
 {
     parentObjectId = _parentObjectId;
     logicalLastUpdateParentTransformRevision = UNKNOWN_REVISION;
+    logicalLocalTransformChangedSinceLastUpdate = true;
     visualLastUpdateParentTransformRevision = UNKNOWN_REVISION;
+    visualLocalTransformChangedSinceLastUpdate = true;
+    worldCacheLink.ReportStructureChanged ();
 }
 
 template <typename Transform>
@@ -46,6 +50,7 @@ void TransformComponent<Transform>::SetLogicalLocalTransform (const Transform &_
     logicalLocalTransform = _transform;
     ++logicalLocalTransformRevision;
     logicalLocalTransformChangedSinceLastUpdate = true;
+    worldCacheLink.ReportLogicalChanged ();
 
     if (_skipInterpolation)
     {
@@ -68,9 +73,23 @@ template <typename Transform>
 const Transform &TransformComponent<Transform>::GetLogicalWorldTransform (
     TransformWorldAccessor<Transform> &_accessor) const noexcept
 {
-    static std::atomic_flag lock;
-    AtomicFlagGuard guard {lock};
+    // Nothing was changed since last propagation, therefore cache is guaranteed to be up to date.
+    if (TransformWorldCacheState *linkedState = worldCacheLink.Get ();
+        linkedState && !linkedState->logical.changed.load (std::memory_order_acquire) &&
+        std::atomic_ref {logicalWorldTransformValidatedRevision}.load (std::memory_order_acquire) ==
+            linkedState->logical.revision.load (std::memory_order_acquire))
+    {
+        return logicalWorldTransformCache;
+    }
 
+    TransformWorldCacheState::Cache &cache = _accessor.GetCacheState ()->logical;
+    if (!cache.changed.load (std::memory_order_acquire) && !cache.rebuildRequested.load (std::memory_order_relaxed))
+    {
+        // Nothing was changed, but cache was not validated: component is not in propagated hierarchy yet.
+        cache.rebuildRequested.store (true, std::memory_order_relaxed);
+    }
+
+    AtomicFlagGuard guard {cache.lock};
     UpdateLogicalWorldTransformCache (_accessor);
     return logicalWorldTransformCache;
 }
@@ -87,15 +106,30 @@ void TransformComponent<Transform>::SetVisualLocalTransform (const Transform &_t
     visualLocalTransform = _transform;
     ++visualLocalTransformRevision;
     visualLocalTransformChangedSinceLastUpdate = true;
+    worldCacheLink.ReportVisualChanged ();
 }
 
 template <typename Transform>
 const Transform &TransformComponent<Transform>::GetVisualWorldTransform (
     TransformWorldAccessor<Transform> &_accessor) const noexcept
 {
-    static std::atomic_flag lock;
-    AtomicFlagGuard guard {lock};
+    // Nothing was changed since last propagation, therefore cache is guaranteed to be up to date.
+    if (TransformWorldCacheState *linkedState = worldCacheLink.Get ();
+        linkedState && !linkedState->visual.changed.load (std::memory_order_acquire) &&
+        std::atomic_ref {visualWorldTransformValidatedRevision}.load (std::memory_order_acquire) ==
+            linkedState->visual.revision.load (std::memory_order_acquire))
+    {
+        return visualWorldTransformCache;
+    }
 
+    TransformWorldCacheState::Cache &cache = _accessor.GetCacheState ()->visual;
+    if (!cache.changed.load (std::memory_order_acquire) && !cache.rebuildRequested.load (std::memory_order_relaxed))
+    {
+        // Nothing was changed, but cache was not validated: component is not in propagated hierarchy yet.
+        cache.rebuildRequested.store (true, std::memory_order_relaxed);
+    }
+
+    AtomicFlagGuard guard {cache.lock};
     UpdateVisualWorldTransformCache (_accessor);
     return visualWorldTransformCache;
 }
@@ -106,17 +140,16 @@ const Transform &TransformComponent<Transform>::GetVisualWorldTransform (
                                                                                                                        \
     if (parent)                                                                                                        \
     {                                                                                                                  \
-        if (parent->Update##MethodTag##WorldTransformCache (_accessor) ||                                              \
-            parent->VariableTag##LocalTransformRevision != VariableTag##LastUpdateParentTransformRevision ||           \
+        parent->Update##MethodTag##WorldTransformCache (_accessor);                                                    \
+        if (parent->VariableTag##WorldTransformRevision != VariableTag##LastUpdateParentTransformRevision ||           \
             VariableTag##LocalTransformChangedSinceLastUpdate)                                                         \
         {                                                                                                              \
-            /* TODO: We already had matrix representation of `parent->*WorldTransform` during                          \
-                     `parent->Update*WorldTransformCache` call unless parent is a root node. Therefore,                \
-                     we might try to optimize this method by introducing matrix caching. However, it would             \
-                     slow down root node getters, because they would calculate unneeded matrix. */                     \
+            /* Parent world revision is checked instead of its local revision, because parent world transform          \
+               is also changed when any of its ancestors is changed. */                                                \
             VariableTag##WorldTransformCache = parent->VariableTag##WorldTransformCache * VariableTag##LocalTransform; \
-            VariableTag##LastUpdateParentTransformRevision = parent->VariableTag##LocalTransformRevision;              \
+            VariableTag##LastUpdateParentTransformRevision = parent->VariableTag##WorldTransformRevision;              \
             VariableTag##LocalTransformChangedSinceLastUpdate = false;                                                 \
+            ++VariableTag##WorldTransformRevision;                                                                     \
             return true;                                                                                               \
         }                                                                                                              \
                                                                                                                        \
@@ -129,6 +162,7 @@ const Transform &TransformComponent<Transform>::GetVisualWorldTransform (
     {                                                                                                                  \
         VariableTag##WorldTransformCache = VariableTag##LocalTransform;                                                \
         VariableTag##LocalTransformChangedSinceLastUpdate = false;                                                     \
+        ++VariableTag##WorldTransformRevision;                                                                         \
         return true;                                                                                                   \
     }                                                                                                                  \
                                                                                                                        \
@@ -148,6 +182,97 @@ bool TransformComponent<Transform>::UpdateVisualWorldTransformCache (
     CACHE_UPDATE_METHOD (Visual, visual);
 }
 
+template <typename Transform>
+TransformComponent<Transform>::WorldCacheLink::WorldCacheLink (const WorldCacheLink &_other) noexcept
+{
+    Link (_other.state);
+    ReportStructureChanged ();
+}
+
+template <typename Transform>
+TransformComponent<Transform>::WorldCacheLink::WorldCacheLink (WorldCacheLink &&_other) noexcept
+    : state (_other.state)
+{
+    _other.state = nullptr;
+    ReportStructureChanged ();
+}
+
+template <typename Transform>
+TransformComponent<Transform>::WorldCacheLink::~WorldCacheLink () noexcept
+{
+    if (state)
+    {
+        state->ReportStructureChanged ();
+        state->UnregisterReference ();
+
+        if (state->GetReferenceCount () == 0u)
+        {
+            delete state;
+        }
+    }
+}
+
+template <typename Transform>
+void TransformComponent<Transform>::WorldCacheLink::Link (TransformWorldCacheState *_state) noexcept
+{
+    std::atomic_ref linkedState {state};
+    if (_state && !linkedState.load (std::memory_order_relaxed))
+    {
+        _state->RegisterReference ();
+        linkedState.store (_state, std::memory_order_release);
+    }
+}
+
+template <typename Transform>
+TransformWorldCacheState *TransformComponent<Transform>::WorldCacheLink::Get () noexcept
+{
+    return std::atomic_ref {state}.load (std::memory_order_acquire);
+}
+
+template <typename Transform>
+void TransformComponent<Transform>::WorldCacheLink::ReportStructureChanged () noexcept
+{
+    if (state)
+    {
+        state->ReportStructureChanged ();
+    }
+}
+
+template <typename Transform>
+void TransformComponent<Transform>::WorldCacheLink::ReportLogicalChanged () noexcept
+{
+    if (state)
+    {
+        TransformWorldCacheState::ReportChanged (state->logical);
+    }
+}
+
+template <typename Transform>
+void TransformComponent<Transform>::WorldCacheLink::ReportVisualChanged () noexcept
+{
+    if (state)
+    {
+        TransformWorldCacheState::ReportChanged (state->visual);
+    }
+}
+
+template <typename Transform>
+typename TransformComponent<Transform>::WorldCacheLink &TransformComponent<Transform>::WorldCacheLink::operator= (
+    const WorldCacheLink &_other) noexcept
+{
+    // Link is kept, because assigned component is still stored in the same world.
+    Link (_other.state);
+    ReportStructureChanged ();
+    return *this;
+}
+
+template <typename Transform>
+typename TransformComponent<Transform>::WorldCacheLink &TransformComponent<Transform>::WorldCacheLink::operator= (
+    WorldCacheLink &&_other) noexcept
+{
+    return *this = static_cast<const WorldCacheLink &> (_other);
+}
+
 template <typename Transform>
 const typename TransformComponent<Transform>::Reflection &TransformComponent<Transform>::Reflect () noexcept
 {
@@ -2,9 +2,11 @@
 
 #include <CelerityTransformModelApi.hpp>
 
+#include <atomic>
 #include <limits>
 
 #include <Celerity/Standard/UniqueId.hpp>
+#include <Celerity/Transform/TransformWorldCacheSingleton.hpp>
 
 #include <Math/Transform2d.hpp>
 #include <Math/Transform3d.hpp>
@@ -25,6 +27,10 @@ class TransformWorldAccessor;
 ///
 ///          If object is used only for visual effects, only its visual transform should be changed,
 ///          because it has no "logical" gameplay meaning.
+///
+///          World transforms are cached. Tasks from TransformWorldPropagation update caches of all components
+///          in hierarchy order, after that world transform getters only read cached values until any transform of
+///          the same type is changed in the same world. Otherwise getters lazily update required part of hierarchy.
 template <typename Transform>
 class CelerityTransformModelApi TransformComponent final
 {
@@ -66,15 +72,55 @@ private:
     template <typename TransformComponentType>
     friend class TransformVisualSynchronizer;
 
+    template <typename PropagatedTransform, bool Visual>
+    friend class TransformWorldPropagator;
+
     /// \brief Used to inform transform caching logic that parent transform was never observed yet.
     static constexpr std::size_t UNKNOWN_REVISION = std::numeric_limits<UniqueId>::max ();
 
+    /// \brief Reference to world caching state, to which component was linked by propagation.
+    /// \details Only propagation links components and it never runs in parallel with transform writers,
+    ///          therefore copy, move and destruction can safely report structure changes to linked state.
+    struct CelerityTransformModelApi WorldCacheLink final
+    {
+        WorldCacheLink () noexcept = default;
+
+        WorldCacheLink (const WorldCacheLink &_other) noexcept;
+
+        WorldCacheLink (WorldCacheLink &&_other) noexcept;
+
+        ~WorldCacheLink () noexcept;
+
+        /// \brief Links to given state if not linked already.
+        void Link (TransformWorldCacheState *_state) noexcept;
+
+        /// \return Linked state or `nullptr`.
+        /// \details Safe to call while propagation links components in parallel.
+        TransformWorldCacheState *Get () noexcept;
+
+        void ReportStructureChanged () noexcept;
+
+        void ReportLogicalChanged () noexcept;
+
+        void ReportVisualChanged () noexcept;
+
+        WorldCacheLink &operator= (const WorldCacheLink &_other) noexcept;
+
+        WorldCacheLink &operator= (WorldCacheLink &&_other) noexcept;
+
+        /// \details Accessed through std::atomic_ref, because world transforms might be requested
+        ///          while propagation links components.
+        TransformWorldCacheState *state = nullptr;
+    };
+
     /// \return Whether cache was actually changed.
     bool UpdateLogicalWorldTransformCache (TransformWorldAccessor<Transform> &_accessor) const noexcept;
 
     /// \return Whether cache was actually changed.
     bool UpdateVisualWorldTransformCache (TransformWorldAccessor<Transform> &_accessor) const noexcept;
 
+    mutable WorldCacheLink worldCacheLink;
+
     UniqueId objectId = INVALID_UNIQUE_ID;
     UniqueId parentObjectId = INVALID_UNIQUE_ID;
 
@@ -84,12 +130,26 @@ private:
     mutable bool logicalLocalTransformChangedSinceLastUpdate = true;
     mutable Transform logicalWorldTransformCache {};
 
+    /// \brief Incremented every time when ::logicalWorldTransformCache is recalculated.
+    mutable std::uint64_t logicalWorldTransformRevision = 0u;
+
+    /// \brief Propagation revision during which ::logicalWorldTransformCache was validated last time.
+    alignas (std::atomic_ref<std::uint64_t>::required_alignment) mutable std::uint64_t
+        logicalWorldTransformValidatedRevision = 0u;
+
     Transform visualLocalTransform {};
     std::uint64_t visualLocalTransformRevision = 0u;
     mutable std::uint64_t visualLastUpdateParentTransformRevision = UNKNOWN_REVISION;
     mutable bool visualLocalTransformChangedSinceLastUpdate = true;
     mutable Transform visualWorldTransformCache {};
 
+    /// \brief Incremented every time when ::visualWorldTransformCache is recalculated.
+    mutable std::uint64_t visualWorldTransformRevision = 0u;
+
+    /// \brief Propagation revision during which ::visualWorldTransformCache was validated last time.
+    alignas (std::atomic_ref<std::uint64_t>::required_alignment) mutable std::uint64_t
+        visualWorldTransformValidatedRevision = 0u;
+
     bool visualTransformSyncNeeded = false;
 
     std::uint64_t lastObservedLogicalTransformRevision = 0u;
@@ -6,10 +6,19 @@ namespace Emergence::Celerity
 {
 template <typename Transform>
 TransformWorldAccessor<Transform>::TransformWorldAccessor (TaskConstructor &_constructor) noexcept
-    : fetchTransformByObjectId (FETCH_VALUE_1F (TransformComponent<Transform>, objectId))
+    : fetchTransformByObjectId (FETCH_VALUE_1F (TransformComponent<Transform>, objectId)),
+      fetchWorldCache (FETCH_SINGLETON (TransformWorldCacheSingleton<Transform>))
 {
 }
 
+template <typename Transform>
+TransformWorldCacheState *TransformWorldAccessor<Transform>::GetCacheState () noexcept
+{
+    auto cursor = fetchWorldCache.Execute ();
+    const auto *worldCache = static_cast<const TransformWorldCacheSingleton<Transform> *> (*cursor);
+    return worldCache->state.Get ();
+}
+
 template class TransformWorldAccessor<Math::Transform2d>;
 template class TransformWorldAccessor<Math::Transform3d>;
 } // namespace Emergence::Celerity
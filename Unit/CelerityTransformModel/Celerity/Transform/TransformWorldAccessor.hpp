@@ -3,13 +3,14 @@
 #include <CelerityTransformModelApi.hpp>
 
 #include <Celerity/PipelineBuilder.hpp>
+#include <Celerity/Transform/TransformWorldCacheSingleton.hpp>
 
 #include <Math/Transform2d.hpp>
 #include <Math/Transform3d.hpp>
 
 namespace Emergence::Celerity
 {
-/// \brief Encapsulates query, required for Transform3dComponent world transform access.
+/// \brief Encapsulates queries, required for TransformComponent world transform access.
 template <typename Transform>
 class CelerityTransformModelApi TransformWorldAccessor final
 {
@@ -19,7 +20,11 @@ public:
 private:
     friend class TransformComponent<Transform>;
 
+    /// \return World caching state of this world.
+    TransformWorldCacheState *GetCacheState () noexcept;
+
     FetchValueQuery fetchTransformByObjectId;
+    FetchSingletonQuery fetchWorldCache;
 };
 
 using Transform2dWorldAccessor = TransformWorldAccessor<Math::Transform2d>;
@@ -0,0 +1,78 @@
+#include <Celerity/Transform/TransformWorldCacheSingleton.hpp>
+
+#include <Memory/Heap.hpp>
+
+#include <StandardLayout/MappingRegistration.hpp>
+
+namespace Emergence::Celerity
+{
+using namespace Memory::Literals;
+
+static Memory::Heap &GetWorldCacheStateHeap () noexcept
+{
+    static Memory::Heap heap {Memory::Profiler::AllocationGroup {"TransformWorldCacheState"_us}};
+    return heap;
+}
+
+void *TransformWorldCacheState::operator new (std::size_t /*unused*/) noexcept
+{
+    return GetWorldCacheStateHeap ().Acquire (sizeof (TransformWorldCacheState), alignof (TransformWorldCacheState));
+}
+
+void TransformWorldCacheState::operator delete (void *_pointer) noexcept
+{
+    GetWorldCacheStateHeap ().Release (_pointer, sizeof (TransformWorldCacheState));
+}
+
+void TransformWorldCacheState::ReportChanged (Cache &_cache) noexcept
+{
+    // Writers never run in parallel with readers and propagation, therefore relaxed order is enough.
+    if (!_cache.changed.load (std::memory_order_relaxed))
+    {
+        _cache.changed.store (true, std::memory_order_relaxed);
+    }
+}
+
+void TransformWorldCacheState::ReportStructureChanged () noexcept
+{
+    for (Cache *cache : {&logical, &visual})
+    {
+        ReportChanged (*cache);
+        if (!cache->rebuildRequested.load (std::memory_order_relaxed))
+        {
+            cache->rebuildRequested.store (true, std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename Transform>
+const typename TransformWorldCacheSingleton<Transform>::Reflection &
+TransformWorldCacheSingleton<Transform>::Reflect () noexcept
+{
+    static Reflection reflection = [] ()
+    {
+        constexpr const char *NAME = [] () constexpr
+        {
+            if constexpr (std::is_same_v<Transform, Math::Transform2d>)
+            {
+                return "Transform2dWorldCacheSingleton";
+            }
+
+            if constexpr (std::is_same_v<Transform, Math::Transform3d>)
+            {
+                return "Transform3dWorldCacheSingleton";
+            }
+
+            return "TransformUnknownWorldCacheSingleton";
+        }();
+
+        EMERGENCE_MAPPING_REGISTRATION_BEGIN_WITH_CUSTOM_NAME (TransformWorldCacheSingleton, NAME);
+        EMERGENCE_MAPPING_REGISTRATION_END ();
+    }();
+
+    return reflection;
+}
+
+template struct TransformWorldCacheSingleton<Math::Transform2d>;
+template struct TransformWorldCacheSingleton<Math::Transform3d>;
+} // namespace Emergence::Celerity
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <CelerityTransformModelApi.hpp>
+
+#include <atomic>
+
+#include <Handling/Handle.hpp>
+#include <Handling/HandleableBase.hpp>
+
+#include <Math/Transform2d.hpp>
+#include <Math/Transform3d.hpp>
+
+#include <StandardLayout/Mapping.hpp>
+
+namespace Emergence::Celerity
+{
+/// \brief World transform caching state, shared by all transform components of one type inside one world.
+/// \details Transform setters only raise change flags of the state to which component is linked, revisions are
+///          incremented by TransformWorldPropagation once per pass. Therefore writes never touch state of other
+///          worlds and repeated writes do not contend on shared counters.
+///
+///          State is allocated separately from TransformWorldCacheSingleton, because components, linked to it by
+///          propagation, hold references to it and might outlive singleton during garbage collection.
+class CelerityTransformModelApi TransformWorldCacheState final : public Handling::HandleableBase
+{
+public:
+    /// \brief Caching state of either logical or visual world transforms.
+    struct CelerityTransformModelApi Cache final
+    {
+        /// \brief Incremented by propagation pass if any transform was changed since previous pass.
+        /// \details Component world transform cache can be read without checks if it was validated during
+        ///          current revision and ::changed is not raised.
+        std::atomic<std::uint64_t> revision {0u};
+
+        /// \brief Whether any transform was changed since last propagation pass.
+        /// \details Initially raised, because caches were never propagated.
+        std::atomic_bool changed {true};
+
+        /// \brief Whether propagation should rebuild its hierarchy during next pass.
+        std::atomic_bool rebuildRequested {true};
+
+        /// \brief Guards world transform caches, because world transforms might be requested in parallel.
+        std::atomic_flag lock;
+    };
+
+    void *operator new (std::size_t /*unused*/) noexcept;
+
+    void operator delete (void *_pointer) noexcept;
+
+    /// \brief Informs that local transform of given cache was changed.
+    /// \details Flag is checked before write in order to avoid invalidating cache line on every transform change.
+    static void ReportChanged (Cache &_cache) noexcept;
+
+    /// \brief Informs that components were added, removed or moved inside hierarchy.
+    void ReportStructureChanged () noexcept;
+
+    Cache logical;
+    Cache visual;
+};
+
+/// \brief Stores world transform caching state for TransformComponent of given type.
+/// \details Getters and propagation access it only through fetch queries: all fields of the state are atomic.
+template <typename Transform>
+struct CelerityTransformModelApi TransformWorldCacheSingleton final
+{
+    Handling::Handle<TransformWorldCacheState> state {new TransformWorldCacheState};
+
+    struct CelerityTransformModelApi Reflection final
+    {
+        StandardLayout::Mapping mapping;
+    };
+
+    static const Reflection &Reflect () noexcept;
+};
+
+using Transform2dWorldCacheSingleton = TransformWorldCacheSingleton<Math::Transform2d>;
+using Transform3dWorldCacheSingleton = TransformWorldCacheSingleton<Math::Transform3d>;
+} // namespace Emergence::Celerity
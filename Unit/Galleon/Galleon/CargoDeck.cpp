@@ -23,7 +23,8 @@ CargoDeck::CargoDeck (Memory::UniqueString _name) noexcept
       singleton (Memory::Profiler::AllocationGroup {"Singleton"_us}),
       shortTerm (Memory::Profiler::AllocationGroup {"ShortTerm"_us}),
       longTerm (Memory::Profiler::AllocationGroup {"LongTerm"_us}),
-      garbageCollectionDisabled (Memory::Profiler::AllocationGroup {"GarbageCollectionDisabledSet"_us})
+      garbageCollectionDisabled (Memory::Profiler::AllocationGroup {"GarbageCollectionDisabledSet"_us}),
+      shortTermArenaEnabled (Memory::Profiler::AllocationGroup {"ShortTermArenaEnabledSet"_us})
 {
 }
 
@@ -78,7 +79,9 @@ Handling::Handle<ShortTermContainer> CargoDeck::AcquireShortTermContainer (const
     }
 
     auto placeholder = shortTerm.GetAllocationGroup ().PlaceOnTop ();
-    return &shortTerm.Acquire (this, _typeMapping);
+    ShortTermContainer &container = shortTerm.Acquire (this, _typeMapping);
+    container.SetArenaEnabled (shortTermArenaEnabled.contains (_typeMapping));
+    return &container;
 }
 
 Handling::Handle<LongTermContainer> CargoDeck::AcquireLongTermContainer (const StandardLayout::Mapping &_typeMapping)
@@ -200,6 +203,24 @@ void CargoDeck::SetGarbageCollectionEnabled (const StandardLayout::Mapping &_typ
     }
 }
 
+void CargoDeck::SetShortTermArenaEnabled (const StandardLayout::Mapping &_typeMapping, bool _enabled) noexcept
+{
+    if (_enabled)
+    {
+        shortTermArenaEnabled.emplace (_typeMapping);
+    }
+    else
+    {
+        shortTermArenaEnabled.erase (_typeMapping);
+    }
+
+    auto iterator = Container::FindIf (shortTerm.Begin (), shortTerm.End (), TypeMappingPredicate {_typeMapping});
+    if (iterator != shortTerm.End ())
+    {
+        (*iterator).SetArenaEnabled (_enabled);
+    }
+}
+
 Memory::UniqueString CargoDeck::GetName () const noexcept
 {
     return name;
@@ -46,6 +46,10 @@ public:
 
     void SetGarbageCollectionEnabled (const StandardLayout::Mapping &_typeMapping, bool _enabled) noexcept;
 
+    /// \brief Sets whether short term container for given type should allocate records from linear arena.
+    /// \see ShortTermContainer::SetArenaEnabled
+    void SetShortTermArenaEnabled (const StandardLayout::Mapping &_typeMapping, bool _enabled) noexcept;
+
     [[nodiscard]] Memory::UniqueString GetName () const noexcept;
 
     /// CargoDeck manages lots of storages with lots of objects, therefore it's not optimal to copy assign it.
@@ -79,5 +83,6 @@ private:
 
     bool garbageCollectionEnabled = true;
     Container::HashSet<StandardLayout::Mapping> garbageCollectionDisabled;
+    Container::HashSet<StandardLayout::Mapping> shortTermArenaEnabled;
 };
 } // namespace Emergence::Galleon
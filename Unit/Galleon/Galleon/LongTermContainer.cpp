@@ -10,16 +10,21 @@ void *LongTermContainer::InsertQuery::Cursor::operator++ () noexcept
     return allocator.Allocate ();
 }
 
-LongTermContainer::InsertQuery::Cursor::Cursor (Handling::Handle<LongTermContainer> _container) noexcept
+LongTermContainer::InsertQuery::Cursor::Cursor (Handling::Handle<LongTermContainer> _container, bool _bulk) noexcept
     : container (std::move (_container)),
-      allocator (container->collection.AllocateAndInsert ())
+      allocator (_bulk ? container->collection.AllocateAndInsertBulk () : container->collection.AllocateAndInsert ())
 {
     EMERGENCE_ASSERT (container);
 }
 
 LongTermContainer::InsertQuery::Cursor LongTermContainer::InsertQuery::Execute () const noexcept
 {
-    return Cursor (container);
+    return Cursor (container, false);
+}
+
+LongTermContainer::InsertQuery::Cursor LongTermContainer::InsertQuery::ExecuteBulk () const noexcept
+{
+    return Cursor (container, true);
 }
 
 Handling::Handle<LongTermContainer> LongTermContainer::InsertQuery::GetContainer () const noexcept
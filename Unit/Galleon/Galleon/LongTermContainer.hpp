@@ -44,7 +44,7 @@ public:
         private:
             friend class InsertQuery;
 
-            explicit Cursor (Handling::Handle<LongTermContainer> _container) noexcept;
+            explicit Cursor (Handling::Handle<LongTermContainer> _container, bool _bulk) noexcept;
 
             Handling::Handle<LongTermContainer> container;
             RecordCollection::Collection::Allocator allocator;
@@ -58,6 +58,9 @@ public:
 
         [[nodiscard]] Cursor Execute () const noexcept;
 
+        /// \brief Starts insertion transaction, that inserts all objects into collection at its end.
+        [[nodiscard]] Cursor ExecuteBulk () const noexcept;
+
         [[nodiscard]] Handling::Handle<LongTermContainer> GetContainer () const noexcept;
 
         /// Assigning prepared queries looks counter intuitive.
@@ -5,6 +5,9 @@
 
 namespace Emergence::Galleon
 {
+/// \brief Minimum count of records, that fit into the first arena page.
+static constexpr std::size_t ARENA_FIRST_PAGE_RECORDS = 64u;
+
 ShortTermContainer::InsertQuery::Cursor::~Cursor () noexcept
 {
     if (container)
@@ -16,7 +19,7 @@ ShortTermContainer::InsertQuery::Cursor::~Cursor () noexcept
 void *ShortTermContainer::InsertQuery::Cursor::operator++ () noexcept
 {
     EMERGENCE_ASSERT (container);
-    void *node = container->pool.Acquire ();
+    void *node = container->AcquireNode ();
     container->SetNextNode (node, container->firstNode);
     container->firstNode = node;
 
@@ -149,9 +152,9 @@ ShortTermContainer::ModifyQuery::Cursor &ShortTermContainer::ModifyQuery::Cursor
     EMERGENCE_ASSERT (container);
     EMERGENCE_ASSERT (currentNode);
 
-    void *next = container->GetNextNode (currentNode);
-    container->typeMapping.Destruct (ShortTermContainer::GetNodeContent (currentNode));
-    container->pool.Release (currentNode);
+    void *node = currentNode;
+    void *next = container->GetNextNode (node);
+    container->typeMapping.Destruct (ShortTermContainer::GetNodeContent (node));
     currentNode = next;
 
     if (previousNode)
@@ -163,6 +166,7 @@ ShortTermContainer::ModifyQuery::Cursor &ShortTermContainer::ModifyQuery::Cursor
         container->firstNode = next;
     }
 
+    container->ReleaseNode (node);
     return *this;
 }
 
@@ -217,6 +221,15 @@ void ShortTermContainer::SetUnsafeFetchAllowed (bool _allowed) noexcept
     accessCounter.SetUnsafeFetchAllowed (_allowed);
 }
 
+void ShortTermContainer::SetArenaEnabled (bool _enabled) noexcept
+{
+    arenaRequested = _enabled;
+    if (!firstNode)
+    {
+        arenaActive = arenaRequested;
+    }
+}
+
 void *ShortTermContainer::GetNodeContent (void *_node) noexcept
 {
     return _node;
@@ -231,7 +244,8 @@ ShortTermContainer::ShortTermContainer (CargoDeck *_deck, StandardLayout::Mappin
     : ContainerBase (_deck, std::move (_typeMapping)),
       pool (Memory::Profiler::AllocationGroup {Memory::UniqueString {typeMapping.GetName ()}},
             typeMapping.GetObjectSize () + sizeof (std::uintptr_t),
-            typeMapping.GetObjectAlignment ())
+            typeMapping.GetObjectAlignment ()),
+      arenaPages (pool.GetAllocationGroup ())
 {
     EMERGENCE_ASSERT (typeMapping.GetObjectSize () % sizeof (std::uintptr_t) == 0u);
 }
@@ -260,4 +274,59 @@ void ShortTermContainer::SetNextNode (void *_node, void *_next) noexcept
 {
     *reinterpret_cast<void **> (static_cast<std::uint8_t *> (_node) + typeMapping.GetObjectSize ()) = _next;
 }
+
+void *ShortTermContainer::AcquireNode () noexcept
+{
+    if (!firstNode)
+    {
+        // Container is empty, therefore it is safe to switch allocation mode.
+        arenaActive = arenaRequested;
+    }
+
+    if (!arenaActive)
+    {
+        return pool.Acquire ();
+    }
+
+    const std::size_t nodeSize = typeMapping.GetObjectSize () + sizeof (std::uintptr_t);
+    const std::size_t nodeAlignment = typeMapping.GetObjectAlignment ();
+
+    while (true)
+    {
+        if (arenaPageIndex == arenaPages.size ())
+        {
+            arenaPages.emplace_back (pool.GetAllocationGroup (),
+                                     (nodeSize + nodeAlignment) * (ARENA_FIRST_PAGE_RECORDS << arenaPageIndex));
+        }
+
+        Memory::Stack &page = arenaPages[arenaPageIndex];
+        // Alignment is added to the size, because page head might need to be aligned first.
+        if (page.GetFreeSize () >= nodeSize + nodeAlignment)
+        {
+            return page.Acquire (nodeSize, nodeAlignment);
+        }
+
+        ++arenaPageIndex;
+    }
+}
+
+void ShortTermContainer::ReleaseNode (void *_node) noexcept
+{
+    if (!arenaActive)
+    {
+        pool.Release (_node);
+        return;
+    }
+
+    if (!firstNode)
+    {
+        // The last record was deleted: reclaim memory of all records at once.
+        for (std::size_t pageIndex = 0u; pageIndex <= arenaPageIndex && pageIndex < arenaPages.size (); ++pageIndex)
+        {
+            arenaPages[pageIndex].Clear ();
+        }
+
+        arenaPageIndex = 0u;
+    }
+}
 } // namespace Emergence::Galleon
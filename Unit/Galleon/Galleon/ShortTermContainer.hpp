@@ -9,11 +9,16 @@
 #include <Galleon/AccessCounter.hpp>
 #include <Galleon/ContainerBase.hpp>
 
+#include <Memory/Stack.hpp>
 #include <Memory/UnorderedPool.hpp>
 
 namespace Emergence::Galleon
 {
 /// \brief Container for objects that are created and destroyed frequently.
+/// \details In arena mode records are allocated from linear arena pages instead of pool. Deleting record in this
+///          mode only destructs it, while memory of all records is reclaimed at once by resetting arena after
+///          the last record is deleted. It is designed for records like events, that are always deleted
+///          together at the end of their pipeline.
 class ShortTermContainer final : public ContainerBase
 {
 public:
@@ -160,6 +165,11 @@ public:
 
     void SetUnsafeFetchAllowed (bool _allowed) noexcept;
 
+    /// \brief Sets whether records should be allocated from linear arena.
+    /// \details Allocation mode can only be changed when container is empty, therefore if container has records,
+    ///          new mode will be applied on the first insertion after all records are deleted.
+    void SetArenaEnabled (bool _enabled) noexcept;
+
     EMERGENCE_DELETE_ASSIGNMENT (ShortTermContainer);
 
 private:
@@ -181,8 +191,27 @@ private:
 
     void SetNextNode (void *_node, void *_next) noexcept;
 
+    void *AcquireNode () noexcept;
+
+    /// \invariant Node is already unlinked from node list.
+    void ReleaseNode (void *_node) noexcept;
+
     Memory::UnorderedPool pool;
 
+    /// \brief Linear arena pages, from which nodes are allocated in arena mode.
+    /// \details Pages are never deallocated and are reused after reset, therefore after first few frames arena mode
+    ///          allocates nothing from heap. Every next page is twice bigger than previous one.
+    Container::Vector<Memory::Stack> arenaPages;
+
+    /// \brief Index of the page from which nodes are allocated right now.
+    std::size_t arenaPageIndex = 0u;
+
+    /// \brief Whether arena mode is requested through ::SetArenaEnabled.
+    bool arenaRequested = false;
+
+    /// \brief Whether existing nodes are allocated from arena.
+    bool arenaActive = false;
+
     void *firstNode = nullptr;
 
     AccessCounter accessCounter;
@@ -26,7 +26,7 @@ static void ImGUIProfiledFree (void *_pointer, void * /*unused*/)
     if (_pointer)
     {
         auto *memory = static_cast<std::uintptr_t *> (_pointer) - 1u;
-        GetImGUIHeap ().Release (memory, *memory);
+        GetImGUIHeap ().Release (memory, *memory + sizeof (std::uintptr_t));
     }
 }
 
@@ -3,8 +3,11 @@
 #include <JobDispatcherApi.hpp>
 
 #include <array>
-#include <functional>
+#include <cstddef>
+#include <cstring>
+#include <new>
 #include <thread>
+#include <type_traits>
 
 #include <API/Common/ImplementationBinding.hpp>
 #include <API/Common/Shortcuts.hpp>
@@ -34,7 +37,75 @@ class JobDispatcherApi Dispatcher final
 {
 public:
     /// \brief Type of a job, that can be executed by job dispatcher.
-    using Job = std::function<void ()>;
+    /// \details Job is a move-only type-erased callable that stores its functor inplace, therefore constructing,
+    ///          dispatching and executing jobs never allocates memory. Functors that are too big to be stored
+    ///          inplace are rejected at compile time: capture pointer to the shared state instead.
+    class Job final
+    {
+    public:
+        /// \brief Maximum size of a functor that can be stored inside job.
+        static constexpr std::size_t MAX_FUNCTOR_SIZE = sizeof (std::uintptr_t) * 6u;
+
+        /// \brief Maximum alignment of a functor that can be stored inside job.
+        static constexpr std::size_t MAX_FUNCTOR_ALIGNMENT = alignof (std::max_align_t);
+
+        /// \brief Constructs empty job.
+        Job () noexcept = default;
+
+        /// \brief Constructs empty job.
+        Job (std::nullptr_t) noexcept;
+
+        /// \brief Constructs job that calls given function with given context.
+        Job (void (*_function) (void *), void *_context) noexcept;
+
+        /// \brief Constructs job that moves given functor into its inplace storage.
+        template <typename Functor>
+        Job (Functor &&_functor) noexcept
+        requires (!std::is_same_v<std::decay_t<Functor>, Job> && std::is_invocable_v<std::decay_t<Functor> &>);
+
+        /// Jobs are move-only, because copying captures might be expensive or even impossible.
+        Job (const Job &_other) = delete;
+
+        Job (Job &&_other) noexcept;
+
+        ~Job () noexcept;
+
+        /// \brief Executes stored functor.
+        /// \invariant Job is not empty.
+        void operator() () noexcept;
+
+        /// \return Whether job contains functor.
+        explicit operator bool () const noexcept;
+
+        /// \brief Destroys stored functor, if any.
+        Job &operator= (std::nullptr_t) noexcept;
+
+        Job &operator= (const Job &_other) = delete;
+
+        Job &operator= (Job &&_other) noexcept;
+
+    private:
+        /// \brief Calls functor, stored in given storage.
+        using Invoker = void (*) (void *_storage);
+
+        /// \brief Moves functor from source storage to target storage, if target is not null,
+        ///        and destroys functor in source storage. Not needed for trivially copyable functors.
+        using Manager = void (*) (void *_target, void *_source);
+
+        struct FunctionWithContext final
+        {
+            void operator() () const noexcept;
+
+            void (*function) (void *);
+            void *context;
+        };
+
+        void Reset () noexcept;
+
+        Invoker invoker = nullptr;
+        Manager manager = nullptr;
+        alignas (MAX_FUNCTOR_ALIGNMENT) std::array<std::uint8_t, MAX_FUNCTOR_SIZE> storage;
+    };
 
     /// \brief Utility class for optimized dispatching multiple jobs at once.
     /// \details It is advised to use this class instead of calling dispatch multiple times if you have
@@ -92,4 +163,108 @@ public:
 private:
     EMERGENCE_BIND_IMPLEMENTATION_INPLACE (sizeof (std::uintptr_t) * 18u);
 };
+
+inline Dispatcher::Job::Job (std::nullptr_t) noexcept
+{
+}
+
+inline Dispatcher::Job::Job (void (*_function) (void *), void *_context) noexcept
+    : Job (FunctionWithContext {_function, _context})
+{
+}
+
+template <typename Functor>
+Dispatcher::Job::Job (Functor &&_functor) noexcept
+requires (!std::is_same_v<std::decay_t<Functor>, Job> && std::is_invocable_v<std::decay_t<Functor> &>)
+{
+    using Stored = std::decay_t<Functor>;
+    static_assert (sizeof (Stored) <= MAX_FUNCTOR_SIZE,
+                   "Job functor is too big to be stored inplace. Capture pointer to the shared state instead.");
+    static_assert (alignof (Stored) <= MAX_FUNCTOR_ALIGNMENT, "Job functor alignment is not supported.");
+
+    new (storage.data ()) Stored (std::forward<Functor> (_functor));
+    invoker = [] (void *_storage)
+    {
+        (*static_cast<Stored *> (_storage)) ();
+    };
+
+    if constexpr (!std::is_trivially_copyable_v<Stored> || !std::is_trivially_destructible_v<Stored>)
+    {
+        manager = [] (void *_target, void *_source)
+        {
+            auto *source = static_cast<Stored *> (_source);
+            if (_target)
+            {
+                new (_target) Stored (std::move (*source));
+            }
+
+            source->~Stored ();
+        };
+    }
+}
+
+inline Dispatcher::Job::Job (Job &&_other) noexcept
+    : invoker (_other.invoker),
+      manager (_other.manager)
+{
+    if (manager)
+    {
+        manager (storage.data (), _other.storage.data ());
+    }
+    else if (invoker)
+    {
+        std::memcpy (storage.data (), _other.storage.data (), MAX_FUNCTOR_SIZE);
+    }
+
+    _other.invoker = nullptr;
+    _other.manager = nullptr;
+}
+
+inline Dispatcher::Job::~Job () noexcept
+{
+    Reset ();
+}
+
+inline void Dispatcher::Job::operator() () noexcept
+{
+    invoker (storage.data ());
+}
+
+inline Dispatcher::Job::operator bool () const noexcept
+{
+    return invoker;
+}
+
+inline Dispatcher::Job &Dispatcher::Job::operator= (std::nullptr_t) noexcept
+{
+    Reset ();
+    return *this;
+}
+
+inline Dispatcher::Job &Dispatcher::Job::operator= (Job &&_other) noexcept
+{
+    if (this != &_other)
+    {
+        this->~Job ();
+        new (this) Job (std::move (_other));
+    }
+
+    return *this;
+}
+
+inline void Dispatcher::Job::FunctionWithContext::operator() () const noexcept
+{
+    function (context);
+}
+
+inline void Dispatcher::Job::Reset () noexcept
+{
+    if (manager)
+    {
+        manager (nullptr, storage.data ());
+    }
+
+    invoker = nullptr;
+    manager = nullptr;
+}
 } // namespace Emergence::Job
@@ -0,0 +1,595 @@
+#include <array>
+#include <atomic>
+
+#include <API/Common/BlockCast.hpp>
+
+#include <Container/Vector.hpp>
+
+#include <CPU/Profiler.hpp>
+
+#include <Job/Dispatcher.hpp>
+
+#include <Threading/AtomicFlagGuard.hpp>
+
+namespace Emergence::Job
+{
+using namespace Memory::Literals;
+
+/// \brief Alignment that is used to separate data modified by different threads into different cache lines.
+static constexpr std::size_t CACHE_LINE_SIZE = 64u;
+
+/// \brief Maximum count of jobs in worker local deque. Jobs that do not fit are sent to shared injection queue.
+static constexpr std::intptr_t WORKER_DEQUE_CAPACITY = 256;
+
+/// \brief Bounded Chase-Lev deque: owner thread pushes and pops jobs from the bottom, thieves steal from the top.
+/// \details Job slots are never reallocated. To make it possible to move non-trivial jobs out of the slots after
+///          claiming them, every slot has occupation flag: owner does not reuse slot until its previous job was
+///          moved out by the thread that claimed it, and treats deque as full instead.
+class WorkerDeque final
+{
+public:
+    WorkerDeque () noexcept = default;
+
+    WorkerDeque (const WorkerDeque &_other) = delete;
+
+    WorkerDeque (WorkerDeque &&_other) = delete;
+
+    ~WorkerDeque () noexcept = default;
+
+    /// \brief Pushes job to the bottom. Can only be called by the owner thread.
+    /// \return Whether job was pushed. If deque is full, job is left untouched.
+    bool Push (Dispatcher::Job &_job) noexcept;
+
+    /// \brief Pops job from the bottom. Can only be called by the owner thread.
+    bool Pop (Dispatcher::Job &_output) noexcept;
+
+    /// \brief Steals job from the top. Can be called from any thread.
+    bool Steal (Dispatcher::Job &_output) noexcept;
+
+    EMERGENCE_DELETE_ASSIGNMENT (WorkerDeque);
+
+private:
+    struct Slot final
+    {
+        std::atomic_bool occupied = false;
+        Dispatcher::Job job;
+    };
+
+    void Take (std::intptr_t _index, Dispatcher::Job &_output) noexcept;
+
+    alignas (CACHE_LINE_SIZE) std::atomic_intptr_t top = 0;
+    alignas (CACHE_LINE_SIZE) std::atomic_intptr_t bottom = 0;
+    alignas (CACHE_LINE_SIZE) std::array<Slot, WORKER_DEQUE_CAPACITY> slots;
+};
+
+bool WorkerDeque::Push (Dispatcher::Job &_job) noexcept
+{
+    const std::intptr_t currentBottom = bottom.load (std::memory_order_relaxed);
+    const std::intptr_t currentTop = top.load (std::memory_order_acquire);
+
+    if (currentBottom - currentTop >= WORKER_DEQUE_CAPACITY)
+    {
+        return false;
+    }
+
+    Slot &slot = slots[static_cast<std::size_t> (currentBottom % WORKER_DEQUE_CAPACITY)];
+    if (slot.occupied.load (std::memory_order_acquire))
+    {
+        // Previous job from this slot is still being moved out by thief.
+        return false;
+    }
+
+    slot.job = std::move (_job);
+    slot.occupied.store (true, std::memory_order_relaxed);
+    bottom.store (currentBottom + 1, std::memory_order_release);
+    return true;
+}
+
+bool WorkerDeque::Pop (Dispatcher::Job &_output) noexcept
+{
+    const std::intptr_t newBottom = bottom.load (std::memory_order_relaxed) - 1;
+    bottom.store (newBottom, std::memory_order_relaxed);
+    std::atomic_thread_fence (std::memory_order_seq_cst);
+    std::intptr_t currentTop = top.load (std::memory_order_relaxed);
+
+    if (currentTop > newBottom)
+    {
+        bottom.store (newBottom + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    if (currentTop == newBottom)
+    {
+        // Last job: we are racing with thieves for it.
+        const bool won = top.compare_exchange_strong (currentTop, currentTop + 1, std::memory_order_seq_cst,
+                                                      std::memory_order_relaxed);
+        bottom.store (newBottom + 1, std::memory_order_relaxed);
+
+        if (!won)
+        {
+            return false;
+        }
+    }
+
+    Take (newBottom, _output);
+    return true;
+}
+
+bool WorkerDeque::Steal (Dispatcher::Job &_output) noexcept
+{
+    std::intptr_t currentTop = top.load (std::memory_order_acquire);
+    std::atomic_thread_fence (std::memory_order_seq_cst);
+    const std::intptr_t currentBottom = bottom.load (std::memory_order_acquire);
+
+    if (currentTop >= currentBottom ||
+        !top.compare_exchange_strong (currentTop, currentTop + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed))
+    {
+        return false;
+    }
+
+    Take (currentTop, _output);
+    return true;
+}
+
+void WorkerDeque::Take (std::intptr_t _index, Dispatcher::Job &_output) noexcept
+{
+    Slot &slot = slots[static_cast<std::size_t> (_index % WORKER_DEQUE_CAPACITY)];
+    _output = std::move (slot.job);
+    slot.job = nullptr;
+    slot.occupied.store (false, std::memory_order_release);
+}
+
+/// \brief Worker thread state. Only deque top and ::busy flag are accessed by other threads.
+struct alignas (CACHE_LINE_SIZE) Worker final
+{
+    WorkerDeque deque;
+
+    /// \brief Whether worker is executing job right now.
+    /// \details Stored per worker instead of shared counter, so job execution does not touch shared cache lines.
+    alignas (CACHE_LINE_SIZE) std::atomic_bool busy = false;
+
+    /// \brief State of xorshift generator that selects first victim for stealing.
+    std::uint32_t stealSeed = 0u;
+};
+
+class DispatcherImplementation final
+{
+public:
+    class Batch final
+    {
+    public:
+        Batch (DispatcherImplementation *_owner) noexcept;
+
+        Batch (const Batch &_other) = delete;
+
+        Batch (Batch &&_other) = delete;
+
+        ~Batch () noexcept;
+
+        void Dispatch (Priority _jobPriority, Dispatcher::Job _job) noexcept;
+
+        EMERGENCE_DELETE_ASSIGNMENT (Batch);
+
+    private:
+        DispatcherImplementation *owner;
+        std::size_t jobsDispatched = 0u;
+    };
+
+    DispatcherImplementation (Memory::Heap &_heap, std::size_t _threadCount) noexcept;
+
+    DispatcherImplementation (const DispatcherImplementation &_other) = delete;
+
+    DispatcherImplementation (DispatcherImplementation &&_other) = delete;
+
+    ~DispatcherImplementation () noexcept;
+
+    void Dispatch (Priority _jobPriority, Dispatcher::Job _job) noexcept;
+
+    [[nodiscard]] std::size_t GetAvailableThreadsCount () const noexcept;
+
+    void SetMaximumThreadsForBackgroundExecution (std::size_t _maxBackgroundThreadCount) noexcept;
+
+    EMERGENCE_DELETE_ASSIGNMENT (DispatcherImplementation);
+
+private:
+    friend class Batch;
+
+    void WorkerFunction (std::size_t _workerIndex) noexcept;
+
+    /// \brief Places job into appropriate queue without waking up sleeping workers.
+    void DispatchInternal (Priority _jobPriority, Dispatcher::Job _job) noexcept;
+
+    /// \brief Wakes up sleeping workers, if there are any, to process newly dispatched jobs.
+    void WakeUp (std::size_t _jobsDispatched) noexcept;
+
+    bool FindJob (std::size_t _workerIndex, Dispatcher::Job &_output, bool &_wasBackground) noexcept;
+
+    bool PopBackground (Dispatcher::Job &_output) noexcept;
+
+    bool PopInjected (Dispatcher::Job &_output) noexcept;
+
+    bool StealForeground (std::size_t _thiefIndex, Dispatcher::Job &_output) noexcept;
+
+    Memory::Heap &heap;
+    Worker *workers = nullptr;
+    std::size_t workerCount = 0u;
+
+    Container::Vector<std::jthread> threads {Memory::Profiler::AllocationGroup {"JobDispatcher"_us}};
+
+    /// \brief Receives foreground jobs from non-worker threads and from workers with full deques.
+    alignas (CACHE_LINE_SIZE) std::atomic_flag modifyingInjectionQueue;
+    std::atomic_uintptr_t injectionQueueSize = 0u;
+    Container::Vector<Dispatcher::Job> injectionQueue {Memory::Profiler::AllocationGroup {"JobDispatcher"_us}};
+
+    /// \brief Background jobs are rare and heavy, therefore they are never stolen and live in shared queue.
+    alignas (CACHE_LINE_SIZE) std::atomic_flag modifyingBackgroundQueue;
+    std::atomic_uintptr_t backgroundQueueSize = 0u;
+    Container::Vector<Dispatcher::Job> backgroundQueue {Memory::Profiler::AllocationGroup {"JobDispatcher"_us}};
+
+    alignas (CACHE_LINE_SIZE) std::atomic_uintptr_t backgroundThreadCount = 0u;
+    std::atomic_uintptr_t maxBackgroundThreadCount;
+
+    alignas (CACHE_LINE_SIZE) std::atomic_uintptr_t sleepingThreadCount = 0u;
+    std::atomic_uint32_t wakeUpEpoch = 0u;
+    std::atomic_flag terminating;
+};
+
+/// \brief Dispatcher, for which current thread is a worker, if any.
+static thread_local DispatcherImplementation *currentDispatcher = nullptr;
+
+/// \brief Worker, that is associated with current thread, if any.
+static thread_local Worker *currentWorker = nullptr;
+
+DispatcherImplementation::Batch::Batch (DispatcherImplementation *_owner) noexcept
+    : owner (_owner)
+{
+}
+
+DispatcherImplementation::Batch::~Batch () noexcept
+{
+    owner->WakeUp (jobsDispatched);
+}
+
+void DispatcherImplementation::Batch::Dispatch (Priority _jobPriority, Dispatcher::Job _job) noexcept
+{
+    owner->DispatchInternal (_jobPriority, std::move (_job));
+    ++jobsDispatched;
+}
+
+DispatcherImplementation::DispatcherImplementation (Memory::Heap &_heap, std::size_t _threadCount) noexcept
+    : heap (_heap),
+      workerCount (_threadCount),
+      maxBackgroundThreadCount (_threadCount / 2u)
+{
+    injectionQueue.reserve (32u);
+    backgroundQueue.reserve (32u);
+
+    workers = static_cast<Worker *> (heap.Acquire (sizeof (Worker) * workerCount, alignof (Worker)));
+    for (std::size_t workerIndex = 0u; workerIndex < workerCount; ++workerIndex)
+    {
+        new (&workers[workerIndex]) Worker ();
+        // Any non-zero seed is fine for xorshift, we just want different workers to start from different victims.
+        workers[workerIndex].stealSeed = static_cast<std::uint32_t> (workerIndex * 2654435761u) | 1u;
+    }
+
+    threads.reserve (workerCount);
+    for (std::size_t workerIndex = 0u; workerIndex < workerCount; ++workerIndex)
+    {
+        threads.emplace_back (
+            [this, workerIndex] ()
+            {
+                WorkerFunction (workerIndex);
+            });
+    }
+}
+
+DispatcherImplementation::~DispatcherImplementation () noexcept
+{
+    terminating.test_and_set (std::memory_order_seq_cst);
+    wakeUpEpoch.fetch_add (1u, std::memory_order_seq_cst);
+    wakeUpEpoch.notify_all ();
+
+    for (std::jthread &thread : threads)
+    {
+        thread.join ();
+    }
+
+    for (std::size_t workerIndex = 0u; workerIndex < workerCount; ++workerIndex)
+    {
+        workers[workerIndex].~Worker ();
+    }
+
+    heap.Release (workers, sizeof (Worker) * workerCount);
+}
+
+void DispatcherImplementation::Dispatch (Priority _jobPriority, Dispatcher::Job _job) noexcept
+{
+    static CPU::Profiler::SectionDefinition dispatchSection {*"JobDispatcherDispatch"_us, 0xFF990000u};
+    CPU::Profiler::SectionInstance section {dispatchSection};
+
+    DispatchInternal (_jobPriority, std::move (_job));
+    WakeUp (1u);
+}
+
+std::size_t DispatcherImplementation::GetAvailableThreadsCount () const noexcept
+{
+    std::size_t available = 0u;
+    for (std::size_t workerIndex = 0u; workerIndex < workerCount; ++workerIndex)
+    {
+        if (!workers[workerIndex].busy.load (std::memory_order_relaxed))
+        {
+            ++available;
+        }
+    }
+
+    return available;
+}
+
+void DispatcherImplementation::SetMaximumThreadsForBackgroundExecution (std::size_t _maxBackgroundThreadCount) noexcept
+{
+    maxBackgroundThreadCount.store (_maxBackgroundThreadCount, std::memory_order_relaxed);
+}
+
+void DispatcherImplementation::WorkerFunction (std::size_t _workerIndex) noexcept
+{
+    static const Memory::UniqueString threadName {"JobDispatcherThread"};
+    static CPU::Profiler::SectionDefinition foregroundJobSection {*"ForegroundJob"_us, 0xFF999900u};
+    static CPU::Profiler::SectionDefinition backgroundJobSection {*"BackgroundJob"_us, 0xFF999900u};
+
+    CPU::Profiler::SetThreadName (*threadName);
+    Worker &worker = workers[_workerIndex];
+    currentDispatcher = this;
+    currentWorker = &worker;
+
+    Dispatcher::Job job;
+    bool wasBackground;
+
+    while (!terminating.test (std::memory_order_acquire))
+    {
+        if (!FindJob (_workerIndex, job, wasBackground))
+        {
+            // Register as sleeping before final check, so dispatchers that pushed
+            // job after our check are guaranteed to see us and send wake up signal.
+            const std::uint32_t epoch = wakeUpEpoch.load (std::memory_order_seq_cst);
+            sleepingThreadCount.fetch_add (1u, std::memory_order_seq_cst);
+
+            if (terminating.test (std::memory_order_seq_cst))
+            {
+                sleepingThreadCount.fetch_sub (1u, std::memory_order_relaxed);
+                break;
+            }
+
+            if (!FindJob (_workerIndex, job, wasBackground))
+            {
+                wakeUpEpoch.wait (epoch, std::memory_order_acquire);
+                sleepingThreadCount.fetch_sub (1u, std::memory_order_relaxed);
+                continue;
+            }
+
+            sleepingThreadCount.fetch_sub (1u, std::memory_order_relaxed);
+        }
+
+        worker.busy.store (true, std::memory_order_relaxed);
+        {
+            CPU::Profiler::SectionInstance section {wasBackground ? backgroundJobSection : foregroundJobSection};
+            job ();
+        }
+
+        job = nullptr;
+        worker.busy.store (false, std::memory_order_relaxed);
+
+        if (wasBackground)
+        {
+            backgroundThreadCount.fetch_sub (1u, std::memory_order_release);
+        }
+    }
+
+    currentDispatcher = nullptr;
+    currentWorker = nullptr;
+}
+
+void DispatcherImplementation::DispatchInternal (Priority _jobPriority, Dispatcher::Job _job) noexcept
+{
+    switch (_jobPriority)
+    {
+    case Priority::FOREGROUND:
+    {
+        // Workers push into their own deques, so nested dispatch from tasks does not touch shared state.
+        if (currentDispatcher == this && currentWorker->deque.Push (_job))
+        {
+            return;
+        }
+
+        AtomicFlagGuard guard {modifyingInjectionQueue};
+        injectionQueue.emplace_back (std::move (_job));
+        injectionQueueSize.store (injectionQueue.size (), std::memory_order_relaxed);
+        break;
+    }
+
+    case Priority::BACKGROUND:
+    {
+        AtomicFlagGuard guard {modifyingBackgroundQueue};
+        backgroundQueue.emplace_back (std::move (_job));
+        backgroundQueueSize.store (backgroundQueue.size (), std::memory_order_relaxed);
+        break;
+    }
+    }
+}
+
+void DispatcherImplementation::WakeUp (std::size_t _jobsDispatched) noexcept
+{
+    if (_jobsDispatched == 0u)
+    {
+        return;
+    }
+
+    // Pairs with sleeping registration in worker function: either worker sees new job
+    // during its final check or we see that worker is going to sleep.
+    std::atomic_thread_fence (std::memory_order_seq_cst);
+    if (sleepingThreadCount.load (std::memory_order_relaxed) > 0u)
+    {
+        wakeUpEpoch.fetch_add (1u, std::memory_order_seq_cst);
+        if (_jobsDispatched > 1u)
+        {
+            wakeUpEpoch.notify_all ();
+        }
+        else
+        {
+            wakeUpEpoch.notify_one ();
+        }
+    }
+}
+
+bool DispatcherImplementation::FindJob (std::size_t _workerIndex,
+                                        Dispatcher::Job &_output,
+                                        bool &_wasBackground) noexcept
+{
+    // Background jobs are scheduled first unless background thread limit is reached, like in original dispatcher.
+    if (PopBackground (_output))
+    {
+        _wasBackground = true;
+        return true;
+    }
+
+    _wasBackground = false;
+    return workers[_workerIndex].deque.Pop (_output) || PopInjected (_output) ||
+           StealForeground (_workerIndex, _output);
+}
+
+bool DispatcherImplementation::PopBackground (Dispatcher::Job &_output) noexcept
+{
+    if (backgroundQueueSize.load (std::memory_order_relaxed) == 0u)
+    {
+        return false;
+    }
+
+    std::uintptr_t threadsBusy = backgroundThreadCount.load (std::memory_order_relaxed);
+    do
+    {
+        if (threadsBusy >= maxBackgroundThreadCount.load (std::memory_order_relaxed))
+        {
+            return false;
+        }
+    } while (!backgroundThreadCount.compare_exchange_weak (threadsBusy, threadsBusy + 1u, std::memory_order_acquire,
+                                                           std::memory_order_relaxed));
+
+    AtomicFlagGuard guard {modifyingBackgroundQueue};
+    if (backgroundQueue.empty ())
+    {
+        backgroundThreadCount.fetch_sub (1u, std::memory_order_release);
+        return false;
+    }
+
+    _output = std::move (backgroundQueue.back ());
+    backgroundQueue.pop_back ();
+    backgroundQueueSize.store (backgroundQueue.size (), std::memory_order_relaxed);
+    return true;
+}
+
+bool DispatcherImplementation::PopInjected (Dispatcher::Job &_output) noexcept
+{
+    if (injectionQueueSize.load (std::memory_order_relaxed) == 0u)
+    {
+        return false;
+    }
+
+    AtomicFlagGuard guard {modifyingInjectionQueue};
+    if (injectionQueue.empty ())
+    {
+        return false;
+    }
+
+    _output = std::move (injectionQueue.back ());
+    injectionQueue.pop_back ();
+    injectionQueueSize.store (injectionQueue.size (), std::memory_order_relaxed);
+    return true;
+}
+
+bool DispatcherImplementation::StealForeground (std::size_t _thiefIndex, Dispatcher::Job &_output) noexcept
+{
+    if (workerCount < 2u)
+    {
+        return false;
+    }
+
+    static CPU::Profiler::SectionDefinition stealSection {*"JobDispatcherSteal"_us, 0xFF990000u};
+    CPU::Profiler::SectionInstance section {stealSection};
+
+    std::uint32_t &seed = workers[_thiefIndex].stealSeed;
+    seed ^= seed << 13u;
+    seed ^= seed >> 17u;
+    seed ^= seed << 5u;
+    const std::size_t firstVictim = seed % workerCount;
+
+    for (std::size_t offset = 0u; offset < workerCount; ++offset)
+    {
+        const std::size_t victimIndex = (firstVictim + offset) % workerCount;
+        if (victimIndex != _thiefIndex && workers[victimIndex].deque.Steal (_output))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+struct InternalData final
+{
+    Memory::Heap heap {Memory::Profiler::AllocationGroup {"JobDispatcher"_us}};
+    DispatcherImplementation *dispatcher = nullptr;
+};
+
+Dispatcher::Batch::Batch (Dispatcher &_dispatcher) noexcept
+{
+    new (&data) DispatcherImplementation::Batch (block_cast<InternalData> (_dispatcher.data).dispatcher);
+}
+
+Dispatcher::Batch::~Batch () noexcept
+{
+    block_cast<DispatcherImplementation::Batch> (data).~Batch ();
+}
+
+void Dispatcher::Batch::Dispatch (Priority _jobPriority, Dispatcher::Job _job) noexcept
+{
+    block_cast<DispatcherImplementation::Batch> (data).Dispatch (_jobPriority, std::move (_job));
+}
+
+Dispatcher &Dispatcher::Global () noexcept
+{
+    static Dispatcher globalDispatcher {std::thread::hardware_concurrency ()};
+    return globalDispatcher;
+}
+
+Dispatcher::Dispatcher (std::size_t _threadCount) noexcept
+{
+    auto &internal = *new (&data) InternalData ();
+    auto placeholder = internal.heap.GetAllocationGroup ().PlaceOnTop ();
+    internal.dispatcher =
+        new (internal.heap.Acquire (sizeof (DispatcherImplementation), alignof (DispatcherImplementation)))
+            DispatcherImplementation (internal.heap, _threadCount);
+}
+
+Dispatcher::~Dispatcher () noexcept
+{
+    auto &internal = block_cast<InternalData> (data);
+    internal.dispatcher->~DispatcherImplementation ();
+    internal.heap.Release (internal.dispatcher, sizeof (DispatcherImplementation));
+    internal.~InternalData ();
+}
+
+void Dispatcher::Dispatch (Priority _jobPriority, Dispatcher::Job _job) noexcept
+{
+    block_cast<InternalData> (data).dispatcher->Dispatch (_jobPriority, std::move (_job));
+}
+
+std::size_t Dispatcher::GetAvailableThreadsCount () const noexcept
+{
+    return block_cast<InternalData> (data).dispatcher->GetAvailableThreadsCount ();
+}
+
+void Dispatcher::SetMaximumThreadsForBackgroundExecution (std::size_t _maxBackgroundThreadCount) noexcept
+{
+    block_cast<InternalData> (data).dispatcher->SetMaximumThreadsForBackgroundExecution (_maxBackgroundThreadCount);
+}
+} // namespace Emergence::Job
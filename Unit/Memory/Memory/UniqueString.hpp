@@ -41,6 +41,11 @@ public:
     ///         but can not be stored in files or shared between processes.
     [[nodiscard]] std::uintptr_t Hash () const noexcept;
 
+    /// \return Hash of string content, that is computed once when string is registered.
+    /// \details Unlike ::Hash, it is the same for equal strings in every process and on every platform, therefore
+    ///          it can be stored in files. It is not guaranteed to be unique. Empty string has zero hash.
+    [[nodiscard]] std::uint64_t StableHash () const noexcept;
+
     [[nodiscard]] bool operator== (const UniqueString &_other) const noexcept;
 
     [[nodiscard]] bool operator!= (const UniqueString &_other) const noexcept;
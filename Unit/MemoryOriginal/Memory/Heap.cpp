@@ -1,7 +1,7 @@
 #include <API/Common/BlockCast.hpp>
 
 #include <Memory/Heap.hpp>
-#include <Memory/Original/AlignedAllocation.hpp>
+#include <Memory/Original/CachedAllocation.hpp>
 
 namespace Emergence::Memory
 {
@@ -25,7 +25,7 @@ void *Heap::Acquire (std::size_t _bytes, std::size_t _alignment) noexcept
     auto &registry = block_cast<Profiler::AllocationGroup> (data);
     registry.Allocate (_bytes);
     registry.Acquire (_bytes);
-    return Original::AlignedAllocate (_alignment, _bytes);
+    return Original::CachedAllocate (_alignment, _bytes);
 }
 
 void *Heap::Resize (void *_record, std::size_t _alignment, std::size_t _currentSize, std::size_t _newSize) noexcept
@@ -35,7 +35,7 @@ void *Heap::Resize (void *_record, std::size_t _alignment, std::size_t _currentS
     registry.Acquire (_newSize);
     registry.Release (_currentSize);
     registry.Free (_currentSize);
-    return Original::AlignedReallocate (_record, _alignment, _currentSize, _newSize);
+    return Original::CachedReallocate (_record, _alignment, _currentSize, _newSize);
 }
 
 void Heap::Release (void *_record, std::size_t _bytes) noexcept
@@ -43,7 +43,7 @@ void Heap::Release (void *_record, std::size_t _bytes) noexcept
     auto &registry = block_cast<Profiler::AllocationGroup> (data);
     registry.Release (_bytes);
     registry.Free (_bytes);
-    Original::AlignedFree (_record);
+    Original::CachedFree (_record, _bytes);
 }
 
 const Profiler::AllocationGroup &Heap::GetAllocationGroup () const noexcept
@@ -0,0 +1,325 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+
+#include <API/Common/Shortcuts.hpp>
+
+#include <Assert/Assert.hpp>
+
+#include <Memory/Original/AlignedAllocation.hpp>
+#include <Memory/Original/CachedAllocation.hpp>
+
+#include <Threading/AtomicFlagGuard.hpp>
+
+namespace Emergence::Memory::Original
+{
+/// \brief Sizes of records, that are allocated through thread caches.
+/// \details Every size is multiple of 16, therefore records of every class are at least 16-byte aligned.
+static constexpr std::array<std::size_t, 20u> SIZE_CLASSES {16u,  32u,  48u,  64u,  80u,  96u,  112u,
+                                                            128u, 160u, 192u, 224u, 256u, 320u, 384u,
+                                                            448u, 512u, 640u, 768u, 896u, 1024u};
+
+static_assert (SIZE_CLASSES.back () == MAX_CACHED_ALLOCATION_SIZE);
+
+static constexpr std::size_t SIZE_CLASS_STEP = 16u;
+
+/// \brief Spans are aligned by their size, therefore span header can be found from any record pointer.
+static constexpr std::size_t SPAN_SIZE = 64u * 1024u;
+
+/// \brief Count of records, that are moved between thread cache and central arena at once.
+static constexpr std::size_t BATCH_SIZE = 32u;
+
+/// \brief Thread cache returns batch to central arena when it has more free records of one class than this.
+static constexpr std::size_t MAX_CACHED_RECORDS = BATCH_SIZE * 2u;
+
+/// \brief Maps `(_bytes + SIZE_CLASS_STEP - 1) / SIZE_CLASS_STEP` to smallest suitable size class.
+static constexpr std::array<std::uint8_t, MAX_CACHED_ALLOCATION_SIZE / SIZE_CLASS_STEP + 1u> SIZE_CLASS_LOOKUP =
+    [] ()
+{
+    std::array<std::uint8_t, MAX_CACHED_ALLOCATION_SIZE / SIZE_CLASS_STEP + 1u> lookup {};
+    std::size_t classIndex = 0u;
+
+    for (std::size_t step = 0u; step < lookup.size (); ++step)
+    {
+        while (SIZE_CLASSES[classIndex] < step * SIZE_CLASS_STEP)
+        {
+            ++classIndex;
+        }
+
+        lookup[step] = static_cast<std::uint8_t> (classIndex);
+    }
+
+    return lookup;
+}();
+
+/// \return Biggest power of two, that divides given size class.
+static constexpr std::size_t GetClassAlignment (std::size_t _classSize) noexcept
+{
+    return _classSize & (~_classSize + 1u);
+}
+
+struct SpanHeader final
+{
+    std::size_t classIndex = 0u;
+};
+
+struct FreeRecord final
+{
+    FreeRecord *next = nullptr;
+};
+
+/// \brief Shared source of records of one size class. Protected by spinlock, because it is only accessed in batches.
+struct ClassArena final
+{
+    std::atomic_flag lock;
+
+    FreeRecord *freeList = nullptr;
+
+    /// \brief Next record in current span, that was never allocated before.
+    std::uint8_t *spanCursor = nullptr;
+
+    std::uint8_t *spanEnd = nullptr;
+};
+
+// Arenas are constant-initialized and trivially destructible, therefore they can be safely
+// used during both static initialization and static destruction.
+static std::array<ClassArena, SIZE_CLASSES.size ()> arenas {};
+
+/// \brief Takes up to `_count` records from central arena, allocates new span if there is not enough records.
+/// \return Chain of exactly `_count` records.
+static FreeRecord *AcquireBatch (std::size_t _classIndex, std::size_t _count) noexcept
+{
+    ClassArena &arena = arenas[_classIndex];
+    AtomicFlagGuard guard {arena.lock};
+
+    FreeRecord *result = nullptr;
+    std::size_t acquired = 0u;
+
+    while (acquired < _count && arena.freeList)
+    {
+        FreeRecord *record = arena.freeList;
+        arena.freeList = record->next;
+        record->next = result;
+        result = record;
+        ++acquired;
+    }
+
+    const std::size_t classSize = SIZE_CLASSES[_classIndex];
+    while (acquired < _count)
+    {
+        if (arena.spanCursor == arena.spanEnd)
+        {
+            auto *span = static_cast<std::uint8_t *> (AlignedAllocate (SPAN_SIZE, SPAN_SIZE));
+            new (span) SpanHeader {_classIndex};
+
+            // Class alignment is at least 16, therefore records never overlap with span header.
+            static_assert (sizeof (SpanHeader) <= SIZE_CLASS_STEP);
+            const std::size_t firstRecordOffset = GetClassAlignment (classSize);
+            arena.spanCursor = span + firstRecordOffset;
+            arena.spanEnd = arena.spanCursor + (SPAN_SIZE - firstRecordOffset) / classSize * classSize;
+        }
+
+        auto *record = reinterpret_cast<FreeRecord *> (arena.spanCursor);
+        arena.spanCursor += classSize;
+        record->next = result;
+        result = record;
+        ++acquired;
+    }
+
+    return result;
+}
+
+/// \brief Returns chain of records from `_first` to `_last` inclusively to central arena.
+static void ReleaseBatch (std::size_t _classIndex, FreeRecord *_first, FreeRecord *_last) noexcept
+{
+    ClassArena &arena = arenas[_classIndex];
+    AtomicFlagGuard guard {arena.lock};
+    _last->next = arena.freeList;
+    arena.freeList = _first;
+}
+
+/// \brief Per-thread free lists of all size classes.
+class ThreadCache final
+{
+public:
+    /// \return Cache of the current thread or `nullptr` if thread is being destroyed.
+    static ThreadCache *Get () noexcept
+    {
+        // Thread local objects with trivial destructors are still accessible during thread local destruction,
+        // therefore we use this flag to detect that cache is already destroyed.
+        static thread_local bool cacheDestroyed = false;
+        if (cacheDestroyed)
+        {
+            return nullptr;
+        }
+
+        static thread_local ThreadCache cache {cacheDestroyed};
+        return &cache;
+    }
+
+    ThreadCache (const ThreadCache &_other) = delete;
+
+    ThreadCache (ThreadCache &&_other) = delete;
+
+    ~ThreadCache () noexcept
+    {
+        for (std::size_t classIndex = 0u; classIndex < SIZE_CLASSES.size (); ++classIndex)
+        {
+            if (FreeRecord *first = freeLists[classIndex])
+            {
+                FreeRecord *last = first;
+                while (last->next)
+                {
+                    last = last->next;
+                }
+
+                ReleaseBatch (classIndex, first, last);
+            }
+        }
+
+        destroyedFlag = true;
+    }
+
+    void *Acquire (std::size_t _classIndex) noexcept
+    {
+        if (!freeLists[_classIndex])
+        {
+            freeLists[_classIndex] = AcquireBatch (_classIndex, BATCH_SIZE);
+            freeCounts[_classIndex] = BATCH_SIZE;
+        }
+
+        FreeRecord *record = freeLists[_classIndex];
+        freeLists[_classIndex] = record->next;
+        --freeCounts[_classIndex];
+        return record;
+    }
+
+    void Release (std::size_t _classIndex, void *_record) noexcept
+    {
+        auto *record = static_cast<FreeRecord *> (_record);
+        record->next = freeLists[_classIndex];
+        freeLists[_classIndex] = record;
+
+        if (++freeCounts[_classIndex] > MAX_CACHED_RECORDS)
+        {
+            // Return the oldest records, because the newest ones are more likely to be in CPU cache.
+            FreeRecord *keptLast = freeLists[_classIndex];
+            for (std::size_t index = 1u; index < freeCounts[_classIndex] - BATCH_SIZE; ++index)
+            {
+                keptLast = keptLast->next;
+            }
+
+            FreeRecord *returnedFirst = keptLast->next;
+            FreeRecord *returnedLast = returnedFirst;
+
+            while (returnedLast->next)
+            {
+                returnedLast = returnedLast->next;
+            }
+
+            keptLast->next = nullptr;
+            freeCounts[_classIndex] -= BATCH_SIZE;
+            ReleaseBatch (_classIndex, returnedFirst, returnedLast);
+        }
+    }
+
+    EMERGENCE_DELETE_ASSIGNMENT (ThreadCache);
+
+private:
+    explicit ThreadCache (bool &_destroyedFlag) noexcept
+        : destroyedFlag (_destroyedFlag)
+    {
+    }
+
+    std::array<FreeRecord *, SIZE_CLASSES.size ()> freeLists {};
+    std::array<std::size_t, SIZE_CLASSES.size ()> freeCounts {};
+    bool &destroyedFlag;
+};
+
+static std::size_t GetClassIndex (std::size_t _alignment, std::size_t _amount) noexcept
+{
+    EMERGENCE_ASSERT (_amount <= MAX_CACHED_ALLOCATION_SIZE);
+    EMERGENCE_ASSERT (_alignment <= MAX_CACHED_ALLOCATION_SIZE);
+    std::size_t classIndex = SIZE_CLASS_LOOKUP[(_amount + SIZE_CLASS_STEP - 1u) / SIZE_CLASS_STEP];
+
+    while (SIZE_CLASSES[classIndex] % _alignment != 0u)
+    {
+        ++classIndex;
+    }
+
+    return classIndex;
+}
+
+static std::size_t GetRecordClassIndex (void *_record) noexcept
+{
+    return reinterpret_cast<SpanHeader *> (reinterpret_cast<std::uintptr_t> (_record) & ~(SPAN_SIZE - 1u))
+        ->classIndex;
+}
+
+void *CachedAllocate (std::size_t _alignment, std::size_t _amount) noexcept
+{
+    if (_amount > MAX_CACHED_ALLOCATION_SIZE)
+    {
+        return AlignedAllocate (_alignment, _amount);
+    }
+
+    const std::size_t classIndex = GetClassIndex (_alignment, _amount);
+    if (ThreadCache *cache = ThreadCache::Get ())
+    {
+        return cache->Acquire (classIndex);
+    }
+
+    return AcquireBatch (classIndex, 1u);
+}
+
+void *CachedReallocate (void *_block, std::size_t _alignment, std::size_t _oldSize, std::size_t _newSize) noexcept
+{
+    if (!_block)
+    {
+        return CachedAllocate (_alignment, _newSize);
+    }
+
+    if (_oldSize > MAX_CACHED_ALLOCATION_SIZE && _newSize > MAX_CACHED_ALLOCATION_SIZE)
+    {
+        return AlignedReallocate (_block, _alignment, _oldSize, _newSize);
+    }
+
+    if (_oldSize <= MAX_CACHED_ALLOCATION_SIZE && _newSize <= MAX_CACHED_ALLOCATION_SIZE &&
+        GetRecordClassIndex (_block) == GetClassIndex (_alignment, _newSize))
+    {
+        return _block;
+    }
+
+    void *newBlock = CachedAllocate (_alignment, _newSize);
+    memcpy (newBlock, _block, std::min (_oldSize, _newSize));
+    CachedFree (_block, _oldSize);
+    return newBlock;
+}
+
+void CachedFree (void *_block, std::size_t _amount) noexcept
+{
+    if (!_block)
+    {
+        return;
+    }
+
+    if (_amount > MAX_CACHED_ALLOCATION_SIZE)
+    {
+        AlignedFree (_block);
+        return;
+    }
+
+    const std::size_t classIndex = GetRecordClassIndex (_block);
+    // Catches callers that release records with size that is bigger than the allocated one.
+    EMERGENCE_ASSERT (_amount <= SIZE_CLASSES[classIndex]);
+
+    if (ThreadCache *cache = ThreadCache::Get ())
+    {
+        cache->Release (classIndex, _block);
+        return;
+    }
+
+    ReleaseBatch (classIndex, static_cast<FreeRecord *> (_block), static_cast<FreeRecord *> (_block));
+}
+} // namespace Emergence::Memory::Original
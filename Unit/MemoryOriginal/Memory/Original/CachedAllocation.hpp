@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+
+namespace Emergence::Memory::Original
+{
+/// \brief Records up to this size are allocated from size classes through thread caches,
+///        bigger records are allocated through AlignedAllocate.
+constexpr std::size_t MAX_CACHED_ALLOCATION_SIZE = 1024u;
+
+/// \brief Allocates memory block from thread local cache of appropriate size class.
+/// \details Records of the same size class are carved from big aligned spans. Every thread has its own free list
+///          for every size class and exchanges records with shared arena in batches, therefore most of the
+///          allocations and deallocations do not need any synchronization. Spans are never returned to the system.
+/// \invariant _alignment must be less or equal to MAX_CACHED_ALLOCATION_SIZE.
+void *CachedAllocate (std::size_t _alignment, std::size_t _amount) noexcept;
+
+/// \brief Resizes block, allocated by CachedAllocate, and copies its content if needed.
+/// \param _oldSize Amount of memory, that was requested during allocation or previous resize.
+/// \warning Deallocation path is selected using `_oldSize`, therefore passing any other size corrupts the heap.
+void *CachedReallocate (void *_block, std::size_t _alignment, std::size_t _oldSize, std::size_t _newSize) noexcept;
+
+/// \brief Frees block, allocated by CachedAllocate.
+/// \param _amount Amount of memory, that was requested during allocation or last resize.
+/// \warning Deallocation path is selected using `_amount`, therefore passing any other size corrupts the heap.
+void CachedFree (void *_block, std::size_t _amount) noexcept;
+} // namespace Emergence::Memory::Original
@@ -1,11 +1,12 @@
 #define _CRT_SECURE_NO_WARNINGS
 
 #include <atomic>
+#include <cstddef>
+#include <cstring>
 
 #include <Assert/Assert.hpp>
 
-#include <Container/HashSet.hpp>
-
+#include <Memory/Original/AlignedAllocation.hpp>
 #include <Memory/Original/UniqueString.hpp>
 #include <Memory/Stack.hpp>
 #include <Memory/UnorderedPool.hpp>
@@ -14,75 +15,224 @@
 
 namespace Emergence::Memory::Original
 {
-static const char MEMORY_PROFILING_GROUP_ID[] = "UniqueString";
+/// \brief Metadata, that is stored right before characters of every registered string.
+struct StringHeader final
+{
+    std::uint64_t hash = 0u;
+    std::uint64_t length = 0u;
+};
 
-static const char *RegisterValue (const std::string_view &_value)
+/// \brief FNV-1a with final avalanche from MurmurHash3, so every bit of the result depends on every character.
+static constexpr std::uint64_t ComputeStableHash (const std::string_view &_value) noexcept
 {
-    if (_value.empty ())
+    std::uint64_t hash = 14695981039346656037u;
+    for (const char character : _value)
     {
-        return nullptr;
+        hash ^= static_cast<std::uint8_t> (character);
+        hash *= 1099511628211u;
     }
 
-    // We can not just compare pointers because of several reasons:
-    // - Optimizer is not guaranteed to merge constants.
-    // - Constant with the same value might be loaded from other source,
-    //   for example memory profiler recording file or from dynamic linking library.
-    if (_value == MEMORY_PROFILING_GROUP_ID)
+    hash ^= hash >> 33u;
+    hash *= 0xff51afd7ed558ccdu;
+    hash ^= hash >> 33u;
+    hash *= 0xc4ceb9fe1a85ec53u;
+    hash ^= hash >> 33u;
+    return hash;
+}
+
+static const StringHeader &GetHeader (const char *_value) noexcept
+{
+    return *(reinterpret_cast<const StringHeader *> (_value) - 1u);
+}
+
+/// \brief Storage for profiling group id, that has the same layout as registered strings.
+struct StaticString final
+{
+    StringHeader header;
+    char value[sizeof ("UniqueString")];
+};
+
+static_assert (offsetof (StaticString, value) == sizeof (StringHeader));
+
+static constexpr StaticString MEMORY_PROFILING_GROUP_ID {
+    {ComputeStableHash ("UniqueString"), sizeof ("UniqueString") - 1u}, "UniqueString"};
+
+/// \brief Open addressing table with linear probing, that stores pointers to registered strings.
+/// \details Slots are only changed from empty to filled, therefore readers can probe table without locking.
+///          When table is full, new bigger table is published instead. Old tables are never deallocated,
+///          because readers might still probe them.
+struct StringTable final
+{
+    static constexpr std::size_t INITIAL_CAPACITY = 4096u;
+
+    static std::size_t CalculateSize (std::size_t _capacity) noexcept
     {
-        return MEMORY_PROFILING_GROUP_ID;
+        return sizeof (StringTable) + sizeof (std::atomic<const char *>) * _capacity;
     }
 
-    // We need to make sure that register is not accessed from multiple threads
+    std::atomic<const char *> *GetSlots () noexcept
+    {
+        return reinterpret_cast<std::atomic<const char *> *> (this + 1u);
+    }
+
+    /// \return Registered string with given value or `nullptr` if it is not found.
+    const char *Find (const std::string_view &_value, std::uint64_t _hash) noexcept
+    {
+        std::atomic<const char *> *slots = GetSlots ();
+        for (std::size_t index = _hash & (capacity - 1u);; index = (index + 1u) & (capacity - 1u))
+        {
+            const char *candidate = slots[index].load (std::memory_order_acquire);
+            if (!candidate)
+            {
+                return nullptr;
+            }
+
+            const StringHeader &header = GetHeader (candidate);
+            if (header.hash == _hash && header.length == _value.size () &&
+                memcmp (candidate, _value.data (), _value.size ()) == 0)
+            {
+                return candidate;
+            }
+        }
+    }
+
+    /// \invariant Called under registration lock and table has free slots.
+    void Insert (const char *_registered) noexcept
+    {
+        std::atomic<const char *> *slots = GetSlots ();
+        std::size_t index = GetHeader (_registered).hash & (capacity - 1u);
+
+        while (slots[index].load (std::memory_order_relaxed))
+        {
+            index = (index + 1u) & (capacity - 1u);
+        }
+
+        slots[index].store (_registered, std::memory_order_release);
+        ++count;
+    }
+
+    /// \invariant Always power of two.
+    std::size_t capacity = 0u;
+
+    /// \brief Count of filled slots, only accessed under registration lock.
+    std::size_t count = 0u;
+};
+
+/// \brief Table, that is used by readers. Constant initialized, therefore it is safe to access it at any moment.
+static std::atomic<StringTable *> currentTable {nullptr};
+
+/// \brief Registers given string under registration lock. Second lookup under lock is needed, because other thread
+///        might have registered the same string or published new table after our lock-free lookup.
+static const char *RegisterValueLocked (const std::string_view &_value, std::uint64_t _hash)
+{
+    // We need to make sure that register is not modified from multiple threads
     // simultaneously because it could result in race condition.
     static std::atomic_flag registrationLock;
     AtomicFlagGuard guard {registrationLock};
 
-    // Code is moved into separate block to make sure that static constructors,
-    // related to memory allocation, will not be called if condition above returned.
+    StringTable *table = currentTable.load (std::memory_order_relaxed);
+    if (table)
     {
-        // In most cases 3-4 or even 1 stack would be enough, but we would like to
-        // avoid creating additional pages, therefore we use this page capacity.
-        constexpr const std::size_t STACK_POOL_PAGE_CAPACITY = 16u;
+        if (const char *found = table->Find (_value, _hash))
+        {
+            return found;
+        }
+    }
+
+    // In most cases 3-4 or even 1 stack would be enough, but we would like to
+    // avoid creating additional pages, therefore we use this page capacity.
+    constexpr const std::size_t STACK_POOL_PAGE_CAPACITY = 16u;
 
-        constexpr const std::size_t STRING_STACK_SIZE = 1u << 20u; // 1 MB.
+    constexpr const std::size_t STRING_STACK_SIZE = 1u << 20u; // 1 MB.
 
-        static Profiler::AllocationGroup allocationGroup {Profiler::AllocationGroup::Root (),
-                                                          Memory::UniqueString {MEMORY_PROFILING_GROUP_ID}};
+    static Profiler::AllocationGroup allocationGroup {Profiler::AllocationGroup::Root (),
+                                                      Memory::UniqueString {MEMORY_PROFILING_GROUP_ID.value}};
 
-        // For flexibility, we dynamically allocate new string stacks instead of using one big stack.
-        static UnorderedPool stacksPool {allocationGroup, sizeof (Stack), alignof (Stack), STACK_POOL_PAGE_CAPACITY};
+    // For flexibility, we dynamically allocate new string stacks instead of using one big stack.
+    static UnorderedPool stacksPool {allocationGroup, sizeof (Stack), alignof (Stack), STACK_POOL_PAGE_CAPACITY};
 
-        // Usually, unique strings are quite small (<100 characters), therefore it's ok to use
-        // only last allocated stack instead of trying to insert into all allocated stacks.
-        static auto *lastStack = new (stacksPool.Acquire ()) Stack (allocationGroup, STRING_STACK_SIZE);
+    // Usually, unique strings are quite small (<100 characters), therefore it's ok to use
+    // only last allocated stack instead of trying to insert into all allocated stacks.
+    static auto *lastStack = new (stacksPool.Acquire ()) Stack (allocationGroup, STRING_STACK_SIZE);
 
-        // Right now we use hash set for simplicity.
-        static Container::HashSet<std::string_view> stringRegister {allocationGroup};
+    // Table is filled by at most a half, so probe sequences stay short.
+    if (!table || (table->count + 1u) * 2u > table->capacity)
+    {
+        const std::size_t newCapacity = table ? table->capacity * 2u : StringTable::INITIAL_CAPACITY;
+        const std::size_t newSize = StringTable::CalculateSize (newCapacity);
+        allocationGroup.Allocate (newSize);
+        allocationGroup.Acquire (newSize);
 
-        auto iterator = stringRegister.find (_value);
-        if (iterator == stringRegister.end ())
+        auto *newTable = new (AlignedAllocate (alignof (StringTable), newSize)) StringTable {};
+        newTable->capacity = newCapacity;
+        std::atomic<const char *> *newSlots = newTable->GetSlots ();
+
+        for (std::size_t index = 0u; index < newCapacity; ++index)
         {
-            EMERGENCE_ASSERT (_value.size () + 1u < STRING_STACK_SIZE);
-            if (lastStack->GetFreeSize () < _value.size () + 1u)
-            {
-                // Current stack is full, we need a new one.
-                lastStack = new (stacksPool.Acquire ()) Stack (allocationGroup, STRING_STACK_SIZE);
-            }
+            new (&newSlots[index]) std::atomic<const char *> {nullptr};
+        }
 
-            char *space = static_cast<char *> (lastStack->Acquire (_value.size () + 1u, 1u));
-            for (std::size_t index = 0u; index < _value.size (); ++index)
+        if (table)
+        {
+            std::atomic<const char *> *oldSlots = table->GetSlots ();
+            for (std::size_t index = 0u; index < table->capacity; ++index)
             {
-                space[index] = _value[index];
+                if (const char *registered = oldSlots[index].load (std::memory_order_relaxed))
+                {
+                    newTable->Insert (registered);
+                }
             }
-
-            space[_value.size ()] = '\0';
-            auto [insertionIterator, result] = stringRegister.emplace (space);
-            EMERGENCE_ASSERT (result);
-            return insertionIterator->data ();
         }
 
-        return iterator->data ();
+        table = newTable;
+        currentTable.store (table, std::memory_order_release);
+    }
+
+    const std::size_t requiredSize = sizeof (StringHeader) + _value.size () + 1u;
+    EMERGENCE_ASSERT (requiredSize + alignof (StringHeader) < STRING_STACK_SIZE);
+
+    if (lastStack->GetFreeSize () < requiredSize + alignof (StringHeader))
+    {
+        // Current stack is full, we need a new one.
+        lastStack = new (stacksPool.Acquire ()) Stack (allocationGroup, STRING_STACK_SIZE);
+    }
+
+    auto *header = new (lastStack->Acquire (requiredSize, alignof (StringHeader))) StringHeader {_hash, _value.size ()};
+    auto *space = reinterpret_cast<char *> (header + 1u);
+    memcpy (space, _value.data (), _value.size ());
+    space[_value.size ()] = '\0';
+
+    table->Insert (space);
+    return space;
+}
+
+static const char *RegisterValue (const std::string_view &_value)
+{
+    if (_value.empty ())
+    {
+        return nullptr;
     }
+
+    // We can not just compare pointers because of several reasons:
+    // - Optimizer is not guaranteed to merge constants.
+    // - Constant with the same value might be loaded from other source,
+    //   for example memory profiler recording file or from dynamic linking library.
+    if (_value == MEMORY_PROFILING_GROUP_ID.value)
+    {
+        return MEMORY_PROFILING_GROUP_ID.value;
+    }
+
+    const std::uint64_t hash = ComputeStableHash (_value);
+    if (StringTable *table = currentTable.load (std::memory_order_acquire))
+    {
+        // Most of the strings are already registered, therefore they are found without locking.
+        if (const char *found = table->Find (_value, hash))
+        {
+            return found;
+        }
+    }
+
+    return RegisterValueLocked (_value, hash);
 }
 
 UniqueString::UniqueString (const char *_string) noexcept
@@ -105,6 +255,11 @@ uintptr_t UniqueString::Hash () const noexcept
     return reinterpret_cast<std::uintptr_t> (value);
 }
 
+std::uint64_t UniqueString::StableHash () const noexcept
+{
+    return value ? GetHeader (value).hash : 0u;
+}
+
 bool UniqueString::operator== (const UniqueString &_other) const
 {
     return value == _other.value;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string_view>
 #include <type_traits>
 
@@ -18,6 +19,8 @@ public:
 
     [[nodiscard]] std::uintptr_t Hash () const noexcept;
 
+    [[nodiscard]] std::uint64_t StableHash () const noexcept;
+
     bool operator== (const UniqueString &_other) const;
 
     bool operator!= (const UniqueString &_other) const;
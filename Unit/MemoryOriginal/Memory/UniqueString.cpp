@@ -30,6 +30,11 @@ uintptr_t UniqueString::Hash () const noexcept
     return block_cast<Original::UniqueString> (data).Hash ();
 }
 
+std::uint64_t UniqueString::StableHash () const noexcept
+{
+    return block_cast<Original::UniqueString> (data).StableHash ();
+}
+
 bool UniqueString::operator== (const UniqueString &_other) const noexcept
 {
     return block_cast<Original::UniqueString> (data) == block_cast<Original::UniqueString> (_other.data);
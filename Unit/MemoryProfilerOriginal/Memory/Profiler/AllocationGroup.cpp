@@ -6,6 +6,7 @@
 #include <Memory/Profiler/AllocationGroup.hpp>
 #include <Memory/Profiler/Original/AllocationGroup.hpp>
 #include <Memory/Profiler/Original/ProfilingLock.hpp>
+#include <Memory/Profiler/Original/ThreadBuffer.hpp>
 
 namespace Emergence::Memory::Profiler
 {
@@ -77,8 +78,8 @@ void AllocationGroup::Allocate (std::size_t _bytesCount) noexcept
 {
     if (handle)
     {
-        Original::ProfilingLock lock;
-        static_cast<Original::AllocationGroup *> (handle)->Allocate (_bytesCount, lock);
+        Original::ThreadBuffer::Record (EventType::ALLOCATE, static_cast<Original::AllocationGroup *> (handle),
+                                        _bytesCount);
     }
 }
 
@@ -86,8 +87,8 @@ void AllocationGroup::Acquire (std::size_t _bytesCount) noexcept
 {
     if (handle)
     {
-        Original::ProfilingLock lock;
-        static_cast<Original::AllocationGroup *> (handle)->Acquire (_bytesCount, lock);
+        Original::ThreadBuffer::Record (EventType::ACQUIRE, static_cast<Original::AllocationGroup *> (handle),
+                                        _bytesCount);
     }
 }
 
@@ -95,8 +96,8 @@ void AllocationGroup::Release (std::size_t _bytesCount) noexcept
 {
     if (handle)
     {
-        Original::ProfilingLock lock;
-        static_cast<Original::AllocationGroup *> (handle)->Release (_bytesCount, lock);
+        Original::ThreadBuffer::Record (EventType::RELEASE, static_cast<Original::AllocationGroup *> (handle),
+                                        _bytesCount);
     }
 }
 
@@ -104,8 +105,8 @@ void AllocationGroup::Free (std::size_t _bytesCount) noexcept
 {
     if (handle)
     {
-        Original::ProfilingLock lock;
-        static_cast<Original::AllocationGroup *> (handle)->Free (_bytesCount, lock);
+        Original::ThreadBuffer::Record (EventType::FREE, static_cast<Original::AllocationGroup *> (handle),
+                                        _bytesCount);
     }
 }
 
@@ -143,6 +144,9 @@ std::size_t AllocationGroup::GetAcquired () const noexcept
 {
     if (handle)
     {
+        // Operations of all threads need to be applied to get actual value.
+        Original::ProfilingLock lock;
+        Original::ThreadBuffer::FlushAll (lock);
         return static_cast<Original::AllocationGroup *> (handle)->GetAcquired ();
     }
 
@@ -153,6 +157,9 @@ std::size_t AllocationGroup::GetReserved () const noexcept
 {
     if (handle)
     {
+        // Operations of all threads need to be applied to get actual value.
+        Original::ProfilingLock lock;
+        Original::ThreadBuffer::FlushAll (lock);
         return static_cast<Original::AllocationGroup *> (handle)->GetReserved ();
     }
 
@@ -163,6 +170,9 @@ std::size_t AllocationGroup::GetTotal () const noexcept
 {
     if (handle)
     {
+        // Operations of all threads need to be applied to get actual value.
+        Original::ProfilingLock lock;
+        Original::ThreadBuffer::FlushAll (lock);
         return static_cast<Original::AllocationGroup *> (handle)->GetTotal ();
     }
 
@@ -7,6 +7,7 @@
 #include <Memory/Profiler/ImplementationUtils.hpp>
 #include <Memory/Profiler/Original/Capture.hpp>
 #include <Memory/Profiler/Original/ProfilingLock.hpp>
+#include <Memory/Profiler/Original/ThreadBuffer.hpp>
 
 #include <Time/Time.hpp>
 
@@ -14,8 +15,7 @@ namespace Emergence::Memory::Profiler
 {
 void AddMarker (UniqueString _markerId, const AllocationGroup &_group) noexcept
 {
-    Original::ProfilingLock lock;
-    Original::EventManager::Get ().Marker (_group, _markerId, lock);
+    Original::ThreadBuffer::Record (EventType::MARKER, ImplementationUtils::ToOriginalFormat (_group), 0u, _markerId);
 }
 
 using Iterator = CapturedAllocationGroup::Iterator;
@@ -123,6 +123,7 @@ EventObserver::~EventObserver () noexcept
 const Event *EventObserver::NextEvent () noexcept
 {
     Original::ProfilingLock lock;
+    Original::ThreadBuffer::FlushAll (lock);
     return block_cast<Original::EventObserver> (data).NextEvent (lock);
 }
 
@@ -134,8 +135,12 @@ EventObserver::EventObserver (std::array<std::uint8_t, DATA_MAX_SIZE> &_data) no
 std::pair<CapturedAllocationGroup, EventObserver> Capture::Start () noexcept
 {
     Original::ProfilingLock lock;
+    // Operations, that were recorded before capture, must be included into captured state, not into events.
+    Original::ThreadBuffer::FlushAll (lock);
+
     // Capture is done in one transaction, therefore reported capture time is equal for all groups.
     const std::uint64_t sharedCaptureTime = Time::NanosecondsSinceStartup ();
+    Original::EventManager::Get ().ReportCaptureTime (sharedCaptureTime, lock);
 
     auto *capturedRoot =
         new Original::CapturedAllocationGroup {*Original::AllocationGroup::Root (), lock, sharedCaptureTime};
@@ -6,4 +6,9 @@ Profiler::AllocationGroup ImplementationUtils::ToServiceFormat (Original::Alloca
 {
     return Profiler::AllocationGroup {_group};
 }
+
+Original::AllocationGroup *ImplementationUtils::ToOriginalFormat (const Profiler::AllocationGroup &_group) noexcept
+{
+    return static_cast<Original::AllocationGroup *> (_group.handle);
+}
 } // namespace Emergence::Memory::Profiler
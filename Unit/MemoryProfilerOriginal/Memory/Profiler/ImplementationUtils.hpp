@@ -11,5 +11,7 @@ public:
     ImplementationUtils () = default;
 
     static Profiler::AllocationGroup ToServiceFormat (Original::AllocationGroup *_group) noexcept;
+
+    static Original::AllocationGroup *ToOriginalFormat (const Profiler::AllocationGroup &_group) noexcept;
 };
 } // namespace Emergence::Memory::Profiler
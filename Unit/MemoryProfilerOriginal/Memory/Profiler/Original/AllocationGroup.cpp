@@ -97,28 +97,28 @@ AllocationGroup *AllocationGroup::Request (AllocationGroup *_parent,
     return newGroup;
 }
 
-void AllocationGroup::Allocate (std::size_t _bytesCount, const ProfilingLock &_lock) noexcept
+void AllocationGroup::Allocate (std::size_t _bytesCount, std::uint64_t _timeNs, const ProfilingLock &_lock) noexcept
 {
     AllocateInternal (_bytesCount);
-    EventManager::Get ().Allocate (ImplementationUtils::ToServiceFormat (this), _bytesCount, _lock);
+    EventManager::Get ().Allocate (ImplementationUtils::ToServiceFormat (this), _bytesCount, _timeNs, _lock);
 }
 
-void AllocationGroup::Acquire (std::size_t _bytesCount, const ProfilingLock &_lock) noexcept
+void AllocationGroup::Acquire (std::size_t _bytesCount, std::uint64_t _timeNs, const ProfilingLock &_lock) noexcept
 {
     AcquireInternal (_bytesCount);
-    EventManager::Get ().Acquire (ImplementationUtils::ToServiceFormat (this), _bytesCount, _lock);
+    EventManager::Get ().Acquire (ImplementationUtils::ToServiceFormat (this), _bytesCount, _timeNs, _lock);
 }
 
-void AllocationGroup::Release (std::size_t _bytesCount, const ProfilingLock &_lock) noexcept
+void AllocationGroup::Release (std::size_t _bytesCount, std::uint64_t _timeNs, const ProfilingLock &_lock) noexcept
 {
     ReleaseInternal (_bytesCount);
-    EventManager::Get ().Release (ImplementationUtils::ToServiceFormat (this), _bytesCount, _lock);
+    EventManager::Get ().Release (ImplementationUtils::ToServiceFormat (this), _bytesCount, _timeNs, _lock);
 }
 
-void AllocationGroup::Free (std::size_t _bytesCount, const ProfilingLock &_lock) noexcept
+void AllocationGroup::Free (std::size_t _bytesCount, std::uint64_t _timeNs, const ProfilingLock &_lock) noexcept
 {
     FreeInternal (_bytesCount);
-    EventManager::Get ().Free (ImplementationUtils::ToServiceFormat (this), _bytesCount, _lock);
+    EventManager::Get ().Free (ImplementationUtils::ToServiceFormat (this), _bytesCount, _timeNs, _lock);
 }
 
 AllocationGroup *AllocationGroup::Parent () const noexcept
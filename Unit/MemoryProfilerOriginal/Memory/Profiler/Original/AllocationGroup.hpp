@@ -36,13 +36,13 @@ public:
                                      UniqueString _id,
                                      const ProfilingLock & /*unused*/) noexcept;
 
-    void Allocate (std::size_t _bytesCount, const ProfilingLock &_lock) noexcept;
+    void Allocate (std::size_t _bytesCount, std::uint64_t _timeNs, const ProfilingLock &_lock) noexcept;
 
-    void Acquire (std::size_t _bytesCount, const ProfilingLock &_lock) noexcept;
+    void Acquire (std::size_t _bytesCount, std::uint64_t _timeNs, const ProfilingLock &_lock) noexcept;
 
-    void Release (std::size_t _bytesCount, const ProfilingLock &_lock) noexcept;
+    void Release (std::size_t _bytesCount, std::uint64_t _timeNs, const ProfilingLock &_lock) noexcept;
 
-    void Free (std::size_t _bytesCount, const ProfilingLock &_lock) noexcept;
+    void Free (std::size_t _bytesCount, std::uint64_t _timeNs, const ProfilingLock &_lock) noexcept;
 
     [[nodiscard]] AllocationGroup *Parent () const noexcept;
 
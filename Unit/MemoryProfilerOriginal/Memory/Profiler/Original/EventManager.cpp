@@ -1,9 +1,9 @@
+#include <algorithm>
+
 #include <Assert/Assert.hpp>
 
 #include <Memory/Profiler/Original/EventManager.hpp>
 
-#include <Time/Time.hpp>
-
 namespace Emergence::Memory::Profiler::Original
 {
 EventNode::EventNode (Event _event) noexcept
@@ -19,6 +19,7 @@ EventManager &EventManager::Get () noexcept
 
 void EventManager::Allocate (const Profiler::AllocationGroup &_group,
                              std::size_t _bytes,
+                             std::uint64_t _timeNs,
                              const ProfilingLock & /*unused*/) noexcept
 {
     if (observers > 0u)
@@ -26,7 +27,7 @@ void EventManager::Allocate (const Profiler::AllocationGroup &_group,
         RegisterNode (new (events.Acquire ()) EventNode {Event {
             .type = EventType::ALLOCATE,
             .group = _group,
-            .timeNs = Time::NanosecondsSinceStartup (),
+            .timeNs = AdjustTime (_timeNs),
             .bytes = _bytes,
         }});
     }
@@ -34,6 +35,7 @@ void EventManager::Allocate (const Profiler::AllocationGroup &_group,
 
 void EventManager::Acquire (const Profiler::AllocationGroup &_group,
                             std::size_t _bytes,
+                            std::uint64_t _timeNs,
                             const ProfilingLock & /*unused*/) noexcept
 {
     if (observers > 0u)
@@ -41,7 +43,7 @@ void EventManager::Acquire (const Profiler::AllocationGroup &_group,
         RegisterNode (new (events.Acquire ()) EventNode {Event {
             .type = EventType::ACQUIRE,
             .group = _group,
-            .timeNs = Time::NanosecondsSinceStartup (),
+            .timeNs = AdjustTime (_timeNs),
             .bytes = _bytes,
         }});
     }
@@ -49,6 +51,7 @@ void EventManager::Acquire (const Profiler::AllocationGroup &_group,
 
 void EventManager::Release (const Profiler::AllocationGroup &_group,
                             std::size_t _bytes,
+                            std::uint64_t _timeNs,
                             const ProfilingLock & /*unused*/) noexcept
 {
     if (observers > 0u)
@@ -56,7 +59,7 @@ void EventManager::Release (const Profiler::AllocationGroup &_group,
         RegisterNode (new (events.Acquire ()) EventNode {Event {
             .type = EventType::RELEASE,
             .group = _group,
-            .timeNs = Time::NanosecondsSinceStartup (),
+            .timeNs = AdjustTime (_timeNs),
             .bytes = _bytes,
         }});
     }
@@ -64,6 +67,7 @@ void EventManager::Release (const Profiler::AllocationGroup &_group,
 
 void EventManager::Free (const Profiler::AllocationGroup &_group,
                          std::size_t _bytes,
+                         std::uint64_t _timeNs,
                          const ProfilingLock & /*unused*/) noexcept
 {
     if (observers > 0u)
@@ -71,7 +75,7 @@ void EventManager::Free (const Profiler::AllocationGroup &_group,
         RegisterNode (new (events.Acquire ()) EventNode {Event {
             .type = EventType::FREE,
             .group = _group,
-            .timeNs = Time::NanosecondsSinceStartup (),
+            .timeNs = AdjustTime (_timeNs),
             .bytes = _bytes,
         }});
     }
@@ -79,6 +83,7 @@ void EventManager::Free (const Profiler::AllocationGroup &_group,
 
 void EventManager::Marker (const Profiler::AllocationGroup &_group,
                            UniqueString _markerId,
+                           std::uint64_t _timeNs,
                            const ProfilingLock & /*unused*/) noexcept
 {
     if (observers > 0u)
@@ -86,12 +91,22 @@ void EventManager::Marker (const Profiler::AllocationGroup &_group,
         RegisterNode (new (events.Acquire ()) EventNode {Event {
             .type = EventType::MARKER,
             .group = _group,
-            .timeNs = Time::NanosecondsSinceStartup (),
+            .timeNs = AdjustTime (_timeNs),
             .markerId = _markerId,
         }});
     }
 }
 
+bool EventManager::HasObservers () const noexcept
+{
+    return observers.load (std::memory_order_relaxed) > 0u;
+}
+
+void EventManager::ReportCaptureTime (std::uint64_t _timeNs, const ProfilingLock & /*unused*/) noexcept
+{
+    lastTimeNs = std::max (lastTimeNs, _timeNs);
+}
+
 const EventNode *EventManager::StartObservation (const ProfilingLock & /*unused*/) noexcept
 {
     ++observers;
@@ -168,6 +183,12 @@ void EventManager::RegisterNode (EventNode *_node) noexcept
     }
 }
 
+std::uint64_t EventManager::AdjustTime (std::uint64_t _timeNs) noexcept
+{
+    lastTimeNs = std::max (lastTimeNs, _timeNs);
+    return lastTimeNs;
+}
+
 void EventManager::DropOutdatedEvents () noexcept
 {
     if (freshObservers > 0u)
@@ -33,22 +33,36 @@ public:
 
     void Allocate (const Profiler::AllocationGroup &_group,
                    std::size_t _bytes,
+                   std::uint64_t _timeNs,
                    const ProfilingLock & /*unused*/) noexcept;
 
     void Acquire (const Profiler::AllocationGroup &_group,
                   std::size_t _bytes,
+                  std::uint64_t _timeNs,
                   const ProfilingLock & /*unused*/) noexcept;
 
     void Release (const Profiler::AllocationGroup &_group,
                   std::size_t _bytes,
+                  std::uint64_t _timeNs,
                   const ProfilingLock & /*unused*/) noexcept;
 
-    void Free (const Profiler::AllocationGroup &_group, std::size_t _bytes, const ProfilingLock & /*unused*/) noexcept;
+    void Free (const Profiler::AllocationGroup &_group,
+               std::size_t _bytes,
+               std::uint64_t _timeNs,
+               const ProfilingLock & /*unused*/) noexcept;
 
     void Marker (const Profiler::AllocationGroup &_group,
                  UniqueString _markerId,
+                 std::uint64_t _timeNs,
                  const ProfilingLock & /*unused*/) noexcept;
 
+    /// \brief Whether there are observers, that need time of the events.
+    /// \details Can be called without lock, because it is only used as a hint for recording threads.
+    [[nodiscard]] bool HasObservers () const noexcept;
+
+    /// \brief Informs manager about new capture, so events, that are registered after it, do not precede it in time.
+    void ReportCaptureTime (std::uint64_t _timeNs, const ProfilingLock & /*unused*/) noexcept;
+
     /// \return Node, that should be used as parameter for ::RequestNext during first next event request by user.
     const EventNode *StartObservation (const ProfilingLock & /*unused*/) noexcept;
 
@@ -66,6 +80,11 @@ private:
 
     void RegisterNode (EventNode *_node) noexcept;
 
+    /// \brief Events are recorded by different threads and applied later, therefore we need to make sure that
+    ///        their time never decreases. Events, recorded without observers, have zero time and receive time
+    ///        of the previous event.
+    std::uint64_t AdjustTime (std::uint64_t _timeNs) noexcept;
+
     void DropOutdatedEvents () noexcept;
 
     // We use stub allocation group, otherwise program will be stuck in recursive
@@ -76,9 +95,13 @@ private:
     EventNode *last = nullptr;
 
     /// \brief Number of active observers. If there is no observers, event creation will be skipped.
-    std::size_t observers = 0u;
+    /// \details Modified only under lock, but read without it.
+    std::atomic_size_t observers = 0u;
 
     /// \brief Number of freshly constructed observers, that have requested their first event yet.
     std::size_t freshObservers = 0u;
+
+    /// \brief Time of the last registered event or capture.
+    std::uint64_t lastTimeNs = 0u;
 };
 } // namespace Emergence::Memory::Profiler::Original
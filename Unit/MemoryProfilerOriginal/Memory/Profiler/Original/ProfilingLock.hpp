@@ -6,7 +6,8 @@
 
 namespace Emergence::Memory::Profiler::Original
 {
-/// \brief Currently memory profiling logic operates under one spinlock.
+/// \brief Protects allocation group hierarchy and event list.
+/// \details Memory operations are recorded without this lock, see ThreadBuffer.
 class ProfilingLock final
 {
 private:
@@ -0,0 +1,226 @@
+#include <thread>
+
+#include <Assert/Assert.hpp>
+
+#include <Memory/Profiler/ImplementationUtils.hpp>
+#include <Memory/Profiler/Original/EventManager.hpp>
+#include <Memory/Profiler/Original/ThreadBuffer.hpp>
+#include <Memory/UnorderedPool.hpp>
+
+#include <Time/Time.hpp>
+
+namespace Emergence::Memory::Profiler::Original
+{
+/// \brief Shared state of all thread buffers. Everything except ::nextSequenceIndex is protected by ProfilingLock.
+struct ThreadBufferRegistry final
+{
+    static ThreadBufferRegistry &Get () noexcept
+    {
+        static ThreadBufferRegistry registry;
+        return registry;
+    }
+
+    /// \brief Source of sequence indices for all recorded operations.
+    std::atomic_uint64_t nextSequenceIndex {0u};
+
+    /// \brief Sequence index of the next operation, that should be applied.
+    std::uint64_t nextAppliedIndex = 0u;
+
+    ThreadBuffer *first = nullptr;
+
+    // There is no sense to profile memory usage of profiling classes, therefore we use stub-group.
+    UnorderedPool buffers {Profiler::AllocationGroup {}, sizeof (ThreadBuffer), alignof (ThreadBuffer), 1u};
+};
+
+static void Apply (const PendingOperation &_operation, const ProfilingLock &_lock) noexcept
+{
+    switch (_operation.type)
+    {
+    case EventType::ALLOCATE:
+        _operation.group->Allocate (_operation.bytes, _operation.timeNs, _lock);
+        break;
+
+    case EventType::ACQUIRE:
+        _operation.group->Acquire (_operation.bytes, _operation.timeNs, _lock);
+        break;
+
+    case EventType::RELEASE:
+        _operation.group->Release (_operation.bytes, _operation.timeNs, _lock);
+        break;
+
+    case EventType::FREE:
+        _operation.group->Free (_operation.bytes, _operation.timeNs, _lock);
+        break;
+
+    case EventType::MARKER:
+        EventManager::Get ().Marker (ImplementationUtils::ToServiceFormat (_operation.group), _operation.markerId,
+                                     _operation.timeNs, _lock);
+        break;
+    }
+}
+
+/// \brief Creates buffer for current thread on first use and flushes and frees it when thread exits.
+class ThreadBufferOwner final
+{
+public:
+    /// \return Buffer of the current thread or `nullptr` if thread is being destroyed.
+    static ThreadBuffer *Get () noexcept
+    {
+        // Thread local objects with trivial destructors are still accessible during thread local destruction,
+        // therefore we use this flag to detect that buffer owner is already destroyed.
+        static thread_local bool ownerDestroyed = false;
+        if (ownerDestroyed)
+        {
+            return nullptr;
+        }
+
+        static thread_local ThreadBufferOwner owner {ownerDestroyed};
+        return owner.buffer;
+    }
+
+    ThreadBufferOwner (const ThreadBufferOwner &_other) = delete;
+
+    ThreadBufferOwner (ThreadBufferOwner &&_other) = delete;
+
+    EMERGENCE_DELETE_ASSIGNMENT (ThreadBufferOwner);
+
+private:
+    explicit ThreadBufferOwner (bool &_destroyedFlag) noexcept
+        : destroyedFlag (_destroyedFlag)
+    {
+        ProfilingLock lock;
+        ThreadBufferRegistry &registry = ThreadBufferRegistry::Get ();
+        buffer = new (registry.buffers.Acquire ()) ThreadBuffer {};
+        buffer->next = registry.first;
+        registry.first = buffer;
+    }
+
+    ~ThreadBufferOwner () noexcept
+    {
+        ProfilingLock lock;
+        ThreadBuffer::FlushAll (lock);
+        EMERGENCE_ASSERT (!buffer->Peek ());
+
+        ThreadBufferRegistry &registry = ThreadBufferRegistry::Get ();
+        ThreadBuffer **link = &registry.first;
+
+        while (*link != buffer)
+        {
+            EMERGENCE_ASSERT (*link);
+            link = &(*link)->next;
+        }
+
+        *link = buffer->next;
+        buffer->~ThreadBuffer ();
+        registry.buffers.Release (buffer);
+        destroyedFlag = true;
+    }
+
+    ThreadBuffer *buffer = nullptr;
+    bool &destroyedFlag;
+};
+
+void ThreadBuffer::Record (EventType _type,
+                           AllocationGroup *_group,
+                           std::size_t _bytes,
+                           UniqueString _markerId) noexcept
+{
+    ThreadBufferRegistry &registry = ThreadBufferRegistry::Get ();
+    ThreadBuffer *buffer = ThreadBufferOwner::Get ();
+
+    if (!buffer)
+    {
+        // Thread is exiting and its buffer is already flushed, therefore we apply operation right away.
+        ProfilingLock lock;
+        const PendingOperation operation {
+            .sequenceIndex = registry.nextSequenceIndex.fetch_add (1u, std::memory_order_relaxed),
+            .timeNs = Time::NanosecondsSinceStartup (),
+            .group = _group,
+            .type = _type,
+            .bytes = _bytes,
+            .markerId = _markerId,
+        };
+
+        // Other threads may have started recording before us, therefore we need to wait for them.
+        FlushUntil (operation.sequenceIndex, lock);
+        Apply (operation, lock);
+        ++registry.nextAppliedIndex;
+        return;
+    }
+
+    if (buffer->IsFull ())
+    {
+        ProfilingLock lock;
+        FlushAll (lock);
+    }
+
+    // Sequence index must be taken after we ensured that there is free space in buffer: otherwise we could
+    // wait for the lock while other thread waits for our operation in FlushAll under this lock.
+    const std::size_t writeIndex = buffer->writeIndex.load (std::memory_order_relaxed);
+    PendingOperation &operation = buffer->operations[writeIndex % CAPACITY];
+    operation.sequenceIndex = registry.nextSequenceIndex.fetch_add (1u, std::memory_order_relaxed);
+    operation.timeNs = EventManager::Get ().HasObservers () ? Time::NanosecondsSinceStartup () : 0u;
+    operation.group = _group;
+    operation.type = _type;
+    operation.bytes = _bytes;
+    operation.markerId = _markerId;
+    buffer->writeIndex.store (writeIndex + 1u, std::memory_order_release);
+}
+
+void ThreadBuffer::FlushAll (const ProfilingLock &_lock) noexcept
+{
+    // Operations with indices before this one were recorded before flush and must be applied.
+    FlushUntil (ThreadBufferRegistry::Get ().nextSequenceIndex.load (std::memory_order_relaxed), _lock);
+}
+
+void ThreadBuffer::FlushUntil (std::uint64_t _endIndex, const ProfilingLock &_lock) noexcept
+{
+    ThreadBufferRegistry &registry = ThreadBufferRegistry::Get ();
+    while (registry.nextAppliedIndex < _endIndex)
+    {
+        ThreadBuffer *source = nullptr;
+        for (ThreadBuffer *buffer = registry.first; buffer; buffer = buffer->next)
+        {
+            const PendingOperation *operation = buffer->Peek ();
+            if (operation && operation->sequenceIndex == registry.nextAppliedIndex)
+            {
+                source = buffer;
+                break;
+            }
+        }
+
+        if (!source)
+        {
+            // Next operation is being recorded right now, owner thread will publish it soon.
+            std::this_thread::yield ();
+            continue;
+        }
+
+        Apply (*source->Peek (), _lock);
+        source->Pop ();
+        ++registry.nextAppliedIndex;
+    }
+}
+
+bool ThreadBuffer::IsFull () const noexcept
+{
+    return writeIndex.load (std::memory_order_relaxed) - readIndex.load (std::memory_order_acquire) >= CAPACITY;
+}
+
+const PendingOperation *ThreadBuffer::Peek () const noexcept
+{
+    const std::size_t currentReadIndex = readIndex.load (std::memory_order_relaxed);
+    if (currentReadIndex == writeIndex.load (std::memory_order_acquire))
+    {
+        return nullptr;
+    }
+
+    return &operations[currentReadIndex % CAPACITY];
+}
+
+void ThreadBuffer::Pop () noexcept
+{
+    EMERGENCE_ASSERT (Peek ());
+    readIndex.fetch_add (1u, std::memory_order_release);
+}
+} // namespace Emergence::Memory::Profiler::Original
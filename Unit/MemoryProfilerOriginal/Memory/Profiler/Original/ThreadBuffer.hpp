@@ -0,0 +1,88 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+
+#include <API/Common/Shortcuts.hpp>
+
+#include <Memory/Profiler/Capture.hpp>
+#include <Memory/Profiler/Original/AllocationGroup.hpp>
+#include <Memory/Profiler/Original/ProfilingLock.hpp>
+
+namespace Emergence::Memory::Profiler::Original
+{
+/// \brief Memory operation, that was recorded by thread, but was not yet applied to allocation group hierarchy.
+struct PendingOperation final
+{
+    /// \brief Position of this operation in global order of all operations of all threads.
+    std::uint64_t sequenceIndex = 0u;
+
+    /// \brief Time of the operation or zero if there were no event observers during recording.
+    std::uint64_t timeNs = 0u;
+
+    AllocationGroup *group = nullptr;
+
+    EventType type = EventType::ALLOCATE;
+
+    std::size_t bytes = 0u;
+
+    UniqueString markerId;
+};
+
+/// \brief Single producer single consumer ring of operations, recorded by one thread.
+/// \details Owner thread is the only producer and records operations without locking. Any thread, that holds
+///          ProfilingLock, is a consumer, therefore there is only one consumer at any moment. Operations are
+///          applied to allocation groups and event list in global recording order, so captures and event
+///          observers see the same state as if every operation was applied right away under the lock.
+class ThreadBuffer final
+{
+public:
+    /// \brief Records operation of current thread.
+    static void Record (EventType _type,
+                        AllocationGroup *_group,
+                        std::size_t _bytes,
+                        UniqueString _markerId = {}) noexcept;
+
+    /// \brief Applies operations, recorded by all threads, to allocation groups and event list.
+    /// \details Waits for operations, that are being recorded right now, therefore all operations, that were
+    ///          recorded before this call, are guaranteed to be applied after it.
+    static void FlushAll (const ProfilingLock &_lock) noexcept;
+
+    ThreadBuffer (const ThreadBuffer &_other) = delete;
+
+    ThreadBuffer (ThreadBuffer &&_other) = delete;
+
+    EMERGENCE_DELETE_ASSIGNMENT (ThreadBuffer);
+
+private:
+    /// Owner class is used to flush and free buffer when its thread exits.
+    friend class ThreadBufferOwner;
+
+    static constexpr std::size_t CAPACITY = 1024u;
+
+    /// \brief Applies operations with sequence indices before given one.
+    static void FlushUntil (std::uint64_t _endIndex, const ProfilingLock &_lock) noexcept;
+
+    ThreadBuffer () noexcept = default;
+
+    ~ThreadBuffer () noexcept = default;
+
+    [[nodiscard]] bool IsFull () const noexcept;
+
+    /// \return First operation, that is not applied yet, or `nullptr` if there is no such operations.
+    [[nodiscard]] const PendingOperation *Peek () const noexcept;
+
+    void Pop () noexcept;
+
+    std::array<PendingOperation, CAPACITY> operations;
+
+    /// \brief Index of the next operation to be applied. Modified only by consumer.
+    std::atomic_size_t readIndex {0u};
+
+    /// \brief Index of the next operation to be recorded. Modified only by owner thread.
+    std::atomic_size_t writeIndex {0u};
+
+    /// \brief Intrusive list of all alive buffers, protected by ProfilingLock.
+    ThreadBuffer *next = nullptr;
+};
+} // namespace Emergence::Memory::Profiler::Original
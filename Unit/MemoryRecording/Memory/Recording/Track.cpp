@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include <Assert/Assert.hpp>
 
 #include <Log/Log.hpp>
@@ -253,7 +255,10 @@ Track::EventIterator::EventIterator (const Track *_track, const Track::EventNode
 
 Track::Track () noexcept
     : idToGroup (Constants::AllocationGroup ()),
-      events (Constants::AllocationGroup (), sizeof (EventNode), alignof (EventNode))
+      events (Constants::AllocationGroup (), sizeof (EventNode), alignof (EventNode)),
+      headGroups (Constants::AllocationGroup ()),
+      keyframes (Constants::AllocationGroup ()),
+      keyframeStates (Constants::AllocationGroup ())
 {
 }
 
@@ -326,6 +331,7 @@ bool Track::MoveToPreviousEvent () noexcept
     }
 
     current = current->previous;
+    --appliedEventCount;
     return true;
 }
 
@@ -381,9 +387,107 @@ bool Track::MoveToNextEvent () noexcept
     }
 
     current = next;
+    ++appliedEventCount;
+    return true;
+}
+
+bool Track::MoveToAppliedEventCount (std::size_t _appliedEventCount) noexcept
+{
+    if (_appliedEventCount > eventCount)
+    {
+        return false;
+    }
+
+    // Keyframes are created at fixed intervals, therefore there is no need to search for them.
+    const std::size_t keyframesBeforeTarget = std::min (_appliedEventCount / KEYFRAME_INTERVAL, keyframes.size ());
+    const Keyframe *keyframe = keyframesBeforeTarget > 0u ? &keyframes[keyframesBeforeTarget - 1u] : nullptr;
+    const std::size_t keyframeAppliedEventCount = keyframe ? keyframe->appliedEventCount : 0u;
+
+    // Undoing events is cheaper than keyframe restoration only if there is no keyframe between target and current.
+    const bool canUndo = appliedEventCount > _appliedEventCount &&
+                         (keyframesBeforeTarget == keyframes.size () ||
+                          appliedEventCount <= keyframes[keyframesBeforeTarget].appliedEventCount);
+
+    if (appliedEventCount < keyframeAppliedEventCount || (appliedEventCount > _appliedEventCount && !canUndo))
+    {
+        RestoreKeyframe (keyframe);
+    }
+
+    while (appliedEventCount < _appliedEventCount)
+    {
+        if (!MoveToNextEvent ())
+        {
+            return false;
+        }
+    }
+
+    while (appliedEventCount > _appliedEventCount)
+    {
+        if (!MoveToPreviousEvent ())
+        {
+            return false;
+        }
+    }
+
     return true;
 }
 
+bool Track::MoveToTime (std::uint64_t _timeNs) noexcept
+{
+    const auto nextKeyframe = std::upper_bound (keyframes.begin (), keyframes.end (), _timeNs,
+                                                [] (std::uint64_t _time, const Keyframe &_keyframe)
+                                                {
+                                                    return _time < _keyframe.event->event.timeNs;
+                                                });
+
+    const Keyframe *keyframe = nextKeyframe != keyframes.begin () ? &*(nextKeyframe - 1) : nullptr;
+    const std::size_t keyframeAppliedEventCount = keyframe ? keyframe->appliedEventCount : 0u;
+    const bool currentIsAfterTarget = current && current->event.timeNs > _timeNs;
+
+    // Undoing events is cheaper than keyframe restoration only if there is no keyframe between target and current.
+    const bool canUndo = currentIsAfterTarget &&
+                         (nextKeyframe == keyframes.end () || appliedEventCount <= nextKeyframe->appliedEventCount);
+
+    if (appliedEventCount < keyframeAppliedEventCount || (currentIsAfterTarget && !canUndo))
+    {
+        RestoreKeyframe (keyframe);
+    }
+
+    while (current != last)
+    {
+        const EventNode *next = current ? current->next : first;
+        if (next->event.timeNs > _timeNs)
+        {
+            break;
+        }
+
+        if (!MoveToNextEvent ())
+        {
+            return false;
+        }
+    }
+
+    while (current && current->event.timeNs > _timeNs)
+    {
+        if (!MoveToPreviousEvent ())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::size_t Track::GetEventCount () const noexcept
+{
+    return eventCount;
+}
+
+std::size_t Track::GetAppliedEventCount () const noexcept
+{
+    return appliedEventCount;
+}
+
 const RecordedAllocationGroup *Track::GetGroupByUID (GroupUID _uid) const noexcept
 {
     if (_uid < idToGroup.size ())
@@ -403,6 +507,14 @@ void Track::Clear () noexcept
     first = nullptr;
     last = nullptr;
     current = nullptr;
+
+    eventCount = 0u;
+    appliedEventCount = 0u;
+
+    headGroups.clear ();
+    keyframes.clear ();
+    keyframeStates.clear ();
+    headBroken = false;
 }
 
 void Track::ReportEvent (const Event &_event) noexcept
@@ -427,6 +539,150 @@ void Track::ReportEvent (const Event &_event) noexcept
         first = node;
         last = node;
     }
+
+    ++eventCount;
+    if (!headBroken)
+    {
+        headBroken = !UpdateHead (_event);
+        if (!headBroken && eventCount % KEYFRAME_INTERVAL == 0u)
+        {
+            AddKeyframe (node);
+        }
+    }
+}
+
+bool Track::UpdateHead (const Event &_event) noexcept
+{
+    // Head update logic mirrors event application logic, but works with plain
+    // group states, because group objects are needed only for current event.
+    switch (_event.type)
+    {
+    case EventType::DECLARE_GROUP:
+        if (_event.declareGroup.uid < headGroups.size ())
+        {
+            HeadGroup &group = headGroups[_event.declareGroup.uid];
+            if (group.id != _event.declareGroup.id)
+            {
+                return false;
+            }
+
+            group.state = {_event.declareGroup.reservedBytes, _event.declareGroup.acquiredBytes};
+            return true;
+        }
+
+        if (_event.declareGroup.uid != headGroups.size () ||
+            (_event.declareGroup.parent == MISSING_GROUP_ID ? !headGroups.empty () :
+                                                              _event.declareGroup.parent >= headGroups.size ()))
+        {
+            return false;
+        }
+
+        headGroups.emplace_back () = {_event.declareGroup.parent,
+                                      _event.declareGroup.id,
+                                      {_event.declareGroup.reservedBytes, _event.declareGroup.acquiredBytes}};
+        return true;
+
+    case EventType::ALLOCATE:
+        return UpdateHeadChain (_event.memory.group, _event.memory.bytes, nullptr, &GroupState::reserved);
+
+    case EventType::ACQUIRE:
+        return UpdateHeadChain (_event.memory.group, _event.memory.bytes, &GroupState::reserved,
+                                &GroupState::acquired);
+
+    case EventType::RELEASE:
+        return UpdateHeadChain (_event.memory.group, _event.memory.bytes, &GroupState::acquired,
+                                &GroupState::reserved);
+
+    case EventType::FREE:
+        return UpdateHeadChain (_event.memory.group, _event.memory.bytes, &GroupState::reserved, nullptr);
+
+    case EventType::MARKER:
+        return true;
+    }
+
+    return false;
+}
+
+bool Track::UpdateHeadChain (GroupUID _uid,
+                             std::uint64_t _bytes,
+                             std::size_t GroupState::*_decreased,
+                             std::size_t GroupState::*_increased) noexcept
+{
+    if (_uid >= headGroups.size ())
+    {
+        return false;
+    }
+
+    // Like RecordedAllocationGroup operations, chain is either modified completely or not modified at all.
+    if (_decreased)
+    {
+        for (GroupUID uid = _uid; uid != MISSING_GROUP_ID; uid = headGroups[uid].parent)
+        {
+            if (_bytes > headGroups[uid].state.*_decreased)
+            {
+                return false;
+            }
+        }
+    }
+
+    for (GroupUID uid = _uid; uid != MISSING_GROUP_ID; uid = headGroups[uid].parent)
+    {
+        GroupState &state = headGroups[uid].state;
+        if (_decreased)
+        {
+            state.*_decreased -= _bytes;
+        }
+
+        if (_increased)
+        {
+            state.*_increased += _bytes;
+        }
+    }
+
+    return true;
+}
+
+void Track::AddKeyframe (EventNode *_event) noexcept
+{
+    keyframes.emplace_back () = {_event, eventCount, keyframeStates.size (), headGroups.size ()};
+    for (const HeadGroup &group : headGroups)
+    {
+        keyframeStates.emplace_back (group.state);
+    }
+}
+
+void Track::RestoreKeyframe (const Keyframe *_keyframe) noexcept
+{
+    const std::size_t groupCount = _keyframe ? _keyframe->groupCount : 0u;
+
+    // Groups, declared before keyframe, might not exist yet if track has never been moved that far.
+    // Head groups are created in declaration order, therefore parents are always created before children.
+    while (idToGroup.size () < groupCount)
+    {
+        const HeadGroup &declaration = headGroups[idToGroup.size ()];
+        if (declaration.parent == MISSING_GROUP_ID)
+        {
+            EMERGENCE_ASSERT (!root);
+            root.reset (new RecordedAllocationGroup {nullptr, {}, 0u, 0u});
+            idToGroup.emplace_back (root.get ());
+        }
+        else
+        {
+            idToGroup.emplace_back (
+                new RecordedAllocationGroup {idToGroup[declaration.parent], declaration.id, 0u, 0u});
+        }
+    }
+
+    // Groups, declared after keyframe, are reset to zero usage, like undone declarations do.
+    for (std::size_t uid = 0u; uid < idToGroup.size (); ++uid)
+    {
+        const GroupState state = uid < groupCount ? keyframeStates[_keyframe->firstStateIndex + uid] : GroupState {};
+        idToGroup[uid]->reserved = state.reserved;
+        idToGroup[uid]->acquired = state.acquired;
+    }
+
+    current = _keyframe ? _keyframe->event : nullptr;
+    appliedEventCount = _keyframe ? _keyframe->appliedEventCount : 0u;
 }
 
 RecordedAllocationGroup *Track::RequireGroup (GroupUID _uid) const noexcept
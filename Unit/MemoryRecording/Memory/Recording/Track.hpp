@@ -102,6 +102,10 @@ private:
 ///        group state at any moment of time, selected through current event pointer.
 /// \details Events could be reported through any ReporterBase derived class, like RuntimeReporter
 ///          or StreamDeserializer. Event addition never invalidates iterators.
+///
+///          Track saves states of all groups as keyframe after every ::KEYFRAME_INTERVAL reported events.
+///          Keyframes are used to move to any event or time point without applying or undoing all the events
+///          between current event and target event.
 class MemoryRecordingApi Track final
 {
 private:
@@ -115,6 +119,30 @@ private:
 
     static_assert (std::is_trivially_destructible_v<EventNode>);
 
+    /// \brief Usage of single group, stored in keyframes.
+    struct GroupState final
+    {
+        std::size_t reserved = 0u;
+        std::size_t acquired = 0u;
+    };
+
+    /// \brief State of group after applying all reported events. Used to create keyframes during reporting.
+    struct HeadGroup final
+    {
+        GroupUID parent = MISSING_GROUP_ID;
+        UniqueString id;
+        GroupState state;
+    };
+
+    /// \brief Saved states of all groups, that are declared before ::event, after applying ::event.
+    struct Keyframe final
+    {
+        EventNode *event = nullptr;
+        std::size_t appliedEventCount = 0u;
+        std::size_t firstStateIndex = 0u;
+        std::size_t groupCount = 0u;
+    };
+
 public:
     /// \brief Provides iteration over events, stored in Track.
     /// \details For convenience, implements circling behaviour:
@@ -167,6 +195,24 @@ public:
     /// \return True if next event was successfully applied. Also returns `false` if all reported events are applied.
     bool MoveToNextEvent () noexcept;
 
+    /// \brief Moves to the state, in which exactly given count of first reported events is applied.
+    /// \details Starts from the closest keyframe if current event is too far from the target,
+    ///          therefore requires at most ::KEYFRAME_INTERVAL event applications or undos.
+    /// \return True if target state was successfully reached. Also returns `false` if there is not enough events.
+    bool MoveToAppliedEventCount (std::size_t _appliedEventCount) noexcept;
+
+    /// \brief Moves to the state, in which all events that occurred at or before given time are applied.
+    /// \details Closest keyframe is found through binary search, therefore seeking has
+    ///          `O(log(keyframeCount) + KEYFRAME_INTERVAL)` complexity.
+    /// \return True if target state was successfully reached.
+    bool MoveToTime (std::uint64_t _timeNs) noexcept;
+
+    /// \return Count of all reported events.
+    [[nodiscard]] std::size_t GetEventCount () const noexcept;
+
+    /// \return Count of events, applied to reach current state. Zero if track is in the initial state.
+    [[nodiscard]] std::size_t GetAppliedEventCount () const noexcept;
+
     /// \return Current state of a group, associated with given uid, or `nullptr` if there is no group with given uid.
     [[nodiscard]] const RecordedAllocationGroup *GetGroupByUID (GroupUID _uid) const noexcept;
 
@@ -176,11 +222,27 @@ public:
     /// Assigning tracks seems counter-intuitive.
     EMERGENCE_DELETE_ASSIGNMENT (Track);
 
+    /// \brief Count of reported events between keyframes.
+    /// \details Every keyframe stores state of every group, therefore interval should be big enough
+    ///          to keep keyframe memory usage small in comparison with events memory usage.
+    static constexpr std::size_t KEYFRAME_INTERVAL = 4096u;
+
 private:
     friend class ReporterBase;
 
     void ReportEvent (const Event &_event) noexcept;
 
+    bool UpdateHead (const Event &_event) noexcept;
+
+    bool UpdateHeadChain (GroupUID _uid,
+                          std::uint64_t _bytes,
+                          std::size_t GroupState::*_decreased,
+                          std::size_t GroupState::*_increased) noexcept;
+
+    void AddKeyframe (EventNode *_event) noexcept;
+
+    void RestoreKeyframe (const Keyframe *_keyframe) noexcept;
+
     [[nodiscard]] RecordedAllocationGroup *RequireGroup (GroupUID _uid) const noexcept;
 
     bool ApplyDeclareGroupEvent (const Event &_event) noexcept;
@@ -210,5 +272,16 @@ private:
     EventNode *first = nullptr;
     EventNode *last = nullptr;
     EventNode *current = nullptr;
+
+    std::size_t eventCount = 0u;
+    std::size_t appliedEventCount = 0u;
+
+    Container::Vector<HeadGroup> headGroups;
+    Container::Vector<Keyframe> keyframes;
+    Container::Vector<GroupState> keyframeStates;
+
+    /// \brief Whether reported events can not be applied after last keyframe.
+    /// \details Such events can not be passed by moving through the track, so there is no sense in new keyframes.
+    bool headBroken = false;
 };
 } // namespace Emergence::Memory::Recording
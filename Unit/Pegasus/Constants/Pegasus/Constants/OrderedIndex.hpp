@@ -6,8 +6,20 @@
 
 namespace Emergence::Pegasus::Constants::OrderedIndex
 {
-/// \brief If `changedRecordsCount / allRecordsCount > thisConstants`, OrderedIndex
-/// will fully resort records storage instead of reinserting changed records one by one.
+/// \brief If `changedRecordsCount / allRecordsCount > thisConstants`, OrderedIndex will fully resort records storage
+/// instead of reinserting changed records one by one. Also used for records, inserted through bulk insertion.
 constexpr float MINIMUM_CHANGED_RECORDS_RATIO_TO_TRIGGER_FULL_RESORT =
     Profile::OrderedIndex::MINIMUM_CHANGED_RECORDS_RATIO_TO_TRIGGER_FULL_RESORT;
+
+/// \brief OrderedIndex selects B+ tree node capacity so that node size is close to this value in bytes.
+constexpr std::size_t TARGET_NODE_SIZE = Profile::OrderedIndex::TARGET_NODE_SIZE;
+
+/// \brief Nodes always have space for at least this count of keys, even if indexed field is big.
+constexpr std::size_t MINIMUM_NODE_CAPACITY = Profile::OrderedIndex::MINIMUM_NODE_CAPACITY;
+
+/// \brief If `leafRecordCount / leafCapacity < thisConstant` after deletion, OrderedIndex
+/// will try to merge this leaf into the next one.
+constexpr float SPARSE_LEAF_FILL_RATIO = Profile::OrderedIndex::SPARSE_LEAF_FILL_RATIO;
+
+static_assert (MINIMUM_NODE_CAPACITY >= 2u);
 } // namespace Emergence::Pegasus::Constants::OrderedIndex
@@ -5,4 +5,10 @@
 namespace Emergence::Pegasus::Constants::Profile::OrderedIndex
 {
 constexpr float MINIMUM_CHANGED_RECORDS_RATIO_TO_TRIGGER_FULL_RESORT = 0.5f;
+
+constexpr std::size_t TARGET_NODE_SIZE = 512u;
+
+constexpr std::size_t MINIMUM_NODE_CAPACITY = 4u;
+
+constexpr float SPARSE_LEAF_FILL_RATIO = 0.25f;
 } // namespace Emergence::Pegasus::Constants::Profile::OrderedIndex
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#    include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define EMERGENCE_PEGASUS_BOUNDS_SSE2
+#    include <emmintrin.h>
+#endif
+
+namespace Emergence::Pegasus
+{
+/// \brief Count of lanes, checked by one call to ::IntersectBoundsLanes.
+constexpr std::size_t BOUNDS_BLOCK_LANES = 8u;
+
+/// \brief Checks which of ::BOUNDS_BLOCK_LANES one-dimensional segments intersect with query segment.
+/// \details Segment intersects query if `!(max < queryMin) && !(min > queryMax)`, therefore results for NaNs are
+///          the same as in per-record check. Arrays are not required to be aligned.
+/// \return Mask, where i-th bit is set if i-th segment intersects with query segment.
+template <typename Unit>
+std::uint32_t IntersectBoundsLanes (const Unit *_minimums,
+                                    const Unit *_maximums,
+                                    Unit _queryMin,
+                                    Unit _queryMax) noexcept
+{
+    std::uint32_t result = 0u;
+    for (std::size_t lane = 0u; lane < BOUNDS_BLOCK_LANES; ++lane)
+    {
+        if (!(_maximums[lane] < _queryMin) && !(_minimums[lane] > _queryMax))
+        {
+            result |= 1u << lane;
+        }
+    }
+
+    return result;
+}
+
+#if defined(__AVX2__)
+template <>
+inline std::uint32_t IntersectBoundsLanes<float> (const float *_minimums,
+                                                  const float *_maximums,
+                                                  float _queryMin,
+                                                  float _queryMax) noexcept
+{
+    const __m256 notBefore = _mm256_cmp_ps (_mm256_loadu_ps (_maximums), _mm256_set1_ps (_queryMin), _CMP_NLT_UQ);
+    const __m256 notAfter = _mm256_cmp_ps (_mm256_loadu_ps (_minimums), _mm256_set1_ps (_queryMax), _CMP_NGT_UQ);
+    return static_cast<std::uint32_t> (_mm256_movemask_ps (_mm256_and_ps (notBefore, notAfter)));
+}
+
+template <>
+inline std::uint32_t IntersectBoundsLanes<double> (const double *_minimums,
+                                                   const double *_maximums,
+                                                   double _queryMin,
+                                                   double _queryMax) noexcept
+{
+    const __m256d queryMin = _mm256_set1_pd (_queryMin);
+    const __m256d queryMax = _mm256_set1_pd (_queryMax);
+    std::uint32_t result = 0u;
+
+    for (std::size_t offset = 0u; offset < BOUNDS_BLOCK_LANES; offset += 4u)
+    {
+        const __m256d notBefore = _mm256_cmp_pd (_mm256_loadu_pd (_maximums + offset), queryMin, _CMP_NLT_UQ);
+        const __m256d notAfter = _mm256_cmp_pd (_mm256_loadu_pd (_minimums + offset), queryMax, _CMP_NGT_UQ);
+        result |= static_cast<std::uint32_t> (_mm256_movemask_pd (_mm256_and_pd (notBefore, notAfter))) << offset;
+    }
+
+    return result;
+}
+
+template <>
+inline std::uint32_t IntersectBoundsLanes<std::int32_t> (const std::int32_t *_minimums,
+                                                         const std::int32_t *_maximums,
+                                                         std::int32_t _queryMin,
+                                                         std::int32_t _queryMax) noexcept
+{
+    const __m256i before = _mm256_cmpgt_epi32 (_mm256_set1_epi32 (_queryMin),
+                                               _mm256_loadu_si256 (reinterpret_cast<const __m256i *> (_maximums)));
+    const __m256i after = _mm256_cmpgt_epi32 (_mm256_loadu_si256 (reinterpret_cast<const __m256i *> (_minimums)),
+                                              _mm256_set1_epi32 (_queryMax));
+
+    const __m256i outside = _mm256_or_si256 (before, after);
+    return ~static_cast<std::uint32_t> (_mm256_movemask_ps (_mm256_castsi256_ps (outside))) & 0xFFu;
+}
+#elif defined(EMERGENCE_PEGASUS_BOUNDS_SSE2)
+template <>
+inline std::uint32_t IntersectBoundsLanes<float> (const float *_minimums,
+                                                  const float *_maximums,
+                                                  float _queryMin,
+                                                  float _queryMax) noexcept
+{
+    const __m128 queryMin = _mm_set1_ps (_queryMin);
+    const __m128 queryMax = _mm_set1_ps (_queryMax);
+    std::uint32_t result = 0u;
+
+    for (std::size_t offset = 0u; offset < BOUNDS_BLOCK_LANES; offset += 4u)
+    {
+        const __m128 notBefore = _mm_cmpnlt_ps (_mm_loadu_ps (_maximums + offset), queryMin);
+        const __m128 notAfter = _mm_cmpngt_ps (_mm_loadu_ps (_minimums + offset), queryMax);
+        result |= static_cast<std::uint32_t> (_mm_movemask_ps (_mm_and_ps (notBefore, notAfter))) << offset;
+    }
+
+    return result;
+}
+
+template <>
+inline std::uint32_t IntersectBoundsLanes<double> (const double *_minimums,
+                                                   const double *_maximums,
+                                                   double _queryMin,
+                                                   double _queryMax) noexcept
+{
+    const __m128d queryMin = _mm_set1_pd (_queryMin);
+    const __m128d queryMax = _mm_set1_pd (_queryMax);
+    std::uint32_t result = 0u;
+
+    for (std::size_t offset = 0u; offset < BOUNDS_BLOCK_LANES; offset += 2u)
+    {
+        const __m128d notBefore = _mm_cmpnlt_pd (_mm_loadu_pd (_maximums + offset), queryMin);
+        const __m128d notAfter = _mm_cmpngt_pd (_mm_loadu_pd (_minimums + offset), queryMax);
+        result |= static_cast<std::uint32_t> (_mm_movemask_pd (_mm_and_pd (notBefore, notAfter))) << offset;
+    }
+
+    return result;
+}
+
+template <>
+inline std::uint32_t IntersectBoundsLanes<std::int32_t> (const std::int32_t *_minimums,
+                                                         const std::int32_t *_maximums,
+                                                         std::int32_t _queryMin,
+                                                         std::int32_t _queryMax) noexcept
+{
+    const __m128i queryMin = _mm_set1_epi32 (_queryMin);
+    const __m128i queryMax = _mm_set1_epi32 (_queryMax);
+    std::uint32_t outside = 0u;
+
+    for (std::size_t offset = 0u; offset < BOUNDS_BLOCK_LANES; offset += 4u)
+    {
+        const __m128i before =
+            _mm_cmpgt_epi32 (queryMin, _mm_loadu_si128 (reinterpret_cast<const __m128i *> (_maximums + offset)));
+        const __m128i after =
+            _mm_cmpgt_epi32 (_mm_loadu_si128 (reinterpret_cast<const __m128i *> (_minimums + offset)), queryMax);
+        outside |= static_cast<std::uint32_t> (_mm_movemask_ps (_mm_castsi128_ps (_mm_or_si128 (before, after))))
+                   << offset;
+    }
+
+    return ~outside & 0xFFu;
+}
+
+#    undef EMERGENCE_PEGASUS_BOUNDS_SSE2
+#endif
+} // namespace Emergence::Pegasus
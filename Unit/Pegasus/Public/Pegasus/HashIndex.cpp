@@ -300,6 +300,16 @@ void HashIndex::InsertRecord (const void *_record) noexcept
     EMERGENCE_UNION2_CALL (records, implementationSwitch, void, emplace, _record);
 }
 
+void HashIndex::Reserve (std::size_t _additionalRecords) noexcept
+{
+    VisitUnion2<void> (
+        [_additionalRecords] (auto &_records)
+        {
+            _records.reserve (_records.size () + _additionalRecords);
+        },
+        records, implementationSwitch);
+}
+
 void HashIndex::OnRecordDeleted (const void *_record, const void *_recordBackup) noexcept
 {
     VisitUnion2<void> (
@@ -160,6 +160,9 @@ private:
 
     void InsertRecord (const void *_record) noexcept;
 
+    /// \brief Prepares records set for insertion of given count of records, so it is resized only once.
+    void Reserve (std::size_t _additionalRecords) noexcept;
+
     void OnRecordDeleted (const void *_record, const void *_recordBackup) noexcept;
 
     RecordHashSetIterator DeleteRecordMyself0 (const RecordHashSetIterator &_position) noexcept;
@@ -1,6 +1,5 @@
 #include <algorithm>
 #include <cstring>
-#include <limits>
 
 #include <Memory/Profiler/AllocationGroup.hpp>
 
@@ -11,30 +10,55 @@
 
 namespace Emergence::Pegasus
 {
-/// Indicates that ::record could be changed and that ::backup should be used to get value, used to insert this record
-/// into ordered vector. When record is changed using cursor from other index, we need to pass this structure instead
-/// of just ::backup, because otherwise ::backup could be compared to changed record and that comparison will lead to
-/// incorrect lookup result.
-struct RecordWithBackup
+struct OrderedIndex::Node
 {
-    const void *record;
-    const void *backup;
+    InnerNode *parent = nullptr;
+
+    /// \brief Count of records in leaf or count of keys in inner node. Inner node has one child more than keys.
+    std::size_t count = 0u;
 };
 
-template <typename BaseComparator>
-struct Comparator
+/// \details Leaf header is followed by record pointer array and key array, see ::OrderedIndex::leafLayout.
+struct OrderedIndex::Leaf final : public OrderedIndex::Node
 {
-    Comparator (const OrderedIndex *_index, BaseComparator _baseComparator) noexcept;
+    Leaf *previous = nullptr;
+    Leaf *next = nullptr;
+};
 
-    bool operator() (const void *_firstRecord, const void *_secondRecord) const noexcept;
+/// \details Inner node header is followed by child pointer array and key array,
+///          see ::OrderedIndex::innerNodeLayout. Key with index `i` separates children `i` and `i + 1`:
+///          it is not less than any key of child `i` and not greater than any key of child `i + 1`.
+struct OrderedIndex::InnerNode final : public OrderedIndex::Node
+{
+};
 
-    bool operator() (const RecordWithBackup &_firstRecord, const void *_secondRecord) const noexcept;
+/// \brief Key arrays are aligned this way, therefore every copied value is correctly aligned too.
+/// \details Indexed values are numbers, strings, unique strings and blocks, so they never need bigger alignment.
+static constexpr std::size_t NODE_ALIGNMENT = alignof (std::uint64_t);
 
-    bool operator() (const void *_firstRecord, const RecordWithBackup &_secondRecord) const noexcept;
+static std::size_t AlignUp (std::size_t _value, std::size_t _alignment) noexcept
+{
+    return (_value + _alignment - 1u) / _alignment * _alignment;
+}
 
-    bool operator() (const OrderedIndex::Bound &_bound, const void *_record) const noexcept;
+static std::size_t CalculateNodeCapacity (std::size_t _headerSize, std::size_t _entrySize) noexcept
+{
+    // One entry is always reserved for insertion before split.
+    std::size_t capacity = 0u;
+    if (Constants::OrderedIndex::TARGET_NODE_SIZE > _headerSize + _entrySize * 2u)
+    {
+        capacity = (Constants::OrderedIndex::TARGET_NODE_SIZE - _headerSize) / _entrySize - 1u;
+    }
 
-    bool operator() (const void *_record, const OrderedIndex::Bound &_bound) const noexcept;
+    return std::max (capacity, Constants::OrderedIndex::MINIMUM_NODE_CAPACITY);
+}
+
+template <typename BaseComparator>
+struct Comparator
+{
+    Comparator (const OrderedIndex *_index, BaseComparator _baseComparator) noexcept;
+
+    bool operator() (const void *_firstRecord, const void *_secondRecord) const noexcept;
 
 private:
     const void *GetValue (const void *_record) const noexcept;
@@ -58,59 +82,13 @@ bool Comparator<BaseComparator>::operator() (const void *_firstRecord, const voi
     return baseComparator.Compare (GetValue (_firstRecord), GetValue (_secondRecord)) < 0;
 }
 
-template <typename BaseComparator>
-bool Comparator<BaseComparator>::operator() (const RecordWithBackup &_firstRecord,
-                                             const void *_secondRecord) const noexcept
-{
-    EMERGENCE_ASSERT (_secondRecord);
-    if (_firstRecord.record == _secondRecord)
-    {
-        return false;
-    }
-    else
-    {
-        EMERGENCE_ASSERT (_firstRecord.backup);
-        return baseComparator.Compare (GetValue (_firstRecord.backup), GetValue (_secondRecord)) < 0;
-    }
-}
-
-template <typename BaseComparator>
-bool Comparator<BaseComparator>::operator() (const void *_firstRecord,
-                                             const RecordWithBackup &_secondRecord) const noexcept
-{
-    EMERGENCE_ASSERT (_firstRecord);
-    if (_secondRecord.record == _firstRecord)
-    {
-        return false;
-    }
-
-    EMERGENCE_ASSERT (_secondRecord.backup);
-    return baseComparator.Compare (GetValue (_firstRecord), GetValue (_secondRecord.backup)) < 0;
-}
-
-template <typename BaseComparator>
-bool Comparator<BaseComparator>::operator() (const OrderedIndex::Bound &_bound, const void *_record) const noexcept
-{
-    EMERGENCE_ASSERT (_bound.boundValue);
-    EMERGENCE_ASSERT (_record);
-    return baseComparator.Compare (_bound.boundValue, GetValue (_record)) < 0;
-}
-
-template <typename BaseComparator>
-bool Comparator<BaseComparator>::operator() (const void *_record, const OrderedIndex::Bound &_bound) const noexcept
-{
-    EMERGENCE_ASSERT (_record);
-    EMERGENCE_ASSERT (_bound.boundValue);
-    return baseComparator.Compare (GetValue (_record), _bound.boundValue) < 0;
-}
-
 template <typename BaseComparator>
 const void *Comparator<BaseComparator>::GetValue (const void *_record) const noexcept
 {
     return static_cast<const std::uint8_t *> (_record) + fieldOffset;
 }
 
-#define READ_CURSOR_IMPLEMENTATION(Cursor, Iterator)                                                                   \
+#define READ_CURSOR_IMPLEMENTATION(Cursor, Step)                                                                       \
     OrderedIndex::Cursor::Cursor (const OrderedIndex::Cursor &_other) noexcept                                         \
         : index (_other.index),                                                                                        \
           current (_other.current),                                                                                    \
@@ -142,7 +120,7 @@ const void *Comparator<BaseComparator>::GetValue (const void *_record) const noe
     const void *OrderedIndex::Cursor::operator* () const noexcept                                                      \
     {                                                                                                                  \
         EMERGENCE_ASSERT (index);                                                                                      \
-        return current != end ? *current : nullptr;                                                                    \
+        return current != end ? index->GetRecord (current) : nullptr;                                                  \
     }                                                                                                                  \
                                                                                                                        \
     OrderedIndex::Cursor &OrderedIndex::Cursor::operator++ () noexcept                                                 \
@@ -150,24 +128,21 @@ const void *Comparator<BaseComparator>::GetValue (const void *_record) const noe
         EMERGENCE_ASSERT (index);                                                                                      \
         EMERGENCE_ASSERT (current != end);                                                                             \
                                                                                                                        \
-        ++current;                                                                                                     \
+        current = index->Step (current);                                                                               \
         return *this;                                                                                                  \
     }                                                                                                                  \
                                                                                                                        \
-    /* NOLINTNEXTLINE(bugprone-macro-parentheses): Types can not be enclosed. */                                       \
-    OrderedIndex::Cursor::Cursor (OrderedIndex *_index, Iterator _begin, Iterator _end) noexcept                       \
+    OrderedIndex::Cursor::Cursor (OrderedIndex *_index, Position _begin, Position _end) noexcept                       \
         : index (_index),                                                                                              \
           current (_begin),                                                                                            \
           end (_end)                                                                                                   \
     {                                                                                                                  \
         EMERGENCE_ASSERT (index);                                                                                      \
-        EMERGENCE_ASSERT (current <= end);                                                                             \
-                                                                                                                       \
         ++index->activeCursors;                                                                                        \
         index->storage->RegisterReader ();                                                                             \
     }
 
-#define EDIT_CURSOR_IMPLEMENTATION(Cursor, Iterator)                                                                   \
+#define EDIT_CURSOR_IMPLEMENTATION(Cursor, Step)                                                                       \
     OrderedIndex::Cursor::Cursor (OrderedIndex::Cursor &&_other) noexcept                                              \
         : index (_other.index),                                                                                        \
           current (_other.current),                                                                                    \
@@ -181,7 +156,7 @@ const void *Comparator<BaseComparator>::GetValue (const void *_record) const noe
     {                                                                                                                  \
         if (index)                                                                                                     \
         {                                                                                                              \
-            if (current != end && index->storage->EndRecordEdition (*current, index))                                  \
+            if (current != end && index->storage->EndRecordEdition (index->GetRecord (current), index))               \
             {                                                                                                          \
                 index->OnRecordChangedByMe (current);                                                                  \
             }                                                                                                          \
@@ -194,7 +169,7 @@ const void *Comparator<BaseComparator>::GetValue (const void *_record) const noe
     void *OrderedIndex::Cursor::operator* () noexcept                                                                  \
     {                                                                                                                  \
         EMERGENCE_ASSERT (index);                                                                                      \
-        return current != end ? const_cast<void *> (*current) : nullptr;                                               \
+        return current != end ? const_cast<void *> (index->GetRecord (current)) : nullptr;                             \
     }                                                                                                                  \
                                                                                                                        \
     OrderedIndex::Cursor &OrderedIndex::Cursor::operator~() noexcept                                                   \
@@ -203,7 +178,7 @@ const void *Comparator<BaseComparator>::GetValue (const void *_record) const noe
         EMERGENCE_ASSERT (current != end);                                                                             \
                                                                                                                        \
         index->DeleteRecordMyself (current);                                                                           \
-        ++current;                                                                                                     \
+        current = index->Step (current);                                                                               \
         BeginRecordEdition ();                                                                                         \
         return *this;                                                                                                  \
     }                                                                                                                  \
@@ -213,25 +188,22 @@ const void *Comparator<BaseComparator>::GetValue (const void *_record) const noe
         EMERGENCE_ASSERT (index);                                                                                      \
         EMERGENCE_ASSERT (current != end);                                                                             \
                                                                                                                        \
-        if (index->storage->EndRecordEdition (*current, index))                                                        \
+        if (index->storage->EndRecordEdition (index->GetRecord (current), index))                                      \
         {                                                                                                              \
             index->OnRecordChangedByMe (current);                                                                      \
         }                                                                                                              \
                                                                                                                        \
-        ++current;                                                                                                     \
+        current = index->Step (current);                                                                               \
         BeginRecordEdition ();                                                                                         \
         return *this;                                                                                                  \
     }                                                                                                                  \
                                                                                                                        \
-    /* NOLINTNEXTLINE(bugprone-macro-parentheses): Types can not be enclosed. */                                       \
-    OrderedIndex::Cursor::Cursor (OrderedIndex *_index, Iterator _begin, Iterator _end) noexcept                       \
+    OrderedIndex::Cursor::Cursor (OrderedIndex *_index, Position _begin, Position _end) noexcept                       \
         : index (_index),                                                                                              \
           current (_begin),                                                                                            \
           end (_end)                                                                                                   \
     {                                                                                                                  \
         EMERGENCE_ASSERT (index);                                                                                      \
-        EMERGENCE_ASSERT (current <= end);                                                                             \
-                                                                                                                       \
         ++index->activeCursors;                                                                                        \
         index->storage->RegisterWriter ();                                                                             \
         BeginRecordEdition ();                                                                                         \
@@ -242,17 +214,17 @@ const void *Comparator<BaseComparator>::GetValue (const void *_record) const noe
         EMERGENCE_ASSERT (index);                                                                                      \
         if (current != end)                                                                                            \
         {                                                                                                              \
-            index->storage->BeginRecordEdition (*current);                                                             \
+            index->storage->BeginRecordEdition (index->GetRecord (current));                                           \
         }                                                                                                              \
     }
 
-READ_CURSOR_IMPLEMENTATION (AscendingReadCursor, Container::Vector<const void *>::const_iterator)
+READ_CURSOR_IMPLEMENTATION (AscendingReadCursor, Next)
 
-EDIT_CURSOR_IMPLEMENTATION (AscendingEditCursor, Container::Vector<const void *>::iterator)
+EDIT_CURSOR_IMPLEMENTATION (AscendingEditCursor, Next)
 
-READ_CURSOR_IMPLEMENTATION (DescendingReadCursor, Container::Vector<const void *>::const_reverse_iterator)
+READ_CURSOR_IMPLEMENTATION (DescendingReadCursor, Previous)
 
-EDIT_CURSOR_IMPLEMENTATION (DescendingEditCursor, Container::Vector<const void *>::reverse_iterator)
+EDIT_CURSOR_IMPLEMENTATION (DescendingEditCursor, Previous)
 
 OrderedIndex::AscendingReadCursor OrderedIndex::LookupToReadAscending (const OrderedIndex::Bound &_min,
                                                                        const OrderedIndex::Bound &_max) noexcept
@@ -265,8 +237,7 @@ OrderedIndex::DescendingReadCursor OrderedIndex::LookupToReadDescending (const O
                                                                          const OrderedIndex::Bound &_max) noexcept
 {
     InternalLookupResult result = InternalLookup (_min, _max);
-    return {this, Container::Vector<const void *>::const_reverse_iterator (result.end),
-            Container::Vector<const void *>::const_reverse_iterator (result.begin)};
+    return {this, Previous (result.end), Previous (result.begin)};
 }
 
 OrderedIndex::AscendingEditCursor OrderedIndex::LookupToEditAscending (const OrderedIndex::Bound &_min,
@@ -282,8 +253,7 @@ OrderedIndex::DescendingEditCursor OrderedIndex::LookupToEditDescending (const O
 {
     hasEditCursor = true;
     InternalLookupResult result = InternalLookup (_min, _max);
-    return {this, Container::Vector<const void *>::reverse_iterator (result.end),
-            Container::Vector<const void *>::reverse_iterator (result.begin)};
+    return {this, Previous (result.end), Previous (result.begin)};
 }
 
 StandardLayout::Field OrderedIndex::GetIndexedField () const noexcept
@@ -301,12 +271,7 @@ void OrderedIndex::Drop () noexcept
 OrderedIndex::MassInsertionExecutor::~MassInsertionExecutor () noexcept
 {
     EMERGENCE_ASSERT (owner);
-    DoWithCorrectComparator (owner->indexedField,
-                             [this] (auto _comparator) -> void
-                             {
-                                 std::sort (owner->records.begin (), owner->records.end (),
-                                            Comparator (owner, _comparator));
-                             });
+    owner->Rebuild ();
 
 #if defined(EMERGENCE_ASSERT_ENABLED)
     EMERGENCE_ASSERT (owner->massInsertionInProgress);
@@ -318,7 +283,7 @@ void OrderedIndex::MassInsertionExecutor::InsertRecord (const void *_record) noe
 {
     EMERGENCE_ASSERT (owner);
     EMERGENCE_ASSERT (_record);
-    owner->records.emplace_back (_record);
+    owner->massInsertionBuffer.emplace_back (_record);
 }
 
 OrderedIndex::MassInsertionExecutor::MassInsertionExecutor (OrderedIndex *_owner) noexcept
@@ -332,16 +297,41 @@ OrderedIndex::MassInsertionExecutor::MassInsertionExecutor (OrderedIndex *_owner
 #endif
 }
 
+OrderedIndex::NodeLayout OrderedIndex::CalculateLeafLayout (std::size_t _keySize) noexcept
+{
+    NodeLayout layout;
+    layout.capacity = CalculateNodeCapacity (sizeof (Leaf), sizeof (const void *) + _keySize);
+    layout.keysOffset = AlignUp (sizeof (Leaf) + (layout.capacity + 1u) * sizeof (const void *), NODE_ALIGNMENT);
+    layout.size = AlignUp (layout.keysOffset + (layout.capacity + 1u) * _keySize, NODE_ALIGNMENT);
+    return layout;
+}
+
+OrderedIndex::NodeLayout OrderedIndex::CalculateInnerNodeLayout (std::size_t _keySize) noexcept
+{
+    NodeLayout layout;
+    layout.capacity = CalculateNodeCapacity (sizeof (InnerNode) + sizeof (Node *), sizeof (Node *) + _keySize);
+    layout.keysOffset = AlignUp (sizeof (InnerNode) + (layout.capacity + 2u) * sizeof (Node *), NODE_ALIGNMENT);
+    layout.size = AlignUp (layout.keysOffset + (layout.capacity + 1u) * _keySize, NODE_ALIGNMENT);
+    return layout;
+}
+
 using namespace Memory::Literals;
 
 OrderedIndex::OrderedIndex (Storage *_owner, StandardLayout::FieldId _indexedField)
     : IndexBase (_owner),
       indexedField (_owner->GetRecordMapping ().GetField (_indexedField)),
-      records (Memory::Profiler::AllocationGroup {"Ordering"_us}),
+      keySize (indexedField.GetSize ()),
+      leafLayout (CalculateLeafLayout (keySize)),
+      innerNodeLayout (CalculateInnerNodeLayout (keySize)),
+      leafPool (Memory::Profiler::AllocationGroup {"Leaves"_us}, leafLayout.size, NODE_ALIGNMENT),
+      innerNodePool (Memory::Profiler::AllocationGroup {"InnerNodes"_us}, innerNodeLayout.size, NODE_ALIGNMENT),
+      massInsertionBuffer (Memory::Profiler::AllocationGroup {"MassInsertion"_us}),
+      rebuildBuffer (Memory::Profiler::AllocationGroup {"Rebuild"_us}),
       changedRecords (Memory::Profiler::AllocationGroup {"ChangedRecords"_us}),
-      deletedRecordIndices (Memory::Profiler::AllocationGroup {"DeletedIndices"_us})
+      dirtyLeaves (Memory::Profiler::AllocationGroup {"DirtyLeaves"_us})
 {
     EMERGENCE_ASSERT (indexedField.IsHandleValid ());
+    Reset ();
 }
 
 OrderedIndex::InternalLookupResult OrderedIndex::InternalLookup (const OrderedIndex::Bound &_min,
@@ -353,55 +343,161 @@ OrderedIndex::InternalLookupResult OrderedIndex::InternalLookup (const OrderedIn
         {
             EMERGENCE_ASSERT (!_min.boundValue || !_max.boundValue ||
                               _comparator.Compare (_min.boundValue, _max.boundValue) <= 0);
-            InternalLookupResult result {records.begin (), records.end ()};
+            InternalLookupResult result {Normalize ({firstLeaf, 0u}), {}};
 
             if (_min.boundValue)
             {
-                result.begin =
-                    std::lower_bound (records.begin (), records.end (), _min, Comparator (this, _comparator));
+                result.begin = Normalize (Descend<false> (_comparator, _min.boundValue));
             }
 
             if (_max.boundValue)
             {
-                result.end = std::upper_bound (result.begin, records.end (), _max, Comparator (this, _comparator));
+                result.end = Normalize (Descend<true> (_comparator, _max.boundValue));
             }
 
             return result;
         });
 }
 
-Container::Vector<const void *>::const_iterator OrderedIndex::LocateRecord (const void *_record,
-                                                                            const void *_recordBackup) const noexcept
+template <bool Upper, typename BaseComparator>
+OrderedIndex::Position OrderedIndex::Descend (const BaseComparator &_comparator, const void *_value) const noexcept
 {
-    auto iterator = DoWithCorrectComparator (indexedField,
-                                             [this, _record, _recordBackup] (auto _comparator)
-                                             {
-                                                 return std::lower_bound (records.begin (), records.end (),
-                                                                          RecordWithBackup {_record, _recordBackup},
-                                                                          Comparator (this, _comparator));
-                                             });
+    // Binary search for the first key, that should not be placed before given value.
+    auto search = [this, &_comparator, _value] (const std::uint8_t *_keys, std::size_t _count)
+    {
+        std::size_t begin = 0u;
+        while (_count > 0u)
+        {
+            const std::size_t step = _count / 2u;
+            const int result = _comparator.Compare (_keys + (begin + step) * keySize, _value);
 
-    EMERGENCE_ASSERT (iterator != records.end ());
+            if (Upper ? result <= 0 : result < 0)
+            {
+                begin += step + 1u;
+                _count -= step + 1u;
+            }
+            else
+            {
+                _count = step;
+            }
+        }
 
-    while (*iterator != _record)
+        return begin;
+    };
+
+    Node *node = root;
+    for (std::size_t level = 1u; level < height; ++level)
     {
-        ++iterator;
-        EMERGENCE_ASSERT (iterator != records.end ());
+        auto *inner = static_cast<InnerNode *> (node);
+        node = GetChildren (inner)[search (GetInnerKey (inner, 0u), inner->count)];
     }
 
-    return iterator;
+    auto *leaf = static_cast<Leaf *> (node);
+    return {leaf, search (GetLeafKey (leaf, 0u), leaf->count)};
+}
+
+OrderedIndex::Position OrderedIndex::Normalize (Position _position) const noexcept
+{
+    if (_position.leaf && _position.slot == _position.leaf->count)
+    {
+        return {_position.leaf->next, 0u};
+    }
+
+    return _position;
+}
+
+OrderedIndex::Position OrderedIndex::LocateRecord (const void *_record, const void *_recordBackup) const noexcept
+{
+    // Leaves store value copies, therefore we can search using backup value even if record is already changed.
+    Position position = DoWithCorrectComparator (indexedField,
+                                                 [this, _recordBackup] (auto _comparator)
+                                                 {
+                                                     return Normalize (Descend<false> (
+                                                         _comparator, indexedField.GetValue (_recordBackup)));
+                                                 });
+
+    EMERGENCE_ASSERT (position.leaf);
+    while (GetRecord (position) != _record)
+    {
+        position = Next (position);
+        EMERGENCE_ASSERT (position.leaf);
+    }
+
+    return position;
+}
+
+OrderedIndex::Position OrderedIndex::Next (Position _position) const noexcept
+{
+    EMERGENCE_ASSERT (_position.leaf);
+    EMERGENCE_ASSERT (_position.slot < _position.leaf->count);
+    ++_position.slot;
+    return Normalize (_position);
+}
+
+OrderedIndex::Position OrderedIndex::Previous (Position _position) const noexcept
+{
+    if (_position.slot > 0u)
+    {
+        --_position.slot;
+        return _position;
+    }
+
+    // Outside position is located after the last record, therefore previous position is the last record.
+    Leaf *previous = _position.leaf ? _position.leaf->previous : lastLeaf;
+    if (previous && previous->count > 0u)
+    {
+        return {previous, previous->count - 1u};
+    }
+
+    return {};
+}
+
+const void *OrderedIndex::GetRecord (const Position &_position) const noexcept
+{
+    EMERGENCE_ASSERT (_position.leaf);
+    EMERGENCE_ASSERT (_position.slot < _position.leaf->count);
+    return GetLeafRecords (_position.leaf)[_position.slot];
+}
+
+const void **OrderedIndex::GetLeafRecords (Leaf *_leaf) const noexcept
+{
+    EMERGENCE_ASSERT (_leaf);
+    return reinterpret_cast<const void **> (reinterpret_cast<std::uint8_t *> (_leaf) + sizeof (Leaf));
+}
+
+std::uint8_t *OrderedIndex::GetLeafKey (Leaf *_leaf, std::size_t _slot) const noexcept
+{
+    EMERGENCE_ASSERT (_leaf);
+    EMERGENCE_ASSERT (_slot <= leafLayout.capacity);
+    return reinterpret_cast<std::uint8_t *> (_leaf) + leafLayout.keysOffset + _slot * keySize;
+}
+
+OrderedIndex::Node **OrderedIndex::GetChildren (InnerNode *_node) const noexcept
+{
+    EMERGENCE_ASSERT (_node);
+    return reinterpret_cast<Node **> (reinterpret_cast<std::uint8_t *> (_node) + sizeof (InnerNode));
+}
+
+std::uint8_t *OrderedIndex::GetInnerKey (InnerNode *_node, std::size_t _index) const noexcept
+{
+    EMERGENCE_ASSERT (_node);
+    EMERGENCE_ASSERT (_index <= innerNodeLayout.capacity);
+    return reinterpret_cast<std::uint8_t *> (_node) + innerNodeLayout.keysOffset + _index * keySize;
 }
 
 void OrderedIndex::InsertRecord (const void *_record) noexcept
 {
     EMERGENCE_ASSERT (_record);
-    DoWithCorrectComparator (indexedField,
-                             [this, _record] (auto _comparator)
-                             {
-                                 auto place = std::upper_bound (records.begin (), records.end (), _record,
-                                                                Comparator (this, _comparator));
-                                 records.insert (place, _record);
-                             });
+    const void *key = indexedField.GetValue (_record);
+
+    // Unlike lookups, insertion needs raw position: placing record into the next leaf could break separator order.
+    const Position position = DoWithCorrectComparator (indexedField,
+                                                       [this, key] (auto _comparator)
+                                                       {
+                                                           return Descend<true> (_comparator, key);
+                                                       });
+
+    InsertToLeaf (position.leaf, position.slot, _record, key);
 }
 
 OrderedIndex::MassInsertionExecutor OrderedIndex::StartMassInsertion () noexcept
@@ -409,166 +505,431 @@ OrderedIndex::MassInsertionExecutor OrderedIndex::StartMassInsertion () noexcept
     return MassInsertionExecutor (this);
 }
 
+void OrderedIndex::InsertRecords (const Container::Vector<const void *> &_records) noexcept
+{
+    if (static_cast<float> (_records.size ()) >=
+        static_cast<float> (_records.size () + recordCount) *
+            Constants::OrderedIndex::MINIMUM_CHANGED_RECORDS_RATIO_TO_TRIGGER_FULL_RESORT)
+    {
+        MassInsertionExecutor executor = StartMassInsertion ();
+        for (const void *record : _records)
+        {
+            executor.InsertRecord (record);
+        }
+    }
+    else
+    {
+        for (const void *record : _records)
+        {
+            InsertRecord (record);
+        }
+    }
+}
+
 void OrderedIndex::OnRecordDeleted (const void *_record, const void *_recordBackup) noexcept
 {
     EMERGENCE_ASSERT (!hasEditCursor);
-    auto iterator = LocateRecord (_record, _recordBackup);
-    EMERGENCE_ASSERT (iterator != records.end ());
-    records.erase (iterator);
+    EraseFromLeaf (LocateRecord (_record, _recordBackup));
 }
 
-void OrderedIndex::DeleteRecordMyself (const Container::Vector<const void *>::iterator &_position) noexcept
+void OrderedIndex::DeleteRecordMyself (const Position &_position) noexcept
 {
-    EMERGENCE_ASSERT (_position != records.end ());
-    std::size_t index = _position - records.begin ();
+    // Tree structure can not be changed while cursor is open, therefore we only clear slot and erase it later.
+    const void *&slot = GetLeafRecords (_position.leaf)[_position.slot];
+    void *record = const_cast<void *> (slot);
+    EMERGENCE_ASSERT (record);
 
-    EMERGENCE_ASSERT (deletedRecordIndices.empty () || index > deletedRecordIndices.back ());
-    deletedRecordIndices.emplace_back (index);
-    storage->DeleteRecord (const_cast<void *> (*_position), this);
+    slot = nullptr;
+    MarkLeafDirty (_position.leaf);
+    storage->DeleteRecord (record, this);
 }
 
-void OrderedIndex::DeleteRecordMyself (const Container::Vector<const void *>::reverse_iterator &_position) noexcept
+void OrderedIndex::OnRecordChanged (const void *_record, const void *_recordBackup) noexcept
+{
+    EMERGENCE_ASSERT (!hasEditCursor);
+    EraseFromLeaf (LocateRecord (_record, _recordBackup));
+    changedRecords.emplace_back (_record);
+}
+
+void OrderedIndex::OnRecordChangedByMe (const Position &_position) noexcept
 {
-    EMERGENCE_ASSERT (_position != records.rend ());
-    std::size_t index = records.rend () - _position - 1u;
+    const void *&slot = GetLeafRecords (_position.leaf)[_position.slot];
+    EMERGENCE_ASSERT (slot);
+    changedRecords.emplace_back (slot);
 
-    EMERGENCE_ASSERT (deletedRecordIndices.empty () || index < deletedRecordIndices.front ());
-    deletedRecordIndices.emplace (deletedRecordIndices.begin (), index);
-    storage->DeleteRecord (const_cast<void *> (*_position), this);
+    slot = nullptr;
+    MarkLeafDirty (_position.leaf);
 }
 
-void OrderedIndex::OnRecordChanged (const void *_record, const void *_recordBackup) noexcept
+void OrderedIndex::OnWriterClosed () noexcept
 {
-    EMERGENCE_ASSERT (!hasEditCursor);
-    auto iterator = LocateRecord (_record, _recordBackup);
-    EMERGENCE_ASSERT (iterator != records.end ());
+    EMERGENCE_ASSERT (hasEditCursor || dirtyLeaves.empty ());
+    for (Leaf *leaf : dirtyLeaves)
+    {
+        CompactLeaf (leaf);
+    }
+
+    dirtyLeaves.clear ();
+    if (!changedRecords.empty ())
+    {
+        InsertRecords (changedRecords);
+        changedRecords.clear ();
+    }
 
-    changedRecords.emplace_back (ChangedRecordInfo {std::numeric_limits<std::size_t>::max (), (_record)});
-    records.erase (iterator);
+    hasEditCursor = false;
 }
 
-void OrderedIndex::OnRecordChangedByMe (const Container::Vector<const void *>::iterator &_position) noexcept
+void OrderedIndex::Clear () noexcept
 {
-    EMERGENCE_ASSERT (_position != records.end ());
-    std::size_t index = _position - records.begin ();
+    EMERGENCE_ASSERT (changedRecords.empty ());
+    EMERGENCE_ASSERT (dirtyLeaves.empty ());
+    Reset ();
+}
 
-    EMERGENCE_ASSERT (changedRecords.empty () || index > changedRecords.back ().originalIndex);
-    changedRecords.emplace_back (ChangedRecordInfo {index, *_position});
+OrderedIndex::Leaf *OrderedIndex::AllocateLeaf () noexcept
+{
+    return new (leafPool.Acquire ()) Leaf ();
 }
 
-void OrderedIndex::OnRecordChangedByMe (const Container::Vector<const void *>::reverse_iterator &_position) noexcept
+OrderedIndex::InnerNode *OrderedIndex::AllocateInnerNode () noexcept
 {
-    EMERGENCE_ASSERT (_position != records.rend ());
-    std::size_t index = records.rend () - _position - 1u;
-    EMERGENCE_ASSERT (changedRecords.empty () || index < changedRecords.front ().originalIndex);
-    changedRecords.emplace (changedRecords.begin (), ChangedRecordInfo {index, *_position});
+    return new (innerNodePool.Acquire ()) InnerNode ();
 }
 
-void OrderedIndex::OnWriterClosed () noexcept
+void OrderedIndex::InsertToLeaf (Leaf *_leaf, std::size_t _slot, const void *_record, const void *_key) noexcept
 {
-    if (hasEditCursor && (!changedRecords.empty () || !deletedRecordIndices.empty ()))
+    EMERGENCE_ASSERT (_leaf);
+    EMERGENCE_ASSERT (_slot <= _leaf->count);
+    EMERGENCE_ASSERT (_leaf->count <= leafLayout.capacity);
+
+    const std::size_t tail = _leaf->count - _slot;
+    const void **records = GetLeafRecords (_leaf);
+    memmove (records + _slot + 1u, records + _slot, tail * sizeof (const void *));
+    records[_slot] = _record;
+
+    std::uint8_t *key = GetLeafKey (_leaf, _slot);
+    memmove (key + keySize, key, tail * keySize);
+    memcpy (key, _key, keySize);
+
+    ++_leaf->count;
+    ++recordCount;
+
+    if (_leaf->count > leafLayout.capacity)
     {
-        auto changedRecordsIterator = changedRecords.begin ();
-        const auto changedRecordsEnd = changedRecords.end ();
+        SplitLeaf (_leaf);
+    }
+}
 
-        auto deletedRecordsIterator = deletedRecordIndices.begin ();
-        const auto deletedRecordsEnd = deletedRecordIndices.end ();
+void OrderedIndex::SplitLeaf (Leaf *_leaf) noexcept
+{
+    Leaf *right = AllocateLeaf ();
+    const std::size_t leftCount = _leaf->count / 2u;
+    const std::size_t rightCount = _leaf->count - leftCount;
 
-        auto advanceToNextCheckpoint = [&changedRecordsIterator, &changedRecordsEnd, &deletedRecordsIterator,
-                                        &deletedRecordsEnd] () -> std::size_t
-        {
-            std::size_t nextCheckpoint;
-            if (changedRecordsIterator != changedRecordsEnd)
-            {
-                if (deletedRecordsIterator != deletedRecordsEnd &&
-                    *deletedRecordsIterator < changedRecordsIterator->originalIndex)
-                {
-                    nextCheckpoint = *deletedRecordsIterator;
-                    ++deletedRecordsIterator;
-                }
-                else
-                {
-                    nextCheckpoint = changedRecordsIterator->originalIndex;
-                    ++changedRecordsIterator;
-                }
-            }
-            else
-            {
-                EMERGENCE_ASSERT (deletedRecordsIterator != deletedRecordsEnd);
-                nextCheckpoint = *deletedRecordsIterator;
-                ++deletedRecordsIterator;
-            }
+    memcpy (GetLeafRecords (right), GetLeafRecords (_leaf) + leftCount, rightCount * sizeof (const void *));
+    memcpy (GetLeafKey (right, 0u), GetLeafKey (_leaf, leftCount), rightCount * keySize);
+    _leaf->count = leftCount;
+    right->count = rightCount;
 
-            return nextCheckpoint;
-        };
+    right->previous = _leaf;
+    right->next = _leaf->next;
 
-        std::size_t offset = 0u;
-        std::size_t intervalBegin = advanceToNextCheckpoint ();
-        std::size_t intervalEnd;
+    if (_leaf->next)
+    {
+        _leaf->next->previous = right;
+    }
+    else
+    {
+        lastLeaf = right;
+    }
 
-        auto offsetInterval = [this, &intervalBegin, &intervalEnd, &offset] () -> void
-        {
-            std::size_t intervalSize = intervalEnd - intervalBegin - 1u;
-            EMERGENCE_ASSERT (intervalSize == 0u || intervalBegin + 1u < records.size ());
+    _leaf->next = right;
+    InsertToParent (_leaf, GetLeafKey (right, 0u), right);
+}
 
-#if defined(EMERGENCE_ASSERT_ENABLED)
-            // Interval begin can be out of bounds only if interval size is zero. It's ok, because memcpy skips
-            // zero-size intervals. But debug version of Container::Vector throws out of bounds exception, therefore
-            // we add this `if` in debug build. In release build it's skipped to improve performance.
-            if (intervalBegin + 1u < records.size ())
-            {
-#endif
-                memcpy (&records[intervalBegin - offset], &records[intervalBegin + 1u], intervalSize * sizeof (void *));
-#if defined(EMERGENCE_ASSERT_ENABLED)
-            }
-#endif
+void OrderedIndex::InsertToParent (Node *_left, const void *_key, Node *_right) noexcept
+{
+    InnerNode *parent = _left->parent;
+    if (!parent)
+    {
+        EMERGENCE_ASSERT (_left == root);
+        parent = AllocateInnerNode ();
+        GetChildren (parent)[0u] = _left;
+        _left->parent = parent;
+
+        root = parent;
+        ++height;
+    }
+
+    Node **children = GetChildren (parent);
+    std::size_t index = 0u;
+
+    while (children[index] != _left)
+    {
+        ++index;
+        EMERGENCE_ASSERT (index <= parent->count);
+    }
+
+    const std::size_t tail = parent->count - index;
+    memmove (children + index + 2u, children + index + 1u, tail * sizeof (Node *));
+    children[index + 1u] = _right;
+    _right->parent = parent;
 
-            ++offset;
-        };
+    std::uint8_t *key = GetInnerKey (parent, index);
+    memmove (key + keySize, key, tail * keySize);
+    memcpy (key, _key, keySize);
+    ++parent->count;
 
-        while (changedRecordsIterator != changedRecordsEnd || deletedRecordsIterator != deletedRecordsEnd)
+    if (parent->count > innerNodeLayout.capacity)
+    {
+        // Middle key goes up to the grandparent, keys after it and their children go to the new sibling.
+        InnerNode *sibling = AllocateInnerNode ();
+        const std::size_t middle = parent->count / 2u;
+        const std::size_t siblingCount = parent->count - middle - 1u;
+
+        Node **siblingChildren = GetChildren (sibling);
+        memcpy (siblingChildren, children + middle + 1u, (siblingCount + 1u) * sizeof (Node *));
+        memcpy (GetInnerKey (sibling, 0u), GetInnerKey (parent, middle + 1u), siblingCount * keySize);
+
+        for (std::size_t childIndex = 0u; childIndex <= siblingCount; ++childIndex)
         {
-            intervalEnd = advanceToNextCheckpoint ();
-            offsetInterval ();
-            intervalBegin = intervalEnd;
+            siblingChildren[childIndex]->parent = sibling;
         }
 
-        intervalEnd = records.size ();
-        offsetInterval ();
-        records.resize (intervalEnd - offset);
-        deletedRecordIndices.clear ();
+        sibling->count = siblingCount;
+        parent->count = middle;
+
+        // Middle key is still stored in parent memory, because parent count is decreased without erasing keys.
+        InsertToParent (parent, GetInnerKey (parent, middle), sibling);
     }
+}
 
-    if (!changedRecords.empty ())
+void OrderedIndex::EraseFromLeaf (const Position &_position) noexcept
+{
+    Leaf *leaf = _position.leaf;
+    EMERGENCE_ASSERT (leaf);
+    EMERGENCE_ASSERT (_position.slot < leaf->count);
+
+    const std::size_t tail = leaf->count - _position.slot - 1u;
+    const void **records = GetLeafRecords (leaf);
+    memmove (records + _position.slot, records + _position.slot + 1u, tail * sizeof (const void *));
+
+    std::uint8_t *key = GetLeafKey (leaf, _position.slot);
+    memmove (key, key + keySize, tail * keySize);
+
+    --leaf->count;
+    --recordCount;
+    RebalanceLeaf (leaf);
+}
+
+void OrderedIndex::RebalanceLeaf (Leaf *_leaf) noexcept
+{
+    // Root leaf is allowed to be sparse or even empty.
+    if (!_leaf->parent)
+    {
+        return;
+    }
+
+    if (_leaf->count == 0u)
+    {
+        RemoveLeaf (_leaf);
+        return;
+    }
+
+    Leaf *next = _leaf->next;
+    if (static_cast<float> (_leaf->count) <
+            static_cast<float> (leafLayout.capacity) * Constants::OrderedIndex::SPARSE_LEAF_FILL_RATIO &&
+        next && next->parent == _leaf->parent && _leaf->count + next->count <= leafLayout.capacity)
+    {
+        const void **nextRecords = GetLeafRecords (next);
+        memmove (nextRecords + _leaf->count, nextRecords, next->count * sizeof (const void *));
+        memcpy (nextRecords, GetLeafRecords (_leaf), _leaf->count * sizeof (const void *));
+
+        std::uint8_t *nextKeys = GetLeafKey (next, 0u);
+        memmove (nextKeys + _leaf->count * keySize, nextKeys, next->count * keySize);
+        memcpy (nextKeys, GetLeafKey (_leaf, 0u), _leaf->count * keySize);
+
+        next->count += _leaf->count;
+        _leaf->count = 0u;
+        RemoveLeaf (_leaf);
+    }
+}
+
+void OrderedIndex::RemoveLeaf (Leaf *_leaf) noexcept
+{
+    EMERGENCE_ASSERT (_leaf->parent);
+    if (_leaf->previous)
+    {
+        _leaf->previous->next = _leaf->next;
+    }
+    else
+    {
+        firstLeaf = _leaf->next;
+    }
+
+    if (_leaf->next)
+    {
+        _leaf->next->previous = _leaf->previous;
+    }
+    else
+    {
+        lastLeaf = _leaf->previous;
+    }
+
+    RemoveChild (_leaf->parent, _leaf);
+    leafPool.Release (_leaf);
+}
+
+void OrderedIndex::RemoveChild (InnerNode *_node, Node *_child) noexcept
+{
+    if (_node->count == 0u)
+    {
+        // Removed child is the only child of this node, therefore this node should be removed too.
+        // Root always has at least two children, because otherwise it is replaced by its child.
+        EMERGENCE_ASSERT (_node->parent);
+        RemoveChild (_node->parent, _node);
+        innerNodePool.Release (_node);
+        return;
+    }
+
+    Node **children = GetChildren (_node);
+    std::size_t index = 0u;
+
+    while (children[index] != _child)
+    {
+        ++index;
+        EMERGENCE_ASSERT (index <= _node->count);
+    }
+
+    memmove (children + index, children + index + 1u, (_node->count - index) * sizeof (Node *));
+
+    // Removed child is either empty or merged into the next child, therefore we remove separator after it.
+    // If there is no next child, separator before removed child is removed instead.
+    const std::size_t keyIndex = index < _node->count ? index : index - 1u;
+    std::uint8_t *key = GetInnerKey (_node, keyIndex);
+    memmove (key, key + keySize, (_node->count - keyIndex - 1u) * keySize);
+    --_node->count;
+
+    while (height > 1u && root->count == 0u)
+    {
+        auto *oldRoot = static_cast<InnerNode *> (root);
+        root = GetChildren (oldRoot)[0u];
+        root->parent = nullptr;
+
+        innerNodePool.Release (oldRoot);
+        --height;
+    }
+}
+
+void OrderedIndex::MarkLeafDirty (Leaf *_leaf) noexcept
+{
+    // Cursors visit leaves one by one, therefore it is enough to check only the last dirty leaf.
+    if (dirtyLeaves.empty () || dirtyLeaves.back () != _leaf)
+    {
+        dirtyLeaves.emplace_back (_leaf);
+    }
+}
+
+void OrderedIndex::CompactLeaf (Leaf *_leaf) noexcept
+{
+    const void **records = GetLeafRecords (_leaf);
+    std::size_t target = 0u;
+
+    for (std::size_t source = 0u; source < _leaf->count; ++source)
     {
-        if (static_cast<float> (changedRecords.size ()) >=
-            static_cast<float> (changedRecords.size () + records.size ()) *
-                Constants::OrderedIndex::MINIMUM_CHANGED_RECORDS_RATIO_TO_TRIGGER_FULL_RESORT)
+        if (records[source])
         {
-            MassInsertionExecutor executor = StartMassInsertion ();
-            for (const ChangedRecordInfo &info : changedRecords)
+            if (target != source)
             {
-                executor.InsertRecord (info.record);
+                records[target] = records[source];
+                memcpy (GetLeafKey (_leaf, target), GetLeafKey (_leaf, source), keySize);
             }
+
+            ++target;
         }
-        else
+    }
+
+    recordCount -= _leaf->count - target;
+    _leaf->count = target;
+    RebalanceLeaf (_leaf);
+}
+
+void OrderedIndex::Reset () noexcept
+{
+    leafPool.Clear ();
+    innerNodePool.Clear ();
+
+    Leaf *leaf = AllocateLeaf ();
+    root = leaf;
+    height = 1u;
+    firstLeaf = leaf;
+    lastLeaf = leaf;
+    recordCount = 0u;
+}
+
+void OrderedIndex::Rebuild () noexcept
+{
+    if (massInsertionBuffer.empty ())
+    {
+        return;
+    }
+
+    // Records in tree are already sorted, therefore only inserted records are sorted and then merged with them
+    // straight from leaves. Merge target is preallocated, so merge never requests temporary buffers on its own.
+    rebuildBuffer.clear ();
+    rebuildBuffer.reserve (massInsertionBuffer.size () + recordCount);
+
+    DoWithCorrectComparator (
+        indexedField,
+        [this] (auto _comparator) -> void
         {
-            for (const ChangedRecordInfo &info : changedRecords)
+            const Comparator comparator (this, _comparator);
+            std::sort (massInsertionBuffer.begin (), massInsertionBuffer.end (), comparator);
+            auto inserted = massInsertionBuffer.begin ();
+
+            for (Leaf *leaf = firstLeaf; leaf; leaf = leaf->next)
             {
-                InsertRecord (info.record);
+                const void **records = GetLeafRecords (leaf);
+                for (std::size_t index = 0u; index < leaf->count; ++index)
+                {
+                    // Inserted records are placed before existing records with equal keys.
+                    while (inserted != massInsertionBuffer.end () && !comparator (records[index], *inserted))
+                    {
+                        rebuildBuffer.emplace_back (*inserted);
+                        ++inserted;
+                    }
+
+                    rebuildBuffer.emplace_back (records[index]);
+                }
             }
+
+            rebuildBuffer.insert (rebuildBuffer.end (), inserted, massInsertionBuffer.end ());
+        });
+
+    massInsertionBuffer.clear ();
+    Reset ();
+    auto *leaf = static_cast<Leaf *> (root);
+
+    for (const void *record : rebuildBuffer)
+    {
+        if (leaf->count == leafLayout.capacity)
+        {
+            Leaf *next = AllocateLeaf ();
+            next->previous = leaf;
+            leaf->next = next;
+            lastLeaf = next;
+
+            // Inner levels are much smaller than leaf level, therefore it is ok to build them through usual splits.
+            InsertToParent (leaf, GetLeafKey (leaf, leaf->count - 1u), next);
+            leaf = next;
         }
 
-        changedRecords.clear ();
+        GetLeafRecords (leaf)[leaf->count] = record;
+        memcpy (GetLeafKey (leaf, leaf->count), indexedField.GetValue (record), keySize);
+        ++leaf->count;
     }
 
-    hasEditCursor = false;
-}
-
-void OrderedIndex::Clear () noexcept
-{
-    EMERGENCE_ASSERT (changedRecords.empty ());
-    EMERGENCE_ASSERT (deletedRecordIndices.empty ());
-    records.clear ();
+    recordCount = rebuildBuffer.size ();
+    rebuildBuffer.clear ();
 }
 } // namespace Emergence::Pegasus
@@ -6,12 +6,34 @@
 
 #include <Handling/HandleableBase.hpp>
 
+#include <Memory/UnorderedPool.hpp>
+
 #include <Pegasus/IndexBase.hpp>
 
 namespace Emergence::Pegasus
 {
+/// \brief Stores records in B+ tree, ordered by indexed field value.
+/// \details Leaves store copies of indexed field values next to record pointers, therefore lookups and traversals
+///          do not touch records themselves. Leaves are linked into list, which is used by cursors to iterate
+///          records in both directions.
 class OrderedIndex final : public IndexBase
 {
+private:
+    struct Node;
+
+    struct Leaf;
+
+    struct InnerNode;
+
+    /// \brief Points to record slot inside leaf. If ::leaf is `nullptr`, position is outside of index.
+    struct Position final
+    {
+        bool operator== (const Position &_other) const noexcept = default;
+
+        Leaf *leaf = nullptr;
+        std::size_t slot = 0u;
+    };
+
 public:
     struct Bound final
     {
@@ -27,13 +49,11 @@ public:
     private:
         friend class OrderedIndex;
 
-        AscendingReadCursor (OrderedIndex *_index,
-                             Container::Vector<const void *>::const_iterator _begin,
-                             Container::Vector<const void *>::const_iterator _end) noexcept;
+        AscendingReadCursor (OrderedIndex *_index, Position _begin, Position _end) noexcept;
 
         OrderedIndex *index;
-        Container::Vector<const void *>::const_iterator current;
-        Container::Vector<const void *>::const_iterator end;
+        Position current;
+        Position end;
     };
 
     class AscendingEditCursor final
@@ -44,15 +64,13 @@ public:
     private:
         friend class OrderedIndex;
 
-        AscendingEditCursor (OrderedIndex *_index,
-                             Container::Vector<const void *>::iterator _begin,
-                             Container::Vector<const void *>::iterator _end) noexcept;
+        AscendingEditCursor (OrderedIndex *_index, Position _begin, Position _end) noexcept;
 
         void BeginRecordEdition () const noexcept;
 
         OrderedIndex *index;
-        Container::Vector<const void *>::iterator current;
-        Container::Vector<const void *>::iterator end;
+        Position current;
+        Position end;
     };
 
     class DescendingReadCursor final
@@ -63,13 +81,11 @@ public:
     private:
         friend class OrderedIndex;
 
-        DescendingReadCursor (OrderedIndex *_index,
-                              Container::Vector<const void *>::const_reverse_iterator _begin,
-                              Container::Vector<const void *>::const_reverse_iterator _end) noexcept;
+        DescendingReadCursor (OrderedIndex *_index, Position _begin, Position _end) noexcept;
 
         OrderedIndex *index;
-        Container::Vector<const void *>::const_reverse_iterator current;
-        Container::Vector<const void *>::const_reverse_iterator end;
+        Position current;
+        Position end;
     };
 
     class DescendingEditCursor final
@@ -80,15 +96,13 @@ public:
     private:
         friend class OrderedIndex;
 
-        DescendingEditCursor (OrderedIndex *_index,
-                              Container::Vector<const void *>::reverse_iterator _begin,
-                              Container::Vector<const void *>::reverse_iterator _end) noexcept;
+        DescendingEditCursor (OrderedIndex *_index, Position _begin, Position _end) noexcept;
 
         void BeginRecordEdition () const noexcept;
 
         OrderedIndex *index;
-        Container::Vector<const void *>::reverse_iterator current;
-        Container::Vector<const void *>::reverse_iterator end;
+        Position current;
+        Position end;
     };
 
     /// There is no sense to copy indices.
@@ -120,16 +134,21 @@ private:
 
     struct InternalLookupResult
     {
-        Container::Vector<const void *>::iterator begin;
-        Container::Vector<const void *>::iterator end;
+        Position begin;
+        Position end;
     };
 
-    struct ChangedRecordInfo
+    /// \brief Describes memory layout of leaves or inner nodes, which depends on indexed field size.
+    struct NodeLayout final
     {
-        /// \warning Correct only if edition was done using cursor from this index, see ::hasEditCursor.
-        std::size_t originalIndex;
+        /// \brief Maximum count of keys in node. Nodes have space for one more key, which triggers split.
+        std::size_t capacity = 0u;
 
-        const void *record;
+        /// \brief Offset of key array from node beginning.
+        std::size_t keysOffset = 0u;
+
+        /// \brief Full size of node in bytes.
+        std::size_t size = 0u;
     };
 
     class MassInsertionExecutor final
@@ -153,52 +172,129 @@ private:
         OrderedIndex *owner;
     };
 
+    static NodeLayout CalculateLeafLayout (std::size_t _keySize) noexcept;
+
+    static NodeLayout CalculateInnerNodeLayout (std::size_t _keySize) noexcept;
+
     OrderedIndex (Storage *_owner, StandardLayout::FieldId _indexedField);
 
     ~OrderedIndex () = default;
 
     InternalLookupResult InternalLookup (const Bound &_min, const Bound &_max) noexcept;
 
-    Container::Vector<const void *>::const_iterator LocateRecord (const void *_record,
-                                                                  const void *_recordBackup) const noexcept;
+    /// \brief Finds first slot, which value is greater than (if ::Upper) or not less than given value.
+    /// \details Returned slot might be equal to leaf record count, use ::Normalize to get valid position.
+    template <bool Upper, typename BaseComparator>
+    Position Descend (const BaseComparator &_comparator, const void *_value) const noexcept;
+
+    Position Normalize (Position _position) const noexcept;
+
+    Position LocateRecord (const void *_record, const void *_recordBackup) const noexcept;
+
+    Position Next (Position _position) const noexcept;
+
+    Position Previous (Position _position) const noexcept;
+
+    const void *GetRecord (const Position &_position) const noexcept;
+
+    const void **GetLeafRecords (Leaf *_leaf) const noexcept;
+
+    std::uint8_t *GetLeafKey (Leaf *_leaf, std::size_t _slot) const noexcept;
+
+    Node **GetChildren (InnerNode *_node) const noexcept;
+
+    std::uint8_t *GetInnerKey (InnerNode *_node, std::size_t _index) const noexcept;
 
     void InsertRecord (const void *_record) noexcept;
 
     MassInsertionExecutor StartMassInsertion () noexcept;
 
-    void OnRecordDeleted (const void *_record, const void *_recordBackup) noexcept;
+    /// \brief Inserts given records either one by one or through full rebuild, depending on their count.
+    void InsertRecords (const Container::Vector<const void *> &_records) noexcept;
 
-    void DeleteRecordMyself (const Container::Vector<const void *>::iterator &_position) noexcept;
+    void OnRecordDeleted (const void *_record, const void *_recordBackup) noexcept;
 
-    void DeleteRecordMyself (const Container::Vector<const void *>::reverse_iterator &_position) noexcept;
+    void DeleteRecordMyself (const Position &_position) noexcept;
 
     void OnRecordChanged (const void *_record, const void *_recordBackup) noexcept;
 
-    void OnRecordChangedByMe (const Container::Vector<const void *>::iterator &_position) noexcept;
-
-    void OnRecordChangedByMe (const Container::Vector<const void *>::reverse_iterator &_position) noexcept;
+    void OnRecordChangedByMe (const Position &_position) noexcept;
 
     void OnWriterClosed () noexcept;
 
     void Clear () noexcept;
 
+    Leaf *AllocateLeaf () noexcept;
+
+    InnerNode *AllocateInnerNode () noexcept;
+
+    void InsertToLeaf (Leaf *_leaf, std::size_t _slot, const void *_record, const void *_key) noexcept;
+
+    void SplitLeaf (Leaf *_leaf) noexcept;
+
+    void InsertToParent (Node *_left, const void *_key, Node *_right) noexcept;
+
+    void EraseFromLeaf (const Position &_position) noexcept;
+
+    /// \brief Releases given leaf if it is empty or merges it into next leaf if it is too sparse.
+    void RebalanceLeaf (Leaf *_leaf) noexcept;
+
+    void RemoveLeaf (Leaf *_leaf) noexcept;
+
+    void RemoveChild (InnerNode *_node, Node *_child) noexcept;
+
+    void MarkLeafDirty (Leaf *_leaf) noexcept;
+
+    /// \brief Erases records, that were deleted or changed by cursor of this index, from given leaf.
+    void CompactLeaf (Leaf *_leaf) noexcept;
+
+    /// \brief Releases all nodes and creates empty root leaf.
+    void Reset () noexcept;
+
+    /// \brief Sorts ::massInsertionBuffer, merges it with records from tree into ::rebuildBuffer
+    ///        and builds new tree bottom-up.
+    void Rebuild () noexcept;
+
     StandardLayout::Field indexedField;
-    Container::Vector<const void *> records;
+
+    /// \brief Size of indexed field value copies, stored inside nodes.
+    std::size_t keySize;
+
+    NodeLayout leafLayout;
+    NodeLayout innerNodeLayout;
+
+    Memory::UnorderedPool leafPool;
+    Memory::UnorderedPool innerNodePool;
+
+    Node *root = nullptr;
+
+    /// \brief Count of levels in tree, including leaf level.
+    std::size_t height = 1u;
+
+    Leaf *firstLeaf = nullptr;
+    Leaf *lastLeaf = nullptr;
+    std::size_t recordCount = 0u;
+
+    Container::Vector<const void *> massInsertionBuffer;
+
+    /// \brief Merge result of ::Rebuild. Stored as field to reuse its memory during next rebuilds.
+    Container::Vector<const void *> rebuildBuffer;
 
     /// \brief Debug-only, used to assert that there is always not more than one MassInsertionExecutor.
     bool massInsertionInProgress = false;
 
     /// If edition is done by cursor from this index, we should execute deletion and reinsertion after cursor is closed,
-    /// because it allows to save time on ::records vector content shifts. It is safe, because edition by own cursor
-    /// does not trigger any lookups.
+    /// because modifying tree structure would invalidate cursor position. Therefore deleted and changed records are
+    /// only marked by `nullptr` in their slots and their leaves are saved into ::dirtyLeaves. It is safe, because
+    /// edition by own cursor does not trigger any lookups.
     ///
     /// Edition by cursors from other indices will trigger lookup for each deletion or edition, therefore we need to
-    /// keep ::records order correct and execute deletions right away. Edited records are deleted right away too, but
+    /// keep tree correct and execute deletions right away. Edited records are deleted right away too, but
     /// reinserted only after edit cursor is closed. This behaviour allows us to use mass insertion optimization
     /// even if edition was done using cursor from other index.
     bool hasEditCursor = false;
 
-    Container::Vector<ChangedRecordInfo> changedRecords;
-    Container::Vector<std::size_t> deletedRecordIndices;
+    Container::Vector<const void *> changedRecords;
+    Container::Vector<Leaf *> dirtyLeaves;
 };
 } // namespace Emergence::Pegasus
@@ -97,7 +97,8 @@ Storage::Storage (StandardLayout::Mapping _recordMapping) noexcept
       orderedIndexHeap (Memory::Profiler::AllocationGroup {"OrderedIndex"_us}),
       signalIndexHeap (Memory::Profiler::AllocationGroup {"SignalIndex"_us}),
       volumetricIndexHeap (Memory::Profiler::AllocationGroup {"VolumetricIndex"_us}),
-      recordMapping (std::move (_recordMapping))
+      recordMapping (std::move (_recordMapping)),
+      bulkInsertionRecords (Memory::Profiler::AllocationGroup {"BulkInsertion"_us})
 {
     editedRecordBackup = records.Acquire ();
 }
@@ -151,6 +152,15 @@ Storage::Allocator Storage::AllocateAndInsert () noexcept
     return Allocator (this);
 }
 
+Storage::Allocator Storage::AllocateAndInsertBulk () noexcept
+{
+    Allocator allocator {this};
+    // Allocator has already registered itself as writer, therefore there is no other bulk insertion.
+    EMERGENCE_ASSERT (!bulkInsertionInProgress);
+    bulkInsertionInProgress = true;
+    return allocator;
+}
+
 Handling::Handle<HashIndex> Storage::CreateHashIndex (
     const Container::Vector<StandardLayout::FieldId> &_indexedFields) noexcept
 {
@@ -337,6 +347,9 @@ void Storage::Clear () noexcept
 
     records.Clear ();
 
+    // Edited record backup is allocated from records pool too, therefore it must be acquired again.
+    editedRecordBackup = records.Acquire ();
+
     // Clear index content.
     for (auto &[index, mask] : hashIndices)
     {
@@ -383,6 +396,11 @@ void Storage::UnregisterWriter () noexcept
     EMERGENCE_ASSERT (writers == 1u);
     --writers;
 
+    if (bulkInsertionInProgress)
+    {
+        FinishBulkInsertion ();
+    }
+
     VisitEveryIndex (
         [] (auto *_index, Constants::Storage::IndexedFieldMask /*unused*/)
         {
@@ -407,6 +425,12 @@ void Storage::InsertRecord (const void *_record) noexcept
     EMERGENCE_ASSERT (readers == 0u);
     EMERGENCE_ASSERT (writers == 1u);
 
+    if (bulkInsertionInProgress)
+    {
+        bulkInsertionRecords.emplace_back (_record);
+        return;
+    }
+
     VisitEveryIndex (
         [_record] (auto *_index, Constants::Storage::IndexedFieldMask /*unused*/)
         {
@@ -414,6 +438,45 @@ void Storage::InsertRecord (const void *_record) noexcept
         });
 }
 
+void Storage::FinishBulkInsertion () noexcept
+{
+    EMERGENCE_ASSERT (bulkInsertionInProgress);
+    bulkInsertionInProgress = false;
+
+    // Indices are updated one by one instead of record by record, so only one index is hot in cache at a time.
+    for (auto &[index, mask] : hashIndices)
+    {
+        index->Reserve (bulkInsertionRecords.size ());
+        for (const void *record : bulkInsertionRecords)
+        {
+            index->InsertRecord (record);
+        }
+    }
+
+    for (auto &[index, mask] : orderedIndices)
+    {
+        index->InsertRecords (bulkInsertionRecords);
+    }
+
+    for (auto &[index, mask] : signalIndices)
+    {
+        for (const void *record : bulkInsertionRecords)
+        {
+            index->InsertRecord (record);
+        }
+    }
+
+    for (auto &[index, mask] : volumetricIndices)
+    {
+        for (const void *record : bulkInsertionRecords)
+        {
+            index->InsertRecord (record);
+        }
+    }
+
+    bulkInsertionRecords.clear ();
+}
+
 void Storage::DeleteRecord (void *_record, const void *_requestedByIndex) noexcept
 {
     EMERGENCE_ASSERT (_record);
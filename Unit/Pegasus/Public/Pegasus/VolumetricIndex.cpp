@@ -4,13 +4,116 @@
 
 #include <API/Common/BlockCast.hpp>
 
+#include <Pegasus/BoundsIntersection.hpp>
 #include <Pegasus/Storage.hpp>
 #include <Pegasus/VolumetricIndex.hpp>
 
 namespace Emergence::Pegasus
 {
-template <std::size_t Dimensions>
-const Container::Vector<const void *> *PartitioningTree<Dimensions>::ShapeEnumerator::operator* () const noexcept
+template <typename Unit, std::size_t Dimensions>
+PartitioningTree<Unit, Dimensions>::RecordList::RecordList (
+    const Memory::Profiler::AllocationGroup &_group) noexcept
+    : records (_group),
+      shapes (_group)
+{
+    static_assert (BLOCK_SIZE == BOUNDS_BLOCK_LANES);
+}
+
+template <typename Unit, std::size_t Dimensions>
+std::size_t PartitioningTree<Unit, Dimensions>::RecordList::GetCount () const noexcept
+{
+    return records.size ();
+}
+
+template <typename Unit, std::size_t Dimensions>
+bool PartitioningTree<Unit, Dimensions>::RecordList::IsEmpty () const noexcept
+{
+    return records.empty ();
+}
+
+template <typename Unit, std::size_t Dimensions>
+const void *PartitioningTree<Unit, Dimensions>::RecordList::GetRecord (std::size_t _index) const noexcept
+{
+    EMERGENCE_ASSERT (_index < records.size ());
+    return records[_index];
+}
+
+template <typename Unit, std::size_t Dimensions>
+const Unit *PartitioningTree<Unit, Dimensions>::RecordList::GetBlock (std::size_t _blockIndex) const noexcept
+{
+    EMERGENCE_ASSERT ((_blockIndex + 1u) * BLOCK_STRIDE <= shapes.size ());
+    return shapes.data () + _blockIndex * BLOCK_STRIDE;
+}
+
+template <typename Unit, std::size_t Dimensions>
+std::size_t PartitioningTree<Unit, Dimensions>::RecordList::Find (const void *_record) const noexcept
+{
+    return static_cast<std::size_t> (std::find (records.begin (), records.end (), _record) - records.begin ());
+}
+
+template <typename Unit, std::size_t Dimensions>
+void PartitioningTree<Unit, Dimensions>::RecordList::Add (const void *_record, const UnitShape &_shape) noexcept
+{
+    const std::size_t index = records.size ();
+    records.emplace_back (_record);
+
+    if (index % BLOCK_SIZE == 0u)
+    {
+        shapes.resize (shapes.size () + BLOCK_STRIDE);
+    }
+
+    SetShape (index, _shape);
+}
+
+template <typename Unit, std::size_t Dimensions>
+void PartitioningTree<Unit, Dimensions>::RecordList::SetShape (std::size_t _index, const UnitShape &_shape) noexcept
+{
+    EMERGENCE_ASSERT (_index < records.size ());
+    for (std::size_t dimension = 0u; dimension < Dimensions; ++dimension)
+    {
+        AccessBorder (_index, dimension * 2u) = _shape.bounds[dimension].min;
+        AccessBorder (_index, dimension * 2u + 1u) = _shape.bounds[dimension].max;
+    }
+}
+
+template <typename Unit, std::size_t Dimensions>
+void PartitioningTree<Unit, Dimensions>::RecordList::EraseExchangingWithLast (std::size_t _index) noexcept
+{
+    EMERGENCE_ASSERT (_index < records.size ());
+    const std::size_t lastIndex = records.size () - 1u;
+
+    if (_index != lastIndex)
+    {
+        records[_index] = records[lastIndex];
+        for (std::size_t border = 0u; border < Dimensions * 2u; ++border)
+        {
+            AccessBorder (_index, border) = AccessBorder (lastIndex, border);
+        }
+    }
+
+    records.pop_back ();
+    if (lastIndex % BLOCK_SIZE == 0u)
+    {
+        shapes.resize (shapes.size () - BLOCK_STRIDE);
+    }
+}
+
+template <typename Unit, std::size_t Dimensions>
+void PartitioningTree<Unit, Dimensions>::RecordList::Clear () noexcept
+{
+    records.clear ();
+    shapes.clear ();
+}
+
+template <typename Unit, std::size_t Dimensions>
+Unit &PartitioningTree<Unit, Dimensions>::RecordList::AccessBorder (std::size_t _index, std::size_t _border) noexcept
+{
+    return shapes[(_index / BLOCK_SIZE) * BLOCK_STRIDE + _border * BLOCK_SIZE + _index % BLOCK_SIZE];
+}
+
+template <typename Unit, std::size_t Dimensions>
+const typename PartitioningTree<Unit, Dimensions>::RecordList *
+PartitioningTree<Unit, Dimensions>::ShapeEnumerator::operator* () const noexcept
 {
     if (!stack.Empty ())
     {
@@ -20,13 +123,12 @@ const Container::Vector<const void *> *PartitioningTree<Dimensions>::ShapeEnumer
     return nullptr;
 }
 
-template <std::size_t Dimensions>
-void PartitioningTree<Dimensions>::ShapeEnumerator::EraseRecord (std::size_t _index) noexcept
+template <typename Unit, std::size_t Dimensions>
+void PartitioningTree<Unit, Dimensions>::ShapeEnumerator::EraseRecord (std::size_t _index) noexcept
 {
     EMERGENCE_ASSERT (tree);
     EMERGENCE_ASSERT (!stack.Empty ());
-    EMERGENCE_ASSERT (_index < stack.Back ().node->children.size ());
-    Container::EraseExchangingWithLast (stack.Back ().node->records, stack.Back ().node->records.begin () + _index);
+    stack.Back ().node->records.EraseExchangingWithLast (_index);
     bool needToMove = false;
 
     while (stack.GetCount () > 1u && IsSafeToDelete (*stack.Back ().node))
@@ -37,8 +139,7 @@ void PartitioningTree<Dimensions>::ShapeEnumerator::EraseRecord (std::size_t _in
         stack.PopBack ();
 
         --stack.Back ().node->childrenCount;
-        EMERGENCE_ASSERT (stack.Back ().nextChildToVisit > 0u);
-        stack.Back ().node->children[stack.Back ().nextChildToVisit - 1u] = nullptr;
+        stack.Back ().node->children[stack.Back ().lastVisitedChild] = nullptr;
     }
 
     if (needToMove)
@@ -47,19 +148,31 @@ void PartitioningTree<Dimensions>::ShapeEnumerator::EraseRecord (std::size_t _in
     }
 }
 
-template <std::size_t Dimensions>
-typename PartitioningTree<Dimensions>::ShapeEnumerator &
-PartitioningTree<Dimensions>::ShapeEnumerator::operator++ () noexcept
+template <typename Unit, std::size_t Dimensions>
+void PartitioningTree<Unit, Dimensions>::ShapeEnumerator::SetRecordShape (std::size_t _index,
+                                                                          const UnitShape &_shape) noexcept
+{
+    EMERGENCE_ASSERT (!stack.Empty ());
+    stack.Back ().node->records.SetShape (_index, _shape);
+}
+
+template <typename Unit, std::size_t Dimensions>
+typename PartitioningTree<Unit, Dimensions>::ShapeEnumerator &
+PartitioningTree<Unit, Dimensions>::ShapeEnumerator::operator++ () noexcept
 {
     while (!stack.Empty ())
     {
         StackItem &top = stack.Back ();
-        while (top.nextChildToVisit < NODE_CHILDREN_COUNT)
+        while (top.childrenToVisit != 0u)
         {
-            const Index toVisit = top.nextChildToVisit++;
-            if (top.node->children[toVisit] && (toVisit & top.filterMask) == top.filterValue)
+            const auto toVisit = static_cast<Index> (std::countr_zero (top.childrenToVisit));
+            top.childrenToVisit &= top.childrenToVisit - 1u;
+
+            // Children can not be added during enumeration, but they can be deleted by ::EraseRecord.
+            if (Node *child = top.node->children[toVisit])
             {
-                EnterNode (top.node->children[toVisit]);
+                top.lastVisitedChild = toVisit;
+                EnterNode (child);
                 return *this;
             }
         }
@@ -70,8 +183,9 @@ PartitioningTree<Dimensions>::ShapeEnumerator::operator++ () noexcept
     return *this;
 }
 
-template <std::size_t Dimensions>
-PartitioningTree<Dimensions>::ShapeEnumerator::ShapeEnumerator (PartitioningTree *_tree, const Shape &_shape) noexcept
+template <typename Unit, std::size_t Dimensions>
+PartitioningTree<Unit, Dimensions>::ShapeEnumerator::ShapeEnumerator (PartitioningTree *_tree,
+                                                                      const Shape &_shape) noexcept
     : tree (_tree),
       shape (_shape)
 {
@@ -79,12 +193,17 @@ PartitioningTree<Dimensions>::ShapeEnumerator::ShapeEnumerator (PartitioningTree
     EnterNode (tree->root);
 }
 
-template <std::size_t Dimensions>
-void PartitioningTree<Dimensions>::ShapeEnumerator::EnterNode (Node *_node) noexcept
+template <typename Unit, std::size_t Dimensions>
+void PartitioningTree<Unit, Dimensions>::ShapeEnumerator::EnterNode (Node *_node) noexcept
 {
     StackItem &item = stack.EmplaceBack ();
     item.node = _node;
 
+    if (_node->childrenCount == 0u)
+    {
+        return;
+    }
+
     Index minMask = 0u;
     Index maxMask = 0u;
 
@@ -104,17 +223,25 @@ void PartitioningTree<Dimensions>::ShapeEnumerator::EnterNode (Node *_node) noex
     const Index difference = minMask ^ maxMask;
     const Index invertedDifference = ~difference;
 
-    item.filterMask = invertedDifference;
-    item.filterValue = minMask & invertedDifference;
+    const Index filterMask = invertedDifference;
+    const Index filterValue = minMask & invertedDifference;
+
+    // We test all children at once, therefore operator++ only needs to iterate over bits of the resulting mask.
+    for (Index child = 0u; child < NODE_CHILDREN_COUNT; ++child)
+    {
+        if (_node->children[child] && (child & filterMask) == filterValue)
+        {
+            item.childrenToVisit |= 1u << child;
+        }
+    }
 }
 
-template <std::size_t Dimensions>
-void PartitioningTree<Dimensions>::RayEnumerator::EraseRecord (std::size_t _index) noexcept
+template <typename Unit, std::size_t Dimensions>
+void PartitioningTree<Unit, Dimensions>::RayEnumerator::EraseRecord (std::size_t _index) noexcept
 {
     EMERGENCE_ASSERT (tree);
     EMERGENCE_ASSERT (!stack.Empty ());
-    EMERGENCE_ASSERT (_index < stack.Back ()->children.size ());
-    Container::EraseExchangingWithLast (stack.Back ()->records, stack.Back ()->records.begin () + _index);
+    stack.Back ()->records.EraseExchangingWithLast (_index);
     bool needToMove = false;
 
     while (stack.GetCount () > 1u && IsSafeToDelete (*stack.Back ()))
@@ -136,8 +263,17 @@ void PartitioningTree<Dimensions>::RayEnumerator::EraseRecord (std::size_t _inde
     }
 }
 
-template <std::size_t Dimensions>
-const Container::Vector<const void *> *PartitioningTree<Dimensions>::RayEnumerator::operator* () const noexcept
+template <typename Unit, std::size_t Dimensions>
+void PartitioningTree<Unit, Dimensions>::RayEnumerator::SetRecordShape (std::size_t _index,
+                                                                        const UnitShape &_shape) noexcept
+{
+    EMERGENCE_ASSERT (!stack.Empty ());
+    stack.Back ()->records.SetShape (_index, _shape);
+}
+
+template <typename Unit, std::size_t Dimensions>
+const typename PartitioningTree<Unit, Dimensions>::RecordList *
+PartitioningTree<Unit, Dimensions>::RayEnumerator::operator* () const noexcept
 {
     if (!stack.Empty ())
     {
@@ -147,9 +283,9 @@ const Container::Vector<const void *> *PartitioningTree<Dimensions>::RayEnumerat
     return nullptr;
 }
 
-template <std::size_t Dimensions>
-typename PartitioningTree<Dimensions>::RayEnumerator &
-PartitioningTree<Dimensions>::RayEnumerator::operator++ () noexcept
+template <typename Unit, std::size_t Dimensions>
+typename PartitioningTree<Unit, Dimensions>::RayEnumerator &
+PartitioningTree<Unit, Dimensions>::RayEnumerator::operator++ () noexcept
 {
     while (!stack.Empty ())
     {
@@ -164,8 +300,8 @@ PartitioningTree<Dimensions>::RayEnumerator::operator++ () noexcept
     return *this;
 }
 
-template <std::size_t Dimensions>
-PartitioningTree<Dimensions>::RayEnumerator::RayEnumerator (
+template <typename Unit, std::size_t Dimensions>
+PartitioningTree<Unit, Dimensions>::RayEnumerator::RayEnumerator (
     PartitioningTree *_tree,
     const PartitioningTree::Ray &_ray,
     float _maxDistance,
@@ -195,9 +331,9 @@ PartitioningTree<Dimensions>::RayEnumerator::RayEnumerator (
     stack.EmplaceBack (tree->root);
 }
 
-template <std::size_t Dimensions>
-typename PartitioningTree<Dimensions>::Index PartitioningTree<Dimensions>::RayEnumerator::GetNextChildIndex ()
-    const noexcept
+template <typename Unit, std::size_t Dimensions>
+typename PartitioningTree<Unit, Dimensions>::Index
+PartitioningTree<Unit, Dimensions>::RayEnumerator::GetNextChildIndex () const noexcept
 {
     Index nextChildMask = tree->border >> stack.GetCount ();
     if (nextChildMask == 0u)
@@ -217,8 +353,8 @@ typename PartitioningTree<Dimensions>::Index PartitioningTree<Dimensions>::RayEn
     return nextChildIndex;
 }
 
-template <std::size_t Dimensions>
-bool PartitioningTree<Dimensions>::RayEnumerator::ContinueDescentToTarget () noexcept
+template <typename Unit, std::size_t Dimensions>
+bool PartitioningTree<Unit, Dimensions>::RayEnumerator::ContinueDescentToTarget () noexcept
 {
     const Index nextChildIndex = GetNextChildIndex ();
     if (nextChildIndex >= NODE_CHILDREN_COUNT)
@@ -236,8 +372,8 @@ bool PartitioningTree<Dimensions>::RayEnumerator::ContinueDescentToTarget () noe
     return false;
 }
 
-template <std::size_t Dimensions>
-void PartitioningTree<Dimensions>::RayEnumerator::MoveToNextTarget () noexcept
+template <typename Unit, std::size_t Dimensions>
+void PartitioningTree<Unit, Dimensions>::RayEnumerator::MoveToNextTarget () noexcept
 {
     struct DirectionInfo
     {
@@ -334,14 +470,14 @@ void PartitioningTree<Dimensions>::RayEnumerator::MoveToNextTarget () noexcept
     }
 }
 
-template <std::size_t Dimensions>
-void PartitioningTree<Dimensions>::RayEnumerator::Stop () noexcept
+template <typename Unit, std::size_t Dimensions>
+void PartitioningTree<Unit, Dimensions>::RayEnumerator::Stop () noexcept
 {
     stack.Clear ();
 }
 
-template <std::size_t Dimensions>
-PartitioningTree<Dimensions>::PartitioningTree (Index _border) noexcept
+template <typename Unit, std::size_t Dimensions>
+PartitioningTree<Unit, Dimensions>::PartitioningTree (Index _border) noexcept
     : border (_border)
 {
     EMERGENCE_ASSERT (border > 1u);
@@ -361,8 +497,8 @@ PartitioningTree<Dimensions>::PartitioningTree (Index _border) noexcept
     root = new (nodePool.Acquire ()) Node (this, center);
 }
 
-template <std::size_t Dimensions>
-PartitioningTree<Dimensions>::PartitioningTree (PartitioningTree &&_other) noexcept
+template <typename Unit, std::size_t Dimensions>
+PartitioningTree<Unit, Dimensions>::PartitioningTree (PartitioningTree &&_other) noexcept
     : border (_other.border),
       maxLevel (_other.maxLevel),
       nodePool (std::move (_other.nodePool)),
@@ -371,28 +507,29 @@ PartitioningTree<Dimensions>::PartitioningTree (PartitioningTree &&_other) noexc
     _other.root = nullptr;
 }
 
-template <std::size_t Dimensions>
-typename PartitioningTree<Dimensions>::Index PartitioningTree<Dimensions>::GetBorder () const noexcept
+template <typename Unit, std::size_t Dimensions>
+typename PartitioningTree<Unit, Dimensions>::Index PartitioningTree<Unit, Dimensions>::GetBorder () const noexcept
 {
     return border;
 }
 
-template <std::size_t Dimensions>
-typename PartitioningTree<Dimensions>::ShapeEnumerator PartitioningTree<Dimensions>::EnumerateIntersectingShapes (
-    const Shape &_shape) noexcept
+template <typename Unit, std::size_t Dimensions>
+typename PartitioningTree<Unit, Dimensions>::ShapeEnumerator
+PartitioningTree<Unit, Dimensions>::EnumerateIntersectingShapes (const Shape &_shape) noexcept
 {
     return {this, _shape};
 }
 
-template <std::size_t Dimensions>
-typename PartitioningTree<Dimensions>::RayEnumerator PartitioningTree<Dimensions>::EnumerateIntersectingShapes (
+template <typename Unit, std::size_t Dimensions>
+typename PartitioningTree<Unit, Dimensions>::RayEnumerator
+PartitioningTree<Unit, Dimensions>::EnumerateIntersectingShapes (
     const Ray &_ray, float _maxDistance, const std::array<float, Dimensions> &_distanceFactors) noexcept
 {
     return {this, _ray, _maxDistance, _distanceFactors};
 }
 
-template <std::size_t Dimensions>
-void PartitioningTree<Dimensions>::Insert (const void *_record, const Shape &_shape)
+template <typename Unit, std::size_t Dimensions>
+void PartitioningTree<Unit, Dimensions>::Insert (const void *_record, const Shape &_shape, const UnitShape &_unitShape)
 {
     Node *current = root;
     std::size_t currentLevel = 0u;
@@ -402,7 +539,7 @@ void PartitioningTree<Dimensions>::Insert (const void *_record, const Shape &_sh
         std::size_t childIndex = SelectNodeChildForShape (*current, _shape);
         if (childIndex == SELECT_TOP_NODE)
         {
-            current->records.emplace_back (_record);
+            current->records.Add (_record, _unitShape);
             break;
         }
 
@@ -435,14 +572,14 @@ void PartitioningTree<Dimensions>::Insert (const void *_record, const Shape &_sh
 
         if (currentLevel == maxLevel - 1u)
         {
-            current->records.emplace_back (_record);
+            current->records.Add (_record, _unitShape);
             break;
         }
     }
 }
 
-template <std::size_t Dimensions>
-void PartitioningTree<Dimensions>::Erase (const void *_record, const Shape &_shape) noexcept
+template <typename Unit, std::size_t Dimensions>
+void PartitioningTree<Unit, Dimensions>::Erase (const void *_record, const Shape &_shape) noexcept
 {
     struct NodeIndexPair
     {
@@ -458,10 +595,10 @@ void PartitioningTree<Dimensions>::Erase (const void *_record, const Shape &_sha
 
     auto tryRemoveRecord = [&current, _record] ()
     {
-        auto iterator = std::find (current->records.begin (), current->records.end (), _record);
+        const std::size_t index = current->records.Find (_record);
         // Otherwise tree integrity is broken: deterministic insertion algorithm should've put it here.
-        EMERGENCE_ASSERT (iterator != current->records.end ());
-        Container::EraseExchangingWithLast (current->records, iterator);
+        EMERGENCE_ASSERT (index < current->records.GetCount ());
+        current->records.EraseExchangingWithLast (index);
     };
 
     while (true)
@@ -505,19 +642,34 @@ void PartitioningTree<Dimensions>::Erase (const void *_record, const Shape &_sha
     }
 }
 
-template <std::size_t Dimensions>
-void PartitioningTree<Dimensions>::Clear () noexcept
+template <typename Unit, std::size_t Dimensions>
+void PartitioningTree<Unit, Dimensions>::UpdateUnitShape (const void *_record,
+                                                          const Shape &_shape,
+                                                          const UnitShape &_unitShape) noexcept
+{
+    Node *node = FindNodeForShape (_shape);
+    const std::size_t index = node->records.Find (_record);
+    // Otherwise tree integrity is broken: deterministic insertion algorithm should've put it here.
+    EMERGENCE_ASSERT (index < node->records.GetCount ());
+    node->records.SetShape (index, _unitShape);
+}
+
+template <typename Unit, std::size_t Dimensions>
+void PartitioningTree<Unit, Dimensions>::Clear () noexcept
 {
     for (Node *&child : root->children)
     {
         DeleteNodeWithChildren (child);
         child = nullptr;
     }
+
+    root->childrenCount = 0u;
+    root->records.Clear ();
 }
 
-template <std::size_t Dimensions>
-PartitioningTree<Dimensions>::Node::Node (PartitioningTree *_tree,
-                                          const std::array<Index, Dimensions> &_center) noexcept
+template <typename Unit, std::size_t Dimensions>
+PartitioningTree<Unit, Dimensions>::Node::Node (PartitioningTree *_tree,
+                                                const std::array<Index, Dimensions> &_center) noexcept
     : records (_tree->nodePool.GetAllocationGroup ()),
       center (_center)
 {
@@ -527,8 +679,9 @@ PartitioningTree<Dimensions>::Node::Node (PartitioningTree *_tree,
     }
 }
 
-template <std::size_t Dimensions>
-std::size_t PartitioningTree<Dimensions>::SelectNodeChildForShape (const Node &_node, const Shape &_shape) noexcept
+template <typename Unit, std::size_t Dimensions>
+std::size_t PartitioningTree<Unit, Dimensions>::SelectNodeChildForShape (const Node &_node,
+                                                                         const Shape &_shape) noexcept
 {
     Index minNode = 0u;
     Index maxNode = 0u;
@@ -550,10 +703,37 @@ std::size_t PartitioningTree<Dimensions>::SelectNodeChildForShape (const Node &_
     return minNode == maxNode ? minNode : SELECT_TOP_NODE;
 }
 
-template <std::size_t Dimensions>
-bool PartitioningTree<Dimensions>::IsSafeToDelete (const Node &_node) noexcept
+template <typename Unit, std::size_t Dimensions>
+bool PartitioningTree<Unit, Dimensions>::IsSafeToDelete (const Node &_node) noexcept
 {
-    return _node.records.empty () && _node.childrenCount == 0u;
+    return _node.records.IsEmpty () && _node.childrenCount == 0u;
+}
+
+template <typename Unit, std::size_t Dimensions>
+typename PartitioningTree<Unit, Dimensions>::Node *PartitioningTree<Unit, Dimensions>::FindNodeForShape (
+    const Shape &_shape) const noexcept
+{
+    Node *current = root;
+    std::size_t currentLevel = 0u;
+
+    while (true)
+    {
+        std::size_t childIndex = SelectNodeChildForShape (*current, _shape);
+        if (childIndex == SELECT_TOP_NODE)
+        {
+            return current;
+        }
+
+        // Otherwise tree integrity is broken: deterministic insertion algorithm should've created this node.
+        EMERGENCE_ASSERT (current->children[childIndex]);
+        current = current->children[childIndex];
+        ++currentLevel;
+
+        if (currentLevel == maxLevel - 1u)
+        {
+            return current;
+        }
+    }
 }
 
 template <typename Unit, std::size_t Dimensions>
@@ -561,10 +741,9 @@ template <typename Enumerator, typename Geometry, typename Inheritor>
 const void *VolumetricTree<Unit, Dimensions>::EnumeratorWrapper<Enumerator, Geometry, Inheritor>::operator* ()
     const noexcept
 {
-    const Container::Vector<const void *> *recordsInNode = *enumerator;
-    if (recordsInNode && currentRecordIndex < recordsInNode->size ())
+    if (candidates != 0u)
     {
-        return (*recordsInNode)[currentRecordIndex];
+        return (*enumerator)->GetRecord (currentRecordIndex);
     }
 
     return nullptr;
@@ -574,51 +753,48 @@ template <typename Unit, std::size_t Dimensions>
 template <typename Enumerator, typename Geometry, typename Inheritor>
 Inheritor &VolumetricTree<Unit, Dimensions>::EnumeratorWrapper<Enumerator, Geometry, Inheritor>::operator++ () noexcept
 {
-    const Container::Vector<const void *> *recordsInNode = *enumerator;
-    EMERGENCE_ASSERT (recordsInNode);
+    constexpr std::size_t BLOCK_SIZE = PartitioningTree<Unit, Dimensions>::RecordList::BLOCK_SIZE;
+    EMERGENCE_ASSERT (candidates != 0u);
 
-    while (true)
-    {
-        ++currentRecordIndex;
-        while (currentRecordIndex >= recordsInNode->size ())
-        {
-            currentRecordIndex = 0u;
-            ++enumerator;
-            recordsInNode = *enumerator;
-
-            if (!recordsInNode)
-            {
-                // We're done: whole tree is scanned.
-                return *static_cast<Inheritor *> (this);
-            }
-        }
+    const std::size_t blockStart = currentRecordIndex - currentRecordIndex % BLOCK_SIZE;
+    candidates &= candidates - 1u;
 
-        if (static_cast<Inheritor *> (this)->CheckIntersection ((*recordsInNode)[currentRecordIndex]))
-        {
-            // New intersection is found.
-            return *static_cast<Inheritor *> (this);
-        }
+    if (candidates != 0u)
+    {
+        currentRecordIndex = blockStart + static_cast<std::size_t> (std::countr_zero (candidates));
+    }
+    else
+    {
+        SeekIntersection (blockStart + BLOCK_SIZE);
     }
+
+    return *static_cast<Inheritor *> (this);
 }
 
 template <typename Unit, std::size_t Dimensions>
 template <typename Enumerator, typename Geometry, typename Inheritor>
 Inheritor &VolumetricTree<Unit, Dimensions>::EnumeratorWrapper<Enumerator, Geometry, Inheritor>::operator~() noexcept
 {
-    const Container::Vector<const void *> *oldNode = *enumerator;
+    const typename PartitioningTree<Unit, Dimensions>::RecordList *oldNode = *enumerator;
     EMERGENCE_ASSERT (oldNode);
+    EMERGENCE_ASSERT (candidates != 0u);
     enumerator.EraseRecord (currentRecordIndex);
-    const Container::Vector<const void *> *newNode = *enumerator;
 
-    if (oldNode != newNode)
-    {
-        currentRecordIndex = 0u;
-    }
-
-    EnsureCurrentRecordIsValid ();
+    // If we're still in the same node, last record was moved to current position and it is not checked yet.
+    SeekIntersection (oldNode == *enumerator ? currentRecordIndex : 0u);
     return *static_cast<Inheritor *> (this);
 }
 
+template <typename Unit, std::size_t Dimensions>
+template <typename Enumerator, typename Geometry, typename Inheritor>
+void VolumetricTree<Unit, Dimensions>::EnumeratorWrapper<Enumerator, Geometry, Inheritor>::
+    RefreshCurrentShape () noexcept
+{
+    EMERGENCE_ASSERT (candidates != 0u);
+    enumerator.SetRecordShape (currentRecordIndex,
+                               tree->ExtractShape ((*enumerator)->GetRecord (currentRecordIndex)));
+}
+
 template <typename Unit, std::size_t Dimensions>
 template <typename Enumerator, typename Geometry, typename Inheritor>
 VolumetricTree<Unit, Dimensions>::EnumeratorWrapper<Enumerator, Geometry, Inheritor>::EnumeratorWrapper (
@@ -627,69 +803,130 @@ VolumetricTree<Unit, Dimensions>::EnumeratorWrapper<Enumerator, Geometry, Inheri
       geometry (_geometry),
       enumerator (std::move (_enumerator))
 {
-    EnsureCurrentRecordIsValid ();
+    SeekIntersection (0u);
 }
 
 template <typename Unit, std::size_t Dimensions>
 template <typename Enumerator, typename Geometry, typename Inheritor>
-void VolumetricTree<Unit, Dimensions>::EnumeratorWrapper<Enumerator, Geometry, Inheritor>::
-    EnsureCurrentRecordIsValid () noexcept
+void VolumetricTree<Unit, Dimensions>::EnumeratorWrapper<Enumerator, Geometry, Inheritor>::SeekIntersection (
+    std::size_t _startIndex) noexcept
 {
-    if (*enumerator)
+    constexpr std::size_t BLOCK_SIZE = PartitioningTree<Unit, Dimensions>::RecordList::BLOCK_SIZE;
+    const typename PartitioningTree<Unit, Dimensions>::RecordList *recordsInNode = *enumerator;
+    std::size_t startIndex = _startIndex;
+
+    while (recordsInNode)
     {
-        const void *initialRecord = **this;
-        // If no records in root or no intersection with first record in root: move ahead.
-        if (!initialRecord || !static_cast<Inheritor *> (this)->CheckIntersection (initialRecord))
+        const std::size_t count = recordsInNode->GetCount ();
+        for (std::size_t blockStart = startIndex - startIndex % BLOCK_SIZE; blockStart < count;
+             blockStart += BLOCK_SIZE)
         {
-            ++*this;
+            std::uint32_t mask =
+                static_cast<Inheritor *> (this)->CheckIntersection (*recordsInNode, blockStart / BLOCK_SIZE);
+
+            // Exclude already visited records and lanes after the last record.
+            if (startIndex > blockStart)
+            {
+                mask &= ~0u << (startIndex - blockStart);
+            }
+
+            if (count - blockStart < BLOCK_SIZE)
+            {
+                mask &= (1u << (count - blockStart)) - 1u;
+            }
+
+            if (mask != 0u)
+            {
+                // New intersection is found.
+                candidates = mask;
+                currentRecordIndex = blockStart + static_cast<std::size_t> (std::countr_zero (mask));
+                return;
+            }
         }
+
+        startIndex = 0u;
+        ++enumerator;
+        recordsInNode = *enumerator;
     }
+
+    // We're done: whole tree is scanned.
+    candidates = 0u;
+    currentRecordIndex = 0u;
 }
 
 template <typename Unit, std::size_t Dimensions>
 VolumetricTree<Unit, Dimensions>::ShapeIntersectionEnumerator::ShapeIntersectionEnumerator (
     VolumetricTree *_tree,
     const VolumetricTree::Shape &_shape,
-    typename PartitioningTree<Dimensions>::ShapeEnumerator _enumerator) noexcept
-    : EnumeratorWrapper<typename PartitioningTree<Dimensions>::ShapeEnumerator, Shape, ShapeIntersectionEnumerator> (
-          _tree, _shape, _enumerator)
+    typename PartitioningTree<Unit, Dimensions>::ShapeEnumerator _enumerator) noexcept
+    : EnumeratorWrapper<typename PartitioningTree<Unit, Dimensions>::ShapeEnumerator,
+                        Shape,
+                        ShapeIntersectionEnumerator> (_tree, _shape, _enumerator)
 {
 }
 
 template <typename Unit, std::size_t Dimensions>
-bool VolumetricTree<Unit, Dimensions>::ShapeIntersectionEnumerator::CheckIntersection (
-    const void *_record) const noexcept
+std::uint32_t VolumetricTree<Unit, Dimensions>::ShapeIntersectionEnumerator::CheckIntersection (
+    const typename PartitioningTree<Unit, Dimensions>::RecordList &_records, std::size_t _blockIndex) const noexcept
 {
-    for (std::size_t index = 0u; index < Dimensions; ++index)
-    {
-        const Unit min = *static_cast<const Unit *> (this->tree->dimensions[index].minField.GetValue (_record));
-        const Unit max = *static_cast<const Unit *> (this->tree->dimensions[index].maxField.GetValue (_record));
+    constexpr std::size_t BLOCK_SIZE = PartitioningTree<Unit, Dimensions>::RecordList::BLOCK_SIZE;
+    const Unit *block = _records.GetBlock (_blockIndex);
+    std::uint32_t result = (1u << BLOCK_SIZE) - 1u;
 
-        if (max < this->geometry.bounds[index].min || min > this->geometry.bounds[index].max)
-        {
-            return false;
-        }
+    for (std::size_t dimension = 0u; dimension < Dimensions && result != 0u; ++dimension)
+    {
+        const Unit *minimums = block + dimension * 2u * BLOCK_SIZE;
+        result &= IntersectBoundsLanes (minimums, minimums + BLOCK_SIZE, this->geometry.bounds[dimension].min,
+                                        this->geometry.bounds[dimension].max);
     }
 
-    return true;
+    return result;
 }
 
 template <typename Unit, std::size_t Dimensions>
 VolumetricTree<Unit, Dimensions>::RayIntersectionEnumerator::RayIntersectionEnumerator (
     VolumetricTree *_tree,
     const LimitedFloatingRay &_ray,
-    typename PartitioningTree<Dimensions>::RayEnumerator _enumerator) noexcept
-    : EnumeratorWrapper<typename PartitioningTree<Dimensions>::RayEnumerator,
+    typename PartitioningTree<Unit, Dimensions>::RayEnumerator _enumerator) noexcept
+    : EnumeratorWrapper<typename PartitioningTree<Unit, Dimensions>::RayEnumerator,
                         LimitedFloatingRay,
                         RayIntersectionEnumerator> (_tree, _ray, _enumerator)
 {
 }
 
 template <typename Unit, std::size_t Dimensions>
-bool VolumetricTree<Unit, Dimensions>::RayIntersectionEnumerator::CheckIntersection (const void *_record) const noexcept
+std::uint32_t VolumetricTree<Unit, Dimensions>::RayIntersectionEnumerator::CheckIntersection (
+    const typename PartitioningTree<Unit, Dimensions>::RecordList &_records, std::size_t _blockIndex) const noexcept
 {
-    FloatingShape shape = this->tree->ConvertToFloatingShape (this->tree->ExtractShape (_record));
+    // Ray check is branchy, therefore we still check records one by one, but read shapes from the block.
+    constexpr std::size_t BLOCK_SIZE = PartitioningTree<Unit, Dimensions>::RecordList::BLOCK_SIZE;
+    const Unit *block = _records.GetBlock (_blockIndex);
+    const std::size_t lanes = std::min (BLOCK_SIZE, _records.GetCount () - _blockIndex * BLOCK_SIZE);
+    std::uint32_t result = 0u;
 
+    for (std::size_t lane = 0u; lane < lanes; ++lane)
+    {
+        FloatingShape shape;
+        for (std::size_t dimension = 0u; dimension < Dimensions; ++dimension)
+        {
+            shape.bounds[dimension].min = static_cast<FloatingUnit> (block[dimension * 2u * BLOCK_SIZE + lane]);
+            shape.bounds[dimension].max =
+                static_cast<FloatingUnit> (block[(dimension * 2u + 1u) * BLOCK_SIZE + lane]);
+        }
+
+        if (CheckIntersection (shape))
+        {
+            result |= 1u << lane;
+        }
+    }
+
+    return result;
+}
+
+template <typename Unit, std::size_t Dimensions>
+bool VolumetricTree<Unit, Dimensions>::RayIntersectionEnumerator::CheckIntersection (
+    const FloatingShape &_shape) const noexcept
+{
     // Algorithm is taken from GitHub:
     // https://github.com/erich666/GraphicsGems/blob/master/gems/RayBox.c
 
@@ -703,16 +940,16 @@ bool VolumetricTree<Unit, Dimensions>::RayIntersectionEnumerator::CheckIntersect
 
     for (std::size_t dimension = 0u; dimension < Dimensions; ++dimension)
     {
-        if (this->geometry.axis[dimension].origin < shape.bounds[dimension].min)
+        if (this->geometry.axis[dimension].origin < _shape.bounds[dimension].min)
         {
             quadrant[dimension] = LEFT;
-            candidatePoint[dimension] = shape.bounds[dimension].min;
+            candidatePoint[dimension] = _shape.bounds[dimension].min;
             insideShape = false;
         }
-        else if (this->geometry.axis[dimension].origin > shape.bounds[dimension].max)
+        else if (this->geometry.axis[dimension].origin > _shape.bounds[dimension].max)
         {
             quadrant[dimension] = RIGHT;
-            candidatePoint[dimension] = shape.bounds[dimension].max;
+            candidatePoint[dimension] = _shape.bounds[dimension].max;
             insideShape = false;
         }
         else
@@ -759,7 +996,8 @@ bool VolumetricTree<Unit, Dimensions>::RayIntersectionEnumerator::CheckIntersect
             hitPoint[dimension] =
                 this->geometry.axis[dimension].origin + this->geometry.axis[dimension].direction * maximumMovement;
 
-            if (hitPoint[dimension] < shape.bounds[dimension].min || hitPoint[dimension] > shape.bounds[dimension].max)
+            if (hitPoint[dimension] < _shape.bounds[dimension].min ||
+                hitPoint[dimension] > _shape.bounds[dimension].max)
             {
                 return false;
             }
@@ -806,7 +1044,7 @@ typename VolumetricTree<Unit, Dimensions>::RayIntersectionEnumerator
 VolumetricTree<Unit, Dimensions>::EnumerateIntersectingShapes (const VolumetricTree::Ray &_ray,
                                                                VolumetricTree::FloatingUnit _maxLength) noexcept
 {
-    typename PartitioningTree<Dimensions>::Ray partitioningRay;
+    typename PartitioningTree<Unit, Dimensions>::Ray partitioningRay;
     std::array<float, Dimensions> partitioningDistanceFactors;
 
     LimitedFloatingRay ray;
@@ -833,28 +1071,34 @@ VolumetricTree<Unit, Dimensions>::EnumerateIntersectingShapes (const VolumetricT
 template <typename Unit, std::size_t Dimensions>
 void VolumetricTree<Unit, Dimensions>::Insert (const void *_record)
 {
-    partitioningTree.Insert (_record, ConvertToPartitioningShape (ExtractShape (_record)));
+    const Shape shape = ExtractShape (_record);
+    partitioningTree.Insert (_record, ConvertToPartitioningShape (shape), shape);
 }
 
 template <typename Unit, std::size_t Dimensions>
 void VolumetricTree<Unit, Dimensions>::Update (const void *_record, const void *_backup) noexcept
 {
-    typename PartitioningTree<Dimensions>::Shape oldShape = ConvertToPartitioningShape (ExtractShape (_backup));
-    typename PartitioningTree<Dimensions>::Shape newShape = ConvertToPartitioningShape (ExtractShape (_record));
+    const Shape shape = ExtractShape (_record);
+    typename PartitioningTree<Unit, Dimensions>::Shape oldShape = ConvertToPartitioningShape (ExtractShape (_backup));
+    typename PartitioningTree<Unit, Dimensions>::Shape newShape = ConvertToPartitioningShape (shape);
 
     if (oldShape != newShape)
     {
         // Right now we're not expecting huge objects to move, therefore this approach is good enough.
         partitioningTree.Erase (_record, oldShape);
-        partitioningTree.Insert (_record, newShape);
+        partitioningTree.Insert (_record, newShape, shape);
+    }
+    else
+    {
+        partitioningTree.UpdateUnitShape (_record, newShape, shape);
     }
 }
 
 template <typename Unit, std::size_t Dimensions>
 bool VolumetricTree<Unit, Dimensions>::IsPartitioningChanged (const void *_record, const void *_backup) const noexcept
 {
-    typename PartitioningTree<Dimensions>::Shape oldShape = ConvertToPartitioningShape (ExtractShape (_backup));
-    typename PartitioningTree<Dimensions>::Shape newShape = ConvertToPartitioningShape (ExtractShape (_record));
+    typename PartitioningTree<Unit, Dimensions>::Shape oldShape = ConvertToPartitioningShape (ExtractShape (_backup));
+    typename PartitioningTree<Unit, Dimensions>::Shape newShape = ConvertToPartitioningShape (ExtractShape (_record));
     return oldShape != newShape;
 }
 
@@ -871,10 +1115,10 @@ void VolumetricTree<Unit, Dimensions>::Clear () noexcept
 }
 
 template <typename Unit, std::size_t Dimensions>
-typename PartitioningTree<Dimensions>::Index VolumetricTree<Unit, Dimensions>::PreparePartitioningSpace (
+typename PartitioningTree<Unit, Dimensions>::Index VolumetricTree<Unit, Dimensions>::PreparePartitioningSpace (
     const std::array<Dimension, Dimensions> &_dimensions) noexcept
 {
-    typename PartitioningTree<Dimensions>::Index maxBorder = 0u;
+    typename PartitioningTree<Unit, Dimensions>::Index maxBorder = 0u;
     for (std::size_t index = 0u; index < Dimensions; ++index)
     {
         const Unit space = _dimensions[index].maxBorder - _dimensions[index].minBorder;
@@ -882,10 +1126,10 @@ typename PartitioningTree<Dimensions>::Index VolumetricTree<Unit, Dimensions>::P
             static_cast<float> (space) * Constants::VolumetricIndex::IDEAL_UNIT_TO_PARTITION_SCALE;
 
         const auto roundedPartitions =
-            static_cast<typename PartitioningTree<Dimensions>::Index> (ceilf (floatingPartitions));
+            static_cast<typename PartitioningTree<Unit, Dimensions>::Index> (ceilf (floatingPartitions));
 
-        constexpr std::size_t BIT_COUNT = sizeof (typename PartitioningTree<Dimensions>::Index) * 8u;
-        maxBorder = std::max (maxBorder, static_cast<typename PartitioningTree<Dimensions>::Index> (
+        constexpr std::size_t BIT_COUNT = sizeof (typename PartitioningTree<Unit, Dimensions>::Index) * 8u;
+        maxBorder = std::max (maxBorder, static_cast<typename PartitioningTree<Unit, Dimensions>::Index> (
                                              1u << (BIT_COUNT - std::countl_zero (roundedPartitions))));
     }
 
@@ -907,10 +1151,10 @@ typename VolumetricTree<Unit, Dimensions>::Shape VolumetricTree<Unit, Dimensions
 }
 
 template <typename Unit, std::size_t Dimensions>
-typename PartitioningTree<Dimensions>::Shape VolumetricTree<Unit, Dimensions>::ConvertToPartitioningShape (
+typename PartitioningTree<Unit, Dimensions>::Shape VolumetricTree<Unit, Dimensions>::ConvertToPartitioningShape (
     const VolumetricTree::Shape &_shape) const noexcept
 {
-    typename PartitioningTree<Dimensions>::Shape convertedShape;
+    typename PartitioningTree<Unit, Dimensions>::Shape convertedShape;
     for (std::size_t index = 0u; index < Dimensions; ++index)
     {
         convertedShape.bounds[index].min = ConvertPointToIndex (_shape.bounds[index].min, index);
@@ -935,29 +1179,29 @@ typename VolumetricTree<Unit, Dimensions>::FloatingShape VolumetricTree<Unit, Di
 }
 
 template <typename Unit, std::size_t Dimensions>
-typename PartitioningTree<Dimensions>::Index VolumetricTree<Unit, Dimensions>::ConvertPointToIndex (
+typename PartitioningTree<Unit, Dimensions>::Index VolumetricTree<Unit, Dimensions>::ConvertPointToIndex (
     Unit _point, std::size_t _dimension) const noexcept
 {
-    const typename PartitioningTree<Dimensions>::Index partitions = partitioningTree.GetBorder ();
+    const typename PartitioningTree<Unit, Dimensions>::Index partitions = partitioningTree.GetBorder ();
     const Unit space = dimensions[_dimension].maxBorder - dimensions[_dimension].minBorder;
 
     const Unit localizedValue = _point - dimensions[_dimension].minBorder;
     const FloatingUnit percent = static_cast<FloatingUnit> (localizedValue) / static_cast<FloatingUnit> (space);
 
-    return static_cast<typename PartitioningTree<Dimensions>::Index> (
+    return static_cast<typename PartitioningTree<Unit, Dimensions>::Index> (
         floor (percent * static_cast<FloatingUnit> (partitions)));
 }
 
 template <typename Unit, std::size_t Dimensions>
-typename PartitioningTree<Dimensions>::FloatingIndex VolumetricTree<Unit, Dimensions>::ConvertDirectionToIndex (
+typename PartitioningTree<Unit, Dimensions>::FloatingIndex VolumetricTree<Unit, Dimensions>::ConvertDirectionToIndex (
     Unit _direction, std::size_t _dimension) const noexcept
 {
-    const typename PartitioningTree<Dimensions>::Index partitions = partitioningTree.GetBorder ();
+    const typename PartitioningTree<Unit, Dimensions>::Index partitions = partitioningTree.GetBorder ();
     const Unit space = dimensions[_dimension].maxBorder - dimensions[_dimension].minBorder;
 
     const FloatingUnit scale = static_cast<FloatingUnit> (partitions) / static_cast<FloatingUnit> (space);
-    return static_cast<typename PartitioningTree<Dimensions>::FloatingIndex> (static_cast<FloatingUnit> (_direction) *
-                                                                              scale);
+    return static_cast<typename PartitioningTree<Unit, Dimensions>::FloatingIndex> (
+        static_cast<FloatingUnit> (_direction) * scale);
 }
 
 VolumetricIndex::DimensionIterator::DimensionIterator (const VolumetricIndex::DimensionIterator &_other) noexcept =
@@ -1184,11 +1428,16 @@ bool VolumetricIndex::ShapeIntersectionEditCursor::EndRecordEdition (Enumerator
 {
     if (const void *record = *_enumerator)
     {
-        if (index->storage->EndRecordEdition (record, index) &&
-            index->OnRecordChangedByMe (record, index->storage->GetEditedRecordBackup ()))
+        if (index->storage->EndRecordEdition (record, index))
         {
-            ~_enumerator;
-            return true;
+            if (index->OnRecordChangedByMe (record, index->storage->GetEditedRecordBackup ()))
+            {
+                ~_enumerator;
+                return true;
+            }
+
+            // Record stays in the same node, but tree stores copy of its shape, that must be updated.
+            _enumerator.RefreshCurrentShape ();
         }
     }
 
@@ -1351,11 +1600,16 @@ bool VolumetricIndex::RayIntersectionEditCursor::EndRecordEdition (Enumerator &_
 {
     if (const void *record = *_enumerator)
     {
-        if (index->storage->EndRecordEdition (record, index) &&
-            index->OnRecordChangedByMe (record, index->storage->GetEditedRecordBackup ()))
+        if (index->storage->EndRecordEdition (record, index))
         {
-            ~_enumerator;
-            return true;
+            if (index->OnRecordChangedByMe (record, index->storage->GetEditedRecordBackup ()))
+            {
+                ~_enumerator;
+                return true;
+            }
+
+            // Record stays in the same node, but tree stores copy of its shape, that must be updated.
+            _enumerator.RefreshCurrentShape ();
         }
     }
 
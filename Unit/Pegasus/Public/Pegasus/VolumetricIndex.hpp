@@ -19,7 +19,7 @@ namespace Emergence::Pegasus
 {
 using namespace Memory::Literals;
 
-template <std::size_t Dimensions>
+template <typename Unit, std::size_t Dimensions>
 class PartitioningTree final
 {
 private:
@@ -48,6 +48,18 @@ public:
         bool operator!= (const Shape &_other) const = default;
     };
 
+    /// \brief Exact record shape in record units, copy of which is stored in node alongside with record.
+    struct UnitShape final
+    {
+        struct MinMax final
+        {
+            Unit min;
+            Unit max;
+        };
+
+        std::array<MinMax, Dimensions> bounds;
+    };
+
     struct Ray final
     {
         struct Axe final
@@ -64,6 +76,46 @@ public:
         std::array<FloatingIndex, Dimensions> coordinates;
     };
 
+    /// \brief Records, that belong to one node, and copies of their shapes.
+    /// \details Shapes are stored in SoA blocks of ::BLOCK_SIZE records: inside block, minimums of first dimension
+    ///          go first, then maximums of first dimension, then minimums of second dimension and so on. Therefore
+    ///          intersection checks can load borders of the whole block into SIMD registers without touching records.
+    class RecordList final
+    {
+    public:
+        static constexpr std::size_t BLOCK_SIZE = 8u;
+
+        static constexpr std::size_t BLOCK_STRIDE = BLOCK_SIZE * Dimensions * 2u;
+
+        explicit RecordList (const Memory::Profiler::AllocationGroup &_group) noexcept;
+
+        [[nodiscard]] std::size_t GetCount () const noexcept;
+
+        [[nodiscard]] bool IsEmpty () const noexcept;
+
+        [[nodiscard]] const void *GetRecord (std::size_t _index) const noexcept;
+
+        /// \return Pointer to the beginning of given shape block.
+        /// \details Values in lanes after ::GetCount are undefined and must be ignored.
+        [[nodiscard]] const Unit *GetBlock (std::size_t _blockIndex) const noexcept;
+
+        [[nodiscard]] std::size_t Find (const void *_record) const noexcept;
+
+        void Add (const void *_record, const UnitShape &_shape) noexcept;
+
+        void SetShape (std::size_t _index, const UnitShape &_shape) noexcept;
+
+        void EraseExchangingWithLast (std::size_t _index) noexcept;
+
+        void Clear () noexcept;
+
+    private:
+        [[nodiscard]] Unit &AccessBorder (std::size_t _index, std::size_t _border) noexcept;
+
+        Container::Vector<const void *> records;
+        Container::Vector<Unit> shapes;
+    };
+
     class ShapeEnumerator final
     {
     public:
@@ -76,7 +128,9 @@ public:
         /// \warning Invalidates other enumerators.
         void EraseRecord (std::size_t _index) noexcept;
 
-        [[nodiscard]] const Container::Vector<const void *> *operator* () const noexcept;
+        void SetRecordShape (std::size_t _index, const UnitShape &_shape) noexcept;
+
+        [[nodiscard]] const RecordList *operator* () const noexcept;
 
         ShapeEnumerator &operator++ () noexcept;
 
@@ -90,9 +144,11 @@ public:
         struct StackItem final
         {
             Node *node = nullptr;
-            Index filterValue = 0u;
-            Index filterMask = 0u;
-            Index nextChildToVisit = 0u;
+
+            /// \brief Mask of existing children, that intersect with shape and are not visited yet.
+            Index childrenToVisit = 0u;
+
+            Index lastVisitedChild = 0u;
         };
 
         ShapeEnumerator (PartitioningTree *_tree, const Shape &_shape) noexcept;
@@ -116,7 +172,9 @@ public:
         /// \warning Invalidates other enumerators.
         void EraseRecord (std::size_t _index) noexcept;
 
-        [[nodiscard]] const Container::Vector<const void *> *operator* () const noexcept;
+        void SetRecordShape (std::size_t _index, const UnitShape &_shape) noexcept;
+
+        [[nodiscard]] const RecordList *operator* () const noexcept;
 
         RayEnumerator &operator++ () noexcept;
 
@@ -174,11 +232,14 @@ public:
                                                const std::array<float, Dimensions> &_distanceFactors) noexcept;
 
     /// \warning Invalidates iterators.
-    void Insert (const void *_record, const Shape &_shape);
+    void Insert (const void *_record, const Shape &_shape, const UnitShape &_unitShape);
 
     /// \warning Invalidates iterators.
     void Erase (const void *_record, const Shape &_shape) noexcept;
 
+    /// \brief Updates stored copy of record shape, that is changed without changing its partitioning shape.
+    void UpdateUnitShape (const void *_record, const Shape &_shape, const UnitShape &_unitShape) noexcept;
+
     void Clear () noexcept;
 
     EMERGENCE_DELETE_ASSIGNMENT (PartitioningTree);
@@ -202,7 +263,7 @@ private:
 
         EMERGENCE_DELETE_ASSIGNMENT (Node);
 
-        Container::Vector<const void *> records;
+        RecordList records;
         std::array<Index, Dimensions> center;
 
         /// \brief We store children count to make no-children check faster.
@@ -215,6 +276,8 @@ private:
 
     static bool IsSafeToDelete (const Node &_node) noexcept;
 
+    Node *FindNodeForShape (const Shape &_shape) const noexcept;
+
     void DeleteNodeWithChildren (Node *_node);
 
     Index border;
@@ -243,6 +306,10 @@ private:
 
         Inheritor &operator~() noexcept;
 
+        /// \brief Updates stored copy of current record shape after the record was edited
+        ///        without changing its partitioning shape.
+        void RefreshCurrentShape () noexcept;
+
         EnumeratorWrapper &operator= (const EnumeratorWrapper &_other) noexcept = default;
 
         EnumeratorWrapper &operator= (EnumeratorWrapper &&_other) noexcept = default;
@@ -256,9 +323,15 @@ private:
 
         EnumeratorWrapper (VolumetricTree *_tree, const Geometry &_geometry, Enumerator _enumerator) noexcept;
 
-        void EnsureCurrentRecordIsValid () noexcept;
+        /// \brief Finds first intersecting record, starting from record with given index in current node.
+        void SeekIntersection (std::size_t _startIndex) noexcept;
 
         std::size_t currentRecordIndex = 0u;
+
+        /// \brief Mask of intersecting records in current shape block, that are not visited yet.
+        /// \details Lowest bit always points to current record.
+        std::uint32_t candidates = 0u;
+
         Enumerator enumerator;
     };
 
@@ -267,16 +340,7 @@ public:
 
     using FloatingUnit = SelectType<double, float, USE_DOUBLE_AS_FLOATING_UNIT>;
 
-    struct Shape final
-    {
-        struct MinMax final
-        {
-            Unit min;
-            Unit max;
-        };
-
-        std::array<MinMax, Dimensions> bounds;
-    };
+    using Shape = typename PartitioningTree<Unit, Dimensions>::UnitShape;
 
     struct FloatingShape final
     {
@@ -324,7 +388,7 @@ public:
     };
 
     class ShapeIntersectionEnumerator final
-        : public EnumeratorWrapper<typename PartitioningTree<Dimensions>::ShapeEnumerator,
+        : public EnumeratorWrapper<typename PartitioningTree<Unit, Dimensions>::ShapeEnumerator,
                                    Shape,
                                    ShapeIntersectionEnumerator>
     {
@@ -333,13 +397,15 @@ public:
 
         ShapeIntersectionEnumerator (VolumetricTree *_tree,
                                      const Shape &_shape,
-                                     typename PartitioningTree<Dimensions>::ShapeEnumerator _enumerator) noexcept;
+                                     typename PartitioningTree<Unit, Dimensions>::ShapeEnumerator _enumerator) noexcept;
 
-        bool CheckIntersection (const void *_record) const noexcept;
+        /// \return Mask of intersecting records in given shape block of given record list.
+        std::uint32_t CheckIntersection (const typename PartitioningTree<Unit, Dimensions>::RecordList &_records,
+                                         std::size_t _blockIndex) const noexcept;
     };
 
     class RayIntersectionEnumerator final
-        : public EnumeratorWrapper<typename PartitioningTree<Dimensions>::RayEnumerator,
+        : public EnumeratorWrapper<typename PartitioningTree<Unit, Dimensions>::RayEnumerator,
                                    LimitedFloatingRay,
                                    RayIntersectionEnumerator>
     {
@@ -348,9 +414,13 @@ public:
 
         RayIntersectionEnumerator (VolumetricTree *_tree,
                                    const LimitedFloatingRay &_ray,
-                                   typename PartitioningTree<Dimensions>::RayEnumerator _enumerator) noexcept;
+                                   typename PartitioningTree<Unit, Dimensions>::RayEnumerator _enumerator) noexcept;
+
+        /// \return Mask of intersecting records in given shape block of given record list.
+        std::uint32_t CheckIntersection (const typename PartitioningTree<Unit, Dimensions>::RecordList &_records,
+                                         std::size_t _blockIndex) const noexcept;
 
-        bool CheckIntersection (const void *_record) const noexcept;
+        bool CheckIntersection (const FloatingShape &_shape) const noexcept;
     };
 
     VolumetricTree (const std::array<Dimension, Dimensions> &_dimensions) noexcept;
@@ -380,24 +450,24 @@ public:
     EMERGENCE_DELETE_ASSIGNMENT (VolumetricTree);
 
 private:
-    static typename PartitioningTree<Dimensions>::Index PreparePartitioningSpace (
+    static typename PartitioningTree<Unit, Dimensions>::Index PreparePartitioningSpace (
         const std::array<Dimension, Dimensions> &_dimensions) noexcept;
 
     Shape ExtractShape (const void *_record) const noexcept;
 
-    [[nodiscard]] typename PartitioningTree<Dimensions>::Shape ConvertToPartitioningShape (
+    [[nodiscard]] typename PartitioningTree<Unit, Dimensions>::Shape ConvertToPartitioningShape (
         const Shape &_shape) const noexcept;
 
     [[nodiscard]] FloatingShape ConvertToFloatingShape (const Shape &_shape) const noexcept;
 
-    [[nodiscard]] typename PartitioningTree<Dimensions>::Index ConvertPointToIndex (
+    [[nodiscard]] typename PartitioningTree<Unit, Dimensions>::Index ConvertPointToIndex (
         Unit _point, std::size_t _dimension) const noexcept;
 
-    [[nodiscard]] typename PartitioningTree<Dimensions>::FloatingIndex ConvertDirectionToIndex (
+    [[nodiscard]] typename PartitioningTree<Unit, Dimensions>::FloatingIndex ConvertDirectionToIndex (
         Unit _direction, std::size_t _dimension) const noexcept;
 
     std::array<Dimension, Dimensions> dimensions;
-    PartitioningTree<Dimensions> partitioningTree;
+    PartitioningTree<Unit, Dimensions> partitioningTree;
 };
 
 using VolumetricTreeVariant = Container::Variant<VOLUMETRIC_TREE_VARIANTS ()>;
@@ -565,8 +635,8 @@ private:
 };
 
 // Must be inlined in header, otherwise some compilers do not generate code for these methods.
-template <std::size_t Dimensions>
-PartitioningTree<Dimensions>::~PartitioningTree () noexcept
+template <typename Unit, std::size_t Dimensions>
+PartitioningTree<Unit, Dimensions>::~PartitioningTree () noexcept
 {
     if (root)
     {
@@ -574,8 +644,8 @@ PartitioningTree<Dimensions>::~PartitioningTree () noexcept
     }
 }
 
-template <std::size_t Dimensions>
-void PartitioningTree<Dimensions>::DeleteNodeWithChildren (Node *_node)
+template <typename Unit, std::size_t Dimensions>
+void PartitioningTree<Unit, Dimensions>::DeleteNodeWithChildren (Node *_node)
 {
     if (!_node)
     {
@@ -592,9 +662,9 @@ void PartitioningTree<Dimensions>::DeleteNodeWithChildren (Node *_node)
     nodePool.Release (_node);
 }
 
-template <std::size_t Dimensions>
+template <typename Unit, std::size_t Dimensions>
 // NOLINTNEXTLINE(modernize-use-equals-default): It's actually not default when asserts are enabled.
-PartitioningTree<Dimensions>::Node::~Node () noexcept
+PartitioningTree<Unit, Dimensions>::Node::~Node () noexcept
 {
 #if defined(EMERGENCE_ASSERT_ENABLED)
     // Ensure that all children are properly deleted by VolumetricTree::DeleteNode.
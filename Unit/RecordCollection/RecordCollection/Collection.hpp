@@ -158,6 +158,12 @@ public:
     /// \invariant There is no active allocation transactions in this collection and cursors in its representations.
     Allocator AllocateAndInsert () noexcept;
 
+    /// \brief Starts allocation transaction, that inserts all allocated records into representations at its end.
+    /// \details Much faster than ::AllocateAndInsert for big batches of records, because representations are
+    ///          updated only once. Allocated records are not visible to representations until transaction ends.
+    /// \invariant There is no active allocation transactions in this collection and cursors in its representations.
+    Allocator AllocateAndInsertBulk () noexcept;
+
     /// \brief Adds LinearRepresentation to Collection, which sorts records by value of given _keyField.
     /// \invariant There is no active allocation transactions in this collection and cursors in its representations.
     [[nodiscard]] LinearRepresentation CreateLinearRepresentation (StandardLayout::FieldId _keyField) noexcept;
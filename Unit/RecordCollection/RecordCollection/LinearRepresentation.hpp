@@ -31,7 +31,7 @@ public:
         /// LinearRepresentation constructs its cursors.
         friend class LinearRepresentation;
 
-        EMERGENCE_BIND_IMPLEMENTATION_INPLACE (sizeof (std::uintptr_t) * 3u);
+        EMERGENCE_BIND_IMPLEMENTATION_INPLACE (sizeof (std::uintptr_t) * 5u);
 
         explicit AscendingReadCursor (std::array<std::uint8_t, DATA_MAX_SIZE> &_data) noexcept;
     };
@@ -47,7 +47,7 @@ public:
         /// LinearRepresentation constructs its cursors.
         friend class LinearRepresentation;
 
-        EMERGENCE_BIND_IMPLEMENTATION_INPLACE (sizeof (std::uintptr_t) * 3u);
+        EMERGENCE_BIND_IMPLEMENTATION_INPLACE (sizeof (std::uintptr_t) * 5u);
 
         explicit AscendingEditCursor (std::array<std::uint8_t, DATA_MAX_SIZE> &_data) noexcept;
     };
@@ -64,7 +64,7 @@ public:
         /// LinearRepresentation constructs its cursors.
         friend class LinearRepresentation;
 
-        EMERGENCE_BIND_IMPLEMENTATION_INPLACE (sizeof (std::uintptr_t) * 3u);
+        EMERGENCE_BIND_IMPLEMENTATION_INPLACE (sizeof (std::uintptr_t) * 5u);
 
         explicit DescendingReadCursor (std::array<std::uint8_t, DATA_MAX_SIZE> &_data) noexcept;
     };
@@ -80,7 +80,7 @@ public:
         /// LinearRepresentation constructs its cursors.
         friend class LinearRepresentation;
 
-        EMERGENCE_BIND_IMPLEMENTATION_INPLACE (sizeof (std::uintptr_t) * 3u);
+        EMERGENCE_BIND_IMPLEMENTATION_INPLACE (sizeof (std::uintptr_t) * 5u);
 
         explicit DescendingEditCursor (std::array<std::uint8_t, DATA_MAX_SIZE> &_data) noexcept;
     };
@@ -36,7 +36,7 @@ public:
 
         /// Cursor implementation could copy Shape inside to be more cache coherent and Shape could contain doubles,
         /// which are 8-byte long on all architectures. Therefore we use std::uint64_t as base size type.
-        EMERGENCE_BIND_IMPLEMENTATION_INPLACE (sizeof (std::uint64_t) * 46u);
+        EMERGENCE_BIND_IMPLEMENTATION_INPLACE (sizeof (std::uint64_t) * 47u);
 
         explicit ShapeIntersectionReadCursor (std::array<std::uint8_t, DATA_MAX_SIZE> &_data) noexcept;
     };
@@ -53,7 +53,7 @@ public:
         friend class VolumetricRepresentation;
 
         /// About std::uint64_t: see comment in ShapeIntersectionReadCursor.
-        EMERGENCE_BIND_IMPLEMENTATION_INPLACE (sizeof (std::uint64_t) * 46u);
+        EMERGENCE_BIND_IMPLEMENTATION_INPLACE (sizeof (std::uint64_t) * 47u);
 
         explicit ShapeIntersectionEditCursor (std::array<std::uint8_t, DATA_MAX_SIZE> &_data) noexcept;
     };
@@ -71,7 +71,7 @@ public:
         friend class VolumetricRepresentation;
 
         /// About std::uint64_t: same as in comment in ShapeIntersectionReadCursor, but for Ray caching.
-        EMERGENCE_BIND_IMPLEMENTATION_INPLACE (sizeof (std::uint64_t) * 36u);
+        EMERGENCE_BIND_IMPLEMENTATION_INPLACE (sizeof (std::uint64_t) * 37u);
 
         explicit RayIntersectionReadCursor (std::array<std::uint8_t, DATA_MAX_SIZE> &_data) noexcept;
     };
@@ -88,7 +88,7 @@ public:
         friend class VolumetricRepresentation;
 
         /// About std::uint64_t: see comment in RayIntersectionReadCursor.
-        EMERGENCE_BIND_IMPLEMENTATION_INPLACE (sizeof (std::uint64_t) * 36u);
+        EMERGENCE_BIND_IMPLEMENTATION_INPLACE (sizeof (std::uint64_t) * 37u);
 
         explicit RayIntersectionEditCursor (std::array<std::uint8_t, DATA_MAX_SIZE> &_data) noexcept;
     };
@@ -119,6 +119,14 @@ Collection::Allocator Collection::AllocateAndInsert () noexcept
     return Allocator (array_cast (allocator));
 }
 
+Collection::Allocator Collection::AllocateAndInsertBulk () noexcept
+{
+    auto &internal = block_cast<InternalData> (data);
+    EMERGENCE_ASSERT (internal.storage);
+    Pegasus::Storage::Allocator allocator = internal.storage->AllocateAndInsertBulk ();
+    return Allocator (array_cast (allocator));
+}
+
 LinearRepresentation Collection::CreateLinearRepresentation (StandardLayout::FieldId _keyField) noexcept
 {
     auto &internal = block_cast<InternalData> (data);
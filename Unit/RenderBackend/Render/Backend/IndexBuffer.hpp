@@ -0,0 +1,40 @@
+#pragma once
+
+#include <RenderBackendApi.hpp>
+
+#include <cstdint>
+
+#include <API/Common/ImplementationBinding.hpp>
+
+namespace Emergence::Render::Backend
+{
+/// \brief Persistent index buffer, which content is uploaded once during construction.
+/// \see VertexBuffer
+class RenderBackendApi IndexBuffer final
+{
+public:
+    /// \brief Constructs default invalid object.
+    IndexBuffer () noexcept;
+
+    /// \brief Constructs buffer with copy of given indices, using 32-bit indices if requested.
+    IndexBuffer (const void *_data, std::uint32_t _indexCount, bool _use32BitIndices) noexcept;
+
+    IndexBuffer (const IndexBuffer &_other) = delete;
+
+    IndexBuffer (IndexBuffer &&_other) noexcept;
+
+    ~IndexBuffer () noexcept;
+
+    /// \return Whether buffer was successfully created and ready to be used.
+    [[nodiscard]] bool IsValid () const noexcept;
+
+    IndexBuffer &operator= (const IndexBuffer &_other) = delete;
+
+    IndexBuffer &operator= (IndexBuffer &&_other) noexcept;
+
+private:
+    friend class SubmissionAgent;
+
+    EMERGENCE_BIND_IMPLEMENTATION_INPLACE (sizeof (std::uint64_t) * 2u);
+};
+} // namespace Emergence::Render::Backend
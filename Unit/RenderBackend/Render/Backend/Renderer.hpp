@@ -8,10 +8,12 @@
 #include <Math/Matrix4x4f.hpp>
 #include <Math/Vector4f.hpp>
 
+#include <Render/Backend/IndexBuffer.hpp>
 #include <Render/Backend/Program.hpp>
 #include <Render/Backend/TransientIndexBuffer.hpp>
 #include <Render/Backend/TransientVertexBuffer.hpp>
 #include <Render/Backend/Uniform.hpp>
+#include <Render/Backend/VertexBuffer.hpp>
 #include <Render/Backend/Viewport.hpp>
 
 namespace Emergence::Render::Backend
@@ -101,6 +103,12 @@ public:
                          std::uint32_t _indicesOffset,
                          std::uint32_t _indicesCount) noexcept;
 
+    /// \brief Submits geometry from persistent buffers to given viewport that will be rendered using given program.
+    void SubmitGeometry (ViewportId _viewport,
+                         ProgramId _program,
+                         const VertexBuffer &_vertices,
+                         const IndexBuffer &_indices) noexcept;
+
     /// \brief Informs backend that given viewport is still in use, even if no geometries were submitted to it.
     /// \details Needed to trigger internal procedures like color and depth clearing.
     void Touch (ViewportId _viewport) noexcept;
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <RenderBackendApi.hpp>
+
+#include <cstdint>
+
+#include <API/Common/ImplementationBinding.hpp>
+
+#include <Render/Backend/VertexLayout.hpp>
+
+namespace Emergence::Render::Backend
+{
+/// \brief Persistent vertex buffer, which content is uploaded once during construction.
+/// \details Useful for geometry that is rarely changed, for example, baked static 2d sprites.
+///          It is cheaper to construct new buffer when geometry changes than to fill transient buffer every frame.
+class RenderBackendApi VertexBuffer final
+{
+public:
+    /// \brief Constructs default invalid object.
+    VertexBuffer () noexcept;
+
+    /// \brief Constructs buffer with copy of given vertices, described by given vertex layout.
+    VertexBuffer (const void *_data, std::uint32_t _vertexCount, const VertexLayout &_layout) noexcept;
+
+    VertexBuffer (const VertexBuffer &_other) = delete;
+
+    VertexBuffer (VertexBuffer &&_other) noexcept;
+
+    ~VertexBuffer () noexcept;
+
+    /// \return Whether buffer was successfully created and ready to be used.
+    [[nodiscard]] bool IsValid () const noexcept;
+
+    VertexBuffer &operator= (const VertexBuffer &_other) = delete;
+
+    VertexBuffer &operator= (VertexBuffer &&_other) noexcept;
+
+private:
+    friend class SubmissionAgent;
+
+    EMERGENCE_BIND_IMPLEMENTATION_INPLACE (sizeof (std::uint64_t) * 2u);
+};
+} // namespace Emergence::Render::Backend
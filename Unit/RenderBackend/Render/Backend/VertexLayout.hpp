@@ -58,6 +58,7 @@ public:
 
 private:
     friend class TransientVertexBuffer;
+    friend class VertexBuffer;
     friend class VertexLayoutBuilder;
 
     EMERGENCE_BIND_IMPLEMENTATION_INPLACE (sizeof (std::uintptr_t) * 11u);
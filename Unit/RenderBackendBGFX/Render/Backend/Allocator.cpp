@@ -26,15 +26,16 @@ void *Allocator::realloc (
 
     if (!_pointer)
     {
+        // Store acquired size, because heap must receive the same size during release and resize.
         void *allocated = allocator.Acquire (_size + _alignment, _alignment);
-        *static_cast<std::uintptr_t *> (allocated) = _size;
+        *static_cast<std::uintptr_t *> (allocated) = _size + _alignment;
         return static_cast<std::uint8_t *> (allocated) + _alignment;
     }
 
     void *initialAddress = static_cast<std::uint8_t *> (_pointer) - _alignment;
     void *newAddress = allocator.Resize (initialAddress, _alignment, *static_cast<std::uintptr_t *> (initialAddress),
                                          _size + _alignment);
-    *static_cast<std::uintptr_t *> (newAddress) = _size;
+    *static_cast<std::uintptr_t *> (newAddress) = _size + _alignment;
     return static_cast<std::uint8_t *> (newAddress) + _alignment;
 }
 
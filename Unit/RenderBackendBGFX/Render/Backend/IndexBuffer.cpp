@@ -0,0 +1,68 @@
+#include <API/Common/BlockCast.hpp>
+
+#include <bgfx/bgfx.h>
+
+#include <Log/Log.hpp>
+
+#include <Render/Backend/IndexBuffer.hpp>
+
+namespace Emergence::Render::Backend
+{
+IndexBuffer::IndexBuffer () noexcept
+{
+    block_cast<std::uint16_t> (data) = bgfx::kInvalidHandle;
+}
+
+IndexBuffer::IndexBuffer (const void *_data, std::uint32_t _indexCount, bool _use32BitIndices) noexcept
+{
+    auto &resultHandle = block_cast<std::uint16_t> (data);
+    resultHandle = bgfx::kInvalidHandle;
+
+    if (_indexCount == 0u)
+    {
+        return;
+    }
+
+    const std::uint32_t indexSize = _use32BitIndices ? sizeof (std::uint32_t) : sizeof (std::uint16_t);
+    bgfx::IndexBufferHandle handle = bgfx::createIndexBuffer (
+        bgfx::copy (_data, _indexCount * indexSize), _use32BitIndices ? BGFX_BUFFER_INDEX32 : BGFX_BUFFER_NONE);
+
+    if (!bgfx::isValid (handle))
+    {
+        EMERGENCE_LOG (ERROR, "Render::Backend: Unable to create index buffer.");
+        return;
+    }
+
+    resultHandle = handle.idx;
+}
+
+IndexBuffer::IndexBuffer (IndexBuffer &&_other) noexcept
+{
+    data = _other.data;
+    block_cast<std::uint16_t> (_other.data) = bgfx::kInvalidHandle;
+}
+
+IndexBuffer::~IndexBuffer () noexcept
+{
+    if (auto handle = block_cast<std::uint16_t> (data); handle != bgfx::kInvalidHandle)
+    {
+        bgfx::destroy (bgfx::IndexBufferHandle {handle});
+    }
+}
+
+bool IndexBuffer::IsValid () const noexcept
+{
+    return block_cast<std::uint16_t> (data) != bgfx::kInvalidHandle;
+}
+
+IndexBuffer &IndexBuffer::operator= (IndexBuffer &&_other) noexcept
+{
+    if (this != &_other)
+    {
+        this->~IndexBuffer ();
+        new (this) IndexBuffer (std::move (_other));
+    }
+
+    return *this;
+}
+} // namespace Emergence::Render::Backend
@@ -74,6 +74,21 @@ void SubmissionAgent::SubmitGeometry (ViewportId _viewport,
                      bgfx::ProgramHandle {static_cast<std::uint16_t> (_program)});
 }
 
+void SubmissionAgent::SubmitGeometry (ViewportId _viewport,
+                                      ProgramId _program,
+                                      const VertexBuffer &_vertices,
+                                      const IndexBuffer &_indices) noexcept
+{
+    auto *encoder = block_cast<bgfx::Encoder *> (data);
+    EMERGENCE_ASSERT (encoder);
+    EMERGENCE_ASSERT (_vertices.IsValid ());
+    EMERGENCE_ASSERT (_indices.IsValid ());
+    encoder->setVertexBuffer (0, bgfx::VertexBufferHandle {block_cast<std::uint16_t> (_vertices.data)});
+    encoder->setIndexBuffer (bgfx::IndexBufferHandle {block_cast<std::uint16_t> (_indices.data)});
+    encoder->submit (static_cast<std::uint16_t> (_viewport),
+                     bgfx::ProgramHandle {static_cast<std::uint16_t> (_program)});
+}
+
 void SubmissionAgent::Touch (ViewportId _viewport) noexcept
 {
     auto *encoder = block_cast<bgfx::Encoder *> (data);
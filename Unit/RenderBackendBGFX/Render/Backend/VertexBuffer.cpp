@@ -0,0 +1,69 @@
+#include <API/Common/BlockCast.hpp>
+
+#include <bgfx/bgfx.h>
+
+#include <Log/Log.hpp>
+
+#include <Render/Backend/VertexBuffer.hpp>
+
+namespace Emergence::Render::Backend
+{
+VertexBuffer::VertexBuffer () noexcept
+{
+    block_cast<std::uint16_t> (data) = bgfx::kInvalidHandle;
+}
+
+VertexBuffer::VertexBuffer (const void *_data, std::uint32_t _vertexCount, const VertexLayout &_layout) noexcept
+{
+    auto &resultHandle = block_cast<std::uint16_t> (data);
+    resultHandle = bgfx::kInvalidHandle;
+
+    if (_vertexCount == 0u)
+    {
+        return;
+    }
+
+    const auto &layout = block_cast<bgfx::VertexLayout> (_layout.data);
+    bgfx::VertexBufferHandle handle =
+        bgfx::createVertexBuffer (bgfx::copy (_data, layout.getSize (_vertexCount)), layout);
+
+    if (!bgfx::isValid (handle))
+    {
+        EMERGENCE_LOG (ERROR, "Render::Backend: Unable to create vertex buffer.");
+        return;
+    }
+
+    resultHandle = handle.idx;
+}
+
+VertexBuffer::VertexBuffer (VertexBuffer &&_other) noexcept
+{
+    data = _other.data;
+    block_cast<std::uint16_t> (_other.data) = bgfx::kInvalidHandle;
+}
+
+VertexBuffer::~VertexBuffer () noexcept
+{
+    // BGFX delays destruction until the end of the frame, therefore buffer can be destroyed right after submission.
+    if (auto handle = block_cast<std::uint16_t> (data); handle != bgfx::kInvalidHandle)
+    {
+        bgfx::destroy (bgfx::VertexBufferHandle {handle});
+    }
+}
+
+bool VertexBuffer::IsValid () const noexcept
+{
+    return block_cast<std::uint16_t> (data) != bgfx::kInvalidHandle;
+}
+
+VertexBuffer &VertexBuffer::operator= (VertexBuffer &&_other) noexcept
+{
+    if (this != &_other)
+    {
+        this->~VertexBuffer ();
+        new (this) VertexBuffer (std::move (_other));
+    }
+
+    return *this;
+}
+} // namespace Emergence::Render::Backend
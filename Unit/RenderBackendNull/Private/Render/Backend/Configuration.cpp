@@ -0,0 +1,43 @@
+#include <Log/Log.hpp>
+
+#include <Render/Backend/Configuration.hpp>
+#include <Render/Backend/NullState.hpp>
+
+namespace Emergence::Render::Backend
+{
+Memory::Profiler::AllocationGroup GetSharedAllocationGroup () noexcept
+{
+    return GetAllocationGroup ();
+}
+
+static Config currentConfig;
+
+bool Init (const Config &_config, void * /*unused*/, void * /*unused*/, bool /*unused*/) noexcept
+{
+    // Null backend has no window and no native allocations, therefore only config is stored.
+    currentConfig = _config;
+    return true;
+}
+
+const Config &GetCurrentConfig () noexcept
+{
+    return currentConfig;
+}
+
+bool Update (const Config &_config) noexcept
+{
+    currentConfig = _config;
+    return true;
+}
+
+void TakePngScreenshot (const char *_outputFilePath) noexcept
+{
+    EMERGENCE_LOG (WARNING, "Render::Backend: Unable to take screenshot \"", _outputFilePath,
+                   "\", because null backend does not render anything.");
+}
+
+void Shutdown () noexcept
+{
+    TransientMemory::Get ().Clear ();
+}
+} // namespace Emergence::Render::Backend
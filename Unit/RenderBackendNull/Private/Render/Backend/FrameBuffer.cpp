@@ -0,0 +1,89 @@
+#include <API/Common/BlockCast.hpp>
+
+#include <Assert/Assert.hpp>
+
+#include <Render/Backend/FrameBuffer.hpp>
+#include <Render/Backend/NullState.hpp>
+
+namespace Emergence::Render::Backend
+{
+FrameBuffer FrameBuffer::CreateInvalid () noexcept
+{
+    return {array_cast<std::uint64_t, sizeof (data)> (INVALID_HANDLE)};
+}
+
+FrameBuffer::FrameBuffer (FrameBuffer &&_other) noexcept
+    : data (_other.data)
+{
+    block_cast<std::uint64_t> (_other.data) = INVALID_HANDLE;
+}
+
+FrameBuffer::~FrameBuffer () noexcept = default;
+
+bool FrameBuffer::IsValid () const noexcept
+{
+    return block_cast<std::uint64_t> (data) != INVALID_HANDLE;
+}
+
+FrameBufferId FrameBuffer::GetId () const noexcept
+{
+    return block_cast<std::uint64_t> (data);
+}
+
+FrameBuffer &FrameBuffer::operator= (FrameBuffer &&_other) noexcept
+{
+    if (this != &_other)
+    {
+        this->~FrameBuffer ();
+        new (this) FrameBuffer (std::move (_other));
+    }
+
+    return *this;
+}
+
+FrameBuffer::FrameBuffer (const std::array<std::uint8_t, DATA_MAX_SIZE> &_data) noexcept
+    : data (_data)
+{
+}
+
+struct FrameBufferBuilderInternal final
+{
+    std::uint64_t renderTargetCount = 0u;
+};
+
+FrameBufferBuilder::FrameBufferBuilder () noexcept
+{
+    new (&data) FrameBufferBuilderInternal;
+}
+
+FrameBufferBuilder::FrameBufferBuilder (FrameBufferBuilder &&_other) noexcept
+{
+    new (&data) FrameBufferBuilderInternal {block_cast<FrameBufferBuilderInternal> (_other.data)};
+    block_cast<FrameBufferBuilderInternal> (_other.data).renderTargetCount = 0u;
+}
+
+FrameBufferBuilder::~FrameBufferBuilder () noexcept
+{
+    block_cast<FrameBufferBuilderInternal> (data).~FrameBufferBuilderInternal ();
+}
+
+// NOLINTNEXTLINE(readability-convert-member-functions-to-static): Not for all implementations, also there is assertion.
+void FrameBufferBuilder::Begin () noexcept
+{
+    EMERGENCE_ASSERT (block_cast<FrameBufferBuilderInternal> (data).renderTargetCount == 0u);
+}
+
+void FrameBufferBuilder::AddRenderTarget (const Texture &_texture) noexcept
+{
+    EMERGENCE_ASSERT (_texture.IsValid ());
+    ++block_cast<FrameBufferBuilderInternal> (data).renderTargetCount;
+}
+
+FrameBuffer FrameBufferBuilder::End () noexcept
+{
+    auto &internal = block_cast<FrameBufferBuilderInternal> (data);
+    const std::uint64_t handle = internal.renderTargetCount > 0u ? AllocateHandle () : INVALID_HANDLE;
+    internal.renderTargetCount = 0u;
+    return {array_cast<std::uint64_t, sizeof (FrameBuffer::data)> (handle)};
+}
+} // namespace Emergence::Render::Backend
@@ -0,0 +1,60 @@
+#include <cstring>
+
+#include <API/Common/BlockCast.hpp>
+
+#include <Render/Backend/IndexBuffer.hpp>
+#include <Render/Backend/NullState.hpp>
+
+namespace Emergence::Render::Backend
+{
+IndexBuffer::IndexBuffer () noexcept
+{
+    new (data.data ()) BufferData {};
+}
+
+IndexBuffer::IndexBuffer (const void *_data, std::uint32_t _indexCount, bool _use32BitIndices) noexcept
+{
+    auto &buffer = *new (data.data ()) BufferData {};
+    if (_indexCount == 0u)
+    {
+        return;
+    }
+
+    const std::uint32_t indexSize = _use32BitIndices ? sizeof (std::uint32_t) : sizeof (std::uint16_t);
+    const std::size_t size = static_cast<std::size_t> (_indexCount) * indexSize;
+    buffer.data = GetPersistentBufferHeap ().Acquire (size, BUFFER_ALIGNMENT);
+    buffer.count = _indexCount;
+    buffer.elementSize = indexSize;
+    memcpy (buffer.data, _data, size);
+}
+
+IndexBuffer::IndexBuffer (IndexBuffer &&_other) noexcept
+{
+    new (data.data ()) BufferData {block_cast<BufferData> (_other.data)};
+    block_cast<BufferData> (_other.data) = {};
+}
+
+IndexBuffer::~IndexBuffer () noexcept
+{
+    if (auto &buffer = block_cast<BufferData> (data); buffer.data)
+    {
+        GetPersistentBufferHeap ().Release (buffer.data, static_cast<std::size_t> (buffer.count) * buffer.elementSize);
+    }
+}
+
+bool IndexBuffer::IsValid () const noexcept
+{
+    return block_cast<BufferData> (data).data;
+}
+
+IndexBuffer &IndexBuffer::operator= (IndexBuffer &&_other) noexcept
+{
+    if (this != &_other)
+    {
+        this->~IndexBuffer ();
+        new (this) IndexBuffer (std::move (_other));
+    }
+
+    return *this;
+}
+} // namespace Emergence::Render::Backend
@@ -0,0 +1,136 @@
+#include <algorithm>
+
+#include <Render/Backend/NullState.hpp>
+
+#include <Threading/AtomicFlagGuard.hpp>
+
+namespace Emergence::Render::Backend
+{
+Memory::Profiler::AllocationGroup GetAllocationGroup () noexcept
+{
+    static Memory::Profiler::AllocationGroup group {Memory::Profiler::AllocationGroup::Root (),
+                                                    Memory::UniqueString {"Render::Backend::Null"}};
+    return group;
+}
+
+std::uint64_t AllocateHandle () noexcept
+{
+    static std::atomic_uint64_t handleCounter = 0u;
+    return handleCounter++;
+}
+
+Memory::Heap &GetPersistentBufferHeap () noexcept
+{
+    static Memory::Heap heap {GetAllocationGroup ()};
+    return heap;
+}
+
+/// \brief Default page size is big enough to fit geometry of several thousands of sprites.
+static constexpr std::size_t TRANSIENT_PAGE_SIZE = 1024u * 1024u;
+
+TransientMemory &TransientMemory::Get () noexcept
+{
+    static TransientMemory memory;
+    return memory;
+}
+
+TransientMemory::~TransientMemory () noexcept
+{
+    Clear ();
+}
+
+void *TransientMemory::Acquire (std::size_t _bytes) noexcept
+{
+    _bytes = std::max (_bytes, std::size_t {1u});
+    AtomicFlagGuard guard {lock};
+
+    if (!pages.empty ())
+    {
+        Page &page = pages.back ();
+        const std::size_t offset = (page.used + BUFFER_ALIGNMENT - 1u) & ~(BUFFER_ALIGNMENT - 1u);
+
+        if (offset + _bytes <= page.capacity)
+        {
+            page.used = offset + _bytes;
+            return page.data + offset;
+        }
+    }
+
+    AddPage (std::max (_bytes, TRANSIENT_PAGE_SIZE));
+    Page &page = pages.back ();
+    page.used = _bytes;
+    return page.data;
+}
+
+void TransientMemory::Reset () noexcept
+{
+    if (pages.size () > 1u)
+    {
+        std::size_t totalCapacity = 0u;
+        for (const Page &page : pages)
+        {
+            totalCapacity += page.capacity;
+        }
+
+        Clear ();
+        AddPage (totalCapacity);
+    }
+    else if (!pages.empty ())
+    {
+        pages.back ().used = 0u;
+    }
+}
+
+void TransientMemory::Clear () noexcept
+{
+    for (const Page &page : pages)
+    {
+        heap.Release (page.data, page.capacity);
+    }
+
+    pages.clear ();
+}
+
+void TransientMemory::AddPage (std::size_t _capacity) noexcept
+{
+    pages.emplace_back (Page {static_cast<std::uint8_t *> (heap.Acquire (_capacity, BUFFER_ALIGNMENT)), _capacity, 0u});
+}
+
+FrameCounters &FrameCounters::Get () noexcept
+{
+    static FrameCounters counters;
+    return counters;
+}
+
+void FrameCounters::Flush (Null::FrameStatistics &_output) noexcept
+{
+    _output.geometrySubmissions = geometrySubmissions.exchange (0u, std::memory_order_relaxed);
+    _output.submittedVertices = submittedVertices.exchange (0u, std::memory_order_relaxed);
+    _output.submittedIndices = submittedIndices.exchange (0u, std::memory_order_relaxed);
+    _output.uniformSubmissions = uniformSubmissions.exchange (0u, std::memory_order_relaxed);
+    _output.stateChanges = stateChanges.exchange (0u, std::memory_order_relaxed);
+    _output.touches = touches.exchange (0u, std::memory_order_relaxed);
+    _output.checksum = checksum.exchange (0u, std::memory_order_relaxed);
+}
+
+static Null::FrameStatistics lastFrameStatistics;
+
+void FinishFrame () noexcept
+{
+    FrameCounters::Get ().Flush (lastFrameStatistics);
+    TransientMemory::Get ().Reset ();
+}
+
+namespace Null
+{
+void SetChecksumEnabled (bool _enabled) noexcept
+{
+    FrameCounters::Get ().checksumEnabled.store (_enabled, std::memory_order_relaxed);
+}
+
+const FrameStatistics &GetLastFrameStatistics () noexcept
+{
+    return lastFrameStatistics;
+}
+} // namespace Null
+} // namespace Emergence::Render::Backend
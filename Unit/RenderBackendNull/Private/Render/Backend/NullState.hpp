@@ -0,0 +1,112 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+
+#include <API/Common/Shortcuts.hpp>
+
+#include <Container/Vector.hpp>
+
+#include <Memory/Heap.hpp>
+
+#include <Render/Backend/Null/Statistics.hpp>
+
+namespace Emergence::Render::Backend
+{
+Memory::Profiler::AllocationGroup GetAllocationGroup () noexcept;
+
+/// \brief Null backend has no native objects, therefore handles are just unique numbers and this one is reserved.
+constexpr std::uint64_t INVALID_HANDLE = std::numeric_limits<std::uint64_t>::max ();
+
+/// \return New unique handle for texture, program, uniform or frame buffer.
+std::uint64_t AllocateHandle () noexcept;
+
+/// \brief Heap for persistent vertex and index buffers. Buffers are aligned in the same way as transient ones.
+Memory::Heap &GetPersistentBufferHeap () noexcept;
+
+/// \brief Alignment for both transient and persistent buffers: as vertices with 4x4 float matrices inside.
+constexpr std::size_t BUFFER_ALIGNMENT = 16u;
+
+/// \brief Data of transient and persistent vertex and index buffers.
+struct BufferData final
+{
+    void *data = nullptr;
+    std::uint32_t count = 0u;
+    std::uint32_t elementSize = 0u;
+};
+
+/// \brief Data of both VertexLayout and VertexLayoutBuilder. Only vertex size is needed to allocate buffers.
+struct VertexLayoutData final
+{
+    std::uint32_t stride = 0u;
+};
+
+/// \brief Allocates transient buffers from memory pages, that are reused after every frame.
+class TransientMemory final
+{
+public:
+    static TransientMemory &Get () noexcept;
+
+    TransientMemory (const TransientMemory &_other) = delete;
+
+    TransientMemory (TransientMemory &&_other) = delete;
+
+    ~TransientMemory () noexcept;
+
+    /// \brief Acquires memory block, that is valid until the end of current frame.
+    /// \details Thread safe.
+    void *Acquire (std::size_t _bytes) noexcept;
+
+    /// \brief Makes all memory available for the next frame.
+    /// \details If frame used multiple pages, they are merged into one, so next frames use only one page.
+    /// \warning Not thread safe.
+    void Reset () noexcept;
+
+    /// \brief Releases all memory pages.
+    /// \warning Not thread safe.
+    void Clear () noexcept;
+
+    EMERGENCE_DELETE_ASSIGNMENT (TransientMemory);
+
+private:
+    struct Page final
+    {
+        std::uint8_t *data = nullptr;
+        std::size_t capacity = 0u;
+        std::size_t used = 0u;
+    };
+
+    TransientMemory () noexcept = default;
+
+    void AddPage (std::size_t _capacity) noexcept;
+
+    std::atomic_flag lock;
+    Memory::Heap heap {GetAllocationGroup ()};
+    Container::Vector<Page> pages {GetAllocationGroup ()};
+};
+
+/// \brief Counters for FrameStatistics that are updated by submission agents in parallel.
+struct FrameCounters final
+{
+    static FrameCounters &Get () noexcept;
+
+    /// \brief Writes counter values into given statistics and resets counters.
+    /// \warning Not thread safe.
+    void Flush (Null::FrameStatistics &_output) noexcept;
+
+    std::atomic_uint64_t geometrySubmissions = 0u;
+    std::atomic_uint64_t submittedVertices = 0u;
+    std::atomic_uint64_t submittedIndices = 0u;
+    std::atomic_uint64_t uniformSubmissions = 0u;
+    std::atomic_uint64_t stateChanges = 0u;
+    std::atomic_uint64_t touches = 0u;
+    std::atomic_uint64_t checksum = 0u;
+
+    /// \brief Whether commands should be hashed into ::checksum.
+    std::atomic_bool checksumEnabled = false;
+};
+
+/// \brief Informs null backend that frame is finished: statistics are published and transient memory is reused.
+void FinishFrame () noexcept;
+} // namespace Emergence::Render::Backend
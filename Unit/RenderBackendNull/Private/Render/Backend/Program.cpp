@@ -0,0 +1,71 @@
+#include <API/Common/BlockCast.hpp>
+
+#include <Log/Log.hpp>
+
+#include <Render/Backend/NullState.hpp>
+#include <Render/Backend/Program.hpp>
+
+namespace Emergence::Render::Backend
+{
+const char *Program::GetShaderSuffix () noexcept
+{
+    return ".spirv";
+}
+
+Program::Program () noexcept
+{
+    block_cast<std::uint64_t> (data) = INVALID_HANDLE;
+}
+
+Program::Program (const std::uint8_t *_vertexShaderData,
+                  std::uint64_t _vertexShaderSize,
+                  const std::uint8_t *_fragmentShaderData,
+                  std::uint64_t _fragmentShaderSize) noexcept
+{
+    auto &resultHandle = block_cast<std::uint64_t> (data);
+    resultHandle = INVALID_HANDLE;
+
+    if (!_vertexShaderData || _vertexShaderSize == 0u)
+    {
+        EMERGENCE_LOG (ERROR, "Render::Backend: Unable to load vertex shader from given data.");
+        return;
+    }
+
+    if (!_fragmentShaderData || _fragmentShaderSize == 0u)
+    {
+        EMERGENCE_LOG (ERROR, "Render::Backend: Unable to load fragment shader from given data.");
+        return;
+    }
+
+    resultHandle = AllocateHandle ();
+}
+
+Program::Program (Program &&_other) noexcept
+{
+    data = _other.data;
+    block_cast<std::uint64_t> (_other.data) = INVALID_HANDLE;
+}
+
+Program::~Program () noexcept = default;
+
+bool Program::IsValid () const noexcept
+{
+    return block_cast<std::uint64_t> (data) != INVALID_HANDLE;
+}
+
+ProgramId Program::GetId () const noexcept
+{
+    return block_cast<std::uint64_t> (data);
+}
+
+Program &Program::operator= (Program &&_other) noexcept
+{
+    if (this != &_other)
+    {
+        this->~Program ();
+        new (this) Program (std::move (_other));
+    }
+
+    return *this;
+}
+} // namespace Emergence::Render::Backend
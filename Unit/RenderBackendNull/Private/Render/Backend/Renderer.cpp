@@ -0,0 +1,266 @@
+#include <API/Common/BlockCast.hpp>
+
+#include <Assert/Assert.hpp>
+
+#include <Hashing/ByteHasher.hpp>
+
+#include <Render/Backend/NullState.hpp>
+#include <Render/Backend/Renderer.hpp>
+#include <Render/Backend/RendererData.hpp>
+
+namespace Emergence::Render::Backend
+{
+/// \brief Identifies command type inside command hash, so different commands with the same data have different hashes.
+enum class Command : std::uint8_t
+{
+    SET_UNIFORM = 0u,
+    SET_SAMPLER,
+    SET_SCISSOR,
+    SET_STATE,
+    SUBMIT_GEOMETRY,
+    TOUCH,
+};
+
+/// \brief Calculates hash of one command and adds it to frame checksum.
+class CommandHash final
+{
+public:
+    explicit CommandHash (Command _command) noexcept
+    {
+        AppendValue (_command);
+    }
+
+    template <typename Value>
+    void AppendValue (const Value &_value) noexcept
+    {
+        AppendBytes (&_value, sizeof (Value));
+    }
+
+    void AppendBytes (const void *_bytes, std::size_t _count) noexcept
+    {
+        hasher.Append (static_cast<const std::uint8_t *> (_bytes), _count);
+    }
+
+    void Submit (FrameCounters &_counters) const noexcept
+    {
+        _counters.checksum.fetch_add (hasher.GetCurrentValue (), std::memory_order_relaxed);
+    }
+
+private:
+    Hashing::ByteHasher hasher;
+};
+
+static void SubmitBufferData (FrameCounters &_counters,
+                              ViewportId _viewport,
+                              ProgramId _program,
+                              const BufferData &_vertices,
+                              std::uint32_t _verticesOffset,
+                              std::uint32_t _verticesCount,
+                              const BufferData &_indices,
+                              std::uint32_t _indicesOffset,
+                              std::uint32_t _indicesCount) noexcept
+{
+    EMERGENCE_ASSERT (_program != INVALID_HANDLE);
+    EMERGENCE_ASSERT (_verticesOffset + _verticesCount <= _vertices.count);
+    EMERGENCE_ASSERT (_indicesOffset + _indicesCount <= _indices.count);
+
+    _counters.geometrySubmissions.fetch_add (1u, std::memory_order_relaxed);
+    _counters.submittedVertices.fetch_add (_verticesCount, std::memory_order_relaxed);
+    _counters.submittedIndices.fetch_add (_indicesCount, std::memory_order_relaxed);
+
+    if (_counters.checksumEnabled.load (std::memory_order_relaxed))
+    {
+        CommandHash hash {Command::SUBMIT_GEOMETRY};
+        hash.AppendValue (_viewport);
+        hash.AppendValue (_program);
+        hash.AppendBytes (static_cast<const std::uint8_t *> (_vertices.data) + _verticesOffset * _vertices.elementSize,
+                          static_cast<std::size_t> (_verticesCount) * _vertices.elementSize);
+        hash.AppendBytes (static_cast<const std::uint8_t *> (_indices.data) + _indicesOffset * _indices.elementSize,
+                          static_cast<std::size_t> (_indicesCount) * _indices.elementSize);
+        hash.Submit (_counters);
+    }
+}
+
+static void SetUniform (FrameCounters &_counters, UniformId _uniform, const void *_value, std::size_t _size) noexcept
+{
+    EMERGENCE_ASSERT (_uniform != INVALID_HANDLE);
+    _counters.uniformSubmissions.fetch_add (1u, std::memory_order_relaxed);
+
+    if (_counters.checksumEnabled.load (std::memory_order_relaxed))
+    {
+        CommandHash hash {Command::SET_UNIFORM};
+        hash.AppendValue (_uniform);
+        hash.AppendBytes (_value, _size);
+        hash.Submit (_counters);
+    }
+}
+
+SubmissionAgent::SubmissionAgent (SubmissionAgent &&_other) noexcept
+{
+    data = _other.data;
+    block_cast<FrameCounters *> (_other.data) = nullptr;
+}
+
+SubmissionAgent::~SubmissionAgent () noexcept = default;
+
+void SubmissionAgent::SetScissor (std::uint32_t _x,
+                                  std::uint32_t _y,
+                                  std::uint32_t _width,
+                                  std::uint32_t _height) noexcept
+{
+    auto *counters = block_cast<FrameCounters *> (data);
+    EMERGENCE_ASSERT (counters);
+    counters->stateChanges.fetch_add (1u, std::memory_order_relaxed);
+
+    if (counters->checksumEnabled.load (std::memory_order_relaxed))
+    {
+        CommandHash hash {Command::SET_SCISSOR};
+        hash.AppendValue (_x);
+        hash.AppendValue (_y);
+        hash.AppendValue (_width);
+        hash.AppendValue (_height);
+        hash.Submit (*counters);
+    }
+}
+
+void SubmissionAgent::SetState (std::uint64_t _state) noexcept
+{
+    auto *counters = block_cast<FrameCounters *> (data);
+    EMERGENCE_ASSERT (counters);
+    counters->stateChanges.fetch_add (1u, std::memory_order_relaxed);
+
+    if (counters->checksumEnabled.load (std::memory_order_relaxed))
+    {
+        CommandHash hash {Command::SET_STATE};
+        hash.AppendValue (_state);
+        hash.Submit (*counters);
+    }
+}
+
+void SubmissionAgent::SubmitGeometry (ViewportId _viewport,
+                                      ProgramId _program,
+                                      const TransientVertexBuffer &_vertices,
+                                      const TransientIndexBuffer &_indices) noexcept
+{
+    const auto &vertices = block_cast<BufferData> (_vertices.data);
+    const auto &indices = block_cast<BufferData> (_indices.data);
+    SubmitGeometry (_viewport, _program, _vertices, 0u, vertices.count, _indices, 0u, indices.count);
+}
+
+void SubmissionAgent::SubmitGeometry (ViewportId _viewport,
+                                      ProgramId _program,
+                                      const TransientVertexBuffer &_vertices,
+                                      std::uint32_t _verticesOffset,
+                                      std::uint32_t _verticesCount,
+                                      const TransientIndexBuffer &_indices,
+                                      std::uint32_t _indicesOffset,
+                                      std::uint32_t _indicesCount) noexcept
+{
+    auto *counters = block_cast<FrameCounters *> (data);
+    EMERGENCE_ASSERT (counters);
+    SubmitBufferData (*counters, _viewport, _program, block_cast<BufferData> (_vertices.data), _verticesOffset,
+                      _verticesCount, block_cast<BufferData> (_indices.data), _indicesOffset, _indicesCount);
+}
+
+void SubmissionAgent::SubmitGeometry (ViewportId _viewport,
+                                      ProgramId _program,
+                                      const VertexBuffer &_vertices,
+                                      const IndexBuffer &_indices) noexcept
+{
+    auto *counters = block_cast<FrameCounters *> (data);
+    EMERGENCE_ASSERT (counters);
+    EMERGENCE_ASSERT (_vertices.IsValid ());
+    EMERGENCE_ASSERT (_indices.IsValid ());
+
+    const auto &vertices = block_cast<BufferData> (_vertices.data);
+    const auto &indices = block_cast<BufferData> (_indices.data);
+    SubmitBufferData (*counters, _viewport, _program, vertices, 0u, vertices.count, indices, 0u, indices.count);
+}
+
+void SubmissionAgent::Touch (ViewportId _viewport) noexcept
+{
+    auto *counters = block_cast<FrameCounters *> (data);
+    EMERGENCE_ASSERT (counters);
+    counters->touches.fetch_add (1u, std::memory_order_relaxed);
+
+    if (counters->checksumEnabled.load (std::memory_order_relaxed))
+    {
+        CommandHash hash {Command::TOUCH};
+        hash.AppendValue (_viewport);
+        hash.Submit (*counters);
+    }
+}
+
+void SubmissionAgent::SetVector4f (UniformId _uniform, const Math::Vector4f &_value) noexcept
+{
+    auto *counters = block_cast<FrameCounters *> (data);
+    EMERGENCE_ASSERT (counters);
+    SetUniform (*counters, _uniform, &_value, sizeof (_value));
+}
+
+void SubmissionAgent::SetMatrix3x3f (UniformId _uniform, const Math::Matrix3x3f &_value) noexcept
+{
+    auto *counters = block_cast<FrameCounters *> (data);
+    EMERGENCE_ASSERT (counters);
+    SetUniform (*counters, _uniform, &_value, sizeof (_value));
+}
+
+void SubmissionAgent::SetMatrix4x4f (UniformId _uniform, const Math::Matrix4x4f &_value) noexcept
+{
+    auto *counters = block_cast<FrameCounters *> (data);
+    EMERGENCE_ASSERT (counters);
+    SetUniform (*counters, _uniform, &_value, sizeof (_value));
+}
+
+void SubmissionAgent::SetSampler (UniformId _uniform, std::uint8_t _stage, TextureId _texture) noexcept
+{
+    auto *counters = block_cast<FrameCounters *> (data);
+    EMERGENCE_ASSERT (counters);
+    EMERGENCE_ASSERT (_uniform != INVALID_HANDLE);
+    EMERGENCE_ASSERT (_texture != INVALID_HANDLE);
+    counters->uniformSubmissions.fetch_add (1u, std::memory_order_relaxed);
+
+    if (counters->checksumEnabled.load (std::memory_order_relaxed))
+    {
+        CommandHash hash {Command::SET_SAMPLER};
+        hash.AppendValue (_uniform);
+        hash.AppendValue (_stage);
+        hash.AppendValue (_texture);
+        hash.Submit (*counters);
+    }
+}
+
+SubmissionAgent::SubmissionAgent (void *_pointer) noexcept
+{
+    EMERGENCE_ASSERT (_pointer);
+    block_cast<FrameCounters *> (data) = static_cast<FrameCounters *> (_pointer);
+}
+
+Renderer::Renderer () noexcept
+{
+    new (data.data ()) RendererData ();
+}
+
+Renderer::~Renderer () noexcept
+{
+    block_cast<RendererData> (data).~RendererData ();
+}
+
+// NOLINTNEXTLINE(readability-convert-member-functions-to-static): Being non-static is a part of the API.
+SubmissionAgent Renderer::BeginSubmission () noexcept
+{
+    return SubmissionAgent {&FrameCounters::Get ()};
+}
+
+// NOLINTNEXTLINE(readability-convert-member-functions-to-static): Being non-static is a part of the API.
+void Renderer::SubmitViewportOrder (const Container::Vector<ViewportId> & /*unused*/) noexcept
+{
+    // Nothing is rendered, therefore viewport order doesn't matter.
+}
+
+// NOLINTNEXTLINE(readability-convert-member-functions-to-static): Being non-static is a part of the API.
+void Renderer::SubmitFrame () noexcept
+{
+    FinishFrame ();
+}
+} // namespace Emergence::Render::Backend
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <atomic>
+
+namespace Emergence::Render::Backend
+{
+struct RendererData final
+{
+    std::atomic_uintptr_t viewportIndexCounter = 0u;
+};
+} // namespace Emergence::Render::Backend
@@ -0,0 +1,95 @@
+#include <API/Common/BlockCast.hpp>
+
+#include <Log/Log.hpp>
+
+#include <Render/Backend/NullState.hpp>
+#include <Render/Backend/Texture.hpp>
+
+#include <StandardLayout/MappingRegistration.hpp>
+
+namespace Emergence::Render::Backend
+{
+const TextureSettings::Reflection &TextureSettings::Reflect () noexcept
+{
+    static const Reflection reflection = [] ()
+    {
+        EMERGENCE_MAPPING_REGISTRATION_BEGIN (TextureSettings);
+        EMERGENCE_MAPPING_REGISTER_REGULAR (uSampling);
+        EMERGENCE_MAPPING_REGISTER_REGULAR (vSampling);
+        EMERGENCE_MAPPING_REGISTER_REGULAR (wSampling);
+        EMERGENCE_MAPPING_REGISTRATION_END ();
+    }();
+
+    return reflection;
+}
+
+Texture Texture::CreateInvalid () noexcept
+{
+    return {array_cast<std::uint64_t, sizeof (data)> (INVALID_HANDLE)};
+}
+
+Texture Texture::CreateFromFile (const std::uint8_t *_data,
+                                 std::uint64_t _size,
+                                 const TextureSettings & /*unused*/) noexcept
+{
+    // Texture data is never sampled, therefore there is no need to parse it.
+    if (!_data || _size == 0u)
+    {
+        EMERGENCE_LOG (ERROR, "Render::Backend: Unable to parse texture data!");
+        return CreateInvalid ();
+    }
+
+    return {array_cast<std::uint64_t, sizeof (data)> (AllocateHandle ())};
+}
+
+Texture Texture::CreateFromRaw (std::uint64_t /*unused*/,
+                                std::uint64_t /*unused*/,
+                                TextureFormat /*unused*/,
+                                const std::uint8_t * /*unused*/,
+                                const TextureSettings & /*unused*/) noexcept
+{
+    return {array_cast<std::uint64_t, sizeof (data)> (AllocateHandle ())};
+}
+
+Texture Texture::CreateRenderTarget (std::uint64_t /*unused*/,
+                                     std::uint64_t /*unused*/,
+                                     TextureFormat /*unused*/,
+                                     const TextureSettings & /*unused*/) noexcept
+{
+    return {array_cast<std::uint64_t, sizeof (data)> (AllocateHandle ())};
+}
+
+Texture::Texture (Texture &&_other) noexcept
+    : data (_other.data)
+{
+    block_cast<std::uint64_t> (_other.data) = INVALID_HANDLE;
+}
+
+Texture::~Texture () noexcept = default;
+
+bool Texture::IsValid () const noexcept
+{
+    return block_cast<std::uint64_t> (data) != INVALID_HANDLE;
+}
+
+TextureId Texture::GetId () const noexcept
+{
+    return block_cast<std::uint64_t> (data);
+}
+
+Texture &Texture::operator= (Texture &&_other) noexcept
+{
+    if (this != &_other)
+    {
+        this->~Texture ();
+        new (this) Texture (std::move (_other));
+    }
+
+    return *this;
+}
+
+Texture::Texture (const std::array<std::uint8_t, DATA_MAX_SIZE> &_data) noexcept
+    : data (_data)
+{
+}
+} // namespace Emergence::Render::Backend
@@ -0,0 +1,32 @@
+#include <API/Common/BlockCast.hpp>
+
+#include <Render/Backend/NullState.hpp>
+#include <Render/Backend/TransientIndexBuffer.hpp>
+
+namespace Emergence::Render::Backend
+{
+std::uint32_t TransientIndexBuffer::TruncateSizeToAvailability (std::uint32_t _indexCount, bool /*unused*/)
+{
+    // Transient memory is not limited, because it is allocated from plain memory pages.
+    return _indexCount;
+}
+
+TransientIndexBuffer::TransientIndexBuffer (std::uint32_t _indexCount, bool _use32BitIndices) noexcept
+{
+    const std::uint32_t indexSize = _use32BitIndices ? sizeof (std::uint32_t) : sizeof (std::uint16_t);
+    new (data.data ()) BufferData {
+        TransientMemory::Get ().Acquire (static_cast<std::size_t> (_indexCount) * indexSize), _indexCount, indexSize};
+}
+
+TransientIndexBuffer::~TransientIndexBuffer () noexcept = default;
+
+void *TransientIndexBuffer::GetData () noexcept
+{
+    return block_cast<BufferData> (data).data;
+}
+
+const void *TransientIndexBuffer::GetData () const noexcept
+{
+    return block_cast<BufferData> (data).data;
+}
+} // namespace Emergence::Render::Backend
@@ -0,0 +1,33 @@
+#include <API/Common/BlockCast.hpp>
+
+#include <Render/Backend/NullState.hpp>
+#include <Render/Backend/TransientVertexBuffer.hpp>
+
+namespace Emergence::Render::Backend
+{
+std::uint32_t TransientVertexBuffer::TruncateSizeToAvailability (std::uint32_t _vertexCount,
+                                                                 const VertexLayout & /*unused*/)
+{
+    // Transient memory is not limited, because it is allocated from plain memory pages.
+    return _vertexCount;
+}
+
+TransientVertexBuffer::TransientVertexBuffer (std::uint32_t _vertexCount, const VertexLayout &_layout) noexcept
+{
+    const std::uint32_t stride = block_cast<VertexLayoutData> (_layout.data).stride;
+    new (data.data ()) BufferData {
+        TransientMemory::Get ().Acquire (static_cast<std::size_t> (_vertexCount) * stride), _vertexCount, stride};
+}
+
+TransientVertexBuffer::~TransientVertexBuffer () noexcept = default;
+
+void *TransientVertexBuffer::GetData () noexcept
+{
+    return block_cast<BufferData> (data).data;
+}
+
+const void *TransientVertexBuffer::GetData () const noexcept
+{
+    return block_cast<BufferData> (data).data;
+}
+} // namespace Emergence::Render::Backend
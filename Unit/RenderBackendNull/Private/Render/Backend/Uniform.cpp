@@ -0,0 +1,46 @@
+#include <API/Common/BlockCast.hpp>
+
+#include <Render/Backend/NullState.hpp>
+#include <Render/Backend/Uniform.hpp>
+
+namespace Emergence::Render::Backend
+{
+Uniform::Uniform () noexcept
+{
+    block_cast<std::uint64_t> (data) = INVALID_HANDLE;
+}
+
+Uniform::Uniform (Memory::UniqueString /*unused*/, UniformType /*unused*/) noexcept
+{
+    block_cast<std::uint64_t> (data) = AllocateHandle ();
+}
+
+Uniform::Uniform (Uniform &&_other) noexcept
+{
+    data = _other.data;
+    block_cast<std::uint64_t> (_other.data) = INVALID_HANDLE;
+}
+
+Uniform::~Uniform () noexcept = default;
+
+UniformId Uniform::GetId () const noexcept
+{
+    return block_cast<std::uint64_t> (data);
+}
+
+bool Uniform::IsValid () const noexcept
+{
+    return block_cast<std::uint64_t> (data) != INVALID_HANDLE;
+}
+
+Uniform &Uniform::operator= (Uniform &&_other) noexcept
+{
+    if (this != &_other)
+    {
+        this->~Uniform ();
+        new (this) Uniform (std::move (_other));
+    }
+
+    return *this;
+}
+} // namespace Emergence::Render::Backend
@@ -0,0 +1,60 @@
+#include <cstring>
+
+#include <API/Common/BlockCast.hpp>
+
+#include <Render/Backend/NullState.hpp>
+#include <Render/Backend/VertexBuffer.hpp>
+
+namespace Emergence::Render::Backend
+{
+VertexBuffer::VertexBuffer () noexcept
+{
+    new (data.data ()) BufferData {};
+}
+
+VertexBuffer::VertexBuffer (const void *_data, std::uint32_t _vertexCount, const VertexLayout &_layout) noexcept
+{
+    auto &buffer = *new (data.data ()) BufferData {};
+    if (_vertexCount == 0u)
+    {
+        return;
+    }
+
+    const std::uint32_t stride = block_cast<VertexLayoutData> (_layout.data).stride;
+    const std::size_t size = static_cast<std::size_t> (_vertexCount) * stride;
+    buffer.data = GetPersistentBufferHeap ().Acquire (size, BUFFER_ALIGNMENT);
+    buffer.count = _vertexCount;
+    buffer.elementSize = stride;
+    memcpy (buffer.data, _data, size);
+}
+
+VertexBuffer::VertexBuffer (VertexBuffer &&_other) noexcept
+{
+    new (data.data ()) BufferData {block_cast<BufferData> (_other.data)};
+    block_cast<BufferData> (_other.data) = {};
+}
+
+VertexBuffer::~VertexBuffer () noexcept
+{
+    if (auto &buffer = block_cast<BufferData> (data); buffer.data)
+    {
+        GetPersistentBufferHeap ().Release (buffer.data, static_cast<std::size_t> (buffer.count) * buffer.elementSize);
+    }
+}
+
+bool VertexBuffer::IsValid () const noexcept
+{
+    return block_cast<BufferData> (data).data;
+}
+
+VertexBuffer &VertexBuffer::operator= (VertexBuffer &&_other) noexcept
+{
+    if (this != &_other)
+    {
+        this->~VertexBuffer ();
+        new (this) VertexBuffer (std::move (_other));
+    }
+
+    return *this;
+}
+} // namespace Emergence::Render::Backend
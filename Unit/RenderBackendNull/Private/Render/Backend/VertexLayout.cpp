@@ -0,0 +1,86 @@
+#include <API/Common/BlockCast.hpp>
+
+#include <Assert/Assert.hpp>
+
+#include <Render/Backend/NullState.hpp>
+#include <Render/Backend/VertexLayout.hpp>
+
+namespace Emergence::Render::Backend
+{
+/// \return Size of attribute with given type and element count, calculated using the same rules as BGFX uses
+///         for Direct3D and Vulkan, so transient buffer sizes are the same as in real rendering.
+static std::uint32_t GetAttributeSize (AttributeType _type, std::uint8_t _elementCount) noexcept
+{
+    EMERGENCE_ASSERT (_elementCount > 0u && _elementCount <= 4u);
+    switch (_type)
+    {
+    case AttributeType::UINT8:
+        // 3 element attributes are padded to 4 bytes.
+        return _elementCount == 3u ? 4u : _elementCount;
+
+    case AttributeType::INT16:
+    case AttributeType::HALF_FLOAT:
+        // 3 element attributes are padded to 8 bytes.
+        return _elementCount == 3u ? 8u : _elementCount * 2u;
+
+    case AttributeType::FLOAT:
+        return _elementCount * 4u;
+    }
+
+    EMERGENCE_ASSERT (false);
+    return 0u;
+}
+
+VertexLayout::VertexLayout (VertexLayout &&_other) noexcept
+{
+    new (data.data ()) VertexLayoutData (block_cast<VertexLayoutData> (_other.data));
+}
+
+VertexLayout::~VertexLayout () noexcept
+{
+    block_cast<VertexLayoutData> (data).~VertexLayoutData ();
+}
+
+VertexLayout &VertexLayout::operator= (VertexLayout &&_other) noexcept
+{
+    if (this != &_other)
+    {
+        this->~VertexLayout ();
+        new (this) VertexLayout (std::move (_other));
+    }
+
+    return *this;
+}
+
+VertexLayout::VertexLayout (std::array<std::uint8_t, DATA_MAX_SIZE> *_data) noexcept
+{
+    new (data.data ()) VertexLayoutData (block_cast<VertexLayoutData> (*_data));
+}
+
+VertexLayoutBuilder::VertexLayoutBuilder () noexcept = default;
+
+VertexLayoutBuilder::~VertexLayoutBuilder () noexcept = default;
+
+VertexLayoutBuilder &VertexLayoutBuilder::Begin () noexcept
+{
+    new (data.data ()) VertexLayoutData ();
+    return *this;
+}
+
+VertexLayoutBuilder &VertexLayoutBuilder::Add (Attribute /*unused*/,
+                                               AttributeType _type,
+                                               std::uint8_t _elementCount,
+                                               bool /*unused*/) noexcept
+{
+    block_cast<VertexLayoutData> (data).stride += GetAttributeSize (_type, _elementCount);
+    return *this;
+}
+
+VertexLayout VertexLayoutBuilder::End () noexcept
+{
+    auto &layout = block_cast<VertexLayoutData> (data);
+    VertexLayout result {reinterpret_cast<decltype (VertexLayout::data) *> (&layout)};
+    layout.~VertexLayoutData ();
+    return result;
+}
+} // namespace Emergence::Render::Backend
@@ -0,0 +1,57 @@
+#include <limits>
+
+#include <API/Common/BlockCast.hpp>
+
+#include <Render/Backend/Renderer.hpp>
+#include <Render/Backend/RendererData.hpp>
+#include <Render/Backend/Viewport.hpp>
+
+namespace Emergence::Render::Backend
+{
+Viewport::Viewport () noexcept
+{
+    block_cast<std::uint64_t> (data) = std::numeric_limits<std::uint64_t>::max ();
+}
+
+Viewport::Viewport (class Renderer &_context) noexcept
+{
+    block_cast<std::uint64_t> (data) = block_cast<RendererData> (_context.data).viewportIndexCounter++;
+}
+
+Viewport::Viewport (Viewport &&_other) noexcept
+    : data (_other.data)
+{
+    block_cast<std::uint64_t> (_other.data) = std::numeric_limits<std::uint64_t>::max ();
+}
+
+Viewport::~Viewport () noexcept = default;
+
+// NOLINTNEXTLINE(readability-convert-member-functions-to-static): Being non-static is a part of the API.
+void Viewport::SubmitConfiguration (const FrameBuffer & /*unused*/,
+                                    std::uint32_t /*unused*/,
+                                    std::uint32_t /*unused*/,
+                                    std::uint32_t /*unused*/,
+                                    std::uint32_t /*unused*/,
+                                    ViewportSortMode /*unused*/,
+                                    std::uint32_t /*unused*/) noexcept
+{
+    // Nothing is rendered, therefore viewport configuration is not needed.
+}
+
+// NOLINTNEXTLINE(readability-convert-member-functions-to-static): Being non-static is a part of the API.
+void Viewport::SubmitOrthographicView (const Math::Transform2d & /*unused*/, const Math::Vector2f & /*unused*/) noexcept
+{
+    // Nothing is rendered, therefore view and projection matrices are not needed.
+}
+
+ViewportId Viewport::GetId () const noexcept
+{
+    return block_cast<std::uint64_t> (data);
+}
+
+Viewport &Viewport::operator= (Viewport &&_other) noexcept
+{
+    data = _other.data;
+    return *this;
+}
+} // namespace Emergence::Render::Backend
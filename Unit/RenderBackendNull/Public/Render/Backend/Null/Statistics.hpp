@@ -0,0 +1,44 @@
+#pragma once
+
+#include <RenderBackendNullApi.hpp>
+
+#include <cstdint>
+
+namespace Emergence::Render::Backend::Null
+{
+/// \brief Contains counters of render commands, that were submitted during one frame.
+struct RenderBackendNullApi FrameStatistics final
+{
+    /// \brief Count of SubmissionAgent::SubmitGeometry calls.
+    std::uint64_t geometrySubmissions = 0u;
+
+    /// \brief Total count of vertices in all submitted geometries.
+    std::uint64_t submittedVertices = 0u;
+
+    /// \brief Total count of indices in all submitted geometries.
+    std::uint64_t submittedIndices = 0u;
+
+    /// \brief Count of uniform and sampler setter calls.
+    std::uint64_t uniformSubmissions = 0u;
+
+    /// \brief Count of SubmissionAgent::SetState and SubmissionAgent::SetScissor calls.
+    std::uint64_t stateChanges = 0u;
+
+    /// \brief Count of SubmissionAgent::Touch calls.
+    std::uint64_t touches = 0u;
+
+    /// \brief Checksum of all submitted commands and their data or zero if checksums are disabled.
+    /// \details Every command is hashed separately and hashes are combined using wrapping sum, because commands
+    ///          are submitted by multiple agents in parallel. Therefore, checksum does not depend on submission
+    ///          order of different commands, but depends on all submitted data, including geometry content.
+    std::uint64_t checksum = 0u;
+};
+
+/// \brief Enables or disables calculation of FrameStatistics::checksum. Disabled by default.
+/// \details Hashing geometry content is expensive, therefore it should only be enabled when rendering
+///          results need to be compared, for example when checking that optimization didn't change the output.
+RenderBackendNullApi void SetChecksumEnabled (bool _enabled) noexcept;
+
+/// \return Statistics of the last frame, finished by Renderer::SubmitFrame.
+RenderBackendNullApi const FrameStatistics &GetLastFrameStatistics () noexcept;
+} // namespace Emergence::Render::Backend::Null
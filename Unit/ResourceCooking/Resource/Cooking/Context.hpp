@@ -10,11 +10,6 @@
 
 namespace Emergence::Resource::Cooking
 {
-// TODO: Later we might need advanced is-update-needed check for intermediate cache.
-//       Right now passes are doing that by themselves (not always even) and do not take cooker version into account.
-//       This needs careful consideration, because excessive is-update-needed checks might severely slow down
-//       cooking and cause more harm that good.
-
 /// \brief Initializes resource cooking pipeline and stores current state of it.
 ///
 /// \par File system
@@ -36,12 +31,13 @@ namespace Emergence::Resource::Cooking
 /// \par Passes and results
 /// \parblock
 /// Although context does not enforce any particular architecture, it is advised to use passes and results approach.
-/// Pass is a single meaningful transformation, that is applied to resource list. It might be conversion from one
-/// format to another, index backing or even just resource list population from resource provider. Passes are executed
-/// sequentially and execution stops after first failure. Results are functions that take current resource list state
-/// and use it to produce final cooking result, for example to build read-only package. They are usually executed
-/// after all passes have been finished. This is a simple and straightforward solution, but it is easy to understand,
-/// easy to extend and easy to modify.
+/// Pass is a single meaningful transformation, that is applied to resource list. It might be conversion from one format
+/// to another, index backing or even just resource list population from resource provider. Passes are executed
+/// sequentially and execution stops after first failure, but every pass is free to parallelize its own work through
+/// Job::Dispatcher and to keep is-update-needed caches under intermediate directory. Results are functions that take
+/// current resource list state and use it to produce final cooking result, for example to build read-only package. They
+/// are usually executed after all passes have been finished. This is a simple and straightforward solution, but it is
+/// easy to understand, easy to extend and easy to modify.
 /// \endparblock
 class ResourceCookingApi Context final
 {
@@ -1,4 +1,14 @@
+#include <condition_variable>
+#include <mutex>
+
+#include <Container/HashMap.hpp>
+#include <Container/HashSet.hpp>
 #include <Container/StringBuilder.hpp>
+#include <Container/Vector.hpp>
+
+#include <Hashing/ByteHasher.hpp>
+
+#include <Job/Dispatcher.hpp>
 
 #include <Log/Log.hpp>
 
@@ -7,6 +17,8 @@
 #include <Serialization/Binary.hpp>
 #include <Serialization/Yaml.hpp>
 
+#include <StandardLayout/MappingRegistration.hpp>
+
 #include <VirtualFileSystem/Reader.hpp>
 #include <VirtualFileSystem/Writer.hpp>
 
@@ -14,40 +26,403 @@ namespace Emergence::Resource::Cooking
 {
 using namespace Memory::Literals;
 
-struct BinaryConversionHeap final
+/// \brief Describes source of already converted object, stored in binary conversion cache.
+struct BinaryConversionCacheItem final
 {
-    BinaryConversionHeap () noexcept = default;
+    /// \brief Id of converted object.
+    Memory::UniqueString id;
+
+    /// \brief Last write time of the source file, used to skip hashing of untouched sources.
+    std::int64_t sourceWriteTime = 0;
+
+    /// \brief Hash of source file content.
+    std::uint64_t sourceHash = 0u;
 
-    BinaryConversionHeap (const BinaryConversionHeap &_other) = delete;
+    /// \brief Hash of object type layout, because binary format depends on it.
+    std::uint64_t layoutHash = 0u;
 
-    BinaryConversionHeap (BinaryConversionHeap &&_other) = delete;
+    struct Reflection final
+    {
+        StandardLayout::FieldId id;
+        StandardLayout::FieldId sourceWriteTime;
+        StandardLayout::FieldId sourceHash;
+        StandardLayout::FieldId layoutHash;
+        StandardLayout::Mapping mapping;
+    };
+
+    static const Reflection &Reflect () noexcept;
+};
 
-    ~BinaryConversionHeap () noexcept
+const BinaryConversionCacheItem::Reflection &BinaryConversionCacheItem::Reflect () noexcept
+{
+    static const Reflection reflection = [] ()
     {
-        if (currentBuffer)
+        EMERGENCE_MAPPING_REGISTRATION_BEGIN (BinaryConversionCacheItem);
+        EMERGENCE_MAPPING_REGISTER_REGULAR (id);
+        EMERGENCE_MAPPING_REGISTER_REGULAR (sourceWriteTime);
+        EMERGENCE_MAPPING_REGISTER_REGULAR (sourceHash);
+        EMERGENCE_MAPPING_REGISTER_REGULAR (layoutHash);
+        EMERGENCE_MAPPING_REGISTRATION_END ();
+    }();
+
+    return reflection;
+}
+
+/// \brief Binary conversion cache file, that is stored in pass intermediate directory between cooking runs.
+struct BinaryConversionCache final
+{
+    /// \brief Binary conversion pass expects cache file to be named this way.
+    static constexpr const char *FILE_NAME = ".binary.conversion.cache";
+
+    /// \brief Increment it every time when conversion algorithm changes in a way that makes old results invalid.
+    static constexpr std::uint64_t VERSION = 1u;
+
+    /// \brief Hash of cache version, binary format version and all patchable type layouts.
+    /// \details Patches inside objects are serialized using patchable type layouts, therefore every conversion result
+    ///          becomes invalid when any of these layouts changes.
+    std::uint64_t environmentHash = 0u;
+
+    /// \brief Sources of all objects that were successfully converted during last cooking run.
+    Container::Vector<BinaryConversionCacheItem> items {
+        Memory::Profiler::AllocationGroup {"BinaryConversionCache"_us}};
+
+    struct Reflection final
+    {
+        StandardLayout::FieldId environmentHash;
+        StandardLayout::FieldId items;
+        StandardLayout::Mapping mapping;
+    };
+
+    static const Reflection &Reflect () noexcept;
+};
+
+const BinaryConversionCache::Reflection &BinaryConversionCache::Reflect () noexcept
+{
+    static const Reflection reflection = [] ()
+    {
+        EMERGENCE_MAPPING_REGISTRATION_BEGIN (BinaryConversionCache);
+        EMERGENCE_MAPPING_REGISTER_REGULAR (environmentHash);
+        EMERGENCE_MAPPING_REGISTER_REGULAR (items);
+        EMERGENCE_MAPPING_REGISTRATION_END ();
+    }();
+
+    return reflection;
+}
+
+/// \brief Calculates layout hashes of mappings. Binary format is mapping-dependant, therefore these hashes are used
+///        to detect conversion results that must be updated because of code changes, not source changes.
+class LayoutHasher final
+{
+public:
+    std::uint64_t Get (const StandardLayout::Mapping &_mapping) noexcept
+    {
+        if (auto iterator = hashes.find (_mapping); iterator != hashes.end ())
         {
-            heap.Release (currentBuffer, currentBufferSize);
+            return iterator->second;
         }
+
+        Hashing::ByteHasher hasher;
+        Container::HashSet<StandardLayout::Mapping> visited {Memory::Profiler::AllocationGroup {"LayoutHasher"_us}};
+        Append (hasher, _mapping, visited);
+
+        const std::uint64_t hash = hasher.GetCurrentValue ();
+        hashes.emplace (_mapping, hash);
+        return hash;
+    }
+
+private:
+    template <typename Value>
+    static void AppendValue (Hashing::ByteHasher &_hasher, Value _value) noexcept
+    {
+        static_assert (std::is_trivially_copyable_v<Value>);
+        _hasher.Append (reinterpret_cast<const std::uint8_t *> (&_value), sizeof (_value));
     }
 
-    EMERGENCE_DELETE_ASSIGNMENT (BinaryConversionHeap);
+    static void Append (Hashing::ByteHasher &_hasher,
+                        const StandardLayout::Mapping &_mapping,
+                        Container::HashSet<StandardLayout::Mapping> &_visited) noexcept
+    {
+        AppendValue (_hasher, _mapping.GetName ().StableHash ());
+        if (!_visited.emplace (_mapping).second)
+        {
+            // Recursive mapping: name is enough to distinguish it, its layout is already in the hash.
+            return;
+        }
+
+        AppendValue (_hasher, static_cast<std::uint64_t> (_mapping.GetObjectSize ()));
+        for (StandardLayout::Field field : _mapping)
+        {
+            AppendValue (_hasher, field.GetName ().StableHash ());
+            AppendValue (_hasher, field.GetArchetype ());
+            AppendValue (_hasher, static_cast<std::uint64_t> (field.GetOffset ()));
+            AppendValue (_hasher, static_cast<std::uint64_t> (field.GetSize ()));
+
+            switch (field.GetArchetype ())
+            {
+            case StandardLayout::FieldArchetype::BIT:
+                AppendValue (_hasher, static_cast<std::uint64_t> (field.GetBitOffset ()));
+                break;
+
+            case StandardLayout::FieldArchetype::INT:
+            case StandardLayout::FieldArchetype::UINT:
+            case StandardLayout::FieldArchetype::FLOAT:
+            case StandardLayout::FieldArchetype::STRING:
+            case StandardLayout::FieldArchetype::BLOCK:
+            case StandardLayout::FieldArchetype::UNIQUE_STRING:
+            case StandardLayout::FieldArchetype::UTF8_STRING:
+            case StandardLayout::FieldArchetype::PATCH:
+                break;
+
+            case StandardLayout::FieldArchetype::NESTED_OBJECT:
+                // Nested object fields are projected, therefore we only need nested object type name.
+                AppendValue (_hasher, field.GetNestedObjectMapping ().GetName ().StableHash ());
+                break;
+
+            case StandardLayout::FieldArchetype::VECTOR:
+                Append (_hasher, field.GetVectorItemMapping (), _visited);
+                break;
+            }
+        }
+    }
+
+    Container::HashMap<StandardLayout::Mapping, std::uint64_t> hashes {
+        Memory::Profiler::AllocationGroup {"LayoutHasher"_us}};
+};
+
+static std::uint64_t CalculateEnvironmentHash (const Container::MappingRegistry &_patchableTypesRegistry,
+                                               LayoutHasher &_layoutHasher) noexcept
+{
+    // Registry iteration order is not stable, therefore we combine type hashes using commutative operation.
+    std::uint64_t patchableTypesHash = 0u;
+    for (const auto &[typeName, type] : _patchableTypesRegistry.GetRegistry ())
+    {
+        patchableTypesHash += _layoutHasher.Get (type);
+    }
+
+    Hashing::ByteHasher hasher;
+    const std::uint64_t values[] {BinaryConversionCache::VERSION,
+                                  static_cast<std::uint64_t> (Serialization::Binary::FormatVersion::PLANNED),
+                                  patchableTypesHash};
+    hasher.Append (reinterpret_cast<const std::uint8_t *> (values), sizeof (values));
+    return hasher.GetCurrentValue ();
+}
+
+static std::uint64_t HashContent (const std::span<const std::uint8_t> &_content) noexcept
+{
+    Hashing::ByteHasher hasher;
+    hasher.Append (_content.data (), _content.size ());
+    return hasher.GetCurrentValue ();
+}
+
+static std::int64_t GetWriteTime (const VirtualFileSystem::Entry &_entry) noexcept
+{
+    return static_cast<std::int64_t> (_entry.GetLastWriteTime ().time_since_epoch ().count ());
+}
+
+static void LoadCache (const VirtualFileSystem::Entry &_passDirectory,
+                       std::uint64_t _environmentHash,
+                       Container::HashMap<Memory::UniqueString, BinaryConversionCacheItem> &_output) noexcept
+{
+    const VirtualFileSystem::Entry cacheEntry {_passDirectory, BinaryConversionCache::FILE_NAME};
+    if (!cacheEntry)
+    {
+        EMERGENCE_LOG (INFO, "Resource::Cooking: There is no binary conversion cache, everything will be converted.");
+        return;
+    }
+
+    VirtualFileSystem::Reader reader {cacheEntry};
+    BinaryConversionCache cache;
+
+    if (!reader || !Serialization::Binary::DeserializeObject (reader.InputStream (), &cache,
+                                                              BinaryConversionCache::Reflect ().mapping, {}))
+    {
+        EMERGENCE_LOG (WARNING, "Resource::Cooking: Unable to read binary conversion cache, it will be rebuilt.");
+        return;
+    }
+
+    if (cache.environmentHash != _environmentHash)
+    {
+        EMERGENCE_LOG (INFO, "Resource::Cooking: Patchable types or conversion algorithm were changed, binary "
+                             "conversion cache will be rebuilt.");
+        return;
+    }
+
+    for (const BinaryConversionCacheItem &item : cache.items)
+    {
+        _output.emplace (item.id, item);
+    }
+}
+
+static bool SaveCache (VirtualFileSystem::Context &_virtualFileSystem,
+                       const VirtualFileSystem::Entry &_passDirectory,
+                       const BinaryConversionCache &_cache) noexcept
+{
+    VirtualFileSystem::Entry cacheEntry {_passDirectory, BinaryConversionCache::FILE_NAME};
+    if (!cacheEntry)
+    {
+        cacheEntry = _virtualFileSystem.CreateFile (_passDirectory, BinaryConversionCache::FILE_NAME);
+    }
+
+    VirtualFileSystem::Writer writer {cacheEntry};
+    if (!writer)
+    {
+        EMERGENCE_LOG (ERROR, "Resource::Cooking: Unable to open binary conversion cache for write.");
+        return false;
+    }
+
+    Serialization::Binary::SerializeObject (writer.OutputStream (), &_cache, BinaryConversionCache::Reflect ().mapping);
+    return true;
+}
+
+enum class ConversionTaskState : std::uint8_t
+{
+    PENDING = 0u,
+    UP_TO_DATE,
+    CONVERTED,
+    FAILED,
+};
+
+/// \brief Conversion of one object, that is executed through asynchronous read and conversion job.
+struct ConversionTask final
+{
+    Memory::UniqueString id;
+    StandardLayout::Mapping type;
+    VirtualFileSystem::Entry sourceEntry;
+    VirtualFileSystem::Entry outputEntry;
+
+    std::int64_t sourceWriteTime = 0;
+    std::uint64_t layoutHash = 0u;
+
+    /// \brief Source hash from cache or zero if cache item is absent or made for other layout.
+    std::uint64_t cachedSourceHash = 0u;
+
+    std::uint64_t sourceHash = 0u;
+    ConversionTaskState state = ConversionTaskState::PENDING;
+
+    /// \brief Source content copy, because asynchronous read content is only valid during callback.
+    Container::Vector<std::uint8_t> source {Memory::Profiler::AllocationGroup {"BinaryConversionSource"_us}};
 
-    static constexpr std::size_t INITIAL_SIZE = 1024u;
-    static constexpr std::size_t INITIAL_ALIGNMENT = 16u;
+    /// \brief Serialized object, that is written to output entry after all conversions are finished.
+    Container::Vector<std::uint8_t> output {Memory::Profiler::AllocationGroup {"BinaryConversionOutput"_us}};
+};
+
+/// \brief State that is shared between pass thread, virtual file system IO thread and conversion jobs.
+struct ConversionSharedState final
+{
+    const Container::MappingRegistry *patchableTypesRegistry = nullptr;
 
+    /// \brief Heap for temporary objects of conversion jobs. Heap is thread safe, so one heap is enough.
     Memory::Heap heap {Memory::Profiler::AllocationGroup {"BinaryConversionAlgorithm"_us}};
-    void *currentBuffer = heap.Acquire (INITIAL_SIZE, INITIAL_ALIGNMENT);
-    std::size_t currentBufferSize = INITIAL_SIZE;
-    std::size_t currentBufferAlignment = INITIAL_ALIGNMENT;
+
+    /// \details Tasks must not be added after reads are submitted, because callbacks and jobs store task indices.
+    Container::Vector<ConversionTask> tasks {Memory::Profiler::AllocationGroup {"BinaryConversionAlgorithm"_us}};
+
+    /// \details Conversions are finished under mutex, so pass thread can not destroy shared state
+    ///          while finishing thread is still notifying it.
+    std::mutex finishedMutex;
+    std::condition_variable finishedCondition;
+    std::size_t finishedCount = 0u;
 };
 
-bool BinaryConversionPass (Context &_context) noexcept
+static void FinishTask (ConversionSharedState &_state, ConversionTask &_task, ConversionTaskState _result) noexcept
 {
-    // TODO: It might be better to use multithreading? Is there any sense or are we limited by drive read speed?
+    _task.state = _result;
+    _task.source.clear ();
+    _task.source.shrink_to_fit ();
+
+    std::unique_lock lock {_state.finishedMutex};
+    ++_state.finishedCount;
+    _state.finishedCondition.notify_all ();
+}
+
+static void ExecuteConversion (ConversionSharedState &_state, ConversionTask &_task) noexcept
+{
+    _task.sourceHash = HashContent (_task.source);
+    if (_task.sourceHash == _task.cachedSourceHash)
+    {
+        // Usually happens when sources are checked out or copied: file is touched, but its content is the same.
+        FinishTask (_state, _task, ConversionTaskState::UP_TO_DATE);
+        return;
+    }
+
+    void *object = _state.heap.Acquire (_task.type.GetObjectSize (), _task.type.GetObjectAlignment ());
+    _task.type.Construct (object);
+
+    const bool deserialized =
+        Serialization::Yaml::DeserializeObject (_task.source, object, _task.type, *_state.patchableTypesRegistry);
+
+    if (deserialized)
+    {
+        Serialization::Binary::SerializeTypeName (_task.output, _task.type.GetName ());
+        Serialization::Binary::SerializeObject (_task.output, object, _task.type);
+    }
 
+    _task.type.Destruct (object);
+    _state.heap.Release (object, _task.type.GetObjectSize ());
+    FinishTask (_state, _task, deserialized ? ConversionTaskState::CONVERTED : ConversionTaskState::FAILED);
+}
+
+static void ExecuteConversions (const VirtualFileSystem::Context &_virtualFileSystem,
+                                ConversionSharedState &_state) noexcept
+{
+    // Reads are submitted together, so virtual file system can sort and merge them. Conversions are started as soon
+    // as their sources are read, therefore reading and conversion are overlapped.
+    Container::Vector<VirtualFileSystem::AsyncReadRequest> requests {
+        Memory::Profiler::AllocationGroup {"BinaryConversionAlgorithm"_us}};
+    requests.reserve (_state.tasks.size ());
+
+    for (std::size_t index = 0u; index < _state.tasks.size (); ++index)
+    {
+        requests.emplace_back () = {
+            _state.tasks[index].sourceEntry,
+            [&_state, index] (bool _successful, std::span<const std::uint8_t> _content)
+            {
+                ConversionTask &task = _state.tasks[index];
+                if (!_successful)
+                {
+                    FinishTask (_state, task, ConversionTaskState::FAILED);
+                    return;
+                }
+
+                task.source.assign (_content.begin (), _content.end ());
+
+                // Pass waits for conversions, therefore they are foreground jobs: background jobs might never be
+                // executed if background execution is forbidden, for example on single core machines.
+                Job::Dispatcher::Global ().Dispatch (Job::Priority::FOREGROUND,
+                                                     [state {&_state}, taskPointer {&task}] ()
+                                                     {
+                                                         ExecuteConversion (*state, *taskPointer);
+                                                     });
+            }};
+    }
+
+    _virtualFileSystem.SubmitReads (requests);
+    std::unique_lock lock {_state.finishedMutex};
+    _state.finishedCondition.wait (lock,
+                                   [&_state] ()
+                                   {
+                                       return _state.finishedCount == _state.tasks.size ();
+                                   });
+}
+
+bool BinaryConversionPass (Context &_context) noexcept
+{
     EMERGENCE_LOG (INFO, "Resource::Cooking: Binary conversion pass started.");
-    BinaryConversionHeap conversionHeap;
     const VirtualFileSystem::Entry passDirectory = _context.GetPassIntermediateRealDirectory ("BinaryConversion");
+    const Container::MappingRegistry &patchableTypesRegistry =
+        _context.GetInitialResourceProvider ().GetPatchableTypesRegistry ();
+
+    LayoutHasher layoutHasher;
+    BinaryConversionCache newCache;
+    newCache.environmentHash = CalculateEnvironmentHash (patchableTypesRegistry, layoutHasher);
+
+    Container::HashMap<Memory::UniqueString, BinaryConversionCacheItem> oldCache {
+        Memory::Profiler::AllocationGroup {"BinaryConversionCache"_us}};
+    LoadCache (passDirectory, newCache.environmentHash, oldCache);
+
+    ConversionSharedState state;
+    state.patchableTypesRegistry = &patchableTypesRegistry;
+    std::size_t skippedCount = 0u;
 
     for (auto cursor = _context.GetResourceList ().EditAllObjects (); ObjectData *object = *cursor; ++cursor)
     {
@@ -58,23 +433,11 @@ bool BinaryConversionPass (Context &_context) noexcept
 
         case Provider::ObjectFormat::YAML:
         {
-            EMERGENCE_LOG (INFO, "Resource::Cooking: Converting \"", object->id, "\" of type \"",
-                           object->type.GetName (), "\" to binary.");
-
             const Container::Utf8String fileName = object->entry.GetName () + ".bin";
             VirtualFileSystem::Entry outputEntry {passDirectory, fileName};
+            const bool outputExists = static_cast<bool> (outputEntry);
 
-            if (outputEntry)
-            {
-                if (outputEntry.GetLastWriteTime () >= object->entry.GetLastWriteTime ())
-                {
-                    EMERGENCE_LOG (INFO, "Resource::Cooking: Conversion skipped, already up to date.");
-                    object->entry = outputEntry;
-                    object->format = Provider::ObjectFormat::BINARY;
-                    break;
-                }
-            }
-            else
+            if (!outputExists)
             {
                 outputEntry = _context.GetVirtualFileSystem ().CreateFile (passDirectory, fileName);
                 if (!outputEntry)
@@ -85,68 +448,96 @@ bool BinaryConversionPass (Context &_context) noexcept
                 }
             }
 
-            VirtualFileSystem::Reader reader {object->entry};
-            if (!reader)
-            {
-                EMERGENCE_LOG (ERROR, "Resource::Cooking: Unable to open \"", object->entry.GetFullName (),
-                               "\" for read.");
-                return false;
-            }
-
-            VirtualFileSystem::Writer writer {outputEntry};
-            if (!writer)
-            {
-                EMERGENCE_LOG (ERROR, "Resource::Cooking: Unable to open \"", outputEntry.GetFullPath (),
-                               "\" for write.");
-                return false;
-            }
+            const std::int64_t sourceWriteTime = GetWriteTime (object->entry);
+            const std::uint64_t layoutHash = layoutHasher.Get (object->type);
+            std::uint64_t cachedSourceHash = 0u;
 
-            if (conversionHeap.currentBufferSize < object->type.GetObjectSize () ||
-                conversionHeap.currentBufferAlignment < object->type.GetObjectAlignment ())
+            if (auto iterator = oldCache.find (object->id);
+                outputExists && iterator != oldCache.end () && iterator->second.layoutHash == layoutHash)
             {
-                const std::size_t newSize = std::max (conversionHeap.currentBufferSize, object->type.GetObjectSize ());
-                const std::size_t newAlignment =
-                    std::max (conversionHeap.currentBufferAlignment, object->type.GetObjectAlignment ());
-
-                if (newAlignment != conversionHeap.currentBufferAlignment)
-                {
-                    conversionHeap.heap.Release (conversionHeap.currentBuffer, conversionHeap.currentBufferSize);
-                    conversionHeap.currentBuffer = conversionHeap.heap.Acquire (newSize, newAlignment);
-                    conversionHeap.currentBufferSize = newSize;
-                    conversionHeap.currentBufferAlignment = newAlignment;
-                }
-                else
+                if (iterator->second.sourceWriteTime == sourceWriteTime)
                 {
-                    conversionHeap.currentBuffer = conversionHeap.heap.Resize (
-                        conversionHeap.currentBuffer, newAlignment, conversionHeap.currentBufferSize, newSize);
-                    conversionHeap.currentBufferSize = newSize;
+                    newCache.items.emplace_back (iterator->second);
+                    object->entry = outputEntry;
+                    object->format = Provider::ObjectFormat::BINARY;
+                    ++skippedCount;
+                    break;
                 }
-            }
 
-            object->type.Construct (conversionHeap.currentBuffer);
-            if (!Serialization::Yaml::DeserializeObject (
-                    reader.InputStream (), conversionHeap.currentBuffer, object->type,
-                    _context.GetInitialResourceProvider ().GetPatchableTypesRegistry ()))
-            {
-                EMERGENCE_LOG (ERROR, "Resource::Cooking: Unable to deserialize \"", object->entry.GetFullName (),
-                               "\" content.");
-
-                object->type.Destruct (conversionHeap.currentBuffer);
-                return false;
+                cachedSourceHash = iterator->second.sourceHash;
             }
 
-            Serialization::Binary::SerializeTypeName (writer.OutputStream (), object->type.GetName ());
-            Serialization::Binary::SerializeObject (writer.OutputStream (), conversionHeap.currentBuffer, object->type);
-            object->type.Destruct (conversionHeap.currentBuffer);
+            ConversionTask &task = state.tasks.emplace_back ();
+            task.id = object->id;
+            task.type = object->type;
+            task.sourceEntry = object->entry;
+            task.outputEntry = outputEntry;
+            task.sourceWriteTime = sourceWriteTime;
+            task.layoutHash = layoutHash;
+            task.cachedSourceHash = cachedSourceHash;
 
+            // Resource list is not thread safe, therefore we replace entries right away.
+            // If any conversion fails, the whole pass fails, so there is no need to revert it.
             object->entry = outputEntry;
             object->format = Provider::ObjectFormat::BINARY;
-            EMERGENCE_LOG (INFO, "Resource::Cooking: Conversion successful.");
             break;
         }
         }
     }
 
+    EMERGENCE_LOG (INFO, "Resource::Cooking: ", skippedCount, " objects are skipped as untouched, ",
+                   state.tasks.size (), " objects are scheduled for conversion.");
+    ExecuteConversions (_context.GetVirtualFileSystem (), state);
+    bool successful = true;
+
+    for (ConversionTask &task : state.tasks)
+    {
+        switch (task.state)
+        {
+        case ConversionTaskState::PENDING:
+            EMERGENCE_ASSERT (false);
+            successful = false;
+            break;
+
+        case ConversionTaskState::UP_TO_DATE:
+            EMERGENCE_LOG (INFO, "Resource::Cooking: Conversion of \"", task.id,
+                           "\" skipped, source content is the same.");
+            newCache.items.emplace_back () = {task.id, task.sourceWriteTime, task.sourceHash, task.layoutHash};
+            break;
+
+        case ConversionTaskState::CONVERTED:
+        {
+            VirtualFileSystem::Writer writer {task.outputEntry};
+            if (!writer)
+            {
+                EMERGENCE_LOG (ERROR, "Resource::Cooking: Unable to open \"", task.outputEntry.GetFullPath (),
+                               "\" for write.");
+                successful = false;
+                break;
+            }
+
+            writer.OutputStream ().write (reinterpret_cast<const char *> (task.output.data ()),
+                                          static_cast<std::streamsize> (task.output.size ()));
+            EMERGENCE_LOG (INFO, "Resource::Cooking: Converted \"", task.id, "\" of type \"", task.type.GetName (),
+                           "\" to binary.");
+            newCache.items.emplace_back () = {task.id, task.sourceWriteTime, task.sourceHash, task.layoutHash};
+            break;
+        }
+
+        case ConversionTaskState::FAILED:
+            EMERGENCE_LOG (ERROR, "Resource::Cooking: Unable to convert \"", task.sourceEntry.GetFullName (),
+                           "\" to binary.");
+            successful = false;
+            break;
+        }
+    }
+
+    // Cache is saved even if pass has failed, so successful conversions are not repeated after errors are fixed.
+    if (!SaveCache (_context.GetVirtualFileSystem (), passDirectory, newCache) || !successful)
+    {
+        return false;
+    }
+
     EMERGENCE_LOG (INFO, "Resource::Cooking: Binary conversion pass finished successfully.");
     return true;
 }
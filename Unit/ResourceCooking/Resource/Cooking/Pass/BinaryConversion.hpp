@@ -7,6 +7,8 @@
 namespace Emergence::Resource::Cooking
 {
 /// \brief Converts all reflection-driven resource objects in yaml format to binary format.
-///        Uses intermediate cache whenever possible.
+/// \details Objects are read asynchronously and converted in parallel through Job::Dispatcher. Conversion results
+///          are tracked by cache in intermediate directory: objects, which sources and type layouts are unchanged
+///          since previous conversion, are not converted again.
 ResourceCookingApi bool BinaryConversionPass (Context &_context) noexcept;
 } // namespace Emergence::Resource::Cooking
@@ -25,9 +25,17 @@ Library LibraryLoader::Load (const Container::Vector<LibraryLoadingTask> &_loadi
 
     objectList.clear ();
     indexInObjectList.clear ();
+    preloadedObjects.clear ();
     return std::move (currentLibrary);
 }
 
+Library LibraryLoader::Load (const Container::Vector<LibraryLoadingTask> &_loadingTasks,
+                             PreloadedObjectMap _preloadedObjects) noexcept
+{
+    preloadedObjects = std::move (_preloadedObjects);
+    return Load (_loadingTasks);
+}
+
 Memory::Profiler::AllocationGroup LibraryLoader::GetAllocationGroup () noexcept
 {
     return Memory::Profiler::AllocationGroup {GetRootAllocationGroup (), Memory::UniqueString {"LibraryLoader"}};
@@ -52,24 +60,32 @@ bool LibraryLoader::LoadObject (Memory::UniqueString _objectId, bool _loadingAsP
     }
 
     Object object;
-    switch (resourceProvider->LoadObject (Object::Reflect ().mapping, _objectId, &object))
+    if (auto preloadedIterator = preloadedObjects.find (_objectId); preloadedIterator != preloadedObjects.end ())
     {
-    case Provider::LoadingOperationResponse::SUCCESSFUL:
-        break;
-
-    case Provider::LoadingOperationResponse::NOT_FOUND:
-        EMERGENCE_LOG (ERROR, "Resource::Object::LibraryLoader: Object \"", _objectId, "\" is not found.");
-        return false;
-
-    case Provider::LoadingOperationResponse::IO_ERROR:
-        EMERGENCE_LOG (ERROR, "Resource::Object::LibraryLoader: Unable to load object \"", _objectId,
-                       "\" due to an IO error.");
-        return false;
-
-    case Provider::LoadingOperationResponse::WRONG_TYPE:
-        EMERGENCE_LOG (ERROR, "Resource::Object::LibraryLoader: Unable to load object \"", _objectId,
-                       "\", there is another resource with the same id.");
-        return false;
+        object = std::move (preloadedIterator->second);
+        preloadedObjects.erase (preloadedIterator);
+    }
+    else
+    {
+        switch (resourceProvider->LoadObject (Object::Reflect ().mapping, _objectId, &object))
+        {
+        case Provider::LoadingOperationResponse::SUCCESSFUL:
+            break;
+
+        case Provider::LoadingOperationResponse::NOT_FOUND:
+            EMERGENCE_LOG (ERROR, "Resource::Object::LibraryLoader: Object \"", _objectId, "\" is not found.");
+            return false;
+
+        case Provider::LoadingOperationResponse::IO_ERROR:
+            EMERGENCE_LOG (ERROR, "Resource::Object::LibraryLoader: Unable to load object \"", _objectId,
+                           "\" due to an IO error.");
+            return false;
+
+        case Provider::LoadingOperationResponse::WRONG_TYPE:
+            EMERGENCE_LOG (ERROR, "Resource::Object::LibraryLoader: Unable to load object \"", _objectId,
+                           "\", there is another resource with the same id.");
+            return false;
+        }
     }
 
     Memory::UniqueString parent = object.parent;
@@ -21,6 +21,9 @@ struct ResourceObjectApi LibraryLoadingTask final
 class ResourceObjectApi LibraryLoader final
 {
 public:
+    /// \brief Objects that were already read and deserialized by user, for example through asynchronous reads.
+    using PreloadedObjectMap = Container::HashMap<Memory::UniqueString, Object>;
+
     /// \brief Constructs loader with given type manifest.
     LibraryLoader (Provider::ResourceProvider *_resourceProvider, TypeManifest _typeManifest) noexcept;
 
@@ -32,6 +35,12 @@ public:
 
     Library Load (const Container::Vector<LibraryLoadingTask> &_loadingTasks) noexcept;
 
+    /// \brief Loads library using given preloaded objects instead of reading them through resource provider.
+    /// \details Objects that are not preloaded, but needed for the library, are still loaded through resource
+    ///          provider, therefore preloaded map is allowed to be incomplete.
+    Library Load (const Container::Vector<LibraryLoadingTask> &_loadingTasks,
+                  PreloadedObjectMap _preloadedObjects) noexcept;
+
     LibraryLoader &operator= (const LibraryLoader &_other) = delete;
 
     LibraryLoader &operator= (LibraryLoader &&_other) = delete;
@@ -58,6 +67,9 @@ private:
     /// \details Needed for internal recursive inheritance check.
     Container::HashMap<Memory::UniqueString, std::size_t> indexInObjectList {GetAllocationGroup ()};
 
+    /// \brief Objects that were preloaded for current loading routine and not yet taken into library.
+    PreloadedObjectMap preloadedObjects {GetAllocationGroup ()};
+
     TypeManifest typeManifest;
 };
 } // namespace Emergence::Resource::Object
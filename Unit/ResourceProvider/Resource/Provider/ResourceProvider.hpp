@@ -3,6 +3,7 @@
 #include <ResourceProviderApi.hpp>
 
 #include <cstdint>
+#include <span>
 
 #include <API/Common/Cursor.hpp>
 #include <API/Common/Shortcuts.hpp>
@@ -130,7 +131,7 @@ public:
     private:
         friend class ResourceProvider;
 
-        EMERGENCE_BIND_IMPLEMENTATION_INPLACE (sizeof (std::uintptr_t) * 3u);
+        EMERGENCE_BIND_IMPLEMENTATION_INPLACE (sizeof (std::uintptr_t) * 5u);
 
         explicit ThirdPartyRegistryCursor (std::array<std::uint8_t, DATA_MAX_SIZE> &_data) noexcept;
     };
@@ -154,6 +155,10 @@ public:
     /// \brief Supported patchable types.
     [[nodiscard]] const Container::MappingRegistry &GetPatchableTypesRegistry () const noexcept;
 
+    /// \return Virtual file system context from which resources are loaded.
+    /// \details Exposed so users can load resources asynchronously through VirtualFileSystem::Context::SubmitReads.
+    [[nodiscard]] VirtualFileSystem::Context *GetVirtualFileSystemContext () const noexcept;
+
     /// \brief Registers given source and adds all resources from it to resource provider.
     [[nodiscard]] SourceOperationResponse AddSource (Memory::UniqueString _path) noexcept;
 
@@ -170,12 +175,28 @@ public:
                                                        Memory::UniqueString _id,
                                                        void *_output) const noexcept;
 
+    /// \brief Deserializes reflection-based resource object with given id from its already loaded file content.
+    /// \details Intended to be used together with asynchronous reads of ::GetObjectEntry.
+    /// \invariant Output must point to initialized object of requested type.
+    [[nodiscard]] LoadingOperationResponse LoadObjectFromData (const StandardLayout::Mapping &_type,
+                                                               Memory::UniqueString _id,
+                                                               const std::span<const std::uint8_t> &_data,
+                                                               void *_output) const noexcept;
+
     /// \brief Attempts to fully load third party resource by its id, using given heap to allocate memory for it.
+    /// \details Resources from mapped packages are better accessed through ::GetThirdPartyResourceView,
+    ///          which does not copy their data.
     [[nodiscard]] LoadingOperationResponse LoadThirdPartyResource (Memory::UniqueString _id,
                                                                    Memory::Heap &_allocator,
                                                                    std::uint64_t &_sizeOutput,
                                                                    std::uint8_t *&_dataOutput) const noexcept;
 
+    /// \return Direct view of third party resource data if it is stored in mapped package or empty span otherwise.
+    /// \details Only packages mounted from VirtualFileSystem::MountSource::MAPPED_PACKAGE are mapped. View points
+    ///          into package mapping, therefore it stays valid as long as package is mounted, even if resource
+    ///          source is removed from this provider. Use ::LoadThirdPartyResource if view is empty.
+    [[nodiscard]] std::span<const std::uint8_t> GetThirdPartyResourceView (Memory::UniqueString _id) const noexcept;
+
     /// \brief Returns cursor that provides access to ids of all resources of given type.
     /// \warning Cursor holds read access to resource registry while it is alive.
     [[nodiscard]] ObjectRegistryCursor FindObjectsByType (const StandardLayout::Mapping &_type) const noexcept;
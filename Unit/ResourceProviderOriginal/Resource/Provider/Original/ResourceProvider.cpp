@@ -1,5 +1,9 @@
 #define _CRT_SECURE_NO_WARNINGS
 
+#include <istream>
+
+#include <Container/Vector.hpp>
+
 #include <Log/Log.hpp>
 
 #include <Resource/Provider/IndexFile.hpp>
@@ -171,6 +175,11 @@ const Container::MappingRegistry &ResourceProvider::GetPatchableTypesRegistry ()
     return patchableTypesRegistry;
 }
 
+VirtualFileSystem::Context *ResourceProvider::GetVirtualFileSystemContext () const noexcept
+{
+    return virtualFileSystemContext;
+}
+
 SourceOperationResponse ResourceProvider::AddSource ([[maybe_unused]] Memory::UniqueString _path) noexcept
 {
     if (auto cursor = objectsBySource.ReadPoint (&_path); *cursor)
@@ -285,35 +294,52 @@ LoadingOperationResponse ResourceProvider::LoadObject (const StandardLayout::Map
         return LoadingOperationResponse::NOT_FOUND;
     }
 
-    switch (object->format)
+    if (const std::span<const std::uint8_t> view = reader.GetView (); !view.empty ())
     {
-    case ObjectFormat::BINARY:
-    {
-        [[maybe_unused]] const Memory::UniqueString typeName =
-            Serialization::Binary::DeserializeTypeName (reader.InputStream ());
-        EMERGENCE_ASSERT (typeName == _type.GetName ());
+        return DeserializeObject (view, object->format, _type, _output);
+    }
 
-        if (!Serialization::Binary::DeserializeObject (reader.InputStream (), _output, _type, patchableTypesRegistry))
-        {
-            return LoadingOperationResponse::IO_ERROR;
-        }
+    // Object files are small, therefore it is faster to read them at once and deserialize from memory.
+    Container::Vector<std::uint8_t> data {
+        Memory::Profiler::AllocationGroup {Memory::UniqueString {"ResourceProviderAlgorithm"}}};
+    std::istream &input = reader.InputStream ();
 
-        break;
+    while (input)
+    {
+        constexpr std::size_t CHUNK_SIZE = 4096u;
+        const std::size_t oldSize = data.size ();
+        data.resize (oldSize + CHUNK_SIZE);
+        input.read (reinterpret_cast<char *> (data.data () + oldSize), static_cast<std::streamsize> (CHUNK_SIZE));
+        data.resize (oldSize + static_cast<std::size_t> (input.gcount ()));
     }
 
-    case ObjectFormat::YAML:
+    if (input.bad ())
     {
-        // We skip type name deserialization here as it is just a comment.
-        if (!Serialization::Yaml::DeserializeObject (reader.InputStream (), _output, _type, patchableTypesRegistry))
-        {
-            return LoadingOperationResponse::IO_ERROR;
-        }
+        return LoadingOperationResponse::IO_ERROR;
+    }
+
+    return DeserializeObject (data, object->format, _type, _output);
+}
+
+LoadingOperationResponse ResourceProvider::LoadObjectFromData (const StandardLayout::Mapping &_type,
+                                                               Memory::UniqueString _id,
+                                                               const std::span<const std::uint8_t> &_data,
+                                                               void *_output) const noexcept
+{
+    auto cursor = objectsById.ReadPoint (&_id);
+    const auto *object = static_cast<const ObjectResourceData *> (*cursor);
 
-        break;
+    if (!object)
+    {
+        return LoadingOperationResponse::NOT_FOUND;
     }
+
+    if (object->type != _type)
+    {
+        return LoadingOperationResponse::WRONG_TYPE;
     }
 
-    return LoadingOperationResponse::SUCCESSFUL;
+    return DeserializeObject (_data, object->format, _type, _output);
 }
 
 LoadingOperationResponse ResourceProvider::LoadThirdPartyResource (Memory::UniqueString _id,
@@ -354,6 +380,26 @@ LoadingOperationResponse ResourceProvider::LoadThirdPartyResource (Memory::Uniqu
     return LoadingOperationResponse::SUCCESSFUL;
 }
 
+std::span<const std::uint8_t> ResourceProvider::GetThirdPartyResourceView (Memory::UniqueString _id) const noexcept
+{
+    auto cursor = thirdPartyResourcesById.ReadPoint (&_id);
+    const auto *resource = static_cast<const ThirdPartyResourceData *> (*cursor);
+
+    if (!resource || !resource->entry)
+    {
+        return {};
+    }
+
+    VirtualFileSystem::Reader reader {resource->entry};
+    if (!reader)
+    {
+        return {};
+    }
+
+    // View points to the package mapping, therefore it does not depend on reader lifetime.
+    return reader.GetView ();
+}
+
 ResourceProvider::ObjectRegistryCursor ResourceProvider::FindObjectsByType (
     const StandardLayout::Mapping &_type) const noexcept
 {
@@ -420,6 +466,45 @@ VirtualFileSystem::Entry ResourceProvider::GetThirdPartyEntry (Memory::UniqueStr
     return resource->entry;
 }
 
+LoadingOperationResponse ResourceProvider::DeserializeObject (std::span<const std::uint8_t> _data,
+                                                              ObjectFormat _format,
+                                                              const StandardLayout::Mapping &_type,
+                                                              void *_output) const noexcept
+{
+    switch (_format)
+    {
+    case ObjectFormat::BINARY:
+    {
+        Serialization::Binary::FormatVersion version;
+        [[maybe_unused]] const Memory::UniqueString typeName =
+            Serialization::Binary::DeserializeTypeName (_data, version);
+        EMERGENCE_ASSERT (typeName == _type.GetName ());
+
+        if (!*typeName ||
+            !Serialization::Binary::DeserializeObject (_data, _output, _type, patchableTypesRegistry, version))
+        {
+            return LoadingOperationResponse::IO_ERROR;
+        }
+
+        return LoadingOperationResponse::SUCCESSFUL;
+    }
+
+    case ObjectFormat::YAML:
+    {
+        // We skip type name deserialization here as it is just a comment.
+        if (!Serialization::Yaml::DeserializeObject (_data, _output, _type, patchableTypesRegistry))
+        {
+            return LoadingOperationResponse::IO_ERROR;
+        }
+
+        return LoadingOperationResponse::SUCCESSFUL;
+    }
+    }
+
+    EMERGENCE_ASSERT (false);
+    return LoadingOperationResponse::IO_ERROR;
+}
+
 SourceOperationResponse ResourceProvider::AddSourceFromIndex (const VirtualFileSystem::Entry &_indexFile,
                                                               Memory::UniqueString _path) noexcept
 {
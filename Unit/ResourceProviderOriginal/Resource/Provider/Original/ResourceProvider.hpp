@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <span>
 
 #include <Container/String.hpp>
 
@@ -75,6 +76,8 @@ public:
 
     const Container::MappingRegistry &GetPatchableTypesRegistry () const noexcept;
 
+    [[nodiscard]] VirtualFileSystem::Context *GetVirtualFileSystemContext () const noexcept;
+
     SourceOperationResponse AddSource (Memory::UniqueString _path) noexcept;
 
     SourceOperationResponse SaveSourceIndex (Memory::UniqueString _sourcePath,
@@ -86,11 +89,18 @@ public:
                                          Memory::UniqueString _id,
                                          void *_output) const noexcept;
 
+    LoadingOperationResponse LoadObjectFromData (const StandardLayout::Mapping &_type,
+                                                 Memory::UniqueString _id,
+                                                 const std::span<const std::uint8_t> &_data,
+                                                 void *_output) const noexcept;
+
     LoadingOperationResponse LoadThirdPartyResource (Memory::UniqueString _id,
                                                      Memory::Heap &_allocator,
                                                      std::uint64_t &_sizeOutput,
                                                      std::uint8_t *&_dataOutput) const noexcept;
 
+    [[nodiscard]] std::span<const std::uint8_t> GetThirdPartyResourceView (Memory::UniqueString _id) const noexcept;
+
     [[nodiscard]] ObjectRegistryCursor FindObjectsByType (const StandardLayout::Mapping &_type) const noexcept;
 
     [[nodiscard]] ThirdPartyRegistryCursor VisitAllThirdParty () const noexcept;
@@ -131,6 +141,11 @@ private:
 
     bool ClearSource (Memory::UniqueString _path) noexcept;
 
+    LoadingOperationResponse DeserializeObject (std::span<const std::uint8_t> _data,
+                                                ObjectFormat _format,
+                                                const StandardLayout::Mapping &_type,
+                                                void *_output) const noexcept;
+
     VirtualFileSystem::Context *virtualFileSystemContext;
 
     RecordCollection::Collection objects;
@@ -124,6 +124,13 @@ const Container::MappingRegistry &ResourceProvider::GetPatchableTypesRegistry ()
     return internal.resourceProvider->GetPatchableTypesRegistry ();
 }
 
+VirtualFileSystem::Context *ResourceProvider::GetVirtualFileSystemContext () const noexcept
+{
+    const auto &internal = block_cast<InternalData> (data);
+    EMERGENCE_ASSERT (internal.resourceProvider);
+    return internal.resourceProvider->GetVirtualFileSystemContext ();
+}
+
 SourceOperationResponse ResourceProvider::AddSource (Memory::UniqueString _path) noexcept
 {
     auto &internal = block_cast<InternalData> (data);
@@ -155,6 +162,16 @@ LoadingOperationResponse ResourceProvider::LoadObject (const StandardLayout::Map
     return internal.resourceProvider->LoadObject (_type, _id, _output);
 }
 
+LoadingOperationResponse ResourceProvider::LoadObjectFromData (const StandardLayout::Mapping &_type,
+                                                               Memory::UniqueString _id,
+                                                               const std::span<const std::uint8_t> &_data,
+                                                               void *_output) const noexcept
+{
+    const auto &internal = block_cast<InternalData> (data);
+    EMERGENCE_ASSERT (internal.resourceProvider);
+    return internal.resourceProvider->LoadObjectFromData (_type, _id, _data, _output);
+}
+
 LoadingOperationResponse ResourceProvider::LoadThirdPartyResource (Memory::UniqueString _id,
                                                                    Memory::Heap &_allocator,
                                                                    std::uint64_t &_sizeOutput,
@@ -165,6 +182,13 @@ LoadingOperationResponse ResourceProvider::LoadThirdPartyResource (Memory::Uniqu
     return internal.resourceProvider->LoadThirdPartyResource (_id, _allocator, _sizeOutput, _dataOutput);
 }
 
+std::span<const std::uint8_t> ResourceProvider::GetThirdPartyResourceView (Memory::UniqueString _id) const noexcept
+{
+    const auto &internal = block_cast<InternalData> (data);
+    EMERGENCE_ASSERT (internal.resourceProvider);
+    return internal.resourceProvider->GetThirdPartyResourceView (_id);
+}
+
 ResourceProvider::ObjectRegistryCursor ResourceProvider::FindObjectsByType (
     const StandardLayout::Mapping &_type) const noexcept
 {
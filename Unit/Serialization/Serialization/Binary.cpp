@@ -1,11 +1,15 @@
 #define _CRT_SECURE_NO_WARNINGS
 
+#include <atomic>
 #include <cstring>
+#include <string_view>
 
 #include <API/Common/BlockCast.hpp>
 
 #include <Assert/Assert.hpp>
 
+#include <Container/HashMap.hpp>
+#include <Container/HashSet.hpp>
 #include <Container/Optional.hpp>
 #include <Container/String.hpp>
 
@@ -16,57 +20,280 @@
 #include <StandardLayout/Patch.hpp>
 #include <StandardLayout/PatchBuilder.hpp>
 
+#include <Threading/AtomicFlagGuard.hpp>
+
 namespace Emergence::Serialization::Binary
 {
-static void WriteString (std::ostream &_output, const char *_string)
+/// \brief First byte of type name header for FormatVersion above FormatVersion::STREAM.
+/// \details Type names never start with this character, therefore it safely distinguishes versioned headers.
+static constexpr char VERSIONED_HEADER_MARKER = '\x01';
+
+/// \brief Writes data in FormatVersion::STREAM format into output stream.
+class StreamWriter final
 {
-    if (_string)
+public:
+    explicit StreamWriter (std::ostream &_output) noexcept
+        : output (_output)
     {
-        _output.write (_string, static_cast<std::streamsize> (strlen (_string) + 1u)); // +1 for null terminator.
     }
-    else
+
+    void Write (const void *_data, std::size_t _size) noexcept
+    {
+        output.write (static_cast<const char *> (_data), static_cast<std::streamsize> (_size));
+    }
+
+    void WriteString (const char *_string) noexcept
+    {
+        if (_string)
+        {
+            Write (_string, strlen (_string) + 1u); // +1 for null terminator.
+        }
+        else
+        {
+            // Process null strings as empty strings.
+            output.put ('\0');
+        }
+    }
+
+private:
+    std::ostream &output;
+};
+
+/// \brief Appends data in FormatVersion::PLANNED format to the buffer.
+class BufferWriter final
+{
+public:
+    explicit BufferWriter (Container::Vector<std::uint8_t> &_output) noexcept
+        : output (_output)
+    {
+    }
+
+    void Write (const void *_data, std::size_t _size) noexcept
+    {
+        const auto *begin = static_cast<const std::uint8_t *> (_data);
+        output.insert (output.end (), begin, begin + _size);
+    }
+
+    void WriteString (const char *_string) noexcept
     {
         // Process null strings as empty strings.
-        _output.put ('\0');
+        const std::size_t length = _string ? strlen (_string) : 0u;
+        const auto lengthPrefix = static_cast<std::uint32_t> (length);
+        Write (&lengthPrefix, sizeof (lengthPrefix));
+        Write (_string, length);
     }
-}
 
-static Container::Optional<Container::String> ReadString (std::istream &_input)
+private:
+    Container::Vector<std::uint8_t> &output;
+};
+
+/// \brief Reads data in FormatVersion::STREAM format from input stream.
+class StreamReader final
 {
-    Container::StringBuilder output;
-    while (true)
+public:
+    explicit StreamReader (std::istream &_input) noexcept
+        : input (_input)
     {
-        char next;
-        if (!_input.get (next))
+    }
+
+    bool Read (void *_output, std::size_t _size) noexcept
+    {
+        return static_cast<bool> (input.read (static_cast<char *> (_output), static_cast<std::streamsize> (_size)));
+    }
+
+    /// \return String view that is valid until next read or `nullopt` on error.
+    Container::Optional<std::string_view> ReadString () noexcept
+    {
+        buffer.clear ();
+        while (true)
         {
-            return std::nullopt;
+            char next;
+            if (!input.get (next))
+            {
+                return std::nullopt;
+            }
+
+            if (next == '\0')
+            {
+                return std::string_view {buffer};
+            }
+
+            buffer.push_back (next);
         }
+    }
+
+private:
+    std::istream &input;
+    Container::String buffer;
+};
 
-        if (next == '\0')
+/// \brief Reads data in any FormatVersion from memory and moves beginning of given span while reading.
+class SpanReader final
+{
+public:
+    SpanReader (std::span<const std::uint8_t> &_input, FormatVersion _version) noexcept
+        : input (_input),
+          version (_version)
+    {
+    }
+
+    bool Read (void *_output, std::size_t _size) noexcept
+    {
+        if (input.size () < _size)
         {
-            return output.Get ();
+            return false;
         }
 
-        output.Append (next);
+        memcpy (_output, input.data (), _size);
+        input = input.subspan (_size);
+        return true;
     }
+
+    /// \return Pointer to the next given amount of bytes or `nullptr` if there is not enough data.
+    const std::uint8_t *Skip (std::size_t _size) noexcept
+    {
+        if (input.size () < _size)
+        {
+            return nullptr;
+        }
+
+        const std::uint8_t *data = input.data ();
+        input = input.subspan (_size);
+        return data;
+    }
+
+    /// \return String view that points directly to input data or `nullopt` on error.
+    Container::Optional<std::string_view> ReadString () noexcept
+    {
+        switch (version)
+        {
+        case FormatVersion::STREAM:
+        {
+            const void *terminator = memchr (input.data (), '\0', input.size ());
+            if (!terminator)
+            {
+                return std::nullopt;
+            }
+
+            const std::size_t length = static_cast<const std::uint8_t *> (terminator) - input.data ();
+            const std::string_view string {reinterpret_cast<const char *> (input.data ()), length};
+            input = input.subspan (length + 1u);
+            return string;
+        }
+
+        case FormatVersion::PLANNED:
+        {
+            std::uint32_t length;
+            if (!Read (&length, sizeof (length)))
+            {
+                return std::nullopt;
+            }
+
+            if (const std::uint8_t *data = Skip (length))
+            {
+                return std::string_view {reinterpret_cast<const char *> (data), length};
+            }
+
+            return std::nullopt;
+        }
+        }
+
+        EMERGENCE_ASSERT (false);
+        return std::nullopt;
+    }
+
+private:
+    std::span<const std::uint8_t> &input;
+    FormatVersion version;
+};
+
+static void CopyToFixedString (void *_address, std::size_t _capacity, const std::string_view &_value) noexcept
+{
+    const std::size_t length = std::min (_value.size (), _capacity - 1u);
+    memcpy (_address, _value.data (), length);
+    static_cast<char *> (_address)[length] = '\0';
 }
 
 void SerializeTypeName (std::ostream &_output, Memory::UniqueString _typeName) noexcept
 {
-    WriteString (_output, *_typeName);
+    StreamWriter writer {_output};
+    writer.WriteString (*_typeName);
 }
 
-Memory::UniqueString DeserializeTypeName (std::istream &_input) noexcept
+template <typename Reader>
+static Memory::UniqueString DeserializeTypeNameAfterVersion (Reader &_input) noexcept
 {
-    if (Container::Optional<Container::String> typeName = ReadString (_input))
+    if (Container::Optional<std::string_view> typeName = _input.ReadString ())
     {
-        return Memory::UniqueString {typeName->c_str ()};
+        return Memory::UniqueString {typeName.value ()};
     }
 
     return {};
 }
 
-static void SerializePatchValue (std::ostream &_output, const StandardLayout::Field &_field, const void *_value)
+Memory::UniqueString DeserializeTypeName (std::istream &_input) noexcept
+{
+    if (_input.peek () != VERSIONED_HEADER_MARKER)
+    {
+        StreamReader reader {_input};
+        return DeserializeTypeNameAfterVersion (reader);
+    }
+
+    _input.get ();
+    char version;
+
+    if (!_input.get (version) || version != static_cast<char> (FormatVersion::PLANNED))
+    {
+        return {};
+    }
+
+    std::uint32_t length;
+    if (!_input.read (reinterpret_cast<char *> (&length), sizeof (length)))
+    {
+        return {};
+    }
+
+    Container::String typeName (length, '\0');
+    if (!_input.read (typeName.data (), length))
+    {
+        return {};
+    }
+
+    return Memory::UniqueString {typeName};
+}
+
+void SerializeTypeName (Container::Vector<std::uint8_t> &_output, Memory::UniqueString _typeName) noexcept
+{
+    BufferWriter writer {_output};
+    const char header[] {VERSIONED_HEADER_MARKER, static_cast<char> (FormatVersion::PLANNED)};
+    writer.Write (header, sizeof (header));
+    writer.WriteString (*_typeName);
+}
+
+Memory::UniqueString DeserializeTypeName (std::span<const std::uint8_t> &_input,
+                                          FormatVersion &_versionOutput) noexcept
+{
+    if (_input.empty () || _input.front () != static_cast<std::uint8_t> (VERSIONED_HEADER_MARKER))
+    {
+        _versionOutput = FormatVersion::STREAM;
+        SpanReader reader {_input, _versionOutput};
+        return DeserializeTypeNameAfterVersion (reader);
+    }
+
+    if (_input.size () < 2u || _input[1u] != static_cast<std::uint8_t> (FormatVersion::PLANNED))
+    {
+        EMERGENCE_LOG (ERROR, "Serialization: Unknown binary format version.");
+        return {};
+    }
+
+    _versionOutput = FormatVersion::PLANNED;
+    _input = _input.subspan (2u);
+    SpanReader reader {_input, _versionOutput};
+    return DeserializeTypeNameAfterVersion (reader);
+}
+
+template <typename Writer>
+static void SerializePatchValue (Writer &_output, const StandardLayout::Field &_field, const void *_value)
 {
     switch (_field.GetArchetype ())
     {
@@ -74,11 +301,11 @@ static void SerializePatchValue (std::ostream &_output, const StandardLayout::Fi
     case StandardLayout::FieldArchetype::INT:
     case StandardLayout::FieldArchetype::UINT:
     case StandardLayout::FieldArchetype::FLOAT:
-        _output.write (static_cast<const char *> (_value), static_cast<std::streamsize> (_field.GetSize ()));
+        _output.Write (_value, _field.GetSize ());
         break;
 
     case StandardLayout::FieldArchetype::UNIQUE_STRING:
-        WriteString (_output, **static_cast<const Memory::UniqueString *> (_value));
+        _output.WriteString (**static_cast<const Memory::UniqueString *> (_value));
         break;
 
     case StandardLayout::FieldArchetype::STRING:
@@ -93,7 +320,8 @@ static void SerializePatchValue (std::ostream &_output, const StandardLayout::Fi
     }
 }
 
-static bool DeserializePatchValue (std::istream &_input,
+template <typename Reader>
+static bool DeserializePatchValue (Reader &_input,
                                    const StandardLayout::Field &_field,
                                    StandardLayout::FieldId _fieldId,
                                    StandardLayout::PatchBuilder &_builder)
@@ -102,7 +330,7 @@ static bool DeserializePatchValue (std::istream &_input,
     if (_field.GetArchetype () != StandardLayout::FieldArchetype::UNIQUE_STRING)
     {
         EMERGENCE_ASSERT (buffer.size () >= _field.GetSize ());
-        if (!_input.read (reinterpret_cast<char *> (buffer.data ()), static_cast<std::streamsize> (_field.GetSize ())))
+        if (!_input.Read (buffer.data (), _field.GetSize ()))
         {
             return false;
         }
@@ -163,9 +391,9 @@ static bool DeserializePatchValue (std::istream &_input,
         break;
 
     case StandardLayout::FieldArchetype::UNIQUE_STRING:
-        if (Container::Optional<Container::String> string = ReadString (_input))
+        if (Container::Optional<std::string_view> string = _input.ReadString ())
         {
-            _builder.SetUniqueString (_fieldId, Memory::UniqueString {string.value ().c_str ()});
+            _builder.SetUniqueString (_fieldId, Memory::UniqueString {string.value ()});
         }
         else
         {
@@ -188,38 +416,40 @@ static bool DeserializePatchValue (std::istream &_input,
     return true;
 }
 
-void SerializePatch (std::ostream &_output, const StandardLayout::Patch &_patch) noexcept
+template <typename Writer>
+static void SerializePatch (Writer &_output, const StandardLayout::Patch &_patch) noexcept
 {
     const StandardLayout::Mapping &mapping = _patch.GetTypeMapping ();
-    WriteString (_output, *mapping.GetName ());
+    _output.WriteString (*mapping.GetName ());
 
     const auto changeCount = static_cast<std::uint32_t> (_patch.GetChangeCount ());
-    _output.write (reinterpret_cast<const char *> (&changeCount), sizeof (changeCount));
+    _output.Write (&changeCount, sizeof (changeCount));
 
     for (const auto &change : _patch)
     {
-        _output.write (reinterpret_cast<const char *> (&change.field), sizeof (change.field));
+        _output.Write (&change.field, sizeof (change.field));
         StandardLayout::Field field = mapping.GetField (change.field);
         SerializePatchValue (_output, field, change.newValue);
     }
 }
 
-bool DeserializePatch (std::istream &_input,
-                       void *_outputAddress,
-                       const Container::MappingRegistry &_patchableTypesRegistry) noexcept
+template <typename Reader>
+static bool DeserializePatch (Reader &_input,
+                              void *_outputAddress,
+                              const Container::MappingRegistry &_patchableTypesRegistry) noexcept
 {
     StandardLayout::PatchBuilder patchBuilder;
     StandardLayout::Mapping mapping;
 
-    if (Container::Optional<Container::String> typeName = ReadString (_input))
+    if (Container::Optional<std::string_view> typeName = _input.ReadString ())
     {
-        if ((mapping = _patchableTypesRegistry.Get (Memory::UniqueString {*typeName})))
+        if ((mapping = _patchableTypesRegistry.Get (Memory::UniqueString {typeName.value ()})))
         {
             patchBuilder.Begin (mapping);
         }
         else
         {
-            EMERGENCE_LOG (ERROR, "Serialization: Type \"", *typeName, "\" is not patchable!");
+            EMERGENCE_LOG (ERROR, "Serialization: Type \"", typeName.value (), "\" is not patchable!");
             return false;
         }
     }
@@ -229,7 +459,7 @@ bool DeserializePatch (std::istream &_input,
     }
 
     std::uint32_t changeCount = 0u;
-    if (!_input.read (reinterpret_cast<char *> (&changeCount), sizeof (changeCount)))
+    if (!_input.Read (&changeCount, sizeof (changeCount)))
     {
         return false;
     }
@@ -237,7 +467,7 @@ bool DeserializePatch (std::istream &_input,
     for (std::uint32_t index = 0u; index < changeCount; ++index)
     {
         StandardLayout::FieldId fieldId;
-        if (!_input.read (reinterpret_cast<char *> (&fieldId), sizeof (fieldId)))
+        if (!_input.Read (&fieldId, sizeof (fieldId)))
         {
             return false;
         }
@@ -253,7 +483,8 @@ bool DeserializePatch (std::istream &_input,
     return true;
 }
 
-void SerializeObject (std::ostream &_output, const void *_object, const StandardLayout::Mapping &_mapping) noexcept
+template <typename Writer>
+static void SerializeObjectFieldByField (Writer &_output, const void *_object, const StandardLayout::Mapping &_mapping)
 {
     const void *lastBitsetByteAddress = nullptr;
     std::uint8_t lastBitsetByte = 0u;
@@ -268,7 +499,7 @@ void SerializeObject (std::ostream &_output, const void *_object, const Standard
         // We need to write last bitset byte if we stopped encountering bits.
         if (lastBitsetByteAddress && field.GetArchetype () != StandardLayout::FieldArchetype::BIT)
         {
-            _output.write (reinterpret_cast<const char *> (&lastBitsetByte), sizeof (std::uint8_t));
+            _output.Write (&lastBitsetByte, sizeof (std::uint8_t));
             lastBitsetByteAddress = nullptr;
         }
 
@@ -281,7 +512,7 @@ void SerializeObject (std::ostream &_output, const void *_object, const Standard
                 if (lastBitsetByteAddress != address && lastBitsetByteAddress != nullptr)
                 {
                     // We're starting new bitset byte: write older one.
-                    _output.write (reinterpret_cast<const char *> (&lastBitsetByte), sizeof (std::uint8_t));
+                    _output.Write (&lastBitsetByte, sizeof (std::uint8_t));
                 }
 
                 lastBitsetByteAddress = address;
@@ -296,15 +527,15 @@ void SerializeObject (std::ostream &_output, const void *_object, const Standard
         case StandardLayout::FieldArchetype::UINT:
         case StandardLayout::FieldArchetype::FLOAT:
         case StandardLayout::FieldArchetype::BLOCK:
-            _output.write (static_cast<const char *> (address), static_cast<std::streamsize> (field.GetSize ()));
+            _output.Write (address, field.GetSize ());
             break;
 
         case StandardLayout::FieldArchetype::STRING:
-            WriteString (_output, static_cast<const char *> (address));
+            _output.WriteString (static_cast<const char *> (address));
             break;
 
         case StandardLayout::FieldArchetype::UNIQUE_STRING:
-            WriteString (_output, **static_cast<const Memory::UniqueString *> (address));
+            _output.WriteString (**static_cast<const Memory::UniqueString *> (address));
             break;
 
         case StandardLayout::FieldArchetype::NESTED_OBJECT:
@@ -312,7 +543,7 @@ void SerializeObject (std::ostream &_output, const void *_object, const Standard
             break;
 
         case StandardLayout::FieldArchetype::UTF8_STRING:
-            WriteString (_output, static_cast<const Container::Utf8String *> (address)->c_str ());
+            _output.WriteString (static_cast<const Container::Utf8String *> (address)->c_str ());
             break;
 
         case StandardLayout::FieldArchetype::VECTOR:
@@ -322,15 +553,13 @@ void SerializeObject (std::ostream &_output, const void *_object, const Standard
             EMERGENCE_ASSERT (vectorSizeInBytes % field.GetVectorItemMapping ().GetObjectSize () == 0u);
             const std::uint32_t vectorSize =
                 static_cast<std::uint32_t> (vectorSizeInBytes / field.GetVectorItemMapping ().GetObjectSize ());
-
-            _output.write (reinterpret_cast<const char *> (&vectorSize),
-                           static_cast<std::streamsize> (sizeof (vectorSize)));
+            _output.Write (&vectorSize, sizeof (vectorSize));
 
             for (const std::uint8_t *pointer = Container::UntypedVectorUtility::Begin (address);
                  pointer != Container::UntypedVectorUtility::End (address);
                  pointer += field.GetVectorItemMapping ().GetObjectSize ())
             {
-                SerializeObject (_output, pointer, field.GetVectorItemMapping ());
+                SerializeObjectFieldByField (_output, pointer, field.GetVectorItemMapping ());
             }
 
             break;
@@ -347,17 +576,18 @@ void SerializeObject (std::ostream &_output, const void *_object, const Standard
     // If bitset was last field -- write it now.
     if (lastBitsetByteAddress != nullptr)
     {
-        _output.write (reinterpret_cast<const char *> (&lastBitsetByte), sizeof (std::uint8_t));
+        _output.Write (&lastBitsetByte, sizeof (std::uint8_t));
     }
 }
 
-bool DeserializeObject (std::istream &_input,
-                        void *_object,
-                        const StandardLayout::Mapping &_mapping,
-                        const Container::MappingRegistry &_patchableTypesRegistry) noexcept
+template <typename Reader>
+static bool DeserializeObjectFieldByField (Reader &_input,
+                                           void *_object,
+                                           const StandardLayout::Mapping &_mapping,
+                                           const Container::MappingRegistry &_patchableTypesRegistry)
 {
     const void *lastBitsetByteAddress = nullptr;
-    char lastBitsetByte = 0u;
+    std::uint8_t lastBitsetByte = 0u;
 
     for (auto iterator = _mapping.BeginConditional (_object), end = _mapping.EndConditional (); iterator != end;
          ++iterator)
@@ -372,13 +602,13 @@ bool DeserializeObject (std::istream &_input,
             if (lastBitsetByteAddress != address)
             {
                 lastBitsetByteAddress = address;
-                if (!_input.get (lastBitsetByte))
+                if (!_input.Read (&lastBitsetByte, sizeof (std::uint8_t)))
                 {
                     return false;
                 }
             }
 
-            if (static_cast<std::uint8_t> (lastBitsetByte) & (1u << field.GetBitOffset ()))
+            if (lastBitsetByte & (1u << field.GetBitOffset ()))
             {
                 *static_cast<std::uint8_t *> (address) |= 1u << field.GetBitOffset ();
             }
@@ -394,7 +624,7 @@ bool DeserializeObject (std::istream &_input,
         case StandardLayout::FieldArchetype::UINT:
         case StandardLayout::FieldArchetype::FLOAT:
         case StandardLayout::FieldArchetype::BLOCK:
-            if (!_input.read (static_cast<char *> (address), static_cast<std::streamsize> (field.GetSize ())))
+            if (!_input.Read (address, field.GetSize ()))
             {
                 return false;
             }
@@ -402,10 +632,9 @@ bool DeserializeObject (std::istream &_input,
 
         case StandardLayout::FieldArchetype::STRING:
         {
-            if (Container::Optional<Container::String> string = ReadString (_input))
+            if (Container::Optional<std::string_view> string = _input.ReadString ())
             {
-                strncpy (static_cast<char *> (address), string.value ().c_str (), field.GetSize () - 1u);
-                static_cast<char *> (address)[field.GetSize () - 1u] = '\0';
+                CopyToFixedString (address, field.GetSize (), string.value ());
             }
             else
             {
@@ -417,9 +646,9 @@ bool DeserializeObject (std::istream &_input,
 
         case StandardLayout::FieldArchetype::UNIQUE_STRING:
         {
-            if (Container::Optional<Container::String> string = ReadString (_input))
+            if (Container::Optional<std::string_view> string = _input.ReadString ())
             {
-                *static_cast<Memory::UniqueString *> (address) = Memory::UniqueString {string.value ().c_str ()};
+                *static_cast<Memory::UniqueString *> (address) = Memory::UniqueString {string.value ()};
             }
             else
             {
@@ -435,7 +664,7 @@ bool DeserializeObject (std::istream &_input,
 
         case StandardLayout::FieldArchetype::UTF8_STRING:
         {
-            if (Container::Optional<Container::String> string = ReadString (_input))
+            if (Container::Optional<std::string_view> string = _input.ReadString ())
             {
                 *static_cast<Container::Utf8String *> (address) = string.value ();
             }
@@ -450,7 +679,7 @@ bool DeserializeObject (std::istream &_input,
         case StandardLayout::FieldArchetype::VECTOR:
         {
             std::uint32_t vectorSize;
-            if (!_input.read (reinterpret_cast<char *> (&vectorSize), sizeof (vectorSize)))
+            if (!_input.Read (&vectorSize, sizeof (vectorSize)))
             {
                 return false;
             }
@@ -462,7 +691,7 @@ bool DeserializeObject (std::istream &_input,
                  pointer != Container::UntypedVectorUtility::End (address); pointer += itemMapping.GetObjectSize ())
             {
                 itemMapping.Construct (pointer);
-                if (!DeserializeObject (_input, pointer, itemMapping, _patchableTypesRegistry))
+                if (!DeserializeObjectFieldByField (_input, pointer, itemMapping, _patchableTypesRegistry))
                 {
                     return false;
                 }
@@ -485,4 +714,389 @@ bool DeserializeObject (std::istream &_input,
 
     return true;
 }
+
+void SerializeObject (std::ostream &_output, const void *_object, const StandardLayout::Mapping &_mapping) noexcept
+{
+    StreamWriter writer {_output};
+    SerializeObjectFieldByField (writer, _object, _mapping);
+}
+
+bool DeserializeObject (std::istream &_input,
+                        void *_object,
+                        const StandardLayout::Mapping &_mapping,
+                        const Container::MappingRegistry &_patchableTypesRegistry) noexcept
+{
+    StreamReader reader {_input};
+    return DeserializeObjectFieldByField (reader, _object, _mapping, _patchableTypesRegistry);
+}
+
+/// \brief Precomputed sequence of operations that (de)serializes objects of one mapping.
+/// \details Produces exactly the same data as field by field serialization, because fields are still processed
+///          in mapping order: copies are only merged when fields are adjacent both in mapping order and in memory.
+struct SerializationPlan final
+{
+    enum class StepType : std::uint8_t
+    {
+        COPY,
+        BITS,
+        STRING,
+        UNIQUE_STRING,
+        UTF8_STRING,
+        VECTOR,
+        PATCH,
+    };
+
+    struct Step final
+    {
+        StepType type = StepType::COPY;
+
+        /// \brief Mask of all bits that are stored in one bitset byte for StepType::BITS.
+        std::uint8_t bitMask = 0u;
+
+        std::size_t offset = 0u;
+
+        /// \brief Size of copied block for StepType::COPY or capacity for StepType::STRING.
+        std::size_t size = 0u;
+
+        /// \brief Item plan for StepType::VECTOR.
+        const SerializationPlan *itemPlan = nullptr;
+    };
+
+    /// \return Whether whole object is one memory block, so arrays of such objects can be copied at once.
+    [[nodiscard]] bool IsSingleCopy () const noexcept
+    {
+        return steps.size () == 1u && steps.front ().type == StepType::COPY && steps.front ().offset == 0u &&
+               steps.front ().size == mapping.GetObjectSize ();
+    }
+
+    StandardLayout::Mapping mapping;
+
+    Container::Vector<Step> steps {Memory::Profiler::AllocationGroup {Memory::UniqueString {"SerializationPlan"}}};
+};
+
+/// \brief Compiled plans are cached for the whole application lifetime, because mappings are never unloaded.
+struct PlanCache final
+{
+    /// \details Node-based map is used, therefore pointers to plans are never invalidated.
+    Container::HashMap<StandardLayout::Mapping, SerializationPlan> plans {
+        Memory::Profiler::AllocationGroup {Memory::UniqueString {"SerializationPlan"}}};
+
+    /// \brief Mappings that can not be planned, for example due to visibility conditions.
+    /// \details Mappings are also added here while their plans are being compiled, so recursive mappings are
+    ///          processed field by field instead of causing infinite recursion.
+    Container::HashSet<StandardLayout::Mapping> unplannable {
+        Memory::Profiler::AllocationGroup {Memory::UniqueString {"SerializationPlan"}}};
+
+    std::atomic_flag lock;
+};
+
+static PlanCache &GetPlanCache () noexcept
+{
+    static PlanCache cache;
+    return cache;
+}
+
+/// \invariant Called under PlanCache::lock.
+static const SerializationPlan *CompilePlanLocked (PlanCache &_cache, const StandardLayout::Mapping &_mapping) noexcept
+{
+    if (auto iterator = _cache.plans.find (_mapping); iterator != _cache.plans.end ())
+    {
+        return &iterator->second;
+    }
+
+    if (_cache.unplannable.find (_mapping) != _cache.unplannable.end ())
+    {
+        return nullptr;
+    }
+
+    _cache.unplannable.emplace (_mapping);
+    if (_mapping.HasVisibilityConditions ())
+    {
+        return nullptr;
+    }
+
+    SerializationPlan plan;
+    plan.mapping = _mapping;
+
+    for (StandardLayout::Field field : _mapping)
+    {
+        SerializationPlan::Step *last = plan.steps.empty () ? nullptr : &plan.steps.back ();
+        switch (field.GetArchetype ())
+        {
+        case StandardLayout::FieldArchetype::BIT:
+        {
+            const auto bit = static_cast<std::uint8_t> (1u << field.GetBitOffset ());
+            if (last && last->type == SerializationPlan::StepType::BITS && last->offset == field.GetOffset ())
+            {
+                last->bitMask |= bit;
+            }
+            else
+            {
+                plan.steps.emplace_back () = {SerializationPlan::StepType::BITS, bit, field.GetOffset (), 1u};
+            }
+
+            break;
+        }
+
+        case StandardLayout::FieldArchetype::INT:
+        case StandardLayout::FieldArchetype::UINT:
+        case StandardLayout::FieldArchetype::FLOAT:
+        case StandardLayout::FieldArchetype::BLOCK:
+            if (last && last->type == SerializationPlan::StepType::COPY &&
+                last->offset + last->size == field.GetOffset ())
+            {
+                last->size += field.GetSize ();
+            }
+            else
+            {
+                plan.steps.emplace_back () = {SerializationPlan::StepType::COPY, 0u, field.GetOffset (),
+                                              field.GetSize ()};
+            }
+
+            break;
+
+        case StandardLayout::FieldArchetype::STRING:
+            plan.steps.emplace_back () = {SerializationPlan::StepType::STRING, 0u, field.GetOffset (),
+                                          field.GetSize ()};
+            break;
+
+        case StandardLayout::FieldArchetype::UNIQUE_STRING:
+            plan.steps.emplace_back () = {SerializationPlan::StepType::UNIQUE_STRING, 0u, field.GetOffset ()};
+            break;
+
+        case StandardLayout::FieldArchetype::NESTED_OBJECT:
+            // We do nothing for nested objects, because all of their fields are projected.
+            break;
+
+        case StandardLayout::FieldArchetype::UTF8_STRING:
+            plan.steps.emplace_back () = {SerializationPlan::StepType::UTF8_STRING, 0u, field.GetOffset ()};
+            break;
+
+        case StandardLayout::FieldArchetype::VECTOR:
+        {
+            const SerializationPlan *itemPlan = CompilePlanLocked (_cache, field.GetVectorItemMapping ());
+            if (!itemPlan)
+            {
+                return nullptr;
+            }
+
+            plan.steps.emplace_back () = {SerializationPlan::StepType::VECTOR, 0u, field.GetOffset (), 0u, itemPlan};
+            break;
+        }
+
+        case StandardLayout::FieldArchetype::PATCH:
+            plan.steps.emplace_back () = {SerializationPlan::StepType::PATCH, 0u, field.GetOffset ()};
+            break;
+        }
+    }
+
+    _cache.unplannable.erase (_mapping);
+    return &_cache.plans.emplace (_mapping, std::move (plan)).first->second;
+}
+
+static const SerializationPlan *GetPlan (const StandardLayout::Mapping &_mapping) noexcept
+{
+    PlanCache &cache = GetPlanCache ();
+    AtomicFlagGuard guard {cache.lock};
+    return CompilePlanLocked (cache, _mapping);
+}
+
+static void ExecuteSerialization (BufferWriter &_output, const void *_object, const SerializationPlan &_plan) noexcept
+{
+    const auto *object = static_cast<const std::uint8_t *> (_object);
+    for (const SerializationPlan::Step &step : _plan.steps)
+    {
+        const std::uint8_t *address = object + step.offset;
+        switch (step.type)
+        {
+        case SerializationPlan::StepType::COPY:
+            _output.Write (address, step.size);
+            break;
+
+        case SerializationPlan::StepType::BITS:
+        {
+            const std::uint8_t bitsetByte = *address & step.bitMask;
+            _output.Write (&bitsetByte, sizeof (bitsetByte));
+            break;
+        }
+
+        case SerializationPlan::StepType::STRING:
+            _output.WriteString (reinterpret_cast<const char *> (address));
+            break;
+
+        case SerializationPlan::StepType::UNIQUE_STRING:
+            _output.WriteString (**reinterpret_cast<const Memory::UniqueString *> (address));
+            break;
+
+        case SerializationPlan::StepType::UTF8_STRING:
+            _output.WriteString (reinterpret_cast<const Container::Utf8String *> (address)->c_str ());
+            break;
+
+        case SerializationPlan::StepType::VECTOR:
+        {
+            const std::uint8_t *begin = Container::UntypedVectorUtility::Begin (address);
+            const std::uint8_t *end = Container::UntypedVectorUtility::End (address);
+            const std::size_t itemSize = step.itemPlan->mapping.GetObjectSize ();
+            EMERGENCE_ASSERT ((end - begin) % itemSize == 0u);
+
+            const auto vectorSize = static_cast<std::uint32_t> ((end - begin) / itemSize);
+            _output.Write (&vectorSize, sizeof (vectorSize));
+
+            if (step.itemPlan->IsSingleCopy ())
+            {
+                _output.Write (begin, end - begin);
+                break;
+            }
+
+            for (const std::uint8_t *item = begin; item != end; item += itemSize)
+            {
+                ExecuteSerialization (_output, item, *step.itemPlan);
+            }
+
+            break;
+        }
+
+        case SerializationPlan::StepType::PATCH:
+            SerializePatch (_output, *reinterpret_cast<const StandardLayout::Patch *> (address));
+            break;
+        }
+    }
+}
+
+static bool ExecuteDeserialization (SpanReader &_input,
+                                    void *_object,
+                                    const SerializationPlan &_plan,
+                                    const Container::MappingRegistry &_patchableTypesRegistry) noexcept
+{
+    auto *object = static_cast<std::uint8_t *> (_object);
+    for (const SerializationPlan::Step &step : _plan.steps)
+    {
+        std::uint8_t *address = object + step.offset;
+        switch (step.type)
+        {
+        case SerializationPlan::StepType::COPY:
+            if (!_input.Read (address, step.size))
+            {
+                return false;
+            }
+
+            break;
+
+        case SerializationPlan::StepType::BITS:
+        {
+            std::uint8_t bitsetByte;
+            if (!_input.Read (&bitsetByte, sizeof (bitsetByte)))
+            {
+                return false;
+            }
+
+            *address = (*address & ~step.bitMask) | (bitsetByte & step.bitMask);
+            break;
+        }
+
+        case SerializationPlan::StepType::STRING:
+            if (Container::Optional<std::string_view> string = _input.ReadString ())
+            {
+                CopyToFixedString (address, step.size, string.value ());
+                break;
+            }
+
+            return false;
+
+        case SerializationPlan::StepType::UNIQUE_STRING:
+            if (Container::Optional<std::string_view> string = _input.ReadString ())
+            {
+                *reinterpret_cast<Memory::UniqueString *> (address) = Memory::UniqueString {string.value ()};
+                break;
+            }
+
+            return false;
+
+        case SerializationPlan::StepType::UTF8_STRING:
+            if (Container::Optional<std::string_view> string = _input.ReadString ())
+            {
+                *reinterpret_cast<Container::Utf8String *> (address) = string.value ();
+                break;
+            }
+
+            return false;
+
+        case SerializationPlan::StepType::VECTOR:
+        {
+            std::uint32_t vectorSize;
+            if (!_input.Read (&vectorSize, sizeof (vectorSize)))
+            {
+                return false;
+            }
+
+            const std::size_t itemSize = step.itemPlan->mapping.GetObjectSize ();
+            Container::UntypedVectorUtility::InitSize (address, vectorSize * itemSize);
+            std::uint8_t *begin = Container::UntypedVectorUtility::Begin (address);
+            std::uint8_t *end = Container::UntypedVectorUtility::End (address);
+
+            if (step.itemPlan->IsSingleCopy ())
+            {
+                // Every byte of item is covered by plain fields, therefore copy fully initializes items.
+                if (!_input.Read (begin, end - begin))
+                {
+                    return false;
+                }
+
+                break;
+            }
+
+            for (std::uint8_t *item = begin; item != end; item += itemSize)
+            {
+                step.itemPlan->mapping.Construct (item);
+                if (!ExecuteDeserialization (_input, item, *step.itemPlan, _patchableTypesRegistry))
+                {
+                    return false;
+                }
+            }
+
+            break;
+        }
+
+        case SerializationPlan::StepType::PATCH:
+            if (!DeserializePatch (_input, address, _patchableTypesRegistry))
+            {
+                return false;
+            }
+
+            break;
+        }
+    }
+
+    return true;
+}
+
+void SerializeObject (Container::Vector<std::uint8_t> &_output,
+                      const void *_object,
+                      const StandardLayout::Mapping &_mapping) noexcept
+{
+    BufferWriter writer {_output};
+    if (const SerializationPlan *plan = GetPlan (_mapping))
+    {
+        ExecuteSerialization (writer, _object, *plan);
+    }
+    else
+    {
+        SerializeObjectFieldByField (writer, _object, _mapping);
+    }
+}
+
+bool DeserializeObject (std::span<const std::uint8_t> &_input,
+                        void *_object,
+                        const StandardLayout::Mapping &_mapping,
+                        const Container::MappingRegistry &_patchableTypesRegistry,
+                        FormatVersion _version) noexcept
+{
+    SpanReader reader {_input, _version};
+    if (const SerializationPlan *plan = GetPlan (_mapping))
+    {
+        return ExecuteDeserialization (reader, _object, *plan, _patchableTypesRegistry);
+    }
+
+    return DeserializeObjectFieldByField (reader, _object, _mapping, _patchableTypesRegistry);
+}
 } // namespace Emergence::Serialization::Binary
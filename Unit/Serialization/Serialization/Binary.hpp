@@ -2,19 +2,36 @@
 
 #include <SerializationApi.hpp>
 
+#include <cstdint>
 #include <istream>
 #include <ostream>
+#include <span>
 
 #include <Container/MappingRegistry.hpp>
+#include <Container/Vector.hpp>
 
 #include <StandardLayout/Mapping.hpp>
 
 namespace Emergence::Serialization::Binary
 {
+/// \brief Version of binary object format.
+/// \details Version is stored in type name header, therefore it is only known for data with type names, like
+///          resource objects. Data without type name header is always expected to be in ::STREAM format.
+enum class FormatVersion : std::uint8_t
+{
+    /// \brief Original format, produced by stream serialization. Strings are null-terminated.
+    STREAM = 0u,
+
+    /// \brief Format, produced by buffer serialization. Strings are length-prefixed, so they are copied at once.
+    /// \details All other values are written exactly like in ::STREAM format.
+    PLANNED,
+};
+
 /// \brief Adds type name info to given output stream.
 SerializationApi void SerializeTypeName (std::ostream &_output, Memory::UniqueString _typeName) noexcept;
 
 /// \brief Attempts to read type name from given output stream. Returns empty name on error.
+/// \details Supports headers of every FormatVersion.
 SerializationApi Memory::UniqueString DeserializeTypeName (std::istream &_input) noexcept;
 
 /// \brief Serializes given object of given type into given binary stream.
@@ -30,4 +47,33 @@ bool SerializationApi DeserializeObject (std::istream &_input,
                                          void *_object,
                                          const StandardLayout::Mapping &_mapping,
                                          const Container::MappingRegistry &_patchableTypesRegistry) noexcept;
+
+/// \brief Appends type name header with FormatVersion::PLANNED to given buffer.
+SerializationApi void SerializeTypeName (Container::Vector<std::uint8_t> &_output,
+                                         Memory::UniqueString _typeName) noexcept;
+
+/// \brief Reads type name header from the beginning of given data and moves data beginning after the header.
+/// \return Type name or empty name on error.
+SerializationApi Memory::UniqueString DeserializeTypeName (std::span<const std::uint8_t> &_input,
+                                                           FormatVersion &_versionOutput) noexcept;
+
+/// \brief Appends given object of given type to given buffer in FormatVersion::PLANNED.
+/// \details Uses compiled serialization plan for given mapping, see ::DeserializeObject for span.
+/// \warning Serialization is mapping-dependant: deserialization must be
+///          made using exactly same mapping, otherwise data will be broken.
+SerializationApi void SerializeObject (Container::Vector<std::uint8_t> &_output,
+                                       const void *_object,
+                                       const StandardLayout::Mapping &_mapping) noexcept;
+
+/// \brief Deserializes object from the beginning of given data and moves data beginning after the object.
+/// \details Serialization plan is compiled once for every mapping: contiguous trivially copyable fields are merged
+///          into single copies and vectors of such objects are copied at once. Plans are not compiled for mappings
+///          with visibility conditions, because their field set depends on object. Such mappings are deserialized
+///          field by field, but still without streams.
+/// \invariant Data must be serialized in given format version.
+SerializationApi bool DeserializeObject (std::span<const std::uint8_t> &_input,
+                                         void *_object,
+                                         const StandardLayout::Mapping &_mapping,
+                                         const Container::MappingRegistry &_patchableTypesRegistry,
+                                         FormatVersion _version) noexcept;
 } // namespace Emergence::Serialization::Binary
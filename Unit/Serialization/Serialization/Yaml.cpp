@@ -1,11 +1,19 @@
 #define _CRT_SECURE_NO_WARNINGS
 
+#include <cctype>
+#include <charconv>
 #include <cstring>
+#include <limits>
+#include <streambuf>
+#include <string_view>
 
 #include <API/Common/BlockCast.hpp>
 
 #include <Assert/Assert.hpp>
 
+#include <Container/String.hpp>
+#include <Container/Vector.hpp>
+
 #include <Log/Log.hpp>
 
 #include <Serialization/Yaml.hpp>
@@ -16,6 +24,7 @@
 // We're linking to static library, but define is not passed to us for some reason.
 // Therefore, we need to add it manually.
 #define YAML_CPP_STATIC_DEFINE
+#include <yaml-cpp/eventhandler.h>
 #include <yaml-cpp/yaml.h>
 
 namespace Emergence::Serialization::Yaml
@@ -244,466 +253,1138 @@ static void SerializeObjectToYaml (YAML::Node &_output, const void *_object, con
     }
 }
 
-static bool DeserializeLeafValueFromYaml (const YAML::Node &_input, void *_address, const StandardLayout::Field &_field)
+static bool IsFlexibleCase (const std::string &_value)
 {
-    try
+    // Same rules as in yaml-cpp: all lower, all upper or first upper and other lower.
+    if (_value.empty ())
     {
-        switch (_field.GetArchetype ())
-        {
-        case StandardLayout::FieldArchetype::BIT:
-            if (_input.as<bool> ())
-            {
-                *static_cast<std::uint8_t *> (_address) |= 1u << _field.GetBitOffset ();
-            }
-            else
-            {
-                *static_cast<std::uint8_t *> (_address) &= ~(1u << _field.GetBitOffset ());
-            }
-            break;
-
-        case StandardLayout::FieldArchetype::INT:
-            switch (_field.GetSize ())
-            {
-            case 1u:
-                *static_cast<int8_t *> (_address) = _input.as<int8_t> ();
-                break;
-            case 2u:
-                *static_cast<int16_t *> (_address) = _input.as<int16_t> ();
-                break;
-            case 4u:
-                *static_cast<int32_t *> (_address) = _input.as<int32_t> ();
-                break;
-            case 8u:
-                *static_cast<int64_t *> (_address) = _input.as<int64_t> ();
-                break;
-            }
-            break;
-
-        case StandardLayout::FieldArchetype::UINT:
-            switch (_field.GetSize ())
-            {
-            case 1u:
-                *static_cast<std::uint8_t *> (_address) = _input.as<std::uint8_t> ();
-                break;
-            case 2u:
-                *static_cast<std::uint16_t *> (_address) = _input.as<std::uint16_t> ();
-                break;
-            case 4u:
-                *static_cast<std::uint32_t *> (_address) = _input.as<std::uint32_t> ();
-                break;
-            case 8u:
-                *static_cast<std::uint64_t *> (_address) = _input.as<std::uint64_t> ();
-                break;
-            }
-            break;
-
-        case StandardLayout::FieldArchetype::FLOAT:
-            switch (_field.GetSize ())
-            {
-            case 4u:
-                *static_cast<float *> (_address) = _input.as<float> ();
-                break;
-            case 8u:
-                *static_cast<double *> (_address) = _input.as<double> ();
-                break;
-            }
-            break;
+        return true;
+    }
 
-        case StandardLayout::FieldArchetype::STRING:
-            strncpy (static_cast<char *> (_address), _input.Scalar ().c_str (), _field.GetSize () - 1u);
-            static_cast<char *> (_address)[_field.GetSize () - 1u] = '\0';
-            break;
+    const bool firstUpper = std::isupper (static_cast<unsigned char> (_value[0u]));
+    bool restLower = true;
+    bool restUpper = true;
 
-        case StandardLayout::FieldArchetype::BLOCK:
-        {
-            auto binary = _input.as<YAML::Binary> ();
-            EMERGENCE_ASSERT (binary.data ());
-            memcpy (_address, binary.data (), std::min (binary.size (), _field.GetSize ()));
-            break;
-        }
+    for (std::size_t index = 1u; index < _value.size (); ++index)
+    {
+        restLower &= !std::isupper (static_cast<unsigned char> (_value[index]));
+        restUpper &= !std::islower (static_cast<unsigned char> (_value[index]));
+    }
 
-        case StandardLayout::FieldArchetype::UNIQUE_STRING:
-            *static_cast<Memory::UniqueString *> (_address) = Memory::UniqueString {_input.Scalar ().c_str ()};
-            break;
+    return restLower || (firstUpper && restUpper);
+}
 
-        case StandardLayout::FieldArchetype::UTF8_STRING:
-            *static_cast<Container::Utf8String *> (_address) = _input.Scalar ();
-            break;
+static bool ParseScalar (const std::string &_value, bool &_output)
+{
+    static const std::pair<std::string_view, std::string_view> names[] = {
+        {"y", "n"}, {"yes", "no"}, {"true", "false"}, {"on", "off"}};
 
-        case StandardLayout::FieldArchetype::NESTED_OBJECT:
-        case StandardLayout::FieldArchetype::VECTOR:
-        case StandardLayout::FieldArchetype::PATCH:
-            // Only leaf values are supported.
-            EMERGENCE_ASSERT (false);
-            break;
-        }
-    }
-    catch ([[maybe_unused]] YAML::Exception &exception)
+    if (!IsFlexibleCase (_value) || _value.size () > 5u)
     {
         return false;
     }
 
-    return true;
-}
+    char lowered[6u];
+    for (std::size_t index = 0u; index < _value.size (); ++index)
+    {
+        lowered[index] = static_cast<char> (std::tolower (static_cast<unsigned char> (_value[index])));
+    }
 
-static bool DeserializePatchLeafValueFromYaml (const YAML::Node &_input,
-                                               StandardLayout::PatchBuilder &_builder,
-                                               const StandardLayout::Mapping &_mapping,
-                                               const StandardLayout::Field &_field)
-{
-    StandardLayout::FieldId fieldId = _mapping.GetFieldId (_field);
-    try
+    const std::string_view value {lowered, _value.size ()};
+    for (const auto &[trueName, falseName] : names)
     {
-        switch (_field.GetArchetype ())
+        if (value == trueName)
         {
-        case StandardLayout::FieldArchetype::BIT:
-            _builder.SetBit (fieldId, _input.as<bool> ());
-            break;
-
-        case StandardLayout::FieldArchetype::INT:
-            switch (_field.GetSize ())
-            {
-            case 1u:
-                _builder.SetInt8 (fieldId, _input.as<int8_t> ());
-                break;
-            case 2u:
-                _builder.SetInt16 (fieldId, _input.as<int16_t> ());
-                break;
-            case 4u:
-                _builder.SetInt32 (fieldId, _input.as<int32_t> ());
-                break;
-            case 8u:
-                _builder.SetInt64 (fieldId, _input.as<int64_t> ());
-                break;
-            }
-            break;
+            _output = true;
+            return true;
+        }
 
-        case StandardLayout::FieldArchetype::UINT:
-            switch (_field.GetSize ())
-            {
-            case 1u:
-                _builder.SetUInt8 (fieldId, _input.as<std::uint8_t> ());
-                break;
-            case 2u:
-                _builder.SetUInt16 (fieldId, _input.as<std::uint16_t> ());
-                break;
-            case 4u:
-                _builder.SetUInt32 (fieldId, _input.as<std::uint32_t> ());
-                break;
-            case 8u:
-                _builder.SetUInt64 (fieldId, _input.as<std::uint64_t> ());
-                break;
-            }
-            break;
+        if (value == falseName)
+        {
+            _output = false;
+            return true;
+        }
+    }
 
-        case StandardLayout::FieldArchetype::FLOAT:
-            switch (_field.GetSize ())
-            {
-            case 4u:
-                _builder.SetFloat (fieldId, _input.as<float> ());
-                break;
-            case 8u:
-                _builder.SetDouble (fieldId, _input.as<double> ());
-                break;
-            }
-            break;
+    return false;
+}
 
-        case StandardLayout::FieldArchetype::UNIQUE_STRING:
-            _builder.SetUniqueString (fieldId, Memory::UniqueString {_input.Scalar ().c_str ()});
-            break;
+template <typename Integer>
+    requires std::is_integral_v<Integer>
+static bool ParseScalar (const std::string &_value, Integer &_output)
+{
+    // Mimics yaml-cpp stream-based conversion: sign is optional, base is detected from prefix.
+    const char *begin = _value.data ();
+    const char *end = begin + _value.size ();
+    bool negative = false;
 
-        case StandardLayout::FieldArchetype::STRING:
-        case StandardLayout::FieldArchetype::BLOCK:
-        case StandardLayout::FieldArchetype::NESTED_OBJECT:
-        case StandardLayout::FieldArchetype::UTF8_STRING:
-        case StandardLayout::FieldArchetype::VECTOR:
-        case StandardLayout::FieldArchetype::PATCH:
-            // Unsupported for patches.
-            EMERGENCE_ASSERT (false);
-            break;
-        }
+    if (begin != end && (*begin == '+' || *begin == '-'))
+    {
+        negative = *begin == '-';
+        ++begin;
     }
-    catch ([[maybe_unused]] YAML::Exception &exception)
+
+    if (negative && std::is_unsigned_v<Integer>)
     {
         return false;
     }
 
-    return true;
-}
-
-static StandardLayout::Field FindFieldByName (const StandardLayout::Mapping &_mapping, Memory::UniqueString _fieldName)
-{
-    for (StandardLayout::Field field : _mapping)
+    int base = 10;
+    if (end - begin > 2 && begin[0u] == '0' && (begin[1u] == 'x' || begin[1u] == 'X'))
     {
-        if (field.GetName () == _fieldName)
-        {
-            return field;
-        }
+        base = 16;
+        begin += 2u;
+    }
+    else if (end - begin > 1 && begin[0u] == '0')
+    {
+        base = 8;
+        ++begin;
     }
 
-    return {};
-}
+    std::uint64_t magnitude;
+    const auto [parsedEnd, error] = std::from_chars (begin, end, magnitude, base);
 
-static bool DeserializePatchBodyFromYaml (const YAML::Node &_input,
-                                          const StandardLayout::Mapping &_mapping,
-                                          StandardLayout::PatchBuilder &_builder,
-                                          const Container::String &_prefix)
-{
-    for (auto iterator = _input.begin (); iterator != _input.end (); ++iterator)
+    if (error != std::errc {} || parsedEnd != end)
+    {
+        return false;
+    }
+
+    if constexpr (std::is_unsigned_v<Integer>)
     {
-        if (!iterator->first.IsScalar ())
+        if (magnitude > std::numeric_limits<Integer>::max ())
         {
-            EMERGENCE_LOG (ERROR, "Serialization::Yaml: Encountered map pair with non-scalar key!");
             return false;
         }
 
-        switch (iterator->second.Type ())
+        _output = static_cast<Integer> (magnitude);
+    }
+    else
+    {
+        const auto maxMagnitude = static_cast<std::uint64_t> (std::numeric_limits<Integer>::max ());
+        if (magnitude > maxMagnitude + (negative ? 1u : 0u))
         {
-        case YAML::NodeType::Undefined:
-            EMERGENCE_LOG (ERROR, "Serialization::Yaml: Encountered undefined node during iteration!");
             return false;
+        }
 
-        case YAML::NodeType::Null:
-            EMERGENCE_LOG (ERROR, "Serialization::Yaml: Encountered null node during iteration!");
-            return false;
+        _output = negative ? static_cast<Integer> (0u - magnitude) : static_cast<Integer> (magnitude);
+    }
 
-        case YAML::NodeType::Scalar:
-        {
-            // NOLINTNEXTLINE(readability-redundant-string-cstr): It's not, because allocators are different.
-            const Memory::UniqueString fieldName {_prefix + iterator->first.Scalar ().c_str ()};
-            StandardLayout::Field field = FindFieldByName (_mapping, fieldName);
+    return true;
+}
 
-            if (!field)
-            {
-                EMERGENCE_LOG (ERROR, "Serialization::Yaml: Mapping \"", _mapping.GetName (),
-                               "\" does not contain field \"", *fieldName, "\"!");
-                return false;
-            }
+template <typename Float>
+    requires std::is_floating_point_v<Float>
+static bool ParseScalar (const std::string &_value, Float &_output)
+{
+    if (_value == ".inf" || _value == ".Inf" || _value == ".INF" || _value == "+.inf" || _value == "+.Inf" ||
+        _value == "+.INF")
+    {
+        _output = std::numeric_limits<Float>::infinity ();
+        return true;
+    }
 
-            if (!DeserializePatchLeafValueFromYaml (iterator->second, _builder, _mapping, field))
-            {
-                EMERGENCE_LOG (ERROR, "Serialization::Yaml: Unable to deserialize value of field \"", *fieldName,
-                               "\" from mapping \"", _mapping.GetName (), "\"!");
-                return false;
-            }
+    if (_value == "-.inf" || _value == "-.Inf" || _value == "-.INF")
+    {
+        _output = -std::numeric_limits<Float>::infinity ();
+        return true;
+    }
 
-            break;
-        }
+    if (_value == ".nan" || _value == ".NaN" || _value == ".NAN")
+    {
+        _output = std::numeric_limits<Float>::quiet_NaN ();
+        return true;
+    }
 
-        case YAML::NodeType::Sequence:
-            EMERGENCE_LOG (ERROR, "Serialization::Yaml: Encountered sequence node during iteration!");
-            return false;
+    const char *begin = _value.data ();
+    const char *end = begin + _value.size ();
 
-        case YAML::NodeType::Map:
-        {
-            if (!DeserializePatchBodyFromYaml (
-                    iterator->second, _mapping, _builder,
-                    // NOLINTNEXTLINE(readability-redundant-string-cstr): It's not, because allocators are different.
-                    _prefix + iterator->first.Scalar ().c_str () + StandardLayout::PROJECTION_NAME_SEPARATOR))
-            {
-                return false;
-            }
+    // Unlike streams, std::from_chars does not accept explicit plus sign.
+    if (begin != end && *begin == '+')
+    {
+        ++begin;
+    }
 
-            break;
-        }
-        }
+    const auto [parsedEnd, error] = std::from_chars (begin, end, _output);
+    return error == std::errc {} && parsedEnd == end;
+}
+
+template <typename Value>
+static bool ParseScalarTo (const std::string &_value, void *_address)
+{
+    Value value;
+    if (ParseScalar (_value, value))
+    {
+        *static_cast<Value *> (_address) = value;
+        return true;
     }
 
-    return true;
+    return false;
 }
 
-static bool DeserializeObjectFromYaml (const YAML::Node &_input,
-                                       void *_objectAddress,
-                                       const StandardLayout::Mapping &_mapping,
-                                       const Container::MappingRegistry &_patchableTypesRegistry)
+static bool DeserializeLeafValue (const std::string &_value, void *_address, const StandardLayout::Field &_field)
 {
-    for (auto iterator = _input.begin (); iterator != _input.end (); ++iterator)
+    switch (_field.GetArchetype ())
+    {
+    case StandardLayout::FieldArchetype::BIT:
     {
-        if (!iterator->first.IsScalar ())
+        bool value;
+        if (!ParseScalar (_value, value))
         {
-            EMERGENCE_LOG (ERROR, "Serialization::Yaml: Encountered map pair with non-scalar key!");
             return false;
         }
 
-        switch (iterator->second.Type ())
-        {
-        case YAML::NodeType::Undefined:
-            EMERGENCE_LOG (ERROR, "Serialization::Yaml: Encountered undefined node during iteration!");
-            return false;
-
-        case YAML::NodeType::Null:
-            EMERGENCE_LOG (ERROR, "Serialization::Yaml: Encountered null node during iteration!");
-            return false;
-
-        case YAML::NodeType::Scalar:
+        if (value)
         {
-            const StandardLayout::Field field =
-                FindFieldByName (_mapping, Memory::UniqueString {iterator->first.Scalar ().c_str ()});
-
-            if (!field)
-            {
-                EMERGENCE_LOG (ERROR, "Serialization::Yaml: Mapping \"", _mapping.GetName (),
-                               "\" does not contain field \"", iterator->first.Scalar ().c_str (), "\"!");
-                return false;
-            }
-
-            if (!DeserializeLeafValueFromYaml (iterator->second, field.GetValue (_objectAddress), field))
-            {
-                EMERGENCE_LOG (ERROR, "Serialization::Yaml: Unable to deserialize value of field \"", *field.GetName (),
-                               "\" from mapping \"", _mapping.GetName (), "\"!");
-                return false;
-            }
-
-            break;
+            *static_cast<std::uint8_t *> (_address) |= 1u << _field.GetBitOffset ();
         }
-
-        case YAML::NodeType::Sequence:
+        else
         {
-            const StandardLayout::Field field =
-                FindFieldByName (_mapping, Memory::UniqueString {iterator->first.Scalar ().c_str ()});
-
-            if (!field)
-            {
-                EMERGENCE_LOG (ERROR, "Serialization::Yaml: Mapping \"", _mapping.GetName (),
-                               "\" does not contain field \"", *iterator->first.Scalar ().c_str (), "\"!");
-                return false;
-            }
-
-            if (field.GetArchetype () != StandardLayout::FieldArchetype::VECTOR)
-            {
-                EMERGENCE_LOG (ERROR, "Serialization::Yaml: Encountered sequence value for non-vector field \"",
-                               *field.GetName (), "\" of mapping \"", *_mapping.GetName (), "\"!");
-                return false;
-            }
-
-            const YAML::Node &sequenceNode = iterator->second;
-            void *vectorAddress = field.GetValue (_objectAddress);
-            const auto vectorSize = static_cast<std::uint32_t> (sequenceNode.size ());
-            const StandardLayout::Mapping &itemMapping = field.GetVectorItemMapping ();
-            Container::UntypedVectorUtility::InitSize (vectorAddress, vectorSize * itemMapping.GetObjectSize ());
-            int32_t itemIndex = 0u;
-
-            for (std::uint8_t *pointer = Container::UntypedVectorUtility::Begin (vectorAddress);
-                 pointer != Container::UntypedVectorUtility::End (vectorAddress);
-                 pointer += itemMapping.GetObjectSize ())
-            {
-                itemMapping.Construct (pointer);
-                if (!DeserializeObjectFromYaml (sequenceNode[itemIndex], pointer, itemMapping, _patchableTypesRegistry))
-                {
-                    return false;
-                }
-
-                ++itemIndex;
-            }
-
-            break;
+            *static_cast<std::uint8_t *> (_address) &= ~(1u << _field.GetBitOffset ());
         }
 
-        case YAML::NodeType::Map:
-        {
-            const StandardLayout::Field field =
-                FindFieldByName (_mapping, Memory::UniqueString {iterator->first.Scalar ().c_str ()});
-
-            if (!field)
-            {
-                EMERGENCE_LOG (ERROR, "Serialization::Yaml: Mapping \"", _mapping.GetName (),
-                               "\" does not contain field \"", *iterator->first.Scalar ().c_str (), "\"!");
-                return false;
-            }
+        return true;
+    }
 
-            switch (field.GetArchetype ())
-            {
-            case StandardLayout::FieldArchetype::BIT:
-            case StandardLayout::FieldArchetype::INT:
-            case StandardLayout::FieldArchetype::UINT:
-            case StandardLayout::FieldArchetype::FLOAT:
-            case StandardLayout::FieldArchetype::STRING:
-            case StandardLayout::FieldArchetype::BLOCK:
-            case StandardLayout::FieldArchetype::UNIQUE_STRING:
-            case StandardLayout::FieldArchetype::UTF8_STRING:
-                EMERGENCE_LOG (ERROR, "Serialization::Yaml: Encountered map value for elementary field \"",
-                               *field.GetName (), "\" of mapping \"", *_mapping.GetName (), "\"!");
-                return false;
-
-            case StandardLayout::FieldArchetype::NESTED_OBJECT:
-                if (!DeserializeObjectFromYaml (iterator->second, field.GetValue (_objectAddress),
-                                                field.GetNestedObjectMapping (), _patchableTypesRegistry))
-                {
-                    return false;
-                }
+    case StandardLayout::FieldArchetype::INT:
+        switch (_field.GetSize ())
+        {
+        case 1u:
+            return ParseScalarTo<int8_t> (_value, _address);
+        case 2u:
+            return ParseScalarTo<int16_t> (_value, _address);
+        case 4u:
+            return ParseScalarTo<int32_t> (_value, _address);
+        case 8u:
+            return ParseScalarTo<int64_t> (_value, _address);
+        }
 
-                break;
+        break;
 
-            case StandardLayout::FieldArchetype::VECTOR:
-                EMERGENCE_LOG (ERROR, "Serialization::Yaml: Encountered map value for vector field \"",
-                               *field.GetName (), "\" of mapping \"", *_mapping.GetName (), "\"!");
-                return false;
+    case StandardLayout::FieldArchetype::UINT:
+        switch (_field.GetSize ())
+        {
+        case 1u:
+            return ParseScalarTo<std::uint8_t> (_value, _address);
+        case 2u:
+            return ParseScalarTo<std::uint16_t> (_value, _address);
+        case 4u:
+            return ParseScalarTo<std::uint32_t> (_value, _address);
+        case 8u:
+            return ParseScalarTo<std::uint64_t> (_value, _address);
+        }
 
-            case StandardLayout::FieldArchetype::PATCH:
-                YAML::Node typeNode = (iterator->second)["type"];
+        break;
 
-                if (!typeNode.IsScalar ())
-                {
-                    EMERGENCE_LOG (ERROR, "Serialization::Yaml: Patch type node is not a scalar!");
-                    return false;
-                }
+    case StandardLayout::FieldArchetype::FLOAT:
+        switch (_field.GetSize ())
+        {
+        case 4u:
+            return ParseScalarTo<float> (_value, _address);
+        case 8u:
+            return ParseScalarTo<double> (_value, _address);
+        }
 
-                YAML::Node contentNode = (iterator->second)["content"];
-                if (!contentNode.IsMap ())
-                {
-                    EMERGENCE_LOG (ERROR, "Serialization::Yaml: Patch content node is not a map!");
-                    return false;
-                }
+        break;
 
-                StandardLayout::Mapping patchMapping =
-                    _patchableTypesRegistry.Get (Memory::UniqueString {typeNode.Scalar ().c_str ()});
+    case StandardLayout::FieldArchetype::STRING:
+        strncpy (static_cast<char *> (_address), _value.c_str (), _field.GetSize () - 1u);
+        static_cast<char *> (_address)[_field.GetSize () - 1u] = '\0';
+        return true;
 
-                if (!patchMapping)
-                {
-                    EMERGENCE_LOG (ERROR, "Serialization::Yaml: Unable to find patchable type \"",
-                                   typeNode.Scalar ().c_str (), "\" requested by patch field!");
-                    return false;
-                }
+    case StandardLayout::FieldArchetype::BLOCK:
+    {
+        const std::vector<unsigned char> binary = YAML::DecodeBase64 (_value);
+        if (binary.empty () && !_value.empty ())
+        {
+            return false;
+        }
 
-                StandardLayout::PatchBuilder builder;
-                builder.Begin (patchMapping);
+        memcpy (_address, binary.data (), std::min (binary.size (), _field.GetSize ()));
+        return true;
+    }
 
-                if (!DeserializePatchBodyFromYaml (contentNode, patchMapping, builder, ""))
-                {
-                    return false;
-                }
+    case StandardLayout::FieldArchetype::UNIQUE_STRING:
+        *static_cast<Memory::UniqueString *> (_address) = Memory::UniqueString {_value.c_str ()};
+        return true;
 
-                *static_cast<StandardLayout::Patch *> (field.GetValue (_objectAddress)) = builder.End ();
-                break;
-            }
+    case StandardLayout::FieldArchetype::UTF8_STRING:
+        *static_cast<Container::Utf8String *> (_address) = _value.c_str ();
+        return true;
 
-            break;
-        }
-        }
+    case StandardLayout::FieldArchetype::NESTED_OBJECT:
+    case StandardLayout::FieldArchetype::VECTOR:
+    case StandardLayout::FieldArchetype::PATCH:
+        // Only leaf values are supported.
+        EMERGENCE_ASSERT (false);
+        return false;
     }
 
-    return true;
+    return false;
 }
 
-void SerializeObject (std::ostream &_output, const void *_object, const StandardLayout::Mapping &_mapping) noexcept
+template <typename Value, typename Setter>
+static bool ParseScalarToPatch (const std::string &_value, Setter _setter)
 {
-    YAML::Node node {YAML::NodeType::Map};
-    SerializeObjectToYaml (node, _object, _mapping);
-    _output << node;
+    Value value;
+    if (ParseScalar (_value, value))
+    {
+        _setter (value);
+        return true;
+    }
+
+    return false;
 }
 
-bool DeserializeObject (std::istream &_input,
-                        void *_object,
-                        const StandardLayout::Mapping &_mapping,
-                        const Container::MappingRegistry &_patchableTypesRegistry) noexcept
+static bool DeserializePatchLeafValue (const std::string &_value,
+                                       StandardLayout::PatchBuilder &_builder,
+                                       const StandardLayout::Mapping &_mapping,
+                                       const StandardLayout::Field &_field)
 {
-    YAML::Node node = YAML::Load (_input);
-    if (!node.IsMap ())
+    StandardLayout::FieldId fieldId = _mapping.GetFieldId (_field);
+    switch (_field.GetArchetype ())
     {
-        EMERGENCE_LOG (ERROR, "Serialization::Yaml: Unable to parse YAML node from given input!");
+    case StandardLayout::FieldArchetype::BIT:
+        return ParseScalarToPatch<bool> (_value,
+                                         [&_builder, fieldId] (bool _bit)
+                                         {
+                                             _builder.SetBit (fieldId, _bit);
+                                         });
+
+    case StandardLayout::FieldArchetype::INT:
+        switch (_field.GetSize ())
+        {
+        case 1u:
+            return ParseScalarToPatch<int8_t> (_value,
+                                               [&_builder, fieldId] (int8_t _number)
+                                               {
+                                                   _builder.SetInt8 (fieldId, _number);
+                                               });
+        case 2u:
+            return ParseScalarToPatch<int16_t> (_value,
+                                                [&_builder, fieldId] (int16_t _number)
+                                                {
+                                                    _builder.SetInt16 (fieldId, _number);
+                                                });
+        case 4u:
+            return ParseScalarToPatch<int32_t> (_value,
+                                                [&_builder, fieldId] (int32_t _number)
+                                                {
+                                                    _builder.SetInt32 (fieldId, _number);
+                                                });
+        case 8u:
+            return ParseScalarToPatch<int64_t> (_value,
+                                                [&_builder, fieldId] (int64_t _number)
+                                                {
+                                                    _builder.SetInt64 (fieldId, _number);
+                                                });
+        }
+
+        break;
+
+    case StandardLayout::FieldArchetype::UINT:
+        switch (_field.GetSize ())
+        {
+        case 1u:
+            return ParseScalarToPatch<std::uint8_t> (_value,
+                                                     [&_builder, fieldId] (std::uint8_t _number)
+                                                     {
+                                                         _builder.SetUInt8 (fieldId, _number);
+                                                     });
+        case 2u:
+            return ParseScalarToPatch<std::uint16_t> (_value,
+                                                      [&_builder, fieldId] (std::uint16_t _number)
+                                                      {
+                                                          _builder.SetUInt16 (fieldId, _number);
+                                                      });
+        case 4u:
+            return ParseScalarToPatch<std::uint32_t> (_value,
+                                                      [&_builder, fieldId] (std::uint32_t _number)
+                                                      {
+                                                          _builder.SetUInt32 (fieldId, _number);
+                                                      });
+        case 8u:
+            return ParseScalarToPatch<std::uint64_t> (_value,
+                                                      [&_builder, fieldId] (std::uint64_t _number)
+                                                      {
+                                                          _builder.SetUInt64 (fieldId, _number);
+                                                      });
+        }
+
+        break;
+
+    case StandardLayout::FieldArchetype::FLOAT:
+        switch (_field.GetSize ())
+        {
+        case 4u:
+            return ParseScalarToPatch<float> (_value,
+                                              [&_builder, fieldId] (float _number)
+                                              {
+                                                  _builder.SetFloat (fieldId, _number);
+                                              });
+        case 8u:
+            return ParseScalarToPatch<double> (_value,
+                                               [&_builder, fieldId] (double _number)
+                                               {
+                                                   _builder.SetDouble (fieldId, _number);
+                                               });
+        }
+
+        break;
+
+    case StandardLayout::FieldArchetype::UNIQUE_STRING:
+        _builder.SetUniqueString (fieldId, Memory::UniqueString {_value.c_str ()});
+        return true;
+
+    case StandardLayout::FieldArchetype::STRING:
+    case StandardLayout::FieldArchetype::BLOCK:
+    case StandardLayout::FieldArchetype::NESTED_OBJECT:
+    case StandardLayout::FieldArchetype::UTF8_STRING:
+    case StandardLayout::FieldArchetype::VECTOR:
+    case StandardLayout::FieldArchetype::PATCH:
+        // Unsupported for patches.
+        EMERGENCE_ASSERT (false);
         return false;
     }
 
-    return DeserializeObjectFromYaml (node, _object, _mapping, _patchableTypesRegistry);
+    return false;
+}
+
+static StandardLayout::Field FindFieldByName (const StandardLayout::Mapping &_mapping, Memory::UniqueString _fieldName)
+{
+    for (StandardLayout::Field field : _mapping)
+    {
+        if (field.GetName () == _fieldName)
+        {
+            return field;
+        }
+    }
+
+    return {};
+}
+
+/// \brief Appends new constructed item to given reflected vector and returns its address.
+/// \details Streaming parser does not know sequence size in advance, therefore vector grows like std::vector,
+///          but items are moved through mapping, because untyped vector has no information about item type.
+static std::uint8_t *AppendVectorItem (void *_vector, const StandardLayout::Mapping &_itemMapping)
+{
+    static constexpr std::size_t MIN_CAPACITY_IN_ITEMS = 4u;
+    auto &bytes = *static_cast<Container::Vector<std::uint8_t> *> (_vector);
+    const std::size_t itemSize = _itemMapping.GetObjectSize ();
+    const std::size_t oldSize = bytes.size ();
+
+    if (oldSize + itemSize > bytes.capacity ())
+    {
+        Container::Vector<std::uint8_t> grown {bytes.get_allocator ()};
+        grown.reserve (std::max (bytes.capacity () * 2u, itemSize * MIN_CAPACITY_IN_ITEMS));
+        grown.resize (oldSize);
+
+        for (std::size_t offset = 0u; offset < oldSize; offset += itemSize)
+        {
+            _itemMapping.MoveConstruct (grown.data () + offset, bytes.data () + offset);
+            _itemMapping.Destruct (bytes.data () + offset);
+        }
+
+        bytes.swap (grown);
+    }
+
+    // Capacity is already enough, therefore resize never reallocates here.
+    bytes.resize (oldSize + itemSize);
+    std::uint8_t *item = bytes.data () + oldSize;
+    _itemMapping.Construct (item);
+    return item;
+}
+
+/// \brief Fills object directly from yaml-cpp parser events, so intermediate node tree is never built.
+/// \details Parser continues to send events after error, therefore every handler exits early after failure.
+class ObjectDeserializationHandler final : public YAML::EventHandler
+{
+public:
+    ObjectDeserializationHandler (void *_object,
+                                  const StandardLayout::Mapping &_mapping,
+                                  const Container::MappingRegistry &_patchableTypesRegistry) noexcept
+        : object (_object),
+          mapping (_mapping),
+          patchableTypesRegistry (_patchableTypesRegistry)
+    {
+    }
+
+    [[nodiscard]] bool IsSuccessful () const noexcept
+    {
+        return rootFinished && !failed;
+    }
+
+    [[nodiscard]] bool IsFailed () const noexcept
+    {
+        return failed;
+    }
+
+    void OnDocumentStart (const YAML::Mark & /*unused*/) override
+    {
+    }
+
+    void OnDocumentEnd () override
+    {
+    }
+
+    void OnNull (const YAML::Mark & /*unused*/, YAML::anchor_t /*unused*/) override
+    {
+        if (failed || !CheckRootStarted ())
+        {
+            return;
+        }
+
+        Frame &top = stack.back ();
+        switch (top.type)
+        {
+        case FrameType::OBJECT:
+        case FrameType::PATCH_CONTENT:
+            if (!CheckExpectingValue (top))
+            {
+                return;
+            }
+
+            EMERGENCE_LOG (ERROR, "Serialization::Yaml: Encountered null node during iteration!");
+            failed = true;
+            return;
+
+        case FrameType::VECTOR:
+            EMERGENCE_LOG (ERROR, "Serialization::Yaml: Encountered null item in sequence of objects!");
+            failed = true;
+            return;
+
+        case FrameType::PATCH:
+            if (!CheckExpectingValue (top) || !CheckPatchValueIsNotSpecial (top, false))
+            {
+                return;
+            }
+
+            top.expectingValue = false;
+            return;
+
+        case FrameType::SKIP:
+            return;
+        }
+
+        EMERGENCE_ASSERT (false);
+    }
+
+    void OnAlias (const YAML::Mark & /*unused*/, YAML::anchor_t /*unused*/) override
+    {
+        if (failed || (!stack.empty () && stack.back ().type == FrameType::SKIP))
+        {
+            return;
+        }
+
+        EMERGENCE_LOG (ERROR, "Serialization::Yaml: Aliases are not supported!");
+        failed = true;
+    }
+
+    void OnScalar (const YAML::Mark & /*unused*/,
+                   const std::string & /*unused*/,
+                   YAML::anchor_t /*unused*/,
+                   const std::string &_value) override
+    {
+        if (failed || !CheckRootStarted ())
+        {
+            return;
+        }
+
+        Frame &top = stack.back ();
+        switch (top.type)
+        {
+        case FrameType::OBJECT:
+            OnObjectScalar (top, _value);
+            return;
+
+        case FrameType::VECTOR:
+            EMERGENCE_LOG (ERROR, "Serialization::Yaml: Encountered scalar item in sequence of objects!");
+            failed = true;
+            return;
+
+        case FrameType::PATCH:
+            OnPatchScalar (top, _value);
+            return;
+
+        case FrameType::PATCH_CONTENT:
+            OnPatchContentScalar (top, _value);
+            return;
+
+        case FrameType::SKIP:
+            return;
+        }
+
+        EMERGENCE_ASSERT (false);
+    }
+
+    void OnSequenceStart (const YAML::Mark & /*unused*/,
+                          const std::string & /*unused*/,
+                          YAML::anchor_t /*unused*/,
+                          YAML::EmitterStyle::value /*unused*/) override
+    {
+        if (failed || !CheckRootStarted ())
+        {
+            return;
+        }
+
+        Frame &top = stack.back ();
+        switch (top.type)
+        {
+        case FrameType::OBJECT:
+        {
+            if (!CheckExpectingValue (top))
+            {
+                return;
+            }
+
+            if (top.field.GetArchetype () != StandardLayout::FieldArchetype::VECTOR)
+            {
+                EMERGENCE_LOG (ERROR, "Serialization::Yaml: Encountered sequence value for non-vector field \"",
+                               *top.field.GetName (), "\" of mapping \"", *top.mapping.GetName (), "\"!");
+                failed = true;
+                return;
+            }
+
+            void *vectorAddress = top.field.GetValue (top.address);
+            EMERGENCE_ASSERT (static_cast<Container::Vector<std::uint8_t> *> (vectorAddress)->empty ());
+
+            const StandardLayout::Mapping itemMapping = top.field.GetVectorItemMapping ();
+            stack.emplace_back (Frame {.type = FrameType::VECTOR, .address = vectorAddress, .mapping = itemMapping});
+            return;
+        }
+
+        case FrameType::VECTOR:
+            EMERGENCE_LOG (ERROR, "Serialization::Yaml: Encountered sequence item in sequence of objects!");
+            failed = true;
+            return;
+
+        case FrameType::PATCH:
+            if (CheckExpectingValue (top) && CheckPatchValueIsNotSpecial (top, false))
+            {
+                stack.emplace_back (Frame {.type = FrameType::SKIP});
+            }
+
+            return;
+
+        case FrameType::PATCH_CONTENT:
+            if (CheckExpectingValue (top))
+            {
+                EMERGENCE_LOG (ERROR, "Serialization::Yaml: Encountered sequence node during iteration!");
+                failed = true;
+            }
+
+            return;
+
+        case FrameType::SKIP:
+            ++top.depth;
+            return;
+        }
+
+        EMERGENCE_ASSERT (false);
+    }
+
+    void OnSequenceEnd () override
+    {
+        OnContainerEnd ();
+    }
+
+    void OnMapStart (const YAML::Mark & /*unused*/,
+                     const std::string & /*unused*/,
+                     YAML::anchor_t /*unused*/,
+                     YAML::EmitterStyle::value /*unused*/) override
+    {
+        if (failed)
+        {
+            return;
+        }
+
+        if (stack.empty ())
+        {
+            EMERGENCE_ASSERT (!rootFinished);
+            stack.emplace_back (Frame {.type = FrameType::OBJECT, .address = object, .mapping = mapping});
+            return;
+        }
+
+        Frame &top = stack.back ();
+        switch (top.type)
+        {
+        case FrameType::OBJECT:
+            if (CheckExpectingValue (top))
+            {
+                OnObjectMapStart (top);
+            }
+
+            return;
+
+        case FrameType::VECTOR:
+        {
+            std::uint8_t *item = AppendVectorItem (top.address, top.mapping);
+            const StandardLayout::Mapping itemMapping = top.mapping;
+            stack.emplace_back (Frame {.type = FrameType::OBJECT, .address = item, .mapping = itemMapping});
+            return;
+        }
+
+        case FrameType::PATCH:
+            if (!CheckExpectingValue (top) || !CheckPatchValueIsNotSpecial (top, true))
+            {
+                return;
+            }
+
+            if (top.patchKey == PatchKey::CONTENT)
+            {
+                patchContentFound = true;
+                patchPrefix.clear ();
+                stack.emplace_back (Frame {.type = FrameType::PATCH_CONTENT});
+            }
+            else
+            {
+                stack.emplace_back (Frame {.type = FrameType::SKIP});
+            }
+
+            return;
+
+        case FrameType::PATCH_CONTENT:
+            if (CheckExpectingValue (top))
+            {
+                patchPrefix += StandardLayout::PROJECTION_NAME_SEPARATOR;
+                stack.emplace_back (Frame {.type = FrameType::PATCH_CONTENT});
+            }
+
+            return;
+
+        case FrameType::SKIP:
+            ++top.depth;
+            return;
+        }
+
+        EMERGENCE_ASSERT (false);
+    }
+
+    void OnMapEnd () override
+    {
+        OnContainerEnd ();
+    }
+
+private:
+    enum class FrameType : std::uint8_t
+    {
+        OBJECT,
+        VECTOR,
+        PATCH,
+        PATCH_CONTENT,
+        SKIP,
+    };
+
+    enum class PatchKey : std::uint8_t
+    {
+        TYPE,
+        CONTENT,
+        UNKNOWN,
+    };
+
+    struct Frame final
+    {
+        FrameType type;
+
+        /// \brief Address of the object for ::OBJECT, vector for ::VECTOR and patch for ::PATCH.
+        void *address = nullptr;
+
+        /// \brief Object mapping for ::OBJECT and item mapping for ::VECTOR.
+        StandardLayout::Mapping mapping {};
+
+        /// \brief For map frames: whether key was already read and its value is expected next.
+        bool expectingValue = false;
+
+        /// \brief For ::PATCH: key, which value is expected.
+        PatchKey patchKey = PatchKey::UNKNOWN;
+
+        /// \brief For ::OBJECT: field, which value is expected.
+        StandardLayout::Field field {};
+
+        /// \brief For ::PATCH_CONTENT: size of patch field name prefix before key was appended.
+        std::size_t prefixSize = 0u;
+
+        /// \brief For ::SKIP: count of containers that are not yet closed.
+        std::size_t depth = 1u;
+    };
+
+    bool CheckRootStarted () noexcept
+    {
+        if (stack.empty ())
+        {
+            EMERGENCE_LOG (ERROR, "Serialization::Yaml: Unable to parse YAML node from given input!");
+            failed = true;
+            return false;
+        }
+
+        return true;
+    }
+
+    bool CheckExpectingValue (const Frame &_frame) noexcept
+    {
+        if (!_frame.expectingValue)
+        {
+            EMERGENCE_LOG (ERROR, "Serialization::Yaml: Encountered map pair with non-scalar key!");
+            failed = true;
+            return false;
+        }
+
+        return true;
+    }
+
+    bool CheckPatchValueIsNotSpecial (const Frame &_frame, bool _isMap) noexcept
+    {
+        if (_frame.patchKey == PatchKey::TYPE)
+        {
+            EMERGENCE_LOG (ERROR, "Serialization::Yaml: Patch type node is not a scalar!");
+            failed = true;
+            return false;
+        }
+
+        if (_frame.patchKey == PatchKey::CONTENT && !_isMap)
+        {
+            EMERGENCE_LOG (ERROR, "Serialization::Yaml: Patch content node is not a map!");
+            failed = true;
+            return false;
+        }
+
+        return true;
+    }
+
+    void OnObjectScalar (Frame &_frame, const std::string &_value) noexcept
+    {
+        if (!_frame.expectingValue)
+        {
+            _frame.field = FindFieldByName (_frame.mapping, Memory::UniqueString {_value.c_str ()});
+            if (!_frame.field)
+            {
+                EMERGENCE_LOG (ERROR, "Serialization::Yaml: Mapping \"", _frame.mapping.GetName (),
+                               "\" does not contain field \"", _value.c_str (), "\"!");
+                failed = true;
+                return;
+            }
+
+            _frame.expectingValue = true;
+            return;
+        }
+
+        _frame.expectingValue = false;
+        switch (_frame.field.GetArchetype ())
+        {
+        case StandardLayout::FieldArchetype::BIT:
+        case StandardLayout::FieldArchetype::INT:
+        case StandardLayout::FieldArchetype::UINT:
+        case StandardLayout::FieldArchetype::FLOAT:
+        case StandardLayout::FieldArchetype::STRING:
+        case StandardLayout::FieldArchetype::BLOCK:
+        case StandardLayout::FieldArchetype::UNIQUE_STRING:
+        case StandardLayout::FieldArchetype::UTF8_STRING:
+            if (!DeserializeLeafValue (_value, _frame.field.GetValue (_frame.address), _frame.field))
+            {
+                EMERGENCE_LOG (ERROR, "Serialization::Yaml: Unable to deserialize value of field \"",
+                               *_frame.field.GetName (), "\" from mapping \"", _frame.mapping.GetName (), "\"!");
+                failed = true;
+            }
+
+            return;
+
+        case StandardLayout::FieldArchetype::NESTED_OBJECT:
+        case StandardLayout::FieldArchetype::VECTOR:
+        case StandardLayout::FieldArchetype::PATCH:
+            EMERGENCE_LOG (ERROR, "Serialization::Yaml: Encountered scalar value for non-elementary field \"",
+                           *_frame.field.GetName (), "\" of mapping \"", *_frame.mapping.GetName (), "\"!");
+            failed = true;
+            return;
+        }
+
+        EMERGENCE_ASSERT (false);
+    }
+
+    void OnObjectMapStart (Frame &_frame) noexcept
+    {
+        switch (_frame.field.GetArchetype ())
+        {
+        case StandardLayout::FieldArchetype::BIT:
+        case StandardLayout::FieldArchetype::INT:
+        case StandardLayout::FieldArchetype::UINT:
+        case StandardLayout::FieldArchetype::FLOAT:
+        case StandardLayout::FieldArchetype::STRING:
+        case StandardLayout::FieldArchetype::BLOCK:
+        case StandardLayout::FieldArchetype::UNIQUE_STRING:
+        case StandardLayout::FieldArchetype::UTF8_STRING:
+            EMERGENCE_LOG (ERROR, "Serialization::Yaml: Encountered map value for elementary field \"",
+                           *_frame.field.GetName (), "\" of mapping \"", *_frame.mapping.GetName (), "\"!");
+            failed = true;
+            return;
+
+        case StandardLayout::FieldArchetype::NESTED_OBJECT:
+        {
+            void *nestedAddress = _frame.field.GetValue (_frame.address);
+            const StandardLayout::Mapping nestedMapping = _frame.field.GetNestedObjectMapping ();
+            stack.emplace_back (Frame {.type = FrameType::OBJECT, .address = nestedAddress, .mapping = nestedMapping});
+            return;
+        }
+
+        case StandardLayout::FieldArchetype::VECTOR:
+            EMERGENCE_LOG (ERROR, "Serialization::Yaml: Encountered map value for vector field \"",
+                           *_frame.field.GetName (), "\" of mapping \"", *_frame.mapping.GetName (), "\"!");
+            failed = true;
+            return;
+
+        case StandardLayout::FieldArchetype::PATCH:
+        {
+            patchMapping = {};
+            patchContentFound = false;
+            delayedPatchValues.clear ();
+
+            void *patchAddress = _frame.field.GetValue (_frame.address);
+            stack.emplace_back (Frame {.type = FrameType::PATCH, .address = patchAddress});
+            return;
+        }
+        }
+
+        EMERGENCE_ASSERT (false);
+    }
+
+    void OnPatchScalar (Frame &_frame, const std::string &_value) noexcept
+    {
+        if (!_frame.expectingValue)
+        {
+            if (_value == "type")
+            {
+                _frame.patchKey = PatchKey::TYPE;
+            }
+            else if (_value == "content")
+            {
+                _frame.patchKey = PatchKey::CONTENT;
+            }
+            else
+            {
+                _frame.patchKey = PatchKey::UNKNOWN;
+            }
+
+            _frame.expectingValue = true;
+            return;
+        }
+
+        _frame.expectingValue = false;
+        switch (_frame.patchKey)
+        {
+        case PatchKey::TYPE:
+        {
+            patchMapping = patchableTypesRegistry.Get (Memory::UniqueString {_value.c_str ()});
+            if (!patchMapping)
+            {
+                EMERGENCE_LOG (ERROR, "Serialization::Yaml: Unable to find patchable type \"", _value.c_str (),
+                               "\" requested by patch field!");
+                failed = true;
+                return;
+            }
+
+            patchBuilder.Begin (patchMapping);
+
+            // Content might be written before type, in this case its values are applied only now.
+            for (const auto &[fieldName, value] : delayedPatchValues)
+            {
+                if (!ApplyPatchValue (fieldName, value))
+                {
+                    return;
+                }
+            }
+
+            delayedPatchValues.clear ();
+            return;
+        }
+
+        case PatchKey::CONTENT:
+            EMERGENCE_LOG (ERROR, "Serialization::Yaml: Patch content node is not a map!");
+            failed = true;
+            return;
+
+        case PatchKey::UNKNOWN:
+            return;
+        }
+
+        EMERGENCE_ASSERT (false);
+    }
+
+    void OnPatchContentScalar (Frame &_frame, const std::string &_value) noexcept
+    {
+        if (!_frame.expectingValue)
+        {
+            _frame.prefixSize = patchPrefix.size ();
+            patchPrefix += _value.c_str ();
+            _frame.expectingValue = true;
+            return;
+        }
+
+        if (patchMapping)
+        {
+            ApplyPatchValue (patchPrefix, _value);
+        }
+        else
+        {
+            delayedPatchValues.emplace_back (patchPrefix, Container::String {_value.c_str ()});
+        }
+
+        FinishValue (_frame);
+    }
+
+    bool ApplyPatchValue (const Container::String &_fieldName, const std::string_view &_value) noexcept
+    {
+        const Memory::UniqueString fieldName {_fieldName.c_str ()};
+        StandardLayout::Field field = FindFieldByName (patchMapping, fieldName);
+
+        if (!field)
+        {
+            EMERGENCE_LOG (ERROR, "Serialization::Yaml: Mapping \"", patchMapping.GetName (),
+                           "\" does not contain field \"", *fieldName, "\"!");
+            failed = true;
+            return false;
+        }
+
+        if (!DeserializePatchLeafValue (std::string {_value}, patchBuilder, patchMapping, field))
+        {
+            EMERGENCE_LOG (ERROR, "Serialization::Yaml: Unable to deserialize value of field \"", *fieldName,
+                           "\" from mapping \"", patchMapping.GetName (), "\"!");
+            failed = true;
+            return false;
+        }
+
+        return true;
+    }
+
+    void OnContainerEnd () noexcept
+    {
+        if (failed)
+        {
+            return;
+        }
+
+        EMERGENCE_ASSERT (!stack.empty ());
+        Frame &top = stack.back ();
+
+        switch (top.type)
+        {
+        case FrameType::OBJECT:
+        case FrameType::VECTOR:
+        case FrameType::PATCH_CONTENT:
+            break;
+
+        case FrameType::PATCH:
+            if (!patchMapping)
+            {
+                EMERGENCE_LOG (ERROR, "Serialization::Yaml: Patch type node is not a scalar!");
+                failed = true;
+                return;
+            }
+
+            if (!patchContentFound)
+            {
+                EMERGENCE_LOG (ERROR, "Serialization::Yaml: Patch content node is not a map!");
+                failed = true;
+                return;
+            }
+
+            *static_cast<StandardLayout::Patch *> (top.address) = patchBuilder.End ();
+            break;
+
+        case FrameType::SKIP:
+            if (--top.depth > 0u)
+            {
+                return;
+            }
+
+            break;
+        }
+
+        stack.pop_back ();
+        if (stack.empty ())
+        {
+            rootFinished = true;
+        }
+        else
+        {
+            FinishValue (stack.back ());
+        }
+    }
+
+    void FinishValue (Frame &_frame) noexcept
+    {
+        _frame.expectingValue = false;
+        if (_frame.type == FrameType::PATCH_CONTENT)
+        {
+            patchPrefix.resize (_frame.prefixSize);
+        }
+    }
+
+    void *object;
+    StandardLayout::Mapping mapping;
+    const Container::MappingRegistry &patchableTypesRegistry;
+
+    Container::Vector<Frame> stack;
+    bool rootFinished = false;
+    bool failed = false;
+
+    // Patches can not contain other patches, therefore there is only one patch in progress at any moment.
+
+    StandardLayout::PatchBuilder patchBuilder;
+    StandardLayout::Mapping patchMapping;
+    bool patchContentFound = false;
+    Container::String patchPrefix;
+    Container::Vector<std::pair<Container::String, Container::String>> delayedPatchValues;
+};
+
+void SerializeObject (std::ostream &_output, const void *_object, const StandardLayout::Mapping &_mapping) noexcept
+{
+    YAML::Node node {YAML::NodeType::Map};
+    SerializeObjectToYaml (node, _object, _mapping);
+    _output << node;
+}
+
+bool DeserializeObject (std::istream &_input,
+                        void *_object,
+                        const StandardLayout::Mapping &_mapping,
+                        const Container::MappingRegistry &_patchableTypesRegistry) noexcept
+{
+    ObjectDeserializationHandler handler {_object, _mapping, _patchableTypesRegistry};
+    try
+    {
+        YAML::Parser parser {_input};
+        parser.HandleNextDocument (handler);
+    }
+    catch (const YAML::Exception &_exception)
+    {
+        EMERGENCE_LOG (ERROR, "Serialization::Yaml: Unable to parse YAML from given input: ", _exception.what ());
+        return false;
+    }
+
+    if (!handler.IsSuccessful () && !handler.IsFailed ())
+    {
+        EMERGENCE_LOG (ERROR, "Serialization::Yaml: Unable to parse YAML node from given input!");
+    }
+
+    return handler.IsSuccessful ();
+}
+
+/// \brief Read-only stream buffer over memory block, used to feed parser without copying the data.
+class SpanInputBuffer final : public std::streambuf
+{
+public:
+    explicit SpanInputBuffer (const std::span<const std::uint8_t> &_data) noexcept
+    {
+        // Get area is never written through, therefore it is safe to remove constness here.
+        auto *begin = reinterpret_cast<char *> (const_cast<std::uint8_t *> (_data.data ()));
+        setg (begin, begin, begin + _data.size ());
+    }
+};
+
+bool DeserializeObject (std::span<const std::uint8_t> _input,
+                        void *_object,
+                        const StandardLayout::Mapping &_mapping,
+                        const Container::MappingRegistry &_patchableTypesRegistry) noexcept
+{
+    SpanInputBuffer buffer {_input};
+    std::istream input {&buffer};
+    return DeserializeObject (input, _object, _mapping, _patchableTypesRegistry);
 }
 } // namespace Emergence::Serialization::Yaml
@@ -4,6 +4,7 @@
 
 #include <istream>
 #include <ostream>
+#include <span>
 
 #include <Container/MappingRegistry.hpp>
 
@@ -27,4 +28,11 @@ bool SerializationApi DeserializeObject (std::istream &_input,
                                          void *_object,
                                          const StandardLayout::Mapping &_mapping,
                                          const Container::MappingRegistry &_patchableTypesRegistry) noexcept;
+
+/// \brief Deserializes Yaml data from given memory block into given address using given mapping.
+/// \details Data is parsed in place, without copying it into intermediate stream buffer.
+bool SerializationApi DeserializeObject (std::span<const std::uint8_t> _input,
+                                         void *_object,
+                                         const StandardLayout::Mapping &_mapping,
+                                         const Container::MappingRegistry &_patchableTypesRegistry) noexcept;
 } // namespace Emergence::Serialization::Yaml
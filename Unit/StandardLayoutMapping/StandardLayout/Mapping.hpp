@@ -97,6 +97,11 @@ public:
     /// \brief Like ::End, but with conditional visibility.
     [[nodiscard]] ConditionalFieldIterator EndConditional () const noexcept;
 
+    /// \return Whether some fields are only visible under visibility conditions.
+    /// \details If there is no visibility conditions, field set is the same for every object,
+    ///          therefore field-related logic can be precomputed for the whole mapping.
+    [[nodiscard]] bool HasVisibilityConditions () const noexcept;
+
     /// \return Id of field, to which iterator points.
     /// \invariant Inside valid bounds, but not in the ending.
     [[nodiscard]] FieldId GetFieldId (const FieldIterator &_iterator) const noexcept;
@@ -160,6 +160,13 @@ ConditionalFieldIterator Mapping::EndConditional () const noexcept
     return ConditionalFieldIterator (array_cast (iterator));
 }
 
+bool Mapping::HasVisibilityConditions () const noexcept
+{
+    const auto &handle = block_cast<Handling::Handle<PlainMapping>> (data);
+    EMERGENCE_ASSERT (handle);
+    return handle->GetFirstCondition ();
+}
+
 FieldId Mapping::GetFieldId (const Mapping::FieldIterator &_iterator) const noexcept
 {
     return GetFieldId (*_iterator);
@@ -9,13 +9,25 @@
 
 namespace Emergence::Task
 {
+/// \brief Hints for executors that are able to choose order of ready tasks. Other executors ignore them.
+struct SchedulingHints final
+{
+    /// \brief Whether ready tasks with the longest path to the end of the task graph should be started first.
+    bool prioritizeCriticalPath = true;
+
+    /// \brief Whether task durations measured during previous executions should be used as weights
+    ///        for critical path calculation. If disabled, every task has the same weight.
+    /// \details Disabled by default, because measurement adds two timestamp queries to every task execution.
+    bool useMeasuredDurations = false;
+};
+
 /// \brief Executes tasks from source collection using implementation-specific mechanism.
 class TaskExecutorApi Executor final
 {
 public:
     /// \brief Constructs executor for given task collection.
     /// \invariant There is no circular dependencies in given task collection.
-    explicit Executor (const Collection &_collection) noexcept;
+    explicit Executor (const Collection &_collection, const SchedulingHints &_hints = {}) noexcept;
 
     /// Copying executors is counter-intuitive.
     Executor (const Executor &_other) = delete;
@@ -1,9 +1,11 @@
+#include <algorithm>
 #include <atomic>
 
 #include <API/Common/BlockCast.hpp>
 
 #include <Assert/Assert.hpp>
 
+#include <Container/Optional.hpp>
 #include <Container/Vector.hpp>
 
 #include <CPU/Profiler.hpp>
@@ -12,7 +14,7 @@
 
 #include <Task/Executor.hpp>
 
-#include <Threading/AtomicFlagGuard.hpp>
+#include <Time/Time.hpp>
 
 namespace Emergence::Task
 {
@@ -21,7 +23,7 @@ using namespace Memory::Literals;
 class ExecutorImplementation final
 {
 public:
-    explicit ExecutorImplementation (const Collection &_collection) noexcept;
+    ExecutorImplementation (const Collection &_collection, const SchedulingHints &_hints) noexcept;
 
     ExecutorImplementation (const ExecutorImplementation &_other) = delete;
 
@@ -36,6 +38,14 @@ public:
 private:
     struct Task final
     {
+        Task () noexcept = default;
+
+        /// \details Tasks are only moved while executor is being constructed, therefore
+        ///          it is safe to move atomic counter by loading and storing its value.
+        Task (Task &&_other) noexcept;
+
+        ~Task () noexcept = default;
+
         std::function<void ()> executor;
 
         Container::Vector<std::size_t> dependantTasksIndices {Memory::Profiler::AllocationGroup::Top ()};
@@ -43,37 +53,78 @@ private:
         std::size_t dependencyCount = 0u;
 
         /// \brief Count of unresolved dependencies for this task in current execution.
+        /// \details Decremented by finished dependencies without any locks: dependency
+        ///          that decrements it to zero is responsible for running this task.
         /// \invariant After executor initialization and after every execution of this task
         ///            ::dependenciesLeftThisRun should be equal to ::dependencyCount.
-        std::size_t dependenciesLeftThisRun = 0u;
+        std::atomic_size_t dependenciesLeftThisRun = 0u;
+
+        /// \brief Exponential moving average of task execution time.
+        /// \details Only written by the thread that executes the task, only read between executions.
+        std::uint64_t averageDurationNs = 0u;
+
+        /// \brief Weight of the heaviest path from this task (inclusively) to any task without dependants.
+        std::uint64_t criticalPathWeight = 0u;
+
+        EMERGENCE_DELETE_ASSIGNMENT (Task);
+    };
+
+    /// \brief Context for dispatching task as job.
+    /// \details Jobs are built from prepared contexts, so dispatching task never allocates or copies functors.
+    struct TaskJobContext final
+    {
+        ExecutorImplementation *executor = nullptr;
+        std::size_t taskIndex = 0u;
     };
 
+    static void TaskJob (void *_context) noexcept;
+
     void TaskFunction (std::size_t _taskIndex) noexcept;
 
+    [[nodiscard]] Job::Dispatcher::Job MakeTaskJob (std::size_t _taskIndex) noexcept;
+
+    /// \brief Recalculates critical path weights and reorders dependants and entry tasks,
+    ///        so tasks with the heaviest path to the end of the graph are started first.
+    /// \details Reorders existing vectors in place, therefore never allocates.
+    void Prioritize () noexcept;
+
+    /// \brief Interval (in executions) between critical path recalculations when measured durations are used.
+    static constexpr std::size_t PRIORITIZATION_INTERVAL = 64u;
+
     Container::Vector<Task> tasks;
 
+    /// \brief Task indices in topological order: every task is placed before all its dependants.
+    Container::Vector<std::size_t> topologicalOrder;
+
+    /// \brief Prepared job contexts for every task, indexed by task index.
+    Container::Vector<TaskJobContext> jobTable;
+
     /// \details We cache entry tasks to make ::taskQueue initialization in ::Execute faster.
     Container::Vector<std::size_t> entryTaskIndices;
 
-    /// \details Task modification is rare and chance that different threads are fighting for modification access
-    ///          is low. Most performant mutual exclusion technique is such cases is atomic_flag-based spinlock.
-    std::atomic_flag modifyingTasks;
-
     /// \brief Atomic flag for waiting until all tasks are executed.
     std::atomic_flag tasksExecuting;
 
     /// \brief Indicates how much unfinished tasks left during this execution.
     std::atomic_uintptr_t tasksLeftToExecute = 0u;
+
+    const SchedulingHints hints;
+
+    std::size_t executionsSincePrioritization = 0u;
 };
 
 using namespace Memory::Literals;
 
-ExecutorImplementation::ExecutorImplementation (const Collection &_collection) noexcept
+ExecutorImplementation::ExecutorImplementation (const Collection &_collection, const SchedulingHints &_hints) noexcept
     : tasks (Memory::Profiler::AllocationGroup::Top ()),
-      entryTaskIndices (Memory::Profiler::AllocationGroup::Top ())
+      topologicalOrder (Memory::Profiler::AllocationGroup::Top ()),
+      jobTable (Memory::Profiler::AllocationGroup::Top ()),
+      entryTaskIndices (Memory::Profiler::AllocationGroup::Top ()),
+      hints (_hints)
 {
     auto placeholder = tasks.get_allocator ().GetAllocationGroup ().PlaceOnTop ();
     tasks.resize (_collection.tasks.size ());
+    jobTable.resize (_collection.tasks.size ());
 
     for (std::size_t taskIndex = 0u; taskIndex < tasks.size (); ++taskIndex)
     {
@@ -82,6 +133,7 @@ ExecutorImplementation::ExecutorImplementation (const Collection &_collection) n
 
         task.executor = item.task;
         task.dependantTasksIndices = item.dependantTasksIndices;
+        jobTable[taskIndex] = {this, taskIndex};
 
         for (std::size_t dependantIndex : task.dependantTasksIndices)
         {
@@ -92,7 +144,7 @@ ExecutorImplementation::ExecutorImplementation (const Collection &_collection) n
     for (std::size_t taskIndex = 0u; taskIndex < tasks.size (); ++taskIndex)
     {
         Task &task = tasks[taskIndex];
-        task.dependenciesLeftThisRun = task.dependencyCount;
+        task.dependenciesLeftThisRun.store (task.dependencyCount, std::memory_order_relaxed);
 
         if (task.dependencyCount == 0u)
         {
@@ -101,6 +153,31 @@ ExecutorImplementation::ExecutorImplementation (const Collection &_collection) n
     }
 
     EMERGENCE_ASSERT (!entryTaskIndices.empty ());
+    topologicalOrder.reserve (tasks.size ());
+    topologicalOrder.insert (topologicalOrder.end (), entryTaskIndices.begin (), entryTaskIndices.end ());
+
+    // Counters are used as temporary storage for Kahn algorithm and are restored afterwards.
+    for (std::size_t orderIndex = 0u; orderIndex < topologicalOrder.size (); ++orderIndex)
+    {
+        for (std::size_t dependantIndex : tasks[topologicalOrder[orderIndex]].dependantTasksIndices)
+        {
+            if (tasks[dependantIndex].dependenciesLeftThisRun.fetch_sub (1u, std::memory_order_relaxed) == 1u)
+            {
+                topologicalOrder.emplace_back (dependantIndex);
+            }
+        }
+    }
+
+    EMERGENCE_ASSERT (topologicalOrder.size () == tasks.size ());
+    for (Task &task : tasks)
+    {
+        task.dependenciesLeftThisRun.store (task.dependencyCount, std::memory_order_relaxed);
+    }
+
+    if (hints.prioritizeCriticalPath)
+    {
+        Prioritize ();
+    }
 }
 
 void ExecutorImplementation::Execute () noexcept
@@ -121,66 +198,145 @@ void ExecutorImplementation::Execute () noexcept
         Job::Dispatcher::Batch batch {Job::Dispatcher::Global ()};
         for (std::size_t taskIndex : entryTaskIndices)
         {
-            batch.Dispatch (Job::Priority::FOREGROUND,
-                            [this, taskIndex] ()
-                            {
-                                TaskFunction (taskIndex);
-                            });
+            batch.Dispatch (Job::Priority::FOREGROUND, MakeTaskJob (taskIndex));
         }
     }
 
     tasksExecuting.wait (true, std::memory_order_acquire);
+    if (hints.prioritizeCriticalPath && hints.useMeasuredDurations &&
+        ++executionsSincePrioritization >= PRIORITIZATION_INTERVAL)
+    {
+        executionsSincePrioritization = 0u;
+        Prioritize ();
+    }
 }
 
-void ExecutorImplementation::TaskFunction (std::size_t _taskIndex) noexcept
+void ExecutorImplementation::TaskJob (void *_context) noexcept
 {
-    Task &task = tasks[_taskIndex];
-    EMERGENCE_ASSERT (task.dependenciesLeftThisRun == 0u);
-
-    {
-        static CPU::Profiler::SectionDefinition taskExecutionSection {*"TaskExecution"_us, 0xFF009900u};
-        CPU::Profiler::SectionInstance section {taskExecutionSection};
-        task.executor ();
-    }
+    const auto *context = static_cast<const TaskJobContext *> (_context);
+    context->executor->TaskFunction (context->taskIndex);
+}
 
+void ExecutorImplementation::TaskFunction (std::size_t _taskIndex) noexcept
+{
+    static CPU::Profiler::SectionDefinition taskExecutionSection {*"TaskExecution"_us, 0xFF009900u};
     static CPU::Profiler::SectionDefinition synchronizationSection {*"Synchronization"_us, 0xFF990000u};
-    CPU::Profiler::SectionInstance section {synchronizationSection};
-    task.dependenciesLeftThisRun = task.dependencyCount;
 
+    // First unlocked dependant is executed inline by the same thread to avoid unnecessary queue round trip.
+    // When critical path is prioritized, dependants are sorted by descending critical path weight, therefore
+    // the heaviest unlocked dependant continues on this thread and others are dispatched from heaviest to lightest.
+    const bool measureDuration = hints.prioritizeCriticalPath && hints.useMeasuredDurations;
+    std::size_t currentTaskIndex = _taskIndex;
+    bool hasTaskToExecute = true;
+
+    while (hasTaskToExecute)
     {
-        AtomicFlagGuard guard {modifyingTasks};
-        std::size_t dependenciesUnlocked = 0u;
+        Task &task = tasks[currentTaskIndex];
+        EMERGENCE_ASSERT (task.dependenciesLeftThisRun.load (std::memory_order_relaxed) == 0u);
 
-        for (std::size_t dependantIndex : task.dependantTasksIndices)
         {
-            if (--tasks[dependantIndex].dependenciesLeftThisRun == 0u)
+            CPU::Profiler::SectionInstance section {taskExecutionSection};
+            if (measureDuration)
+            {
+                const std::uint64_t startTime = Time::NanosecondsSinceStartup ();
+                task.executor ();
+                const std::uint64_t duration = Time::NanosecondsSinceStartup () - startTime;
+                task.averageDurationNs =
+                    task.averageDurationNs == 0u ? duration : (task.averageDurationNs * 7u + duration) / 8u;
+            }
+            else
             {
-                ++dependenciesUnlocked;
+                task.executor ();
             }
         }
 
-        if (dependenciesUnlocked > 0u)
+        CPU::Profiler::SectionInstance section {synchronizationSection};
+        // Nobody accesses this counter until all its dependencies are executed during next run.
+        task.dependenciesLeftThisRun.store (task.dependencyCount, std::memory_order_relaxed);
+
+        hasTaskToExecute = false;
+        Container::Optional<Job::Dispatcher::Batch> batch;
+
+        for (std::size_t dependantIndex : task.dependantTasksIndices)
         {
-            Job::Dispatcher::Batch batch {Job::Dispatcher::Global ()};
-            for (std::size_t dependantIndex : task.dependantTasksIndices)
+            // Release makes results of this task visible to the thread that will execute dependant.
+            // Acquire makes results of other dependencies visible if this thread executes dependant.
+            if (tasks[dependantIndex].dependenciesLeftThisRun.fetch_sub (1u, std::memory_order_acq_rel) == 1u)
             {
-                if (tasks[dependantIndex].dependenciesLeftThisRun == 0u)
+                if (!hasTaskToExecute)
+                {
+                    currentTaskIndex = dependantIndex;
+                    hasTaskToExecute = true;
+                    continue;
+                }
+
+                if (!batch)
                 {
-                    batch.Dispatch (Job::Priority::FOREGROUND,
-                                    [this, dependantIndex] ()
-                                    {
-                                        TaskFunction (dependantIndex);
-                                    });
+                    batch.emplace (Job::Dispatcher::Global ());
                 }
+
+                batch->Dispatch (Job::Priority::FOREGROUND, MakeTaskJob (dependantIndex));
             }
         }
+
+        // Task is finished only after its dependants were unlocked, therefore task counter can not reach
+        // zero while there are unlocked, but not yet dispatched tasks.
+        if (tasksLeftToExecute.fetch_sub (1u, std::memory_order_acq_rel) == 1u)
+        {
+            tasksExecuting.clear (std::memory_order_release);
+            tasksExecuting.notify_one ();
+        }
     }
+}
+
+ExecutorImplementation::Task::Task (Task &&_other) noexcept
+    : executor (std::move (_other.executor)),
+      dependantTasksIndices (std::move (_other.dependantTasksIndices)),
+      dependencyCount (_other.dependencyCount),
+      dependenciesLeftThisRun (_other.dependenciesLeftThisRun.load (std::memory_order_relaxed)),
+      averageDurationNs (_other.averageDurationNs),
+      criticalPathWeight (_other.criticalPathWeight)
+{
+}
+
+Job::Dispatcher::Job ExecutorImplementation::MakeTaskJob (std::size_t _taskIndex) noexcept
+{
+    return {&ExecutorImplementation::TaskJob, &jobTable[_taskIndex]};
+}
+
+void ExecutorImplementation::Prioritize () noexcept
+{
+    static CPU::Profiler::SectionDefinition prioritizeSection {*"TaskPrioritization"_us, 0xFF009900u};
+    CPU::Profiler::SectionInstance section {prioritizeSection};
 
-    if (--tasksLeftToExecute == 0u)
+    // Ties are resolved by task index to keep order deterministic without std::stable_sort,
+    // because std::stable_sort might allocate temporary buffer.
+    auto heavierPathFirst = [this] (std::size_t _first, std::size_t _second)
     {
-        tasksExecuting.clear (std::memory_order_release);
-        tasksExecuting.notify_one ();
+        const std::uint64_t firstWeight = tasks[_first].criticalPathWeight;
+        const std::uint64_t secondWeight = tasks[_second].criticalPathWeight;
+        return firstWeight > secondWeight || (firstWeight == secondWeight && _first < _second);
+    };
+
+    // Dependants are always placed after their dependencies, therefore reverse order visits dependants first.
+    for (auto iterator = topologicalOrder.rbegin (); iterator != topologicalOrder.rend (); ++iterator)
+    {
+        Task &task = tasks[*iterator];
+        std::uint64_t heaviestDependantPath = 0u;
+
+        for (std::size_t dependantIndex : task.dependantTasksIndices)
+        {
+            heaviestDependantPath = std::max (heaviestDependantPath, tasks[dependantIndex].criticalPathWeight);
+        }
+
+        // Without measurements every task has unit weight, so critical path is the longest chain of tasks.
+        const std::uint64_t weight =
+            hints.useMeasuredDurations ? std::max (task.averageDurationNs, std::uint64_t {1u}) : 1u;
+        task.criticalPathWeight = weight + heaviestDependantPath;
+        std::sort (task.dependantTasksIndices.begin (), task.dependantTasksIndices.end (), heavierPathFirst);
     }
+
+    std::sort (entryTaskIndices.begin (), entryTaskIndices.end (), heavierPathFirst);
 }
 
 struct InternalData final
@@ -189,12 +345,12 @@ struct InternalData final
     ExecutorImplementation *executor = nullptr;
 };
 
-Executor::Executor (const Collection &_collection) noexcept
+Executor::Executor (const Collection &_collection, const SchedulingHints &_hints) noexcept
 {
     auto &internal = *new (&data) InternalData ();
     auto placeholder = internal.heap.GetAllocationGroup ().PlaceOnTop ();
     internal.executor = new (internal.heap.Acquire (sizeof (ExecutorImplementation), alignof (ExecutorImplementation)))
-        ExecutorImplementation (_collection);
+        ExecutorImplementation (_collection, _hints);
 }
 
 Executor::Executor (Executor &&_other) noexcept
@@ -96,7 +96,7 @@ struct InternalData final
     ExecutorImplementation *executor = nullptr;
 };
 
-Executor::Executor (const Collection &_collection) noexcept
+Executor::Executor (const Collection &_collection, [[maybe_unused]] const SchedulingHints &_hints) noexcept
 {
     auto &internal = *new (&data) InternalData ();
     auto placeholder = internal.heap.GetAllocationGroup ().PlaceOnTop ();
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <VirtualFileSystemApi.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <span>
+
+#include <VirtualFileSystem/Entry.hpp>
+
+namespace Emergence::VirtualFileSystem
+{
+/// \brief Callback that is executed on virtual file system IO thread when asynchronous read is finished.
+/// \details Callback receives whether read was successful and the whole file content. Content is only valid during
+///          callback execution, therefore it must be copied or deserialized right away. Callbacks are executed one by
+///          one and block other reads, so heavy processing should be dispatched to job dispatcher instead.
+///          It is allowed to submit new reads from callbacks.
+using AsyncReadCallback = std::function<void (bool _successful, std::span<const std::uint8_t> _content)>;
+
+/// \brief Request to read the whole file asynchronously through Context::SubmitReads.
+struct VirtualFileSystemApi AsyncReadRequest final
+{
+    /// \brief File to be read.
+    Entry entry;
+
+    /// \brief Receives file content once it is read. Always called exactly once, even if read has failed.
+    AsyncReadCallback callback;
+};
+} // namespace Emergence::VirtualFileSystem
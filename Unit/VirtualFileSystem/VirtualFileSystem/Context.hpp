@@ -6,6 +6,7 @@
 
 #include <Container/String.hpp>
 
+#include <VirtualFileSystem/AsyncRead.hpp>
 #include <VirtualFileSystem/Entry.hpp>
 #include <VirtualFileSystem/MountConfiguration.hpp>
 
@@ -48,6 +49,15 @@ constexpr const char PATH_SEPARATOR = '/';
 /// for cases where we need to store large amount of data without spending time on saving it to hard drive.
 /// \endparblock
 ///
+/// \par Asynchronous reads
+/// \parblock
+/// Files can be read asynchronously through ::SubmitReads. Submitted reads are executed by IO thread that is owned by
+/// context and is started on the first submission. IO thread processes all reads that were submitted since its last
+/// iteration together: package entries are sorted by their offsets inside package and close entries are read using
+/// one drive read, so every package file is opened and traversed only once per iteration. It makes loading of lots of
+/// small resources, like objects and textures of a level, much faster than reading them one by one.
+/// \endparblock
+///
 /// \par Multiple virtual file systems
 /// \parblock
 /// You can safely create multiple virtual file systems under one process by creating multiple context instances.
@@ -107,10 +117,15 @@ public:
     /// \brief Attempts to mount given configuration as child of given entry that must be virtual directory.
     bool Mount (const Entry &_at, const MountConfiguration &_configuration) noexcept;
 
+    /// \brief Submits given requests to be read asynchronously by IO thread.
+    /// \details Thread safe like other constant methods, can also be called from read callbacks.
+    ///          All submitted reads are finished and their callbacks are executed before context destruction.
+    void SubmitReads (const std::span<const AsyncReadRequest> &_requests) const noexcept;
+
 private:
     friend class Entry;
     friend class PackageBuilder;
 
-    EMERGENCE_BIND_IMPLEMENTATION_INPLACE (sizeof (std::uint64_t) * 2u);
+    EMERGENCE_BIND_IMPLEMENTATION_INPLACE (sizeof (std::uint64_t) * 3u);
 };
 } // namespace Emergence::VirtualFileSystem
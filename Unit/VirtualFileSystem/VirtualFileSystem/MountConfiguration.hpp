@@ -16,7 +16,11 @@ enum class MountSource : uint8_t
     FILE_SYSTEM = 0u,
 
     /// \brief Source is read-only package that lies under given real file system path.
-    PACKAGE
+    PACKAGE,
+
+    /// \brief Same as PACKAGE, but package is mapped into memory once during mount, therefore
+    ///        package entries are read without file system calls and Reader::GetView is available for them.
+    MAPPED_PACKAGE
 };
 
 /// \brief Describes parameters for single mount operation.
@@ -4,6 +4,7 @@
 
 #include <cstdint>
 #include <iostream>
+#include <span>
 
 #include <API/Common/ImplementationBinding.hpp>
 #include <API/Common/Shortcuts.hpp>
@@ -30,6 +31,11 @@ public:
     /// \brief Standard input stream for reading file data.
     std::istream &InputStream () noexcept;
 
+    /// \return Direct view of the whole file data if file is mapped into memory or empty span otherwise.
+    /// \details Currently, only entries of packages mounted from MountSource::MAPPED_PACKAGE are mapped.
+    ///          View is valid as long as owner context is alive and does not depend on reader or stream state.
+    [[nodiscard]] std::span<const std::uint8_t> GetView () const noexcept;
+
     inline explicit operator bool () const noexcept
     {
         return IsValid ();
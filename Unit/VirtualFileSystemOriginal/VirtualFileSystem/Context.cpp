@@ -8,6 +8,8 @@
 
 namespace Emergence::VirtualFileSystem
 {
+using namespace Memory::Literals;
+
 Context::Context () noexcept
 {
     auto *holder = new (&data) Original::VirtualFileSystemHolder {};
@@ -15,6 +17,10 @@ Context::Context () noexcept
     holder->virtualFileSystem =
         new (holder->heap.Acquire (sizeof (Original::VirtualFileSystem), alignof (Original::VirtualFileSystem)))
             Original::VirtualFileSystem {};
+
+    holder->asyncReadQueue =
+        new (holder->heap.Acquire (sizeof (Original::AsyncReadQueue), alignof (Original::AsyncReadQueue)))
+            Original::AsyncReadQueue {holder->virtualFileSystem};
 }
 
 Context::Context (Context &&_context) noexcept
@@ -22,11 +28,19 @@ Context::Context (Context &&_context) noexcept
     new (&data)
         Original::VirtualFileSystemHolder {std::move (block_cast<Original::VirtualFileSystemHolder> (_context.data))};
     block_cast<Original::VirtualFileSystemHolder> (_context.data).virtualFileSystem = nullptr;
+    block_cast<Original::VirtualFileSystemHolder> (_context.data).asyncReadQueue = nullptr;
 }
 
 Context::~Context () noexcept
 {
     auto &holder = block_cast<Original::VirtualFileSystemHolder> (data);
+    // Queue must be destroyed first, because it finishes pending reads from the file system.
+    if (holder.asyncReadQueue)
+    {
+        holder.asyncReadQueue->~AsyncReadQueue ();
+        holder.heap.Release (holder.asyncReadQueue, sizeof (Original::AsyncReadQueue));
+    }
+
     if (holder.virtualFileSystem)
     {
         holder.virtualFileSystem->~VirtualFileSystem ();
@@ -122,4 +136,22 @@ bool Context::Mount (const Entry &_at, const MountConfiguration &_configuration)
     EMERGENCE_ASSERT (entryData.owner == holder.virtualFileSystem);
     return holder.virtualFileSystem->Mount (entryData.object, _configuration);
 }
+
+void Context::SubmitReads (const std::span<const AsyncReadRequest> &_requests) const noexcept
+{
+    const auto &holder = block_cast<Original::VirtualFileSystemHolder> (data);
+    EMERGENCE_ASSERT (holder.asyncReadQueue);
+
+    Container::Vector<Original::AsyncReadTask> tasks {Memory::Profiler::AllocationGroup {"AsyncReadQueue"_us}};
+    tasks.reserve (_requests.size ());
+
+    for (const AsyncReadRequest &request : _requests)
+    {
+        const auto &entryData = block_cast<Original::EntryImplementationData> (request.entry.data);
+        EMERGENCE_ASSERT (!entryData.owner || entryData.owner == holder.virtualFileSystem);
+        tasks.emplace_back (Original::AsyncReadTask {entryData.object, request.callback});
+    }
+
+    holder.asyncReadQueue->Submit (tasks);
+}
 } // namespace Emergence::VirtualFileSystem
@@ -0,0 +1,275 @@
+#include <algorithm>
+#include <cstring>
+
+#include <Assert/Assert.hpp>
+
+#include <CPU/Profiler.hpp>
+
+#include <Log/Log.hpp>
+
+#include <Threading/AtomicFlagGuard.hpp>
+
+#include <VirtualFileSystem/Original/AsyncReadQueue.hpp>
+
+namespace Emergence::VirtualFileSystem::Original
+{
+using namespace Memory::Literals;
+
+AsyncReadQueue::AsyncReadQueue (const VirtualFileSystem *_owner) noexcept
+    : owner (_owner),
+      pending (Memory::Profiler::AllocationGroup {"AsyncReadQueue"_us}),
+      packageReads (Memory::Profiler::AllocationGroup {"AsyncReadQueue"_us}),
+      buffer (Memory::Profiler::AllocationGroup {"AsyncReadQueue"_us})
+{
+    EMERGENCE_ASSERT (owner);
+}
+
+AsyncReadQueue::~AsyncReadQueue () noexcept
+{
+    terminating.test_and_set (std::memory_order_release);
+    pendingCounter.fetch_add (1u, std::memory_order_acq_rel);
+    pendingCounter.notify_all ();
+
+    if (thread.joinable ())
+    {
+        thread.join ();
+    }
+}
+
+void AsyncReadQueue::Submit (Container::Vector<AsyncReadTask> &_tasks) noexcept
+{
+    if (_tasks.empty ())
+    {
+        return;
+    }
+
+    {
+        AtomicFlagGuard guard {modifyingPending};
+        for (AsyncReadTask &task : _tasks)
+        {
+            pending.emplace_back (std::move (task));
+        }
+
+        pendingCounter.fetch_add (_tasks.size (), std::memory_order_acq_rel);
+    }
+
+    _tasks.clear ();
+    if (!threadStarted.test_and_set (std::memory_order_acq_rel))
+    {
+        // Thread is started lazily, because most of file system contexts, like ones in tools and tests,
+        // never use asynchronous reads and there is no need to keep idle thread for them.
+        thread = std::jthread {[this] ()
+                               {
+                                   ThreadMain ();
+                               }};
+    }
+
+    pendingCounter.notify_one ();
+}
+
+void AsyncReadQueue::ThreadMain () noexcept
+{
+    CPU::Profiler::SetThreadName ("VirtualFileSystemIO");
+    static CPU::Profiler::SectionDefinition processSection {*"AsyncReadBatch"_us, 0xFF559944u};
+    Container::Vector<AsyncReadTask> tasks {Memory::Profiler::AllocationGroup {"AsyncReadQueue"_us}};
+
+    while (true)
+    {
+        pendingCounter.wait (0u, std::memory_order_acquire);
+        {
+            AtomicFlagGuard guard {modifyingPending};
+            for (AsyncReadTask &task : pending)
+            {
+                tasks.emplace_back (std::move (task));
+            }
+
+            pending.clear ();
+            pendingCounter.store (0u, std::memory_order_release);
+        }
+
+        if (!tasks.empty ())
+        {
+            CPU::Profiler::SectionInstance section {processSection};
+            Process (tasks);
+            tasks.clear ();
+        }
+
+        if (terminating.test (std::memory_order_acquire))
+        {
+            // Callbacks might have submitted new reads, they must be finished before termination.
+            AtomicFlagGuard guard {modifyingPending};
+            if (pending.empty ())
+            {
+                return;
+            }
+        }
+    }
+}
+
+void AsyncReadQueue::Process (Container::Vector<AsyncReadTask> &_tasks) noexcept
+{
+    EMERGENCE_ASSERT (packageReads.empty ());
+    for (AsyncReadTask &task : _tasks)
+    {
+        PackageFileData packageFile;
+        if (owner->FindUnmappedPackageFile (task.object, packageFile))
+        {
+            packageReads.emplace_back (PackageRead {std::move (packageFile), &task.callback});
+        }
+        else
+        {
+            ProcessRegularRead (task);
+        }
+    }
+
+    ProcessPackageReads ();
+    packageReads.clear ();
+}
+
+void AsyncReadQueue::ProcessPackageReads () noexcept
+{
+    // Sorting reads by package and offset converts random access pattern into sequential one,
+    // which is much faster for both hard drives and solid state drives with read-ahead.
+    std::sort (packageReads.begin (), packageReads.end (),
+               [] (const PackageRead &_first, const PackageRead &_second)
+               {
+                   if (_first.file.path != _second.file.path)
+                   {
+                       return _first.file.path < _second.file.path;
+                   }
+
+                   return _first.file.offset < _second.file.offset;
+               });
+
+    FILE *packageFile = nullptr;
+    const Container::Utf8String *openedPath = nullptr;
+    std::size_t rangeBegin = 0u;
+
+    while (rangeBegin < packageReads.size ())
+    {
+        const PackageFileData &first = packageReads[rangeBegin].file;
+        if (!openedPath || *openedPath != first.path)
+        {
+            if (packageFile)
+            {
+                fclose (packageFile);
+            }
+
+            openedPath = &first.path;
+            packageFile = fopen (first.path.c_str (), "rb");
+
+            if (!packageFile)
+            {
+                EMERGENCE_LOG (ERROR, "VirtualFileSystem: Unable to open package \"", first.path,
+                               "\" for asynchronous read.");
+            }
+        }
+
+        // Merge neighbouring reads into one drive read while gaps between them are small.
+        const std::uint64_t readBegin = first.offset;
+        std::uint64_t readEnd = first.offset + first.size;
+        std::size_t rangeEnd = rangeBegin + 1u;
+
+        while (rangeEnd < packageReads.size ())
+        {
+            const PackageFileData &next = packageReads[rangeEnd].file;
+            const std::uint64_t nextEnd = std::max (readEnd, next.offset + next.size);
+
+            if (next.path != first.path || next.offset > readEnd + MAX_MERGE_GAP ||
+                nextEnd - readBegin > MAX_MERGED_READ_SIZE)
+            {
+                break;
+            }
+
+            readEnd = nextEnd;
+            ++rangeEnd;
+        }
+
+        const std::uint64_t readSize = readEnd - readBegin;
+        buffer.resize (readSize);
+        const bool successful = packageFile && fseek (packageFile, static_cast<long> (readBegin), SEEK_SET) == 0 &&
+                                fread (buffer.data (), 1u, readSize, packageFile) == readSize;
+
+        if (packageFile && !successful)
+        {
+            EMERGENCE_LOG (ERROR, "VirtualFileSystem: Failed to read ", readSize, " bytes at offset ", readBegin,
+                           " from package \"", first.path, "\".");
+        }
+
+        for (std::size_t index = rangeBegin; index < rangeEnd; ++index)
+        {
+            const PackageRead &read = packageReads[index];
+            if (successful)
+            {
+                (*read.callback) (true, {buffer.data () + (read.file.offset - readBegin), read.file.size});
+            }
+            else
+            {
+                (*read.callback) (false, {});
+            }
+        }
+
+        rangeBegin = rangeEnd;
+    }
+
+    if (packageFile)
+    {
+        fclose (packageFile);
+    }
+}
+
+void AsyncReadQueue::ProcessRegularRead (AsyncReadTask &_task) noexcept
+{
+    const FileReadContext context = owner->OpenFileForRead (_task.object);
+    switch (context.type)
+    {
+    case FileIOContextType::REAL_FILE:
+    {
+        if (!context.realFile.file)
+        {
+            _task.callback (false, {});
+            return;
+        }
+
+        buffer.resize (context.realFile.size);
+        const bool successful =
+            fread (buffer.data (), 1u, context.realFile.size, context.realFile.file) == context.realFile.size;
+        fclose (context.realFile.file);
+
+        if (successful)
+        {
+            _task.callback (true, {buffer.data (), context.realFile.size});
+        }
+        else
+        {
+            _task.callback (false, {});
+        }
+
+        return;
+    }
+
+    case FileIOContextType::VIRTUAL_FILE:
+    {
+        buffer.resize (context.virtualFile->size);
+        std::uint8_t *output = buffer.data ();
+
+        for (const VirtualFileChunk *chunk = context.virtualFile->firstChunk; chunk; chunk = chunk->next)
+        {
+            memcpy (output, chunk->data, chunk->used);
+            output += chunk->used;
+        }
+
+        EMERGENCE_ASSERT (output == buffer.data () + buffer.size ());
+        _task.callback (true, {buffer.data (), buffer.size ()});
+        return;
+    }
+
+    case FileIOContextType::MAPPED_FILE:
+        _task.callback (true, {context.mappedFile.data, context.mappedFile.size});
+        return;
+    }
+
+    EMERGENCE_ASSERT (false);
+    _task.callback (false, {});
+}
+} // namespace Emergence::VirtualFileSystem::Original
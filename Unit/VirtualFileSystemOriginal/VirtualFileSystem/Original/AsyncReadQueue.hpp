@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <thread>
+
+#include <Container/Vector.hpp>
+
+#include <VirtualFileSystem/AsyncRead.hpp>
+#include <VirtualFileSystem/Original/Core.hpp>
+
+namespace Emergence::VirtualFileSystem::Original
+{
+struct AsyncReadTask final
+{
+    Object object;
+    AsyncReadCallback callback;
+};
+
+/// \brief Executes asynchronous reads for one virtual file system on dedicated IO thread.
+class AsyncReadQueue final
+{
+public:
+    /// \brief Reads that are closer to each other than this gap are merged into one drive read.
+    static constexpr std::uint64_t MAX_MERGE_GAP = 16u * 1024u;
+
+    /// \brief Merged read is never extended over this size, so merging does not produce huge temporary buffers.
+    static constexpr std::uint64_t MAX_MERGED_READ_SIZE = 4u * 1024u * 1024u;
+
+    explicit AsyncReadQueue (const VirtualFileSystem *_owner) noexcept;
+
+    AsyncReadQueue (const AsyncReadQueue &_other) = delete;
+
+    AsyncReadQueue (AsyncReadQueue &&_other) = delete;
+
+    /// \brief Finishes all submitted reads and stops IO thread.
+    ~AsyncReadQueue () noexcept;
+
+    void Submit (Container::Vector<AsyncReadTask> &_tasks) noexcept;
+
+    EMERGENCE_DELETE_ASSIGNMENT (AsyncReadQueue);
+
+private:
+    /// \brief Read of package file, that is executed through package file handle shared by all reads of iteration.
+    struct PackageRead final
+    {
+        PackageFileData file;
+        AsyncReadCallback *callback = nullptr;
+    };
+
+    void ThreadMain () noexcept;
+
+    void Process (Container::Vector<AsyncReadTask> &_tasks) noexcept;
+
+    void ProcessPackageReads () noexcept;
+
+    void ProcessRegularRead (AsyncReadTask &_task) noexcept;
+
+    const VirtualFileSystem *owner;
+
+    std::atomic_flag modifyingPending;
+    std::atomic_flag terminating;
+    std::atomic_uintptr_t pendingCounter = 0u;
+    std::atomic_flag threadStarted;
+
+    Container::Vector<AsyncReadTask> pending;
+    std::jthread thread;
+
+    // Fields below are only accessed from IO thread.
+
+    Container::Vector<PackageRead> packageReads;
+    Container::Vector<std::uint8_t> buffer;
+};
+} // namespace Emergence::VirtualFileSystem::Original
@@ -379,7 +379,8 @@ VirtualFileSystem::VirtualFileSystem () noexcept
           entries.CreatePointRepresentation ({Entry::Reflect ().parentId, Entry::Reflect ().name})),
       fileSystemLinkEntries (entries.CreateSignalRepresentation (
           Entry::Reflect ().type, array_cast<EntryType, sizeof (std::uint64_t)> (EntryType::FILE_SYSTEM_LINK))),
-      virtualFileChunkHeap (Memory::Profiler::AllocationGroup {"VirtualFiles"_us})
+      virtualFileChunkHeap (Memory::Profiler::AllocationGroup {"VirtualFiles"_us}),
+      mappedPackages (Memory::Profiler::AllocationGroup {"MappedPackages"_us})
 {
     auto inserter = entries.AllocateAndInsert ();
     auto *root = static_cast<Entry *> (inserter.Allocate ());
@@ -1113,6 +1114,7 @@ bool VirtualFileSystem::Mount (const Object &_at, const MountConfiguration &_con
     }
 
     case MountSource::PACKAGE:
+    case MountSource::MAPPED_PACKAGE:
     {
         if (!std::filesystem::is_regular_file (_configuration.sourcePath))
         {
@@ -1138,6 +1140,23 @@ bool VirtualFileSystem::Mount (const Object &_at, const MountConfiguration &_con
         }
 
         const std::uint64_t headerSize = static_cast<std::uint64_t> (input.tellg ());
+        const std::uint8_t *mappedData = nullptr;
+
+        if (_configuration.source == MountSource::MAPPED_PACKAGE)
+        {
+            // If mapping is not possible, package is still mounted, but entries are read through file streams.
+            if (MappedFile mapping {_configuration.sourcePath}; mapping.IsValid ())
+            {
+                mappedData = mapping.GetData ();
+                mappedPackages.emplace_back (std::move (mapping));
+            }
+            else
+            {
+                EMERGENCE_LOG (WARNING, "VirtualFileSystem: Unable to map package \"", _configuration.sourcePath,
+                               "\", falling back to reading through file streams.");
+            }
+        }
+
         Object packageRootObject;
 
         {
@@ -1190,6 +1209,13 @@ bool VirtualFileSystem::Mount (const Object &_at, const MountConfiguration &_con
             entry->packageFile.path = _configuration.sourcePath;
             entry->packageFile.offset = headerSize + headerEntry.offset;
             entry->packageFile.size = headerEntry.size;
+
+            if (mappedData)
+            {
+                EMERGENCE_ASSERT (entry->packageFile.offset + entry->packageFile.size <=
+                                  mappedPackages.back ().GetSize ());
+                entry->packageFile.mappedData = mappedData + entry->packageFile.offset;
+            }
         }
 
         return !anyErrors;
@@ -1244,6 +1270,41 @@ Object VirtualFileSystem::GetWeakFileLinkTarget (EntryId _id) const noexcept
     return entry->weakFileLink;
 }
 
+bool VirtualFileSystem::FindUnmappedPackageFile (const Object &_object, PackageFileData &_output) const noexcept
+{
+    if (_object.type != ObjectType::ENTRY)
+    {
+        return false;
+    }
+
+    auto entryCursor = entriesById.ReadPoint (&_object.entryId);
+    const auto *entry = static_cast<const Entry *> (*entryCursor);
+    EMERGENCE_ASSERT (entry);
+
+    switch (entry->type)
+    {
+    case EntryType::VIRTUAL_DIRECTORY:
+    case EntryType::VIRTUAL_FILE:
+    case EntryType::FILE_SYSTEM_LINK:
+        return false;
+
+    case EntryType::PACKAGE_FILE:
+        if (entry->packageFile.mappedData)
+        {
+            return false;
+        }
+
+        _output = entry->packageFile;
+        return true;
+
+    case EntryType::WEAK_FILE_LINK:
+        return FindUnmappedPackageFile (entry->weakFileLink, _output);
+    }
+
+    EMERGENCE_ASSERT (false);
+    return false;
+}
+
 FileReadContext VirtualFileSystem::OpenFileForRead (const Object &_object) const noexcept
 {
     switch (_object.type)
@@ -1275,6 +1336,14 @@ FileReadContext VirtualFileSystem::OpenFileForRead (const Object &_object) const
 
         case EntryType::PACKAGE_FILE:
         {
+            if (entry->packageFile.mappedData)
+            {
+                FileReadContext context;
+                context.type = FileIOContextType::MAPPED_FILE;
+                context.mappedFile = {entry->packageFile.mappedData, entry->packageFile.size};
+                return context;
+            }
+
             FILE *packageFile = fopen (entry->packageFile.path.c_str (), "rb");
             fseek (packageFile, static_cast<long> (entry->packageFile.offset), SEEK_SET);
 
@@ -6,6 +6,7 @@
 #include <limits>
 
 #include <Container/String.hpp>
+#include <Container/Vector.hpp>
 
 #include <Memory/UniqueString.hpp>
 
@@ -13,6 +14,7 @@
 
 #include <VirtualFileSystem/Context.hpp>
 #include <VirtualFileSystem/MountConfiguration.hpp>
+#include <VirtualFileSystem/Original/MappedFile.hpp>
 
 namespace Emergence::VirtualFileSystem::Original
 {
@@ -122,6 +124,10 @@ struct PackageFileData final
     std::uint64_t offset = 0u;
     std::uint64_t size = 0u;
 
+    /// \brief Pointer to the beginning of file data if package is mapped into memory or `nullptr` otherwise.
+    /// \details Mapping is owned by VirtualFileSystem and lives as long as file system itself.
+    const std::uint8_t *mappedData = nullptr;
+
     struct Reflection final
     {
         StandardLayout::FieldId path;
@@ -175,7 +181,8 @@ struct Entry final
 enum class FileIOContextType
 {
     REAL_FILE,
-    VIRTUAL_FILE
+    VIRTUAL_FILE,
+    MAPPED_FILE
 };
 
 struct RealFileReadContext final
@@ -187,6 +194,15 @@ struct RealFileReadContext final
 
 static_assert (std::is_trivially_destructible_v<RealFileReadContext>);
 
+/// \details Has no default member initializers, because it is used as non-first member of anonymous union.
+struct MappedFileReadContext final
+{
+    const std::uint8_t *data;
+    std::uint64_t size;
+};
+
+static_assert (std::is_trivial_v<MappedFileReadContext>);
+
 struct FileReadContext final
 {
     FileIOContextType type = FileIOContextType::REAL_FILE;
@@ -194,6 +210,7 @@ struct FileReadContext final
     {
         RealFileReadContext realFile {};
         VirtualFileData *virtualFile;
+        MappedFileReadContext mappedFile;
     };
 };
 
@@ -277,6 +294,11 @@ public:
 
     [[nodiscard]] Object GetWeakFileLinkTarget (EntryId _id) const noexcept;
 
+    /// \brief Follows weak file links and checks whether object points to package file that is not mapped.
+    /// \details Used to read package files directly from already opened package instead of ::OpenFileForRead.
+    /// \return Whether package file data was found and copied to given output.
+    [[nodiscard]] bool FindUnmappedPackageFile (const Object &_object, PackageFileData &_output) const noexcept;
+
     [[nodiscard]] FileReadContext OpenFileForRead (const Object &_object) const noexcept;
 
     [[nodiscard]] FileWriteContext OpenFileForWrite (const Object &_object) const noexcept;
@@ -292,5 +314,10 @@ private:
 
     EntryId nextEntryId = ROOT_ID + 1u;
     Memory::Heap virtualFileChunkHeap;
+
+    /// \brief Mappings of packages, mounted from MountSource::MAPPED_PACKAGE.
+    /// \details Mappings are never released before file system destruction, because readers
+    ///          and views might still reference data of the entries that were already deleted.
+    Container::Vector<MappedFile> mappedPackages;
 };
 } // namespace Emergence::VirtualFileSystem::Original
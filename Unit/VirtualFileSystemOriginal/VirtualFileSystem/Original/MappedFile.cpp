@@ -0,0 +1,149 @@
+#include <filesystem>
+
+#if defined(_WIN32)
+#    define WIN32_LEAN_AND_MEAN
+#    define NOMINMAX
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#include <Log/Log.hpp>
+
+#include <VirtualFileSystem/Original/MappedFile.hpp>
+
+namespace Emergence::VirtualFileSystem::Original
+{
+MappedFile::MappedFile (const Container::Utf8String &_path) noexcept
+{
+#if defined(_WIN32)
+    const std::filesystem::path path {_path};
+    HANDLE file = CreateFileW (path.c_str (), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                               FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        EMERGENCE_LOG (ERROR, "VirtualFileSystem: Unable to open \"", _path, "\" for mapping.");
+        return;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx (file, &fileSize) || fileSize.QuadPart == 0)
+    {
+        EMERGENCE_LOG (ERROR, "VirtualFileSystem: Unable to map \"", _path, "\" as it is empty or inaccessible.");
+        CloseHandle (file);
+        return;
+    }
+
+    // Mapping object holds reference to the file, therefore file handle can be closed right away.
+    HANDLE mapping = CreateFileMappingW (file, nullptr, PAGE_READONLY, 0u, 0u, nullptr);
+    CloseHandle (file);
+
+    if (!mapping)
+    {
+        EMERGENCE_LOG (ERROR, "VirtualFileSystem: Unable to create file mapping for \"", _path, "\".");
+        return;
+    }
+
+    const void *view = MapViewOfFile (mapping, FILE_MAP_READ, 0u, 0u, 0u);
+    if (!view)
+    {
+        EMERGENCE_LOG (ERROR, "VirtualFileSystem: Unable to map view of \"", _path, "\".");
+        CloseHandle (mapping);
+        return;
+    }
+
+    mappingHandle = mapping;
+    data = static_cast<const std::uint8_t *> (view);
+    size = static_cast<std::uint64_t> (fileSize.QuadPart);
+#else
+    const int file = open (_path.c_str (), O_RDONLY);
+    if (file == -1)
+    {
+        EMERGENCE_LOG (ERROR, "VirtualFileSystem: Unable to open \"", _path, "\" for mapping.");
+        return;
+    }
+
+    struct stat fileStatus
+    {
+    };
+
+    if (fstat (file, &fileStatus) != 0 || fileStatus.st_size == 0)
+    {
+        EMERGENCE_LOG (ERROR, "VirtualFileSystem: Unable to map \"", _path, "\" as it is empty or inaccessible.");
+        close (file);
+        return;
+    }
+
+    // Mapping holds reference to the file, therefore descriptor can be closed right away.
+    void *view = mmap (nullptr, static_cast<std::size_t> (fileStatus.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+    close (file);
+
+    if (view == MAP_FAILED)
+    {
+        EMERGENCE_LOG (ERROR, "VirtualFileSystem: Unable to map \"", _path, "\".");
+        return;
+    }
+
+    data = static_cast<const std::uint8_t *> (view);
+    size = static_cast<std::uint64_t> (fileStatus.st_size);
+#endif
+}
+
+MappedFile::MappedFile (MappedFile &&_other) noexcept
+    : data (_other.data),
+      size (_other.size)
+#if defined(_WIN32)
+      ,
+      mappingHandle (_other.mappingHandle)
+#endif
+{
+    _other.data = nullptr;
+    _other.size = 0u;
+#if defined(_WIN32)
+    _other.mappingHandle = nullptr;
+#endif
+}
+
+MappedFile::~MappedFile () noexcept
+{
+    Unmap ();
+}
+
+bool MappedFile::IsValid () const noexcept
+{
+    return data;
+}
+
+const std::uint8_t *MappedFile::GetData () const noexcept
+{
+    return data;
+}
+
+std::uint64_t MappedFile::GetSize () const noexcept
+{
+    return size;
+}
+
+void MappedFile::Unmap () noexcept
+{
+    if (!data)
+    {
+        return;
+    }
+
+#if defined(_WIN32)
+    UnmapViewOfFile (data);
+    CloseHandle (mappingHandle);
+    mappingHandle = nullptr;
+#else
+    munmap (const_cast<std::uint8_t *> (data), static_cast<std::size_t> (size));
+#endif
+
+    data = nullptr;
+    size = 0u;
+}
+} // namespace Emergence::VirtualFileSystem::Original
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+
+#include <API/Common/Shortcuts.hpp>
+
+#include <Container/String.hpp>
+
+namespace Emergence::VirtualFileSystem::Original
+{
+/// \brief Read-only memory mapping of the whole real file.
+/// \details Used for mounted packages: package is mapped once during mount and then every package
+///          entry is read directly from mapped memory without opening and seeking the package file.
+class MappedFile final
+{
+public:
+    /// \brief Maps file under given real file system path. Check ::IsValid to find out whether mapping succeeded.
+    explicit MappedFile (const Container::Utf8String &_path) noexcept;
+
+    MappedFile (const MappedFile &_other) = delete;
+
+    MappedFile (MappedFile &&_other) noexcept;
+
+    ~MappedFile () noexcept;
+
+    [[nodiscard]] bool IsValid () const noexcept;
+
+    /// \return Beginning of mapped file content.
+    [[nodiscard]] const std::uint8_t *GetData () const noexcept;
+
+    [[nodiscard]] std::uint64_t GetSize () const noexcept;
+
+    EMERGENCE_DELETE_ASSIGNMENT (MappedFile);
+
+private:
+    void Unmap () noexcept;
+
+    const std::uint8_t *data = nullptr;
+    std::uint64_t size = 0u;
+
+#if defined(_WIN32)
+    void *mappingHandle = nullptr;
+#endif
+};
+} // namespace Emergence::VirtualFileSystem::Original
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <VirtualFileSystem/Original/AsyncReadQueue.hpp>
 #include <VirtualFileSystem/Original/Core.hpp>
 
 namespace Emergence::VirtualFileSystem::Original
@@ -7,6 +8,7 @@ namespace Emergence::VirtualFileSystem::Original
 struct VirtualFileSystemHolder final
 {
     VirtualFileSystem *virtualFileSystem = nullptr;
+    AsyncReadQueue *asyncReadQueue = nullptr;
     Memory::Heap heap {Memory::Profiler::AllocationGroup {Memory::UniqueString {"VirtualFileSystem"}}};
 };
 
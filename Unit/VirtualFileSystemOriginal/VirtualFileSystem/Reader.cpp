@@ -191,6 +191,79 @@ private:
     char buffer[BUFFER_SIZE];
 };
 
+/// \brief Exposes mapped memory as get area directly, therefore reads are plain copies without system calls.
+class MappedReadBuffer final : public std::streambuf
+{
+public:
+    MappedReadBuffer (const std::uint8_t *_data, std::uint64_t _size) noexcept
+        : data (_data),
+          size (_size)
+    {
+        // Stream buffer interface requires mutable pointers, but get area is never written through them.
+        char *begin = const_cast<char *> (reinterpret_cast<const char *> (data));
+        setg (begin, begin, begin + size);
+    }
+
+    MappedReadBuffer (const MappedReadBuffer &_other) = delete;
+
+    MappedReadBuffer (MappedReadBuffer &&_other) = delete;
+
+    ~MappedReadBuffer () noexcept override = default;
+
+    [[nodiscard]] bool IsOpen () const noexcept
+    {
+        return data;
+    }
+
+    [[nodiscard]] std::span<const std::uint8_t> GetView () const noexcept
+    {
+        return {data, static_cast<std::size_t> (size)};
+    }
+
+    EMERGENCE_DELETE_ASSIGNMENT (MappedReadBuffer);
+
+protected:
+    pos_type seekoff (off_type _offset, std::ios::seekdir _direction, std::ios::openmode _openMode) override
+    {
+        std::int64_t movedPosition = 0;
+        switch (_direction)
+        {
+        case std::ios::beg:
+            movedPosition = _offset;
+            break;
+
+        case std::ios::cur:
+            movedPosition = static_cast<std::int64_t> (gptr () - eback ()) + _offset;
+            break;
+
+        case std::ios::end:
+            movedPosition = static_cast<std::int64_t> (size) + _offset;
+            break;
+
+        // We need default because some implementations define additional "end" enum value.
+        default:
+            EMERGENCE_ASSERT (false);
+        }
+
+        return seekpos (static_cast<pos_type> (movedPosition), _openMode);
+    }
+
+    pos_type seekpos (pos_type _position, std::ios::openmode /*unused*/) override
+    {
+        if (_position < 0 || static_cast<std::int64_t> (_position) > static_cast<std::int64_t> (size))
+        {
+            return traits_type::eof ();
+        }
+
+        setg (eback (), eback () + static_cast<std::int64_t> (_position), egptr ());
+        return _position;
+    }
+
+private:
+    const std::uint8_t *data = nullptr;
+    std::uint64_t size = 0u;
+};
+
 struct ReaderImplementationData
 {
     ReaderImplementationData (FILE *_source, std::uint64_t _offset, std::uint64_t _size) noexcept
@@ -205,6 +278,12 @@ struct ReaderImplementationData
     {
     }
 
+    ReaderImplementationData (const std::uint8_t *_data, std::uint64_t _size) noexcept
+        : buffer (std::in_place_type<MappedReadBuffer>, _data, _size),
+          input (&std::get<MappedReadBuffer> (buffer))
+    {
+    }
+
     [[nodiscard]] bool IsOpen () const noexcept
     {
         return std::visit (
@@ -215,7 +294,7 @@ struct ReaderImplementationData
             buffer);
     }
 
-    Container::Variant<BoundedFileReadBuffer, Original::VirtualFileReadBuffer> buffer;
+    Container::Variant<BoundedFileReadBuffer, Original::VirtualFileReadBuffer, MappedReadBuffer> buffer;
     std::istream input;
 };
 
@@ -233,6 +312,10 @@ Reader::Reader (const Entry &_entry) noexcept
     case Original::FileIOContextType::VIRTUAL_FILE:
         new (&data) ReaderImplementationData {context.virtualFile};
         break;
+
+    case Original::FileIOContextType::MAPPED_FILE:
+        new (&data) ReaderImplementationData {context.mappedFile.data, context.mappedFile.size};
+        break;
     }
 }
 
@@ -251,4 +334,15 @@ std::istream &Reader::InputStream () noexcept
 {
     return block_cast<ReaderImplementationData> (data).input;
 }
+
+std::span<const std::uint8_t> Reader::GetView () const noexcept
+{
+    const auto &implementation = block_cast<ReaderImplementationData> (data);
+    if (const auto *mapped = std::get_if<MappedReadBuffer> (&implementation.buffer))
+    {
+        return mapped->GetView ();
+    }
+
+    return {};
+}
 } // namespace Emergence::VirtualFileSystem
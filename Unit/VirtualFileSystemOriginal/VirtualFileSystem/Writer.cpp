@@ -205,6 +205,12 @@ Writer::Writer (const Entry &_entry) noexcept
     case Original::FileIOContextType::VIRTUAL_FILE:
         new (&data) WriterImplementationData {context.virtualFile};
         break;
+
+    case Original::FileIOContextType::MAPPED_FILE:
+        // Mapped files are read-only and are never opened for write.
+        EMERGENCE_ASSERT (false);
+        new (&data) WriterImplementationData {static_cast<FILE *> (nullptr)};
+        break;
     }
 }
 
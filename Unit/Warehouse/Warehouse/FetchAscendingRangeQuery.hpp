@@ -7,6 +7,7 @@
 #include <API/Common/Shortcuts.hpp>
 
 #include <Warehouse/Parameter.hpp>
+#include <Warehouse/Partition.hpp>
 #include <Warehouse/PreparedQuery.hpp>
 
 namespace Emergence::Warehouse
@@ -28,13 +29,21 @@ public:
         /// Prepared query constructs cursors.
         friend class FetchAscendingRangeQuery;
 
-        EMERGENCE_BIND_IMPLEMENTATION_INPLACE (sizeof (std::uintptr_t) * 3u);
+        EMERGENCE_BIND_IMPLEMENTATION_INPLACE (sizeof (std::uintptr_t) * 5u);
 
         explicit Cursor (std::array<std::uint8_t, DATA_MAX_SIZE> &_data) noexcept;
     };
 
     EMERGENCE_READONLY_PREPARED_QUERY_OPERATIONS (FetchAscendingRangeQuery, Cursor, Bound _min, Bound _max);
 
+    /// \brief Executes query and splits its result into chunks, that can be processed by different threads.
+    /// \details Invariants of ::Execute are applied until returned partition is destroyed.
+    /// \see Partition
+    [[nodiscard]] Partition<Cursor> ExecutePartitioned (std::size_t _maxChunkCount,
+                                                        std::size_t _minimumChunkSize,
+                                                        Bound _min,
+                                                        Bound _max) noexcept;
+
     [[nodiscard]] StandardLayout::Field GetKeyField () const noexcept;
 
 private:
@@ -5,6 +5,7 @@
 #include <API/Common/ImplementationBinding.hpp>
 #include <API/Common/Shortcuts.hpp>
 
+#include <Warehouse/Partition.hpp>
 #include <Warehouse/PreparedQuery.hpp>
 
 namespace Emergence::Warehouse
@@ -30,6 +31,12 @@ public:
 
     EMERGENCE_READONLY_PREPARED_QUERY_OPERATIONS (FetchSequenceQuery, Cursor);
 
+    /// \brief Executes query and splits its result into chunks, that can be processed by different threads.
+    /// \details Invariants of ::Execute are applied until returned partition is destroyed.
+    /// \see Partition
+    [[nodiscard]] Partition<Cursor> ExecutePartitioned (std::size_t _maxChunkCount,
+                                                        std::size_t _minimumChunkSize) noexcept;
+
 private:
     /// Registry constructs prepared queries.
     friend class Registry;
@@ -8,6 +8,7 @@
 
 #include <Warehouse/Dimension.hpp>
 #include <Warehouse/Parameter.hpp>
+#include <Warehouse/Partition.hpp>
 #include <Warehouse/PreparedQuery.hpp>
 
 namespace Emergence::Warehouse
@@ -30,13 +31,20 @@ public:
 
         /// Cursor implementation could copy Shape inside to be more cache coherent and Shape could contain doubles,
         /// which are 8-byte long on all architectures. Therefore we use std::uint64_t as base size type.
-        EMERGENCE_BIND_IMPLEMENTATION_INPLACE (sizeof (std::uint64_t) * 46u);
+        EMERGENCE_BIND_IMPLEMENTATION_INPLACE (sizeof (std::uint64_t) * 47u);
 
         explicit Cursor (std::array<std::uint8_t, DATA_MAX_SIZE> &_data) noexcept;
     };
 
     EMERGENCE_READONLY_PREPARED_QUERY_OPERATIONS (FetchShapeIntersectionQuery, Cursor, Shape _shape);
 
+    /// \brief Executes query and splits its result into chunks, that can be processed by different threads.
+    /// \details Invariants of ::Execute are applied until returned partition is destroyed.
+    /// \see Partition
+    [[nodiscard]] Partition<Cursor> ExecutePartitioned (std::size_t _maxChunkCount,
+                                                        std::size_t _minimumChunkSize,
+                                                        Shape _shape) noexcept;
+
     [[nodiscard]] DimensionIterator DimensionBegin () const noexcept;
 
     [[nodiscard]] DimensionIterator DimensionEnd () const noexcept;
@@ -43,6 +43,13 @@ public:
 
     EMERGENCE_EDITABLE_PREPARED_QUERY_OPERATIONS (InsertLongTermQuery, Cursor);
 
+    /// \brief Same as ::Execute, but objects are inserted into indices all at once, when cursor is destroyed.
+    /// \details Designed for big batches of objects, for example for level loading: indices are rebuilt only once
+    ///          instead of being updated after every object. Inserted objects are invisible to other queries until
+    ///          cursor is destroyed, but there could be no other cursors for this type anyway.
+    /// \invariant There is no other cursors for ::GetTypeMapping type in registry.
+    Cursor ExecuteBulk () noexcept;
+
 private:
     /// Registry constructs prepared queries.
     friend class Registry;
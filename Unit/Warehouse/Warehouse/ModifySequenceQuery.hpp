@@ -5,6 +5,7 @@
 #include <API/Common/ImplementationBinding.hpp>
 #include <API/Common/Shortcuts.hpp>
 
+#include <Warehouse/Partition.hpp>
 #include <Warehouse/PreparedQuery.hpp>
 
 namespace Emergence::Warehouse
@@ -30,6 +31,12 @@ public:
 
     EMERGENCE_EDITABLE_PREPARED_QUERY_OPERATIONS (ModifySequenceQuery, Cursor);
 
+    /// \brief Executes query and splits its result into chunks, that can be edited by different threads.
+    /// \details Invariants of ::Execute are applied until returned partition is destroyed.
+    ///          Short term objects are not indexed, therefore disjoint chunks can be safely edited in parallel.
+    /// \see Partition
+    Partition<Cursor> ExecutePartitioned (std::size_t _maxChunkCount, std::size_t _minimumChunkSize) noexcept;
+
 private:
     /// Registry constructs prepared queries.
     friend class Registry;
@@ -30,7 +30,7 @@ public:
 
         /// Cursor implementation could copy Shape inside to be more cache coherent and Shape could contain doubles,
         /// which are 8-byte long on all architectures. Therefore we use std::uint64_t as base size type.
-        EMERGENCE_BIND_IMPLEMENTATION_INPLACE (sizeof (std::uint64_t) * 46u);
+        EMERGENCE_BIND_IMPLEMENTATION_INPLACE (sizeof (std::uint64_t) * 47u);
 
         explicit Cursor (std::array<std::uint8_t, DATA_MAX_SIZE> &_data) noexcept;
     };
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+#include <API/Common/Shortcuts.hpp>
+
+#include <Assert/Assert.hpp>
+
+#include <Container/Vector.hpp>
+
+namespace Emergence::Warehouse
+{
+/// \brief Result of query execution, split into chunks that can be processed in parallel by different threads.
+/// \details Partition gathers all objects from given cursor during construction and keeps this cursor alive until
+///          partition is destroyed. Therefore access rules, that are checked by cursors, are applied to the whole
+///          fan-out: partition must outlive all jobs that process its chunks.
+///
+///          Chunks never intersect, therefore partitions of modify queries allow to edit objects from different
+///          threads as long as edition of one object does not touch any other object of the same type.
+///          Objects must not be deleted through partition, because cursor has already passed them.
+template <typename Cursor>
+class Partition final
+{
+public:
+    /// \brief Object pointer type, returned by cursor: `const void *` for fetch and `void *` for modify cursors.
+    using ObjectPointer = std::remove_cvref_t<decltype (*std::declval<Cursor &> ())>;
+
+    /// \brief Continuous range of objects, that is meant to be processed by one thread.
+    class Chunk final
+    {
+    public:
+        [[nodiscard]] const ObjectPointer *begin () const noexcept;
+
+        [[nodiscard]] const ObjectPointer *end () const noexcept;
+
+        [[nodiscard]] std::size_t GetSize () const noexcept;
+
+    private:
+        /// Partition constructs chunks.
+        friend class Partition;
+
+        Chunk (const ObjectPointer *_begin, const ObjectPointer *_end) noexcept;
+
+        const ObjectPointer *first;
+        const ObjectPointer *last;
+    };
+
+    /// \brief Gathers all objects from given cursor and splits them into not more than `_maxChunkCount` chunks.
+    /// \details Only last chunk could be smaller than `_minimumChunkSize`, because processing tiny chunks
+    ///          in different threads costs more than it saves.
+    Partition (Cursor _cursor, std::size_t _maxChunkCount, std::size_t _minimumChunkSize) noexcept;
+
+    /// Partition can not be copied, because edit cursors can not be copied.
+    Partition (const Partition &_other) = delete;
+
+    Partition (Partition &&_other) noexcept = default;
+
+    ~Partition () noexcept = default;
+
+    /// \return Count of objects in all chunks.
+    [[nodiscard]] std::size_t GetObjectCount () const noexcept;
+
+    [[nodiscard]] std::size_t GetChunkCount () const noexcept;
+
+    /// \invariant _index < GetChunkCount ()
+    [[nodiscard]] Chunk GetChunk (std::size_t _index) const noexcept;
+
+    EMERGENCE_DELETE_ASSIGNMENT (Partition);
+
+private:
+    Cursor cursor;
+    Container::Vector<ObjectPointer> objects;
+    std::size_t chunkSize = 0u;
+    std::size_t chunkCount = 0u;
+};
+
+template <typename Cursor>
+const typename Partition<Cursor>::ObjectPointer *Partition<Cursor>::Chunk::begin () const noexcept
+{
+    return first;
+}
+
+template <typename Cursor>
+const typename Partition<Cursor>::ObjectPointer *Partition<Cursor>::Chunk::end () const noexcept
+{
+    return last;
+}
+
+template <typename Cursor>
+std::size_t Partition<Cursor>::Chunk::GetSize () const noexcept
+{
+    return static_cast<std::size_t> (last - first);
+}
+
+template <typename Cursor>
+Partition<Cursor>::Chunk::Chunk (const ObjectPointer *_begin, const ObjectPointer *_end) noexcept
+    : first (_begin),
+      last (_end)
+{
+}
+
+template <typename Cursor>
+Partition<Cursor>::Partition (Cursor _cursor, std::size_t _maxChunkCount, std::size_t _minimumChunkSize) noexcept
+    : cursor (std::move (_cursor)),
+      objects (Memory::Profiler::AllocationGroup {Memory::UniqueString {"QueryPartition"}})
+{
+    while (ObjectPointer object = *cursor)
+    {
+        objects.emplace_back (object);
+        ++cursor;
+    }
+
+    if (!objects.empty ())
+    {
+        const std::size_t maxChunkCount = std::max<std::size_t> (1u, _maxChunkCount);
+        chunkSize = std::max<std::size_t> ((objects.size () + maxChunkCount - 1u) / maxChunkCount, _minimumChunkSize);
+        chunkCount = (objects.size () + chunkSize - 1u) / chunkSize;
+    }
+}
+
+template <typename Cursor>
+std::size_t Partition<Cursor>::GetObjectCount () const noexcept
+{
+    return objects.size ();
+}
+
+template <typename Cursor>
+std::size_t Partition<Cursor>::GetChunkCount () const noexcept
+{
+    return chunkCount;
+}
+
+template <typename Cursor>
+typename Partition<Cursor>::Chunk Partition<Cursor>::GetChunk (std::size_t _index) const noexcept
+{
+    EMERGENCE_ASSERT (_index < chunkCount);
+    const ObjectPointer *begin = objects.data () + _index * chunkSize;
+    return {begin, objects.data () + std::min (objects.size (), (_index + 1u) * chunkSize)};
+}
+} // namespace Emergence::Warehouse
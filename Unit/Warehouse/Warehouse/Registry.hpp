@@ -192,6 +192,13 @@ public:
     ///        deallocated when there is no queries that access them.
     void SetGarbageCollectionEnabled (const StandardLayout::Mapping &_typeMapping, bool _enabled) noexcept;
 
+    /// \brief Sets whether short term objects of given type should be allocated from linear arena.
+    /// \details Arena allocates objects in constant time and reclaims memory of all objects at once, when the last
+    ///          object is deleted. Deleting only some of the objects does not free any memory, therefore arena is
+    ///          only suitable for types, all objects of which are regularly deleted together, like events.
+    ///          Implementations are allowed to ignore this hint.
+    void SetShortTermArenaEnabled (const StandardLayout::Mapping &_typeMapping, bool _enabled) noexcept;
+
     /// \return Name of this registry, that can be used for debug or visualization purposes.
     [[nodiscard]] Memory::UniqueString GetName () const noexcept;
 
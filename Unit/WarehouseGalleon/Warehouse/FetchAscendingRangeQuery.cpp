@@ -24,6 +24,14 @@ Cursor FetchAscendingRangeQuery::Execute (Bound _min, Bound _max) noexcept
     return Cursor (array_cast (cursor));
 }
 
+Partition<Cursor> FetchAscendingRangeQuery::ExecutePartitioned (std::size_t _maxChunkCount,
+                                                                std::size_t _minimumChunkSize,
+                                                                Bound _min,
+                                                                Bound _max) noexcept
+{
+    return {Execute (_min, _max), _maxChunkCount, _minimumChunkSize};
+}
+
 StandardLayout::Field FetchAscendingRangeQuery::GetKeyField () const noexcept
 {
     return block_cast<QueryImplementation> (data).GetKeyField ();
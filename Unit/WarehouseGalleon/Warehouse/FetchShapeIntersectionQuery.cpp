@@ -24,6 +24,13 @@ Cursor FetchShapeIntersectionQuery::Execute (Shape _shape) noexcept
     return Cursor (array_cast (cursor));
 }
 
+Partition<Cursor> FetchShapeIntersectionQuery::ExecutePartitioned (std::size_t _maxChunkCount,
+                                                                   std::size_t _minimumChunkSize,
+                                                                   Shape _shape) noexcept
+{
+    return {Execute (_shape), _maxChunkCount, _minimumChunkSize};
+}
+
 DimensionIterator FetchShapeIntersectionQuery::DimensionBegin () const noexcept
 {
     auto iterator = block_cast<QueryImplementation> (data).DimensionBegin ();
@@ -38,4 +38,10 @@ InsertLongTermQuery::Cursor InsertLongTermQuery::Execute () noexcept
     CursorImplementation cursor = block_cast<QueryImplementation> (data).Execute ();
     return Cursor (array_cast (cursor));
 }
+
+InsertLongTermQuery::Cursor InsertLongTermQuery::ExecuteBulk () noexcept
+{
+    CursorImplementation cursor = block_cast<QueryImplementation> (data).ExecuteBulk ();
+    return Cursor (array_cast (cursor));
+}
 } // namespace Emergence::Warehouse
@@ -23,4 +23,10 @@ Cursor ModifySequenceQuery::Execute () noexcept
     CursorImplementation cursor = block_cast<QueryImplementation> (data).Execute ();
     return Cursor (array_cast (cursor));
 }
+
+Partition<Cursor> ModifySequenceQuery::ExecutePartitioned (std::size_t _maxChunkCount,
+                                                           std::size_t _minimumChunkSize) noexcept
+{
+    return {Execute (), _maxChunkCount, _minimumChunkSize};
+}
 } // namespace Emergence::Warehouse
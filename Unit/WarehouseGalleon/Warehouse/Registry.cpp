@@ -271,6 +271,13 @@ void Registry::SetGarbageCollectionEnabled (const StandardLayout::Mapping &_type
     internal.deck->SetGarbageCollectionEnabled (_typeMapping, _enabled);
 }
 
+void Registry::SetShortTermArenaEnabled (const StandardLayout::Mapping &_typeMapping, bool _enabled) noexcept
+{
+    const auto &internal = block_cast<RegistryData> (data);
+    EMERGENCE_ASSERT (internal.deck);
+    internal.deck->SetShortTermArenaEnabled (_typeMapping, _enabled);
+}
+
 Memory::UniqueString Registry::GetName () const noexcept
 {
     const auto &internal = block_cast<RegistryData> (data);